@@ -758,6 +758,483 @@
  */
 #define MM_FILL_MEM16_ALIGN_WARN_INF_EID 64
 
+/**
+ * \brief MM Child Task Initialization Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the child task semaphore or the
+ *  child task itself can't be created during application initialization.
+ *  Load, dump and fill commands are then processed by the main task.
+ */
+#define MM_CHILD_INIT_ERR_EID 65
+
+/**
+ * \brief MM Child Task Busy Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a load from file, dump to file or
+ *  fill command is received while the child task is still processing
+ *  a previous one. The new command is rejected.
+ */
+#define MM_CHILD_BUSY_ERR_EID 66
+
+/**
+ * \brief MM Child Task Queue Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a command can't be handed to the
+ *  child task, either because the command does not fit in the child
+ *  task command buffer, the command code is not one the child task
+ *  processes, or the child task semaphore can't be given.
+ */
+#define MM_CHILD_QUEUE_ERR_EID 67
+
+/**
+ * \brief MM Child Task Terminated Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the child task fails to take its
+ *  wakeup semaphore and exits. Subsequent load, dump and fill commands
+ *  are processed by the main task.
+ */
+#define MM_CHILD_TERM_ERR_EID 68
+
+/**
+ * \brief MM Wakeup Subscription Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a call to #CFE_SB_Subscribe returns
+ *  something other than CFE_SUCCESS when called for MM_WAKEUP_MID.
+ */
+#define MM_WAKEUP_SUB_ERR_EID 69
+
+/**
+ * \brief MM Configuration Table Register Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a call to #CFE_TBL_Register returns
+ *  something other than CFE_SUCCESS for the configuration table during
+ *  application initialization.
+ */
+#define MM_CONFIG_TBL_REG_ERR_EID 70
+
+/**
+ * \brief MM Configuration Table Load Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the configuration table file can't
+ *  be loaded during application initialization. MM uses the compile
+ *  time configuration until a table load is commanded.
+ */
+#define MM_CONFIG_TBL_LOAD_ERR_EID 71
+
+/**
+ * \brief MM Configuration Table Validation Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a configuration table value exceeds
+ *  its compile time upper bound, or a segment size is smaller than 4
+ *  bytes or not a multiple of 4. The table load is rejected.
+ */
+#define MM_CONFIG_TBL_VAL_ERR_EID 72
+
+/**
+ * \brief MM Configuration Table Validated Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a configuration table passes
+ *  validation.
+ */
+#define MM_CONFIG_TBL_VAL_INF_EID 73
+
+/**
+ * \brief MM Load Staging Pool Create Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the load staging memory pool can't
+ *  be created during application initialization. Load files are then
+ *  always read twice, once to verify the CRC and once to load them.
+ */
+#define MM_STAGING_POOL_ERR_EID 74
+
+/**
+ * \brief MM Deferred Command Rejected Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a command arrives while a load, dump
+ *  or fill is running on the main task and it can't be held until the
+ *  operation completes, either because #MM_DEFERRED_CMD_DEPTH commands
+ *  are already held or because the command is larger than any MM command.
+ */
+#define MM_DEFER_CMD_ERR_EID 75
+
+/**
+ * \brief MM File Encoding Not Supported Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a dump command or a load file
+ *  specifies a data encoding that is unknown or that is not supported
+ *  for the memory type.
+ */
+#define MM_FILE_ENCODING_ERR_EID 76
+
+/**
+ * \brief MM Load File Decode Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the data of an encoded load file
+ *  ends early, has data left over, or doesn't decode to the number of
+ *  bytes in the file header.
+ */
+#define MM_LOAD_DECODE_ERR_EID 77
+
+/**
+ * \brief MM Dump Memory To Delta File Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a memory dump to delta file command
+ *  has executed successfully, and reports how many blocks changed.
+ */
+#define MM_DMP_DELTA_FILE_INF_EID 78
+
+/**
+ * \brief MM Delta Dump Baseline Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the baseline file of a memory dump
+ *  to delta file command is encoded, doesn't match the commanded memory
+ *  type or number of bytes, or its data doesn't match its CRC.
+ */
+#define MM_DELTA_BASELINE_ERR_EID 79
+
+/**
+ * \brief MM Load Memory From Patch File Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a memory load from patch file
+ *  command has executed successfully.
+ */
+#define MM_LD_PATCH_FILE_INF_EID 80
+
+/**
+ * \brief MM Patch File Record Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a patch file record is out of
+ *  order, overlaps the one before it, is outside the patched range or
+ *  is cut short, or the file doesn't hold the number of records in its
+ *  patch header.
+ */
+#define MM_PATCH_FILE_ERR_EID 81
+
+/**
+ * \brief MM Patch Pre-image CRC Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the memory a patch file replaces
+ *  doesn't match the pre-image CRC in its patch header, so the patch
+ *  was made for different memory contents.
+ */
+#define MM_PATCH_PREIMAGE_ERR_EID 82
+
+/**
+ * \brief MM Load Memory From Multi-Region File Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a memory load from multi-region
+ *  file command has executed successfully.
+ */
+#define MM_LD_MULTI_FILE_INF_EID 83
+
+/**
+ * \brief MM Multi-Region File Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the region table of a multi-region
+ *  file or region file is empty or too large, its region sizes don't
+ *  add up to the file header size, or a region isn't a raw copy of
+ *  memory.
+ */
+#define MM_MULTI_FILE_ERR_EID 84
+
+/**
+ * \brief MM Dump Memory To Multi-Region File Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a dump memory to multi-region file
+ *  command has executed successfully.
+ */
+#define MM_DMP_MULTI_FILE_INF_EID 85
+
+/**
+ * \brief MM Copy Memory Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a copy memory command has executed
+ *  successfully. It reports the CRC of the copied data.
+ */
+#define MM_COPY_INF_EID 86
+
+/**
+ * \brief MM CRC Memory Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a CRC memory command has executed
+ *  successfully. It reports the CRC of the memory range.
+ */
+#define MM_CRC_MEM_INF_EID 87
+
+/**
+ * \brief MM Load Cache CDS Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the critical data store block for
+ *  the load file validation cache can't be registered during application
+ *  initialization. The cache then only lasts until the next reset.
+ */
+#define MM_LOAD_CACHE_CDS_ERR_EID 88
+
+/**
+ * \brief MM Load Cache Hit Event ID
+ *
+ *  \par Type: DEBUG
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a load from file command finds the
+ *  load file unchanged since it was last verified, and the CRC pass over
+ *  the file is skipped.
+ */
+#define MM_LOAD_CACHE_HIT_DBG_EID 89
+
+/**
+ * \brief MM Symbol Cache Initialization Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the symbol cache mutex can't be
+ *  created during application initialization. Every symbol is then
+ *  looked up in the OSAL symbol table.
+ */
+#define MM_SYM_CACHE_INIT_ERR_EID 90
+
+/**
+ * \brief MM Symbol Cache Flush Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a flush symbol cache command has
+ *  executed successfully.
+ */
+#define MM_SYM_CACHE_FLUSH_INF_EID 91
+
+/**
+ * \brief MM Reverse Symbol Index Built Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the reverse symbol index has been
+ *  rebuilt from a symbol table dump file.
+ */
+#define MM_SYM_INDEX_INF_EID 92
+
+/**
+ * \brief MM Reverse Symbol Index Build Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a symbol table dump file can't be
+ *  opened or read back into the reverse symbol index. The index is left
+ *  empty.
+ */
+#define MM_SYM_INDEX_ERR_EID 93
+
+/**
+ * \brief MM Reverse Symbol Index Full Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a symbol table dump has more symbols
+ *  than fit in the reverse symbol index, see #MM_SYM_INDEX_ENTRIES and
+ *  #MM_SYM_INDEX_NAME_POOL_SIZE. The symbols that fit are still indexed.
+ */
+#define MM_SYM_INDEX_FULL_INF_EID 94
+
+/**
+ * \brief MM Lookup Address Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a lookup address command has
+ *  resolved an address to a symbol name plus offset.
+ */
+#define MM_ADDR_LOOKUP_INF_EID 95
+
+/**
+ * \brief MM Lookup Address Command Failed Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a lookup address command can't
+ *  resolve the address because the reverse symbol index is empty, or
+ *  no indexed symbol is within #MM_SYM_INDEX_MAX_OFFSET bytes below it.
+ */
+#define MM_ADDR_LOOKUP_ERR_EID 96
+
+/**
+ * \brief MM Lookup Symbol File Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a lookup symbol file command has
+ *  written its result file. Symbols that can't be resolved are marked in
+ *  the result file and don't fail the command.
+ */
+#define MM_SYM_LOOKUP_FILE_INF_EID 97
+
+/**
+ * \brief MM Lookup Symbol File Count Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the symbol count in the header of a
+ *  symbol lookup request file is zero or greater than
+ *  #MM_MAX_SYM_LOOKUP_RECORDS.
+ */
+#define MM_SYM_LOOKUP_FILE_COUNT_ERR_EID 98
+
+/**
+ * \brief MM Refresh Memory Range Map Command Event ID
+ *
+ *  \par Type: INFORMATIONAL
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a refresh memory range map command
+ *  has copied the RAM and EEPROM ranges of the PSP memory table again.
+ */
+#define MM_MEM_RANGE_INF_EID 99
+
+/**
+ * \brief MM Memory Range Map Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when the valid memory range map can't be
+ *  built, because a PSP memory table range can't be read or there are
+ *  more ranges of a memory type than #MM_MEM_RANGE_MAP_ENTRIES, or its
+ *  mutex can't be created. Addresses are then checked against the PSP
+ *  memory table on every command.
+ */
+#define MM_MEM_RANGE_ERR_EID 100
+
+/**
+ * \brief MM Memory Type Registration Error Event ID
+ *
+ *  \par Type: ERROR
+ *
+ *  \par Cause:
+ *
+ *  This event message is issued when a mission memory type can't be
+ *  registered, because its number is a built-in memory type, is already
+ *  registered or is not less than #MM_MAX_MEM_TYPES, or its driver is
+ *  missing a routine, its limits or its name, or has an access width
+ *  other than 0, 1, 2 or 4 bytes.
+ */
+#define MM_MEMTYPE_REG_ERR_EID 101
+
 /**\}*/
 
 #endif
@@ -132,6 +132,35 @@ typedef struct
     char         FileName[OS_MAX_PATH_LEN]; /**< \brief Name of memory dump file */
 } MM_DumpMemToFileCmd_Payload_t;
 
+/**
+ *  \brief Memory Dump To Encoded File Command Payload
+ */
+typedef struct
+{
+    MM_DumpMemToFileCmd_Payload_t Dump;       /**< \brief Same as the dump to file command */
+    uint8                         Encoding;   /**< \brief File data encoding, see \ref MMFileEncodings */
+    uint8                         FillValue;  /**< \brief Value left out of #MM_ENCODING_SPARSE data */
+    uint8                         Padding[2]; /**< \brief Structure padding */
+} MM_DumpMemToFileEncCmd_Payload_t;
+
+/**
+ *  \brief Memory Dump To Delta File Command Payload
+ */
+typedef struct
+{
+    MM_DumpMemToFileCmd_Payload_t Dump;                              /**< \brief Same as the dump to file command */
+    char                          BaselineFileName[OS_MAX_PATH_LEN]; /**< \brief Name of the baseline dump file */
+} MM_DumpMemToDeltaFileCmd_Payload_t;
+
+/**
+ *  \brief Memory Dump To Multi-Region File Command Payload
+ */
+typedef struct
+{
+    char RegionFileName[OS_MAX_PATH_LEN]; /**< \brief Name of the file listing the regions to dump */
+    char FileName[OS_MAX_PATH_LEN];       /**< \brief Name of the dump file */
+} MM_DumpMemToMultiFileCmd_Payload_t;
+
 /**
  *  \brief Memory Fill Command Payload
  */
@@ -144,6 +173,29 @@ typedef struct
     MM_SymAddr_t DestSymAddress; /**< \brief Symbol plus optional offset  */
 } MM_FillMemCmd_Payload_t;
 
+/**
+ *  \brief Memory Copy Command Payload
+ */
+typedef struct
+{
+    MM_MemType_t SrcMemType;     /**< \brief Source memory type                        */
+    MM_MemType_t DestMemType;    /**< \brief Destination memory type                   */
+    uint32       NumOfBytes;     /**< \brief Number of bytes to copy                   */
+    uint8        Padding[4];     /**< \brief Structure padding                         */
+    MM_SymAddr_t SrcSymAddress;  /**< \brief Source symbol plus optional offset        */
+    MM_SymAddr_t DestSymAddress; /**< \brief Destination symbol plus optional offset   */
+} MM_CopyMemCmd_Payload_t;
+
+/**
+ *  \brief Memory CRC Command Payload
+ */
+typedef struct
+{
+    MM_MemType_t MemType;       /**< \brief Memory type                           */
+    uint32       NumOfBytes;    /**< \brief Number of bytes to include in the CRC */
+    MM_SymAddr_t SrcSymAddress; /**< \brief Symbol plus optional offset           */
+} MM_CrcMemCmd_Payload_t;
+
 /**
  *  \brief Symbol Table Lookup Command Payload
  */
@@ -160,6 +212,23 @@ typedef struct
     char FileName[OS_MAX_PATH_LEN]; /**< \brief Name of symbol dump file */
 } MM_SymTblToFileCmd_Payload_t;
 
+/**
+ *  \brief Lookup Address Command Payload
+ */
+typedef struct
+{
+    MM_SymAddr_t SymAddress; /**< \brief Symbolic address to look up */
+} MM_LookupAddrCmd_Payload_t;
+
+/**
+ *  \brief Lookup Symbols From File Command Payload
+ */
+typedef struct
+{
+    char InFileName[OS_MAX_PATH_LEN];  /**< \brief Name of the symbol lookup request file */
+    char OutFileName[OS_MAX_PATH_LEN]; /**< \brief Name of the symbol lookup result file */
+} MM_LookupSymFileCmd_Payload_t;
+
 /**
  *  \brief EEPROM Write Enable Command Payload
  */
@@ -252,6 +321,61 @@ typedef struct
     MM_DumpMemToFileCmd_Payload_t Payload;
 } MM_DumpMemToFileCmd_t;
 
+/**
+ *  \brief Memory Dump To Encoded File Command
+ *
+ *  For command details see #MM_DUMP_MEM_TO_FILE_ENC_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t          CommandHeader; /**< \brief Command header */
+    MM_DumpMemToFileEncCmd_Payload_t Payload;
+} MM_DumpMemToFileEncCmd_t;
+
+/**
+ *  \brief Memory Dump To Delta File Command
+ *
+ *  For command details see #MM_DUMP_MEM_TO_DELTA_FILE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t            CommandHeader; /**< \brief Command header */
+    MM_DumpMemToDeltaFileCmd_Payload_t Payload;
+} MM_DumpMemToDeltaFileCmd_t;
+
+/**
+ *  \brief Memory Load From Patch File Command
+ *
+ *  For command details see #MM_LOAD_MEM_FROM_PATCH_FILE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t         CommandHeader; /**< \brief Command header */
+    MM_LoadMemFromFileCmd_Payload_t Payload;
+} MM_LoadMemFromPatchFileCmd_t;
+
+/**
+ *  \brief Memory Load From Multi-Region File Command
+ *
+ *  For command details see #MM_LOAD_MEM_FROM_MULTI_FILE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t         CommandHeader; /**< \brief Command header */
+    MM_LoadMemFromFileCmd_Payload_t Payload;
+} MM_LoadMemFromMultiFileCmd_t;
+
+/**
+ *  \brief Memory Dump To Multi-Region File Command
+ *
+ *  For command details see #MM_DUMP_MEM_TO_MULTI_FILE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t            CommandHeader; /**< \brief Command header */
+    MM_DumpMemToMultiFileCmd_Payload_t Payload;
+} MM_DumpMemToMultiFileCmd_t;
+
 /**
  *  \brief Memory Fill Command
  *
@@ -263,6 +387,28 @@ typedef struct
     MM_FillMemCmd_Payload_t Payload;
 } MM_FillMemCmd_t;
 
+/**
+ *  \brief Memory Copy Command
+ *
+ *  For command details see #MM_COPY_MEM_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+    MM_CopyMemCmd_Payload_t Payload;
+} MM_CopyMemCmd_t;
+
+/**
+ *  \brief Memory CRC Command
+ *
+ *  For command details see #MM_CRC_MEM_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t CommandHeader; /**< \brief Command header */
+    MM_CrcMemCmd_Payload_t  Payload;
+} MM_CrcMemCmd_t;
+
 /**
  *  \brief Symbol Table Lookup Command
  *
@@ -285,6 +431,28 @@ typedef struct
     MM_SymTblToFileCmd_Payload_t Payload;
 } MM_SymTblToFileCmd_t;
 
+/**
+ *  \brief Lookup Address Command
+ *
+ *  For command details see #MM_LOOKUP_ADDR_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t    CommandHeader; /**< \brief Command header */
+    MM_LookupAddrCmd_Payload_t Payload;
+} MM_LookupAddrCmd_t;
+
+/**
+ *  \brief Lookup Symbols From File Command
+ *
+ *  For command details see #MM_LOOKUP_SYM_FILE_CC
+ */
+typedef struct
+{
+    CFE_MSG_CommandHeader_t       CommandHeader; /**< \brief Command header */
+    MM_LookupSymFileCmd_Payload_t Payload;
+} MM_LookupSymFileCmd_t;
+
 /**
  *  \brief EEPROM Write Enable Command
  *
@@ -325,9 +493,25 @@ typedef struct
     uint8        Padding;                   /**< \brief Last command action executed */
     MM_MemType_t MemType;                   /**< \brief Memory type for last command */
     cpuaddr      Address;                   /**< \brief Fully resolved address used for last command */
-    uint32       DataValue;                 /**< \brief Last command data (fill pattern or peek/poke value) */
+    uint32       DataValue;                 /**< \brief Last command data (fill pattern, peek/poke value or CRC) */
     size_t       BytesProcessed;            /**< \brief Bytes processed for last command */
     char         FileName[OS_MAX_PATH_LEN]; /**< \brief Name of the data file used for last command, where applicable */
+    uint8        ChildCmdCounter;           /**< \brief Child task command counter */
+    uint8        ChildErrCounter;           /**< \brief Child task command error counter */
+    uint8        ChildState;                /**< \brief Child task state, see \ref MMChildStates */
+    uint8        ChildLastCC;               /**< \brief Command code of the last command completed by the child task */
+    uint32       LoadSegSize;               /**< \brief Load from file segment size in bytes */
+    uint32       DumpSegSize;               /**< \brief Dump to file segment size in bytes */
+    uint32       FillSegSize;               /**< \brief Fill memory segment size in bytes */
+    uint32       Throughput;                /**< \brief Bytes per second of the last load, dump or fill */
+    uint8        ActiveAction;              /**< \brief Segmented operation in progress, #MM_NOACTION if none */
+    uint8        DeferredCmds;              /**< \brief Commands held until the operation in progress completes */
+    uint8        Spare[2];                  /**< \brief Structure padding */
+    uint32       SymCacheHits;              /**< \brief Symbols resolved from the symbol cache */
+    uint32       SymCacheMisses;            /**< \brief Symbols looked up in the OSAL symbol table */
+    uint32       SymIndexEntries;           /**< \brief Symbols in the reverse symbol index */
+    uint32       MemRangeEntries;           /**< \brief Ranges in the valid memory range map, 0 if not built */
+    uint32       LastMemRange;              /**< \brief PSP range of last checked address, or #MM_MEM_RANGE_UNKNOWN */
 } MM_HkPacket_Payload_t;
 
 /**
@@ -339,6 +523,55 @@ typedef struct
     MM_HkPacket_Payload_t     Payload;
 } MM_HkPacket_t;
 
+/**
+ *  \brief Load, dump, fill, copy or CRC operation statistics
+ *
+ *  Times are in microseconds. The last operation values describe the
+ *  most recent operation of this kind that completed, the minimum,
+ *  maximum and mean values cover all of them since the statistics were
+ *  last reset.
+ */
+typedef struct
+{
+    uint16 CommandCode;    /**< \brief Command code of the operation */
+    uint16 Padding;        /**< \brief Structure padding */
+    uint32 OpCount;        /**< \brief Number of operations completed */
+    uint32 LastBytes;      /**< \brief Bytes processed by the last operation */
+    uint32 LastDuration;   /**< \brief Duration of the last operation */
+    uint32 LastSegments;   /**< \brief Number of segments of the last operation */
+    uint32 LastBreakTime;  /**< \brief Time the last operation spent in segment breaks */
+    uint32 LastIoTime;     /**< \brief Time the last operation spent reading or writing the file */
+    uint32 LastCopyTime;   /**< \brief Time the last operation spent accessing memory */
+    uint32 LastThroughput; /**< \brief Bytes per second of the last operation */
+    uint32 MinDuration;    /**< \brief Shortest operation duration */
+    uint32 MaxDuration;    /**< \brief Longest operation duration */
+    uint32 MeanDuration;   /**< \brief Mean operation duration */
+    uint32 MinThroughput;  /**< \brief Lowest operation throughput in bytes per second */
+    uint32 MaxThroughput;  /**< \brief Highest operation throughput in bytes per second */
+    uint32 MeanThroughput; /**< \brief Mean operation throughput in bytes per second */
+} MM_OpStats_t;
+
+/**
+ *  \brief Statistics Packet Payload Structure
+ */
+typedef struct
+{
+    MM_OpStats_t LoadFromFile; /**< \brief Load memory from file statistics, #MM_LOAD_MEM_FROM_FILE_CC */
+    MM_OpStats_t DumpToFile;   /**< \brief Dump memory to file statistics, #MM_DUMP_MEM_TO_FILE_CC */
+    MM_OpStats_t Fill;         /**< \brief Fill memory statistics, #MM_FILL_MEM_CC */
+    MM_OpStats_t Copy;         /**< \brief Copy memory statistics, #MM_COPY_MEM_CC */
+    MM_OpStats_t Crc;          /**< \brief CRC memory statistics, #MM_CRC_MEM_CC */
+} MM_StatsPacket_Payload_t;
+
+/**
+ *  \brief Statistics Packet Structure
+ */
+typedef struct
+{
+    CFE_MSG_TelemetryHeader_t TelemetryHeader; /**< \brief Telemetry header */
+    MM_StatsPacket_Payload_t  Payload;
+} MM_StatsPacket_t;
+
 /**\}*/
 
 #endif
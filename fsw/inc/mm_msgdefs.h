@@ -70,6 +70,41 @@
 #define MM_EEPROMWRITE_DIS 11 /**< \brief EEPROM write disable action */
 #define MM_NOOP            12 /**< \brief No-op action */
 #define MM_RESET           13 /**< \brief Reset counters action */
+#define MM_COPY            14 /**< \brief Copy memory action */
+#define MM_CRC             15 /**< \brief CRC memory action */
+#define MM_SYM_CACHE_FLUSH 16 /**< \brief Symbol cache flush action */
+#define MM_ADDR_LOOKUP     17 /**< \brief Address lookup action */
+#define MM_RANGE_REFRESH   18 /**< \brief Memory range map refresh action */
+/**\}*/
+
+/**
+ * \name Child Task States
+ * \anchor MMChildStates
+ * \{
+ */
+#define MM_CHILD_DISABLED 0 /**< \brief Child task not running, commands are processed by the main task */
+#define MM_CHILD_IDLE     1 /**< \brief Child task waiting for a command */
+#define MM_CHILD_BUSY     2 /**< \brief Child task processing a command */
+/**\}*/
+
+/**
+ * \name Load and Dump File Data Encodings
+ * \anchor MMFileEncodings
+ * \{
+ */
+#define MM_ENCODING_RAW    0 /**< \brief File data is a copy of memory */
+#define MM_ENCODING_RLE    1 /**< \brief File data is run length encoded, RAM and EEPROM only */
+#define MM_ENCODING_SPARSE 2 /**< \brief File data is the extents that differ from a fill value, RAM and EEPROM only */
+#define MM_ENCODING_DELTA  3 /**< \brief File data is the blocks that differ from a baseline dump, can't be loaded */
+#define MM_ENCODING_PATCH  4 /**< \brief File data is patch records, see #MM_LOAD_MEM_FROM_PATCH_FILE_CC */
+#define MM_ENCODING_MULTI  5 /**< \brief File data is a region table and data, see #MM_LOAD_MEM_FROM_MULTI_FILE_CC */
+/**\}*/
+
+/**
+ * \name Memory Range Numbers
+ * \{
+ */
+#define MM_MEM_RANGE_UNKNOWN 0xFFFFFFFF /**< \brief Address checked by the PSP, range number not known */
 /**\}*/
 
 /**
@@ -122,6 +157,8 @@
  *       the following telemetry:
  *       - #MM_HkPacket_Payload_t.CmdCounter will be cleared
  *       - #MM_HkPacket_Payload_t.ErrCounter will be cleared
+ *       - #MM_HkPacket_Payload_t.ChildCmdCounter will be cleared
+ *       - #MM_HkPacket_Payload_t.ChildErrCounter will be cleared
  *       - The #MM_RESET_INF_EID informational event message will be
  *         generated when the command is executed
  *
@@ -331,7 +368,11 @@
  *  \par Command Verification
  *       Successful execution of this command may be verified with
  *       the following telemetry:
- *       - #MM_HkPacket_Payload_t.CmdCounter will increment
+ *       - #MM_HkPacket_Payload_t.CmdCounter will increment when the command is
+ *         handed to the child task
+ *       - #MM_HkPacket_Payload_t.ChildCmdCounter will increment when the child
+ *         task completes the command
+ *       - #MM_HkPacket_Payload_t.ChildLastCC will be set to this command code
  *       - #MM_HkPacket_Payload_t.LastAction will be set to #MM_LOAD_FROM_FILE
  *       - #MM_HkPacket_Payload_t.MemType will be set to the commanded memory type
  *       - #MM_HkPacket_Payload_t.Address will be set to the fully resolved destination memory address
@@ -343,6 +384,7 @@
  *  \par Error Conditions
  *       This command may fail for the following reason(s):
  *       - Command packet length not as expected
+ *       - The child task is still processing a previous load, dump or fill
  *       - Command specified filename is invalid
  *       - #OS_OpenCreate call fails
  *       - #OS_close call fails
@@ -358,8 +400,12 @@
  *       - The specified memory type is invalid
  *
  *  \par Evidence of failure may be found in the following telemetry:
- *       - #MM_HkPacket_Payload_t.ErrCounter will increment
+ *       - #MM_HkPacket_Payload_t.ErrCounter will increment if the command is
+ *         rejected before it is handed to the child task
+ *       - #MM_HkPacket_Payload_t.ChildErrCounter will increment if the child
+ *         task fails the command
  *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_CHILD_BUSY_ERR_EID
  *       - Error specific event message #MM_OS_OPEN_ERR_EID
  *       - Error specific event message #MM_OS_CLOSE_ERR_EID
  *       - Error specific event message #MM_OS_READ_EXP_ERR_EID
@@ -405,7 +451,11 @@
  *  \par Command Verification
  *       Successful execution of this command may be verified with
  *       the following telemetry:
- *       - #MM_HkPacket_Payload_t.CmdCounter will increment
+ *       - #MM_HkPacket_Payload_t.CmdCounter will increment when the command is
+ *         handed to the child task
+ *       - #MM_HkPacket_Payload_t.ChildCmdCounter will increment when the child
+ *         task completes the command
+ *       - #MM_HkPacket_Payload_t.ChildLastCC will be set to this command code
  *       - #MM_HkPacket_Payload_t.LastAction will be set to #MM_DUMP_TO_FILE
  *       - #MM_HkPacket_Payload_t.MemType will be set to the commanded memory type
  *       - #MM_HkPacket_Payload_t.Address will be set to the fully resolved source memory address
@@ -417,6 +467,7 @@
  *  \par Error Conditions
  *       This command may fail for the following reason(s):
  *       - Command packet length not as expected
+ *       - The child task is still processing a previous load, dump or fill
  *       - Command specified filename is invalid
  *       - A symbol name was specified that can't be resolved
  *       - #OS_OpenCreate call fails
@@ -424,21 +475,23 @@
  *       - #OS_close call fails
  *       - #OS_write doesn't write the expected number of bytes
  *         or returns an error code
- *       - The #MM_ComputeCRCFromFile call fails
  *       - The address range fails validation check
  *       - The specified data size is invalid
  *       - The address and data size are not properly aligned
  *       - The specified memory type is invalid
  *
  *  \par Evidence of failure may be found in the following telemetry:
- *       - #MM_HkPacket_Payload_t.ErrCounter will increment
+ *       - #MM_HkPacket_Payload_t.ErrCounter will increment if the command is
+ *         rejected before it is handed to the child task
+ *       - #MM_HkPacket_Payload_t.ChildErrCounter will increment if the child
+ *         task fails the command
  *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_CHILD_BUSY_ERR_EID
  *       - Error specific event message #MM_SYMNAME_ERR_EID
  *       - Error specific event message #MM_OS_CREAT_ERR_EID
  *       - Error specific event message #MM_CFE_FS_WRITEHDR_ERR_EID
  *       - Error specific event message #MM_OS_CLOSE_ERR_EID
  *       - Error specific event message #MM_OS_WRITE_EXP_ERR_EID
- *       - Error specific event message #MM_COMPUTECRCFROMFILE_ERR_EID
  *       - Error specific event message #MM_OS_MEMVALIDATE_ERR_EID
  *       - Error specific event message #MM_DATA_SIZE_BYTES_ERR_EID
  *       - Error specific event message #MM_ALIGN32_ERR_EID
@@ -524,7 +577,11 @@
  *  \par Command Verification
  *       Successful execution of this command may be verified with
  *       the following telemetry:
- *       - #MM_HkPacket_Payload_t.CmdCounter will increment
+ *       - #MM_HkPacket_Payload_t.CmdCounter will increment when the command is
+ *         handed to the child task
+ *       - #MM_HkPacket_Payload_t.ChildCmdCounter will increment when the child
+ *         task completes the command
+ *       - #MM_HkPacket_Payload_t.ChildLastCC will be set to this command code
  *       - #MM_HkPacket_Payload_t.LastAction will be set to #MM_FILL
  *       - #MM_HkPacket_Payload_t.MemType will be set to the commanded memory type
  *       - #MM_HkPacket_Payload_t.Address will be set to the fully resolved destination memory address
@@ -536,6 +593,7 @@
  *  \par Error Conditions
  *       This command may fail for the following reason(s):
  *       - Command packet length not as expected
+ *       - The child task is still processing a previous load, dump or fill
  *       - A symbol name was specified that can't be resolved
  *       - The address range fails validation check
  *       - The specified data size is invalid
@@ -543,8 +601,12 @@
  *       - The specified memory type is invalid
  *
  *  \par Evidence of failure may be found in the following telemetry:
- *       - #MM_HkPacket_Payload_t.ErrCounter will increment
+ *       - #MM_HkPacket_Payload_t.ErrCounter will increment if the command is
+ *         rejected before it is handed to the child task
+ *       - #MM_HkPacket_Payload_t.ChildErrCounter will increment if the child
+ *         task fails the command
  *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_CHILD_BUSY_ERR_EID
  *       - Error specific event message #MM_SYMNAME_ERR_EID
  *       - Error specific event message #MM_OS_MEMVALIDATE_ERR_EID
  *       - Error specific event message #MM_DATA_SIZE_BYTES_ERR_EID
@@ -718,6 +780,598 @@
  */
 #define MM_DISABLE_EEPROM_WRITE_CC 12
 
+/**
+ * \brief Memory Dump To Encoded File
+ *
+ *  \par Description
+ *       Dumps the input number of bytes from processor memory to a file
+ *       like #MM_DUMP_MEM_TO_FILE_CC, storing the data with the commanded
+ *       encoding. A run length encoded dump of mostly repeated bytes,
+ *       like cleared RAM or erased EEPROM, is a fraction of the size of
+ *       the memory dumped. A sparse dump stores only the extents that
+ *       differ from the commanded fill value, like 0x00 for BSS or 0xFF
+ *       for erased EEPROM. The file header CRC is the CRC of the memory
+ *       dumped, not of the encoded data, and the file can be loaded back
+ *       with #MM_LOAD_MEM_FROM_FILE_CC.
+ *
+ *  \par Command Structure
+ *       #MM_DumpMemToFileEncCmd_t
+ *
+ *  \par Command Verification
+ *       Same as #MM_DUMP_MEM_TO_FILE_CC
+ *
+ *  \par Error Conditions
+ *       This command may fail for the same reasons as #MM_DUMP_MEM_TO_FILE_CC
+ *       and for the following reason(s):
+ *       - The encoding is unknown or not supported for the memory type
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - Same as #MM_DUMP_MEM_TO_FILE_CC
+ *       - Error specific event message #MM_FILE_ENCODING_ERR_EID
+ *
+ *  \par Criticality
+ *       Same as #MM_DUMP_MEM_TO_FILE_CC
+ *
+ *  \sa #MM_DUMP_MEM_TO_FILE_CC, #MM_LOAD_MEM_FROM_FILE_CC
+ */
+#define MM_DUMP_MEM_TO_FILE_ENC_CC 13
+
+/**
+ * \brief Memory Dump To Delta File
+ *
+ *  \par Description
+ *       Dumps the input number of bytes from processor memory like
+ *       #MM_DUMP_MEM_TO_FILE_CC, but compares the memory with a baseline
+ *       file previously written by #MM_DUMP_MEM_TO_FILE_CC and writes
+ *       only the blocks of #MM_DELTA_BLOCK_SIZE bytes that changed. The
+ *       baseline is read a block at a time as the memory is dumped.
+ *
+ *       The delta file data encoding is #MM_ENCODING_DELTA. The MM file
+ *       header CRC is the CRC of all of the memory dumped. It is followed
+ *       by an #MM_DeltaFileHeader_t holding the baseline CRC and the
+ *       number of blocks, then a block map with one bit per block, least
+ *       significant bit first, set for each block that changed. The
+ *       changed blocks follow in address order. A delta file can't be
+ *       loaded with #MM_LOAD_MEM_FROM_FILE_CC.
+ *
+ *  \par Command Structure
+ *       #MM_DumpMemToDeltaFileCmd_t
+ *
+ *  \par Command Verification
+ *       Same as #MM_DUMP_MEM_TO_FILE_CC except that the
+ *       #MM_DMP_DELTA_FILE_INF_EID informational event message reports
+ *       the number of changed blocks
+ *
+ *  \par Error Conditions
+ *       This command may fail for the same reasons as #MM_DUMP_MEM_TO_FILE_CC
+ *       and for the following reason(s):
+ *       - The memory type is not RAM or EEPROM
+ *       - The baseline file can't be opened or read
+ *       - The baseline file is encoded, or is of a different memory
+ *         type or number of bytes than the command
+ *       - The baseline file data doesn't match its CRC
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - Same as #MM_DUMP_MEM_TO_FILE_CC
+ *       - Error specific event message #MM_FILE_ENCODING_ERR_EID
+ *       - Error specific event message #MM_OS_OPEN_ERR_EID
+ *       - Error specific event message #MM_OS_READ_ERR_EID
+ *       - Error specific event message #MM_DELTA_BASELINE_ERR_EID
+ *
+ *  \par Criticality
+ *       Same as #MM_DUMP_MEM_TO_FILE_CC
+ *
+ *  \sa #MM_DUMP_MEM_TO_FILE_CC
+ */
+#define MM_DUMP_MEM_TO_DELTA_FILE_CC 14
+
+/**
+ * \brief Memory Load From Patch File
+ *
+ *  \par Description
+ *       Applies a patch file to processor memory. A patch replaces only
+ *       the bytes it holds, so a small change to a large table doesn't
+ *       need a load file image of the whole table.
+ *
+ *       The patch file data encoding is #MM_ENCODING_PATCH. The MM file
+ *       header holds the symbolic base address, the memory type, the
+ *       number of bytes the patch may change from the base address and
+ *       the CRC of the file data that follows the MM header. The data
+ *       starts with an #MM_PatchFileHeader_t holding the CRC of the memory
+ *       the patch replaces and the number of records. Each record is an
+ *       (offset, length) pair followed by the bytes to write. Records are
+ *       in ascending offset order and don't overlap.
+ *
+ *       The whole file is checked before memory is written: the file
+ *       CRC, every record and the CRC of the memory the records replace,
+ *       so a patch is only applied to the memory it was made for.
+ *
+ *  \par Command Structure
+ *       #MM_LoadMemFromPatchFileCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - Same as #MM_LOAD_MEM_FROM_FILE_CC except that
+ *         #MM_HkPacket_Payload_t.BytesProcessed will be set to the number
+ *         of bytes patched
+ *       - The #MM_LD_PATCH_FILE_INF_EID informational event message will
+ *         be generated
+ *
+ *  \par Error Conditions
+ *       This command may fail for the same reasons as #MM_LOAD_MEM_FROM_FILE_CC
+ *       and for the following reason(s):
+ *       - The file is not a patch file or the memory type is not RAM or EEPROM
+ *       - A record is out of order, overlaps the one before it, is outside
+ *         the patched range or is cut short, or the number of records
+ *         doesn't match the patch header
+ *       - The memory the records replace doesn't match the patch pre-image CRC
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - Same as #MM_LOAD_MEM_FROM_FILE_CC
+ *       - Error specific event message #MM_FILE_ENCODING_ERR_EID
+ *       - Error specific event message #MM_PATCH_FILE_ERR_EID
+ *       - Error specific event message #MM_PATCH_PREIMAGE_ERR_EID
+ *
+ *  \par Criticality
+ *       Same as #MM_LOAD_MEM_FROM_FILE_CC
+ *
+ *  \sa #MM_LOAD_MEM_FROM_FILE_CC, #MM_DUMP_MEM_TO_DELTA_FILE_CC
+ */
+#define MM_LOAD_MEM_FROM_PATCH_FILE_CC 15
+
+/**
+ * \brief Memory Load From Multi-Region File
+ *
+ *  \par Description
+ *       Loads several memory regions from one file, so updating a set of
+ *       tables takes one file and one command instead of one of each per
+ *       table.
+ *
+ *       The file data encoding is #MM_ENCODING_MULTI. The MM file header
+ *       holds the total number of region bytes and the CRC of the region
+ *       table, its symbolic address and memory type are not used. The
+ *       data starts with an #MM_MultiFileHeader_t holding the number of
+ *       regions, then the region table, one #MM_LoadDumpFileHeader_t for
+ *       each region with its own symbolic address, memory type, length
+ *       and CRC. The data of each region follows in table order, in
+ *       #MM_ENCODING_RAW form.
+ *
+ *       Every region is resolved, checked and its CRC verified before
+ *       any memory is written. The regions are then loaded in table
+ *       order the same way #MM_LOAD_MEM_FROM_FILE_CC loads a file of
+ *       their memory type.
+ *
+ *  \par Command Structure
+ *       #MM_LoadMemFromMultiFileCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - Same as #MM_LOAD_MEM_FROM_FILE_CC except that
+ *         #MM_HkPacket_Payload_t.Address and #MM_HkPacket_Payload_t.MemType
+ *         are those of the first region and #MM_HkPacket_Payload_t.BytesProcessed
+ *         is the number of bytes loaded to all regions
+ *       - The #MM_LD_MULTI_FILE_INF_EID informational event message will
+ *         be generated
+ *
+ *  \par Error Conditions
+ *       This command may fail for the same reasons as #MM_LOAD_MEM_FROM_FILE_CC,
+ *       for any region, and for the following reason(s):
+ *       - The file is not a multi-region file
+ *       - The region table is empty, has more than #MM_MAX_FILE_REGIONS
+ *         entries, or its region sizes don't add up to the MM file header
+ *         size
+ *       - A region isn't #MM_ENCODING_RAW
+ *
+ *       A read or write error while loading can leave the earlier regions
+ *       loaded and the later ones unchanged.
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - Same as #MM_LOAD_MEM_FROM_FILE_CC
+ *       - Error specific event message #MM_FILE_ENCODING_ERR_EID
+ *       - Error specific event message #MM_MULTI_FILE_ERR_EID
+ *
+ *  \par Criticality
+ *       Same as #MM_LOAD_MEM_FROM_FILE_CC
+ *
+ *  \sa #MM_LOAD_MEM_FROM_FILE_CC
+ */
+#define MM_LOAD_MEM_FROM_MULTI_FILE_CC 16
+
+/**
+ * \brief Dump Memory To Multi-Region File
+ *
+ *  \par Description
+ *       Dumps several memory regions to one file, so a set of regions
+ *       takes one file and one command instead of one of each per region.
+ *
+ *       The regions are listed in a region file, a multi-region file
+ *       that may hold only the region table, see
+ *       #MM_LOAD_MEM_FROM_MULTI_FILE_CC. Each entry gives the symbolic
+ *       address, memory type and number of bytes of a region, its CRC
+ *       is not used. A multi-region dump file can itself be used as the
+ *       region file to dump the same regions again.
+ *
+ *       The dump file is a multi-region file. Each region table entry
+ *       holds the resolved address of the region and the CRC of its
+ *       data, and the MM file header holds the CRC of the region table,
+ *       so the file can be loaded with #MM_LOAD_MEM_FROM_MULTI_FILE_CC.
+ *       Every region is resolved and checked before the dump file is
+ *       created.
+ *
+ *  \par Command Structure
+ *       #MM_DumpMemToMultiFileCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - Same as #MM_DUMP_MEM_TO_FILE_CC except that
+ *         #MM_HkPacket_Payload_t.Address and #MM_HkPacket_Payload_t.MemType
+ *         are those of the first region and #MM_HkPacket_Payload_t.BytesProcessed
+ *         is the number of bytes dumped from all regions
+ *       - The #MM_DMP_MULTI_FILE_INF_EID informational event message will
+ *         be generated
+ *
+ *  \par Error Conditions
+ *       This command may fail for the same reasons as #MM_DUMP_MEM_TO_FILE_CC,
+ *       for any region, and for the following reason(s):
+ *       - The region file can't be read, is not a multi-region file or its
+ *         region table CRC doesn't match its MM file header
+ *       - The region table is empty or has more than #MM_MAX_FILE_REGIONS
+ *         entries
+ *       - A region isn't #MM_ENCODING_RAW
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - Same as #MM_DUMP_MEM_TO_FILE_CC
+ *       - Error specific event message #MM_FILE_ENCODING_ERR_EID
+ *       - Error specific event message #MM_MULTI_FILE_ERR_EID
+ *       - Error specific event message #MM_LOAD_FILE_CRC_ERR_EID
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #MM_DUMP_MEM_TO_FILE_CC, #MM_LOAD_MEM_FROM_MULTI_FILE_CC
+ */
+#define MM_DUMP_MEM_TO_MULTI_FILE_CC 17
+
+/**
+ * \brief Memory Copy
+ *
+ *  \par Description
+ *       Copies memory from one address to another without a dump and
+ *       load through a file. The source and destination each have their
+ *       own memory type, and each side is accessed with the width its
+ *       memory type requires.
+ *
+ *       The copy runs in segments like a load, staging each segment in
+ *       the MM i/o buffer. Overlapping ranges are copied so that every
+ *       source byte is read before it is overwritten. The CRC of the
+ *       copied data is computed with #MM_DUMP_FILE_CRC_TYPE, so it can
+ *       be compared with the CRC of a dump of the source.
+ *
+ *  \par Command Structure
+ *       #MM_CopyMemCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkPacket_Payload_t.CmdCounter will increment when the command is
+ *         handed to the child task
+ *       - #MM_HkPacket_Payload_t.ChildCmdCounter will increment when the child
+ *         task completes the command
+ *       - #MM_HkPacket_Payload_t.ChildLastCC will be set to this command code
+ *       - #MM_HkPacket_Payload_t.LastAction will be set to #MM_COPY
+ *       - #MM_HkPacket_Payload_t.MemType will be set to the destination memory type
+ *       - #MM_HkPacket_Payload_t.Address will be set to the fully resolved destination memory address
+ *       - #MM_HkPacket_Payload_t.DataValue will be set to the CRC of the copied data
+ *       - #MM_HkPacket_Payload_t.BytesProcessed will be set to the number of bytes copied
+ *       - The #MM_COPY_INF_EID informational event message will
+ *         be generated when the command is executed
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - The child task is still processing a previous load, dump, fill or copy
+ *       - A symbol name was specified that can't be resolved
+ *       - The source address range fails the dump checks or the destination
+ *         address range fails the load checks
+ *       - The specified data size is invalid
+ *       - The address and data size are not properly aligned for either memory type
+ *       - A specified memory type is invalid
+ *       - A PSP memory read or write fails
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkPacket_Payload_t.ErrCounter will increment if the command is
+ *         rejected before it is handed to the child task
+ *       - #MM_HkPacket_Payload_t.ChildErrCounter will increment if the child
+ *         task fails the command
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_CHILD_BUSY_ERR_EID
+ *       - Error specific event message #MM_SYMNAME_ERR_EID
+ *       - Error specific event message #MM_OS_MEMVALIDATE_ERR_EID
+ *       - Error specific event message #MM_DATA_SIZE_BYTES_ERR_EID
+ *       - Error specific event message #MM_ALIGN32_ERR_EID
+ *       - Error specific event message #MM_ALIGN16_ERR_EID
+ *       - Error specific event message #MM_MEMTYPE_ERR_EID
+ *       - Error specific event message #MM_PSP_READ_ERR_EID
+ *       - Error specific event message #MM_PSP_WRITE_ERR_EID
+ *
+ *  \par Criticality
+ *       It is the responsibility of the user to verify the <i>DestSymAddress</i>,
+ *       and <i>NumOfBytes</i> in the command. It is possible to destroy critical
+ *       information with this command causing unknown consequences. In addition,
+ *       it is possible to generate a machine check exception when accessing I/O
+ *       memory addresses/registers and other types of memory. The user is
+ *       cautioned to use extreme care.
+ *
+ *  \sa #MM_LOAD_MEM_FROM_FILE_CC, #MM_DUMP_MEM_TO_FILE_CC
+ */
+#define MM_COPY_MEM_CC 18
+
+/**
+ * \brief Memory CRC
+ *
+ *  \par Description
+ *       Computes the CRC of a memory range without dumping it to a file.
+ *       The CRC is computed with #MM_DUMP_FILE_CRC_TYPE, so it matches the
+ *       CRC in the header of a dump file of the same range.
+ *
+ *       The memory is read in segments like a dump, staging each segment
+ *       in the MM i/o buffer, with the access width the memory type
+ *       requires.
+ *
+ *  \par Command Structure
+ *       #MM_CrcMemCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkPacket_Payload_t.CmdCounter will increment when the command is
+ *         handed to the child task
+ *       - #MM_HkPacket_Payload_t.ChildCmdCounter will increment when the child
+ *         task completes the command
+ *       - #MM_HkPacket_Payload_t.ChildLastCC will be set to this command code
+ *       - #MM_HkPacket_Payload_t.LastAction will be set to #MM_CRC
+ *       - #MM_HkPacket_Payload_t.MemType will be set to the commanded memory type
+ *       - #MM_HkPacket_Payload_t.Address will be set to the fully resolved memory address
+ *       - #MM_HkPacket_Payload_t.DataValue will be set to the CRC of the memory range
+ *       - #MM_HkPacket_Payload_t.BytesProcessed will be set to the number of bytes read
+ *       - The #MM_CRC_MEM_INF_EID informational event message will
+ *         be generated when the command is executed
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - The child task is still processing a previous load, dump, fill or copy
+ *       - The symbol name can't be resolved
+ *       - The address range fails the dump checks
+ *       - The specified data size is invalid
+ *       - The address and data size are not properly aligned for the memory type
+ *       - The specified memory type is invalid
+ *       - A PSP memory read fails
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkPacket_Payload_t.ErrCounter will increment if the command is
+ *         rejected before it is handed to the child task
+ *       - #MM_HkPacket_Payload_t.ChildErrCounter will increment if the child
+ *         task fails the command
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_CHILD_BUSY_ERR_EID
+ *       - Error specific event message #MM_SYMNAME_ERR_EID
+ *       - Error specific event message #MM_OS_MEMVALIDATE_ERR_EID
+ *       - Error specific event message #MM_DATA_SIZE_BYTES_ERR_EID
+ *       - Error specific event message #MM_ALIGN32_ERR_EID
+ *       - Error specific event message #MM_ALIGN16_ERR_EID
+ *       - Error specific event message #MM_MEMTYPE_ERR_EID
+ *       - Error specific event message #MM_PSP_READ_ERR_EID
+ *
+ *  \par Criticality
+ *       It is possible to generate a machine check exception when accessing I/O
+ *       memory addresses/registers and other types of memory. The user is
+ *       cautioned to use extreme care.
+ *
+ *  \sa #MM_DUMP_MEM_TO_FILE_CC
+ */
+#define MM_CRC_MEM_CC 19
+
+/**
+ * \brief Flush Symbol Cache
+ *
+ *  \par Description
+ *       Discards every symbol address remembered by the symbol cache.
+ *       Symbols used by later commands are looked up in the OSAL symbol
+ *       table again.
+ *
+ *       This command must be sent after an application or module is
+ *       loaded, reloaded or unloaded, since the symbols it defines may
+ *       have moved. The symbol cache hit and miss counters are not
+ *       changed.
+ *
+ *  \par Command Structure
+ *       #MM_NoArgsCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkPacket_Payload_t.CmdCounter will increment
+ *       - #MM_HkPacket_Payload_t.LastAction will be set to #MM_SYM_CACHE_FLUSH
+ *       - The #MM_SYM_CACHE_FLUSH_INF_EID informational event message will
+ *         be generated when the command is executed
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkPacket_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #MM_LOOKUP_SYM_CC
+ */
+#define MM_SYM_CACHE_FLUSH_CC 20
+
+/**
+ * \brief Lookup Address
+ *
+ *  \par Description
+ *       Reports the symbol that contains a memory address as a symbol
+ *       name plus offset.
+ *
+ *       The address is looked up in the reverse symbol index, which is
+ *       rebuilt from the dump file each time a #MM_SYMTBL_TO_FILE_CC
+ *       command succeeds. The nearest indexed symbol at or below the
+ *       address is reported, as long as the address is no more than
+ *       #MM_SYM_INDEX_MAX_OFFSET bytes above it.
+ *
+ *  \par Command Structure
+ *       #MM_LookupAddrCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkPacket_Payload_t.CmdCounter will increment
+ *       - #MM_HkPacket_Payload_t.LastAction will be set to #MM_ADDR_LOOKUP
+ *       - #MM_HkPacket_Payload_t.Address will be set to the fully resolved memory address
+ *       - #MM_HkPacket_Payload_t.DataValue will be set to the offset from the symbol
+ *       - The #MM_ADDR_LOOKUP_INF_EID informational event message will
+ *         be generated when the command is executed
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - The symbol name can't be resolved
+ *       - The reverse symbol index is empty
+ *       - No indexed symbol is close enough below the address
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkPacket_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_SYMNAME_ERR_EID
+ *       - Error specific event message #MM_ADDR_LOOKUP_ERR_EID
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #MM_LOOKUP_SYM_CC, #MM_SYMTBL_TO_FILE_CC
+ */
+#define MM_LOOKUP_ADDR_CC 21
+
+/**
+ * \brief Lookup Symbols From File
+ *
+ *  \par Description
+ *       Resolves every symbol name in a request file and writes the
+ *       addresses to a result file, so a list of symbols can be looked up
+ *       with one command and one event message.
+ *
+ *       The request file is a cFE file header, a #MM_SymLookupFileHeader_t
+ *       holding the number of symbols, then one #MM_SymLookupRecord_t for
+ *       each symbol with its SymName set. The result file has the same
+ *       layout, with the number of resolved symbols in the header and the
+ *       Address and Resolved fields of each record set.
+ *
+ *       Symbols are resolved the same way as symbolic address arguments,
+ *       using the symbol cache. A symbol that can't be resolved, or an
+ *       empty name, is marked unresolved in the result file and doesn't
+ *       fail the command.
+ *
+ *       The command is processed by the child task, like a dump.
+ *
+ *  \par Command Structure
+ *       #MM_LookupSymFileCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkPacket_Payload_t.CmdCounter will increment when the command is
+ *         handed to the child task
+ *       - #MM_HkPacket_Payload_t.ChildCmdCounter will increment when the child
+ *         task completes the command
+ *       - #MM_HkPacket_Payload_t.ChildLastCC will be set to this command code
+ *       - #MM_HkPacket_Payload_t.LastAction will be set to #MM_SYM_LOOKUP
+ *       - #MM_HkPacket_Payload_t.DataValue will be set to the number of symbols resolved
+ *       - #MM_HkPacket_Payload_t.BytesProcessed will be set to the number of symbols in the file
+ *       - #MM_HkPacket_Payload_t.FileName will be set to the result file name
+ *       - The #MM_SYM_LOOKUP_FILE_INF_EID informational event message will
+ *         be generated when the command is executed
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - The child task is still processing a previous load, dump, fill or copy
+ *       - The request file can't be opened or read
+ *       - The request file symbol count is zero or too large
+ *       - The result file can't be created or written
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkPacket_Payload_t.ErrCounter will increment if the command is
+ *         rejected before it is handed to the child task
+ *       - #MM_HkPacket_Payload_t.ChildErrCounter will increment if the child
+ *         task fails the command
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_CHILD_BUSY_ERR_EID
+ *       - Error specific event message #MM_OS_OPEN_ERR_EID
+ *       - Error specific event message #MM_CFE_FS_READHDR_ERR_EID
+ *       - Error specific event message #MM_OS_READ_EXP_ERR_EID
+ *       - Error specific event message #MM_SYM_LOOKUP_FILE_COUNT_ERR_EID
+ *       - Error specific event message #MM_OS_CREAT_ERR_EID
+ *       - Error specific event message #MM_CFE_FS_WRITEHDR_ERR_EID
+ *       - Error specific event message #MM_OS_WRITE_EXP_ERR_EID
+ *       - Error specific event message #MM_OS_CLOSE_ERR_EID
+ *
+ *  \par Criticality
+ *       None
+ *
+ *  \sa #MM_LOOKUP_SYM_CC
+ */
+#define MM_LOOKUP_SYM_FILE_CC 22
+
+/**
+ * \brief Refresh Memory Range Map
+ *
+ *  \par Description
+ *       Copies the RAM and EEPROM ranges of the PSP memory table into
+ *       the valid memory range map again.
+ *
+ *       Addresses of peek, poke, load, dump, fill, copy and CRC commands
+ *       are checked against this map instead of the PSP memory table.
+ *       The map is built at startup, so this command must be sent after
+ *       the PSP memory table is changed. If the map can't be built the
+ *       PSP memory table is checked on every command until it can.
+ *
+ *  \par Command Structure
+ *       #MM_NoArgsCmd_t
+ *
+ *  \par Command Verification
+ *       Successful execution of this command may be verified with
+ *       the following telemetry:
+ *       - #MM_HkPacket_Payload_t.CmdCounter will increment
+ *       - #MM_HkPacket_Payload_t.LastAction will be set to #MM_RANGE_REFRESH
+ *       - #MM_HkPacket_Payload_t.MemRangeEntries will be set to the number of ranges in the map
+ *       - The #MM_MEM_RANGE_INF_EID informational event message will
+ *         be generated when the command is executed
+ *
+ *  \par Error Conditions
+ *       This command may fail for the following reason(s):
+ *       - Command packet length not as expected
+ *       - A PSP memory table range can't be read
+ *       - The PSP memory table has more ranges of a memory type than
+ *         #MM_MEM_RANGE_MAP_ENTRIES
+ *
+ *  \par Evidence of failure may be found in the following telemetry:
+ *       - #MM_HkPacket_Payload_t.ErrCounter will increment
+ *       - Error specific event message #MM_CMD_LEN_ERR_EID
+ *       - Error specific event message #MM_MEM_RANGE_ERR_EID
+ *
+ *  \par Criticality
+ *       None
+ */
+#define MM_MEM_RANGE_REFRESH_CC 23
+
 /**\}*/
 
 #endif
@@ -31,6 +31,7 @@
 
 #define MM_CMD_MID     0x1888 /**< \brief Msg ID for cmds to mm     */
 #define MM_SEND_HK_MID 0x1889 /**< \brief Msg ID to request mm HK   */
+#define MM_WAKEUP_MID  0x188A /**< \brief Msg ID to wake up mm      */
 
 /**\}*/
 
@@ -39,7 +40,8 @@
  * \{
  */
 
-#define MM_HK_TLM_MID 0x0887 /**< \brief MM Housekeeping Telemetry */
+#define MM_HK_TLM_MID    0x0887 /**< \brief MM Housekeeping Telemetry */
+#define MM_STATS_TLM_MID 0x0888 /**< \brief MM Load, Dump and Fill Statistics Telemetry */
 
 /**\}*/
 
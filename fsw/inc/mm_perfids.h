@@ -34,6 +34,19 @@
 #define MM_EEPROM_POKE_PERF_ID     32 /**< \brief EEPROM poke performance ID */
 #define MM_EEPROM_FILELOAD_PERF_ID 33 /**< \brief EEPROM file load performance ID */
 #define MM_EEPROM_FILL_PERF_ID     34 /**< \brief EEPROM fill performance ID */
+#define MM_CHILD_TASK_PERF_ID      35 /**< \brief Child task performance ID */
+#define MM_LOAD_FILE_PERF_ID       36 /**< \brief Load memory from file command performance ID */
+#define MM_DUMP_FILE_PERF_ID       37 /**< \brief Dump memory to file command performance ID */
+#define MM_FILL_PERF_ID            38 /**< \brief Fill memory command performance ID */
+#define MM_FILE_OPEN_PERF_ID       39 /**< \brief Load or dump file open performance ID */
+#define MM_FILE_HDR_PERF_ID        40 /**< \brief Load or dump file header read or write performance ID */
+#define MM_FILE_CRC_PERF_ID        41 /**< \brief Load file CRC pass performance ID */
+#define MM_SEGCOPY_PERF_ID         42 /**< \brief Segment memory copy, write or fill performance ID */
+#define MM_FILE_IO_PERF_ID         43 /**< \brief Load or dump file data read or write performance ID */
+#define MM_FILE_CLOSE_PERF_ID      44 /**< \brief Load or dump file close performance ID */
+#define MM_SYMRESOLVE_PERF_ID      45 /**< \brief Symbol address resolution performance ID */
+#define MM_COPY_PERF_ID            46 /**< \brief Copy memory command performance ID */
+#define MM_CRC_PERF_ID             47 /**< \brief CRC memory command performance ID */
 
 /**\}*/
 
@@ -241,6 +241,242 @@
  */
 #define MM_MAX_FILL_DATA_SEG 200
 
+/**
+ * \brief Size of the shared i/o buffer
+ *
+ *  \par Description:
+ *       Number of bytes in the single buffer shared by the load, dump
+ *       and fill operations and by the load file CRC computation, only
+ *       one of which runs at a time. Load and dump files are read and
+ *       written in blocks of this size, independent of the segment
+ *       sizes that set how often MM yields the CPU. A larger buffer
+ *       means fewer file system calls per load or dump.
+ *
+ *  \par Limits:
+ *       This parameter must be a multiple of 4 and cannot be less than
+ *       #MM_MAX_LOAD_DATA_SEG, #MM_MAX_DUMP_DATA_SEG or
+ *       #MM_MAX_FILL_DATA_SEG, and cannot be less than 256 so run length
+ *       encoded dumps stay within their size limit. A multiple of the file
+ *       system block size works best.
+ */
+#define MM_IO_BUFFER_SIZE 512
+
+/**
+ * \brief Delta dump block size
+ *
+ *  \par Description:
+ *       Number of bytes in each block a delta dump compares against
+ *       its baseline file. Only the blocks that differ are written to
+ *       the delta file, so smaller blocks make smaller delta files for
+ *       scattered changes but a larger block map. The map has one bit
+ *       for each block of the largest RAM or EEPROM dump.
+ *
+ *  \par Limits:
+ *       This parameter must be a multiple of 4, and twice this size
+ *       cannot be more than #MM_IO_BUFFER_SIZE since a baseline block
+ *       and the changed blocks share the i/o buffer.
+ */
+#define MM_DELTA_BLOCK_SIZE 128
+
+/**
+ * \brief Maximum number of regions in a multi-region file
+ *
+ *  \par Description:
+ *       Largest region table a multi-region file may hold, see
+ *       #MM_LOAD_MEM_FROM_MULTI_FILE_CC and #MM_DUMP_MEM_TO_MULTI_FILE_CC.
+ *       The table is held in the MM global data while a file is loaded
+ *       or dumped.
+ *
+ *  \par Limits:
+ *       This parameter cannot be less than 1 or greater than 255.
+ */
+#define MM_MAX_FILE_REGIONS 32
+
+/**
+ * \brief Maximum number of symbols in a symbol lookup file
+ *
+ *  \par Description:
+ *       Largest number of symbol names a single #MM_LOOKUP_SYM_FILE_CC
+ *       request file may hold.
+ *
+ *  \par Limits:
+ *       This parameter cannot be less than 1 or greater than 65535.
+ */
+#define MM_MAX_SYM_LOOKUP_RECORDS 256
+
+/**
+ * \brief Size of the load staging memory pool
+ *
+ *  \par Description:
+ *       Number of bytes reserved for the ES memory pool that load files
+ *       are staged in. A RAM or EEPROM load no larger than the
+ *       configured maximum staged load is read from the file once into
+ *       a buffer from this pool, its CRC is verified there and the data
+ *       is then copied to memory. Larger loads, loads to the optional
+ *       memory types and loads that can't get a pool buffer read the
+ *       file twice, once for the CRC and once for the load.
+ *
+ *  \par Limits:
+ *       The pool needs some space for its own bookkeeping, so this
+ *       parameter should be somewhat larger than #MM_MAX_STAGED_LOAD.
+ */
+#define MM_LOAD_STAGING_POOL_SIZE (32 * 1024)
+
+/**
+ * \brief Maximum number of bytes for a staged load
+ *
+ *  \par Description:
+ *       Default and upper bound of the largest load file data that is
+ *       staged in the load staging pool, see #MM_LOAD_STAGING_POOL_SIZE.
+ *       The configuration table can lower it, a value of 0 turns
+ *       staging off.
+ *
+ *  \par Limits:
+ *       This parameter cannot be larger than #MM_LOAD_STAGING_POOL_SIZE.
+ */
+#define MM_MAX_STAGED_LOAD (16 * 1024)
+
+/**
+ * \brief Number of commands deferred during a load, dump or fill
+ *
+ *  \par Description:
+ *       When there is no child task a load, dump or fill runs on the
+ *       main task. Between segments the main task polls its command
+ *       pipe, answers housekeeping requests and holds other commands
+ *       until the operation completes. This is the number of commands
+ *       that can be held, further commands are rejected.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1 and no more than 255.
+ */
+#define MM_DEFERRED_CMD_DEPTH 4
+
+/**
+ * \brief Number of load file validation cache entries
+ *
+ *  \par Description:
+ *       A load file whose headers, size and CRC have been verified is
+ *       remembered by path, size and modification time along with its
+ *       MM file header. Loading the same file again while it is
+ *       unchanged skips the CRC pass over the file. This is the number
+ *       of files remembered, the least recently added one is replaced
+ *       first.
+ *
+ *  \par Limits:
+ *       This parameter must be at least 1 and no more than 255.
+ */
+#define MM_LOAD_CACHE_ENTRIES 4
+
+/**
+ * \brief Load file validation cache CDS name
+ *
+ *  \par Description:
+ *       Name of the critical data store block that keeps the load file
+ *       validation cache across processor resets and application
+ *       restarts.
+ *
+ *  \par Limits:
+ *       The string length (including string terminator) cannot exceed
+ *       #CFE_MISSION_ES_CDS_MAX_NAME_LENGTH.  (limit is not verified)
+ */
+#define MM_LOAD_CACHE_CDS_NAME "MM_LOAD_CACHE"
+
+/**
+ * \brief Number of symbol cache entries
+ *
+ *  \par Description:
+ *       Symbol names resolved for load, dump, fill, copy, CRC, peek and
+ *       poke commands are kept in a hash table so that repeated commands
+ *       on the same symbol don't search the OSAL symbol table again.
+ *       Each name maps to a single entry, a name that maps to an entry
+ *       already in use replaces it.
+ *
+ *  \par Limits:
+ *       Must be a power of two, at least 1 and no more than 1024.
+ */
+#define MM_SYM_CACHE_ENTRIES 64
+
+/**
+ * \brief Symbol cache mutex name
+ *
+ *  \par Description:
+ *       Name of the mutex that serializes symbol cache access between
+ *       the main task and the child task.
+ *
+ *  \par Limits:
+ *       The string length (including string terminator) cannot exceed
+ *       #OS_MAX_API_NAME.  (limit is not verified)
+ */
+#define MM_SYM_CACHE_MUTEX_NAME "MM_SYM_CACHE"
+
+/**
+ * \brief Maximum number of reverse symbol index entries
+ *
+ *  \par Description:
+ *       Each successful symbol table dump is read back into a reverse
+ *       symbol index sorted by address, so that addresses can be
+ *       reported as a symbol name plus offset. Symbols beyond this
+ *       many are left out of the index.
+ *
+ *  \par Limits:
+ *       Must be at least 1 and no more than 65536.
+ */
+#define MM_SYM_INDEX_ENTRIES 2048
+
+/**
+ * \brief Reverse symbol index name pool size
+ *
+ *  \par Description:
+ *       Number of bytes reserved for the symbol names of the reverse
+ *       symbol index. Each name takes its length plus a NUL terminator,
+ *       symbols whose name doesn't fit are left out of the index.
+ *
+ *  \par Limits:
+ *       Must be at least #OS_MAX_SYM_LEN bytes.
+ */
+#define MM_SYM_INDEX_NAME_POOL_SIZE 32768
+
+/**
+ * \brief Reverse symbol index maximum offset
+ *
+ *  \par Description:
+ *       Largest offset in bytes from the nearest symbol below an address
+ *       for which the address is still reported as that symbol plus the
+ *       offset. Addresses further from any symbol are not resolved.
+ *
+ *  \par Limits:
+ *       Must be greater than 0.
+ */
+#define MM_SYM_INDEX_MAX_OFFSET 0x10000
+
+/**
+ * \brief Maximum number of valid memory range map entries
+ *
+ *  \par Description:
+ *       The RAM and EEPROM ranges of the PSP memory table are copied at
+ *       startup into a map sorted by address, one per memory type, so
+ *       that command addresses can be checked without walking the PSP
+ *       memory table each time. If the PSP memory table has more ranges
+ *       of a type than this, the PSP memory table is checked instead.
+ *
+ *  \par Limits:
+ *       Must be at least 1 and no more than 256.
+ */
+#define MM_MEM_RANGE_MAP_ENTRIES 32
+
+/**
+ * \brief Valid memory range map mutex name
+ *
+ *  \par Description:
+ *       Name of the mutex that serializes valid memory range map access
+ *       between the main task and the child task.
+ *
+ *  \par Limits:
+ *       The string length (including string terminator) cannot exceed
+ *       #OS_MAX_API_NAME.  (limit is not verified)
+ */
+#define MM_MEM_RANGE_MUTEX_NAME "MM_MEM_RANGE"
+
 /**
  * \brief Optional MEM32 compile switch
  *
@@ -428,6 +664,40 @@
  */
 #define MM_MAX_FILL_DATA_MEM8 (1024 * 1024)
 
+/**
+ * \brief Number of memory type driver table entries
+ *
+ *  \par Description:
+ *       Size of the memory type driver table, indexed by memory type
+ *       number. Entries above #MM_MEM32 are free for mission memory
+ *       types registered with MM_MemTypeRegister.
+ *
+ *  \par Limits:
+ *       Must be at least 6, one more than #MM_MEM32, and no more than
+ *       256.
+ */
+#define MM_MAX_MEM_TYPES 8
+
+/**
+ * \brief Mission memory type registration hook
+ *
+ *  \par Description:
+ *       If defined, called with no arguments from MM initialization
+ *       once the built-in memory types are in the driver table, so a
+ *       mission can add its own memory types with MM_MemTypeRegister
+ *       without changing MM. The function it names must be linked into
+ *       the MM application. For example:
+ *
+ *       \code
+ *       void MISSION_MM_RegisterMemTypes(void);
+ *       #define MM_MISSION_MEM_TYPE_INIT() MISSION_MM_RegisterMemTypes()
+ *       \endcode
+ *
+ *  \par Limits:
+ *       n/a
+ */
+/* #define MM_MISSION_MEM_TYPE_INIT() */
+
 /**
  * \brief Segment break processor delay
  *
@@ -437,8 +707,8 @@
  *       OS scheduler, giving up what's left of the current timeslice.
  *
  *  \par Limits:
- *       The MM app does not place a limit on this parameter.
- *       However, setting this value to a large number will increase the
+ *       This parameter cannot be larger than #MM_MAX_PROCESSOR_CYCLE.
+ *       Setting this value to a large number will increase the
  *       time required to process load, dump, and fill requests.
  *       It will also increase the likelyhood of MM being late responding
  *       to housekeeping requests since it cannot process such a request
@@ -446,6 +716,200 @@
  */
 #define MM_PROCESSOR_CYCLE 0
 
+/**
+ * \brief Maximum segment break processor delay
+ *
+ *  \par Description:
+ *       Upper bound of the segment break delay in the configuration
+ *       table, see #MM_PROCESSOR_CYCLE.
+ *
+ *  \par Limits:
+ *       This parameter is limited only by the maximum value of the
+ *       uint32 type.
+ */
+#define MM_MAX_PROCESSOR_CYCLE 1000
+
+/**
+ * \brief Segment time budget
+ *
+ *  \par Description:
+ *       Target number of microseconds for each load, dump or fill
+ *       segment. When non-zero, MM times every segment with the OS
+ *       clock and grows or shrinks the segment size of the operation
+ *       so a segment takes about this long. The load, dump and fill
+ *       segment sizes in use are reported in housekeeping telemetry.
+ *       A value of zero keeps the segment sizes fixed at
+ *       #MM_MAX_LOAD_DATA_SEG, #MM_MAX_DUMP_DATA_SEG and
+ *       #MM_MAX_FILL_DATA_SEG.
+ *
+ *  \par Limits:
+ *       This parameter cannot be larger than #MM_MAX_SEGMENT_TIME_BUDGET.
+ *       The segment sizes never exceed the maximums above, so those
+ *       should be raised to leave room to grow on fast memory when this
+ *       is enabled.
+ */
+#define MM_SEGMENT_TIME_BUDGET 0
+
+/**
+ * \brief Maximum segment time budget
+ *
+ *  \par Description:
+ *       Upper bound of the segment time budget in the configuration
+ *       table, see #MM_SEGMENT_TIME_BUDGET.
+ *
+ *  \par Limits:
+ *       This parameter is limited only by the maximum value of the
+ *       uint32 type.
+ */
+#define MM_MAX_SEGMENT_TIME_BUDGET 1000000
+
+/**
+ * \brief Bytes processed per scheduler wakeup
+ *
+ *  \par Description:
+ *       Number of bytes a load, dump or fill running on the child task
+ *       may process for each #MM_WAKEUP_MID message before it blocks
+ *       until the next one. This ties the MM CPU share to the scheduler
+ *       slot table. A value of zero disables pacing and the child task
+ *       yields for #MM_PROCESSOR_CYCLE between segments instead.
+ *
+ *  \par Limits:
+ *       This parameter is limited only by the maximum value of the
+ *       uint32 type. When non-zero it cannot be smaller than the
+ *       largest of the load, dump and fill segment sizes, since a whole
+ *       segment is always processed once it is started.
+ */
+#define MM_WAKEUP_BYTE_BUDGET 0
+
+/**
+ * \brief Scheduler wakeup timeout
+ *
+ *  \par Description:
+ *       Maximum number of milliseconds a paced load, dump or fill waits
+ *       for the next #MM_WAKEUP_MID message once its per-wakeup byte
+ *       budget is used up. The operation continues when the timeout
+ *       expires so it cannot stall if the wakeups stop.
+ *
+ *  \par Limits:
+ *       Must be greater than zero.
+ */
+#define MM_WAKEUP_TIMEOUT 1000
+
+/**
+ * \brief Scheduler wakeup semaphore name
+ *
+ *  \par Description:
+ *       Name of the binary semaphore given by the main task on each
+ *       #MM_WAKEUP_MID message.
+ *
+ *  \par Limits:
+ *       The string length (including string terminator) cannot exceed
+ *       #OS_MAX_API_NAME.  (limit is not verified)
+ */
+#define MM_WAKEUP_SEM_NAME "MM_WAKEUP_SEM"
+
+/**
+ * \brief Child task name
+ *
+ *  \par Description:
+ *       Name of the child task that processes the load from file, dump
+ *       to file and fill commands so the main task can keep answering
+ *       housekeeping requests while they are in progress.
+ *
+ *  \par Limits:
+ *       The string length (including string terminator) cannot exceed
+ *       #OS_MAX_API_NAME.  (limit is not verified)
+ */
+#define MM_CHILD_TASK_NAME "MM_CHILD_TASK"
+
+/**
+ * \brief Child task stack size
+ *
+ *  \par Description:
+ *       Stack size in bytes of the child task.
+ *
+ *  \par Limits:
+ *       The child task calls the same load, dump and fill routines the
+ *       main task used to call, so it needs about the same stack as the
+ *       main task. Must be greater than zero.
+ */
+#define MM_CHILD_TASK_STACK_SIZE 8192
+
+/**
+ * \brief Child task priority
+ *
+ *  \par Description:
+ *       Execution priority of the child task.
+ *
+ *  \par Limits:
+ *       Must be from 1 to 255. It should be a lower priority (larger
+ *       number) than the MM main task so that housekeeping requests
+ *       preempt a load, dump or fill in progress.
+ */
+#define MM_CHILD_TASK_PRIORITY 205
+
+/**
+ * \brief Child task semaphore name
+ *
+ *  \par Description:
+ *       Name of the counting semaphore the main task gives to wake up
+ *       the child task when a command is queued.
+ *
+ *  \par Limits:
+ *       The string length (including string terminator) cannot exceed
+ *       #OS_MAX_API_NAME.  (limit is not verified)
+ */
+#define MM_CHILD_SEM_NAME "MM_CHILD_SEM"
+
+/**
+ * \brief Child task state mutex name
+ *
+ *  \par Description:
+ *       Name of the mutex that serializes the child task state between
+ *       the main task, which marks the child task busy when it queues a
+ *       command, and the child task, which marks itself idle when done.
+ *
+ *  \par Limits:
+ *       The string length (including string terminator) cannot exceed
+ *       #OS_MAX_API_NAME.  (limit is not verified)
+ */
+#define MM_CHILD_MUTEX_NAME "MM_CHILD_MUT"
+
+/**
+ * \brief Configuration table name
+ *
+ *  \par Description:
+ *       Name the configuration table is registered with. Table
+ *       services prefixes it with the application name.
+ *
+ *       The configuration table holds the run time values of the load,
+ *       dump and fill size limits, the segment sizes,
+ *       #MM_PROCESSOR_CYCLE, #MM_SEGMENT_TIME_BUDGET and
+ *       #MM_WAKEUP_BYTE_BUDGET. The size limits and segment sizes in
+ *       this file are upper bounds for the table values, the others
+ *       are only defaults.
+ *
+ *  \par Limits:
+ *       The string length (including string terminator) cannot exceed
+ *       #CFE_MISSION_TBL_MAX_NAME_LENGTH.  (limit is not verified)
+ */
+#define MM_CONFIG_TBL_NAME "ConfigTbl"
+
+/**
+ * \brief Configuration table file name
+ *
+ *  \par Description:
+ *       Default file the configuration table is loaded from during
+ *       application initialization. If it can't be loaded MM uses the
+ *       compile time values of this file until a table load is
+ *       commanded.
+ *
+ *  \par Limits:
+ *       The string length (including string terminator) cannot exceed
+ *       #OS_MAX_PATH_LEN.  (limit is not verified)
+ */
+#define MM_CONFIG_TBL_FILENAME "/cf/mm_config.tbl"
+
 /**
  * \brief Mission specific version number for MM application
  *
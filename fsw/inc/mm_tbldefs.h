@@ -0,0 +1,81 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Memory Manager configuration table
+ *   structures.
+ */
+#ifndef MM_TBLDEFS_H
+#define MM_TBLDEFS_H
+
+/************************************************************************
+ * Includes
+ ************************************************************************/
+#include "common_types.h"
+
+/************************************************************************
+ * Type Definitions
+ ************************************************************************/
+
+/**
+ * \defgroup cfsmmtbldefs CFS Memory Manager Table Definitions
+ * \{
+ */
+
+/**
+ *  \brief Size limits for one memory type
+ *
+ *  A limit of zero rejects every command of that kind for the memory
+ *  type.
+ */
+typedef struct
+{
+    uint32 MaxLoadFileData; /**< \brief Maximum number of bytes for a file load */
+    uint32 MaxDumpFileData; /**< \brief Maximum number of bytes for a file dump */
+    uint32 MaxFillData;     /**< \brief Maximum number of bytes for a memory fill */
+} MM_MemTypeLimits_t;
+
+/**
+ *  \brief Configuration table
+ *
+ *  Run time values of the MM throughput parameters. Each value can't
+ *  exceed the mm_platform_cfg.h parameter of the same name, which
+ *  remains the upper bound the static buffers are sized for.
+ */
+typedef struct
+{
+    MM_MemTypeLimits_t Ram;    /**< \brief RAM limits, bounded by the MM_MAX_*_RAM parameters */
+    MM_MemTypeLimits_t Eeprom; /**< \brief EEPROM limits, bounded by the MM_MAX_*_EEPROM parameters */
+    MM_MemTypeLimits_t Mem32;  /**< \brief MEM32 limits, bounded by the MM_MAX_*_MEM32 parameters */
+    MM_MemTypeLimits_t Mem16;  /**< \brief MEM16 limits, bounded by the MM_MAX_*_MEM16 parameters */
+    MM_MemTypeLimits_t Mem8;   /**< \brief MEM8 limits, bounded by the MM_MAX_*_MEM8 parameters */
+
+    uint32 LoadDataSeg;       /**< \brief Maximum bytes per load segment, see #MM_MAX_LOAD_DATA_SEG */
+    uint32 DumpDataSeg;       /**< \brief Maximum bytes per dump segment, see #MM_MAX_DUMP_DATA_SEG */
+    uint32 FillDataSeg;       /**< \brief Maximum bytes per fill segment, see #MM_MAX_FILL_DATA_SEG */
+    uint32 ProcessorCycle;    /**< \brief Segment break delay in milliseconds, see #MM_PROCESSOR_CYCLE */
+    uint32 SegmentTimeBudget; /**< \brief Target microseconds per segment, see #MM_SEGMENT_TIME_BUDGET */
+    uint32 WakeupByteBudget;  /**< \brief Bytes processed per wakeup, see #MM_WAKEUP_BYTE_BUDGET */
+    uint32 MaxStagedLoad;     /**< \brief Largest staged load, 0 disables staging, see #MM_MAX_STAGED_LOAD */
+} MM_ConfigTbl_t;
+
+/**\}*/
+
+#endif
@@ -32,7 +32,12 @@
 #include "mm_msgids.h"
 #include "mm_load.h"
 #include "mm_dump.h"
+#include "mm_child.h"
+#include "mm_tbl.h"
 #include "mm_utils.h"
+#include "mm_crc.h"
+#include "mm_symidx.h"
+#include "mm_memtype.h"
 #include "mm_events.h"
 #include "mm_verify.h"
 #include "mm_version.h"
@@ -94,6 +99,9 @@ void MM_AppMain(void)
         {
             /* Process Software Bus message */
             MM_AppPipe(BufPtr);
+
+            /* Process commands held while a load, dump or fill was in progress */
+            MM_ProcessDeferredCmds();
         }
         else if (Status == CFE_SB_TIME_OUT)
         {
@@ -132,9 +140,12 @@ CFE_Status_t MM_AppInit(void)
     CFE_Status_t Status = CFE_SUCCESS;
 
     /*
-    ** MM doesn't use the critical data store and
-    ** doesn't need to identify power on vs. processor resets.
-    ** If this changes add it here as shown in the qq_app.c template
+    ** The only critical data store MM uses holds the load file
+    ** validation cache, registered by MM_LoadCacheInit below. After a
+    ** power on reset the CDS is new and the cache starts empty. After
+    ** a processor reset or an application restart the CDS already
+    ** exists and the cache is restored from it, so MM doesn't need to
+    ** ask which kind of reset occurred.
     */
 
     /*
@@ -148,6 +159,12 @@ CFE_Status_t MM_AppInit(void)
     MM_AppData.HkPacket.Payload.CmdCounter = 0;
     MM_AppData.HkPacket.Payload.ErrCounter = 0;
 
+    /*
+    ** No commands are held yet
+    */
+    MM_AppData.DeferredHead  = 0;
+    MM_AppData.DeferredCount = 0;
+
     /*
     ** Register for event services
     */
@@ -165,6 +182,33 @@ CFE_Status_t MM_AppInit(void)
     CFE_MSG_Init(CFE_MSG_PTR(MM_AppData.HkPacket.TelemetryHeader), CFE_SB_ValueToMsgId(MM_HK_TLM_MID),
                  sizeof(MM_HkPacket_t));
 
+    /*
+    ** Initialize the load, dump and fill statistics telemetry packet
+    */
+    CFE_MSG_Init(CFE_MSG_PTR(MM_AppData.StatsPacket.TelemetryHeader), CFE_SB_ValueToMsgId(MM_STATS_TLM_MID),
+                 sizeof(MM_StatsPacket_t));
+    MM_ResetStats();
+
+    /*
+    ** Build the CRC lookup tables before anything computes a CRC
+    */
+    MM_CrcInit();
+
+    /*
+    ** Create the symbol cache before the child task can resolve symbols
+    */
+    MM_SymCacheInit();
+
+    /*
+    ** Snapshot the PSP memory table before any command address is checked
+    */
+    MM_MemRangeInit();
+
+    /*
+    ** Fill the memory type driver table before any command is verified
+    */
+    MM_MemTypeInit();
+
     /*
     ** Create Software Bus message pipe
     */
@@ -199,20 +243,65 @@ CFE_Status_t MM_AppInit(void)
     }
 
     /*
-    ** MM doesn't use tables. If this changes add table registration
-    ** and initialization here as shown in the qq_app.c template
+    ** Subscribe to scheduler wakeup messages
     */
+    Status = CFE_SB_Subscribe(CFE_SB_ValueToMsgId(MM_WAKEUP_MID), MM_AppData.CmdPipe);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(MM_WAKEUP_SUB_ERR_EID, CFE_EVS_EventType_ERROR, "Error Subscribing to Wakeup, RC = 0x%08X",
+                          (unsigned int)Status);
+        return Status;
+    }
 
     /*
-    ** MM doesn't use the critical data store. If this changes add CDS
-    ** creation here as shown in the qq_app.c template
+    ** Restore the load file validation cache from the critical data
+    ** store. Failure is not fatal, the cache then starts empty.
     */
+    MM_LoadCacheInit();
 
     /*
     ** Initialize MM housekeeping information
     */
     MM_ResetHk();
 
+    /*
+    ** Load the run time limits and segment parameters
+    */
+    Status = MM_TableInit();
+    if (Status != CFE_SUCCESS)
+    {
+        return Status;
+    }
+
+    /*
+    ** Segments start at their maximum size and only adapt when a
+    ** segment time budget is configured
+    */
+    MM_AppData.SegmentSize[MM_SEG_LOAD] = MM_SegmentMaxSize(MM_SEG_LOAD);
+    MM_AppData.SegmentSize[MM_SEG_DUMP] = MM_SegmentMaxSize(MM_SEG_DUMP);
+    MM_AppData.SegmentSize[MM_SEG_FILL] = MM_SegmentMaxSize(MM_SEG_FILL);
+    MM_AppData.SegmentSize[MM_SEG_COPY] = MM_SegmentMaxSize(MM_SEG_COPY);
+    MM_AppData.SegmentSize[MM_SEG_CRC]  = MM_SegmentMaxSize(MM_SEG_CRC);
+
+    /*
+    ** Create the pool that load files are staged in. Failure is not
+    ** fatal, load files are then read twice instead of once.
+    */
+    Status = CFE_ES_PoolCreate(&MM_AppData.StagingPoolHandle, MM_AppData.StagingPool.Data,
+                               sizeof(MM_AppData.StagingPool));
+    if (Status != CFE_SUCCESS)
+    {
+        MM_AppData.StagingPoolHandle = CFE_ES_MEMHANDLE_UNDEFINED;
+        CFE_EVS_SendEvent(MM_STAGING_POOL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error Creating Load Staging Pool, RC = 0x%08X", (unsigned int)Status);
+    }
+
+    /*
+    ** Start the child task that processes load, dump and fill commands.
+    ** Failure is not fatal, those commands are then processed here.
+    */
+    MM_ChildInit();
+
     /*
     ** Application startup event message
     */
@@ -248,11 +337,28 @@ void MM_AppPipe(const CFE_SB_Buffer_t *BufPtr)
             }
             break;
 
+        /*
+        ** Scheduler wakeup
+        */
+        case MM_WAKEUP_MID:
+            if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_NoArgsCmd_t)))
+            {
+                MM_WakeupCmd(BufPtr);
+            }
+            break;
+
         /*
         ** MM ground commands
         */
         case MM_CMD_MID:
-            MM_ResetHk(); /* Clear all "Last Action" data */
+            /*
+            ** Clear all "Last Action" data, unless the child task is
+            ** still working on a command and will report its own
+            */
+            if (MM_ChildGetState() != MM_CHILD_BUSY)
+            {
+                MM_ResetHk();
+            }
 
             CFE_MSG_GetFcnCode(&BufPtr->Msg, &CommandCode);
             switch (CommandCode)
@@ -271,22 +377,26 @@ void MM_AppPipe(const CFE_SB_Buffer_t *BufPtr)
                     }
                     break;
 
+                /*
+                ** These write the last action data the child task reports
+                ** its results in, so they wait for it to finish
+                */
                 case MM_PEEK_CC:
-                    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_PeekCmd_t)))
+                    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_PeekCmd_t)) && MM_ChildVerifyIdle(CommandCode))
                     {
                         CmdResult = MM_PeekCmd(BufPtr);
                     }
                     break;
 
                 case MM_POKE_CC:
-                    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_PokeCmd_t)))
+                    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_PokeCmd_t)) && MM_ChildVerifyIdle(CommandCode))
                     {
                         CmdResult = MM_PokeCmd(BufPtr);
                     }
                     break;
 
                 case MM_LOAD_MEM_WID_CC:
-                    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_LoadMemWIDCmd_t)))
+                    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_LoadMemWIDCmd_t)) && MM_ChildVerifyIdle(CommandCode))
                     {
                         CmdResult = MM_LoadMemWIDCmd(BufPtr);
                     }
@@ -295,19 +405,55 @@ void MM_AppPipe(const CFE_SB_Buffer_t *BufPtr)
                 case MM_LOAD_MEM_FROM_FILE_CC:
                     if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_LoadMemFromFileCmd_t)))
                     {
-                        CmdResult = MM_LoadMemFromFileCmd(BufPtr);
+                        CmdResult = MM_ChildDispatchCmd(BufPtr, CommandCode, sizeof(MM_LoadMemFromFileCmd_t));
                     }
                     break;
 
                 case MM_DUMP_MEM_TO_FILE_CC:
                     if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_DumpMemToFileCmd_t)))
                     {
-                        CmdResult = MM_DumpMemToFileCmd(BufPtr);
+                        CmdResult = MM_ChildDispatchCmd(BufPtr, CommandCode, sizeof(MM_DumpMemToFileCmd_t));
+                    }
+                    break;
+
+                case MM_DUMP_MEM_TO_FILE_ENC_CC:
+                    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_DumpMemToFileEncCmd_t)))
+                    {
+                        CmdResult = MM_ChildDispatchCmd(BufPtr, CommandCode, sizeof(MM_DumpMemToFileEncCmd_t));
+                    }
+                    break;
+
+                case MM_DUMP_MEM_TO_DELTA_FILE_CC:
+                    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_DumpMemToDeltaFileCmd_t)))
+                    {
+                        CmdResult = MM_ChildDispatchCmd(BufPtr, CommandCode, sizeof(MM_DumpMemToDeltaFileCmd_t));
+                    }
+                    break;
+
+                case MM_LOAD_MEM_FROM_PATCH_FILE_CC:
+                    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_LoadMemFromPatchFileCmd_t)))
+                    {
+                        CmdResult = MM_ChildDispatchCmd(BufPtr, CommandCode, sizeof(MM_LoadMemFromPatchFileCmd_t));
+                    }
+                    break;
+
+                case MM_LOAD_MEM_FROM_MULTI_FILE_CC:
+                    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_LoadMemFromMultiFileCmd_t)))
+                    {
+                        CmdResult = MM_ChildDispatchCmd(BufPtr, CommandCode, sizeof(MM_LoadMemFromMultiFileCmd_t));
+                    }
+                    break;
+
+                case MM_DUMP_MEM_TO_MULTI_FILE_CC:
+                    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_DumpMemToMultiFileCmd_t)))
+                    {
+                        CmdResult = MM_ChildDispatchCmd(BufPtr, CommandCode, sizeof(MM_DumpMemToMultiFileCmd_t));
                     }
                     break;
 
                 case MM_DUMP_IN_EVENT_CC:
-                    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_DumpInEventCmd_t)))
+                    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_DumpInEventCmd_t)) &&
+                        MM_ChildVerifyIdle(CommandCode))
                     {
                         CmdResult = MM_DumpInEventCmd(BufPtr);
                     }
@@ -316,7 +462,21 @@ void MM_AppPipe(const CFE_SB_Buffer_t *BufPtr)
                 case MM_FILL_MEM_CC:
                     if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_FillMemCmd_t)))
                     {
-                        CmdResult = MM_FillMemCmd(BufPtr);
+                        CmdResult = MM_ChildDispatchCmd(BufPtr, CommandCode, sizeof(MM_FillMemCmd_t));
+                    }
+                    break;
+
+                case MM_COPY_MEM_CC:
+                    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_CopyMemCmd_t)))
+                    {
+                        CmdResult = MM_ChildDispatchCmd(BufPtr, CommandCode, sizeof(MM_CopyMemCmd_t));
+                    }
+                    break;
+
+                case MM_CRC_MEM_CC:
+                    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_CrcMemCmd_t)))
+                    {
+                        CmdResult = MM_ChildDispatchCmd(BufPtr, CommandCode, sizeof(MM_CrcMemCmd_t));
                     }
                     break;
 
@@ -334,6 +494,34 @@ void MM_AppPipe(const CFE_SB_Buffer_t *BufPtr)
                     }
                     break;
 
+                case MM_SYM_CACHE_FLUSH_CC:
+                    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_NoArgsCmd_t)))
+                    {
+                        CmdResult = MM_SymCacheFlushCmd(BufPtr);
+                    }
+                    break;
+
+                case MM_MEM_RANGE_REFRESH_CC:
+                    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_NoArgsCmd_t)))
+                    {
+                        CmdResult = MM_MemRangeRefreshCmd(BufPtr);
+                    }
+                    break;
+
+                case MM_LOOKUP_ADDR_CC:
+                    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_LookupAddrCmd_t)))
+                    {
+                        CmdResult = MM_LookupAddrCmd(BufPtr);
+                    }
+                    break;
+
+                case MM_LOOKUP_SYM_FILE_CC:
+                    if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_LookupSymFileCmd_t)))
+                    {
+                        CmdResult = MM_ChildDispatchCmd(BufPtr, CommandCode, sizeof(MM_LookupSymFileCmd_t));
+                    }
+                    break;
+
                 case MM_ENABLE_EEPROM_WRITE_CC:
                     if (MM_VerifyCmdLength(&BufPtr->Msg, sizeof(MM_EepromWriteEnaCmd_t)))
                     {
@@ -388,17 +576,126 @@ void MM_AppPipe(const CFE_SB_Buffer_t *BufPtr)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void MM_HousekeepingCmd(const CFE_SB_Buffer_t *BufPtr)
 {
+    /*
+    ** Pick up a configuration table update
+    */
+    MM_TableManage();
+
+    /*
+    ** Report the segment sizes in use and the last achieved throughput
+    */
+    MM_AppData.HkPacket.Payload.LoadSegSize = MM_AppData.SegmentSize[MM_SEG_LOAD];
+    MM_AppData.HkPacket.Payload.DumpSegSize = MM_AppData.SegmentSize[MM_SEG_DUMP];
+    MM_AppData.HkPacket.Payload.FillSegSize = MM_AppData.SegmentSize[MM_SEG_FILL];
+    MM_AppData.HkPacket.Payload.Throughput  = MM_AppData.Throughput;
+
+    /*
+    ** Report the commands held until the operation in progress completes
+    */
+    MM_AppData.HkPacket.Payload.DeferredCmds = MM_AppData.DeferredCount;
+
     /*
     ** Send housekeeping telemetry packet
     */
     CFE_SB_TimeStampMsg(CFE_MSG_PTR(MM_AppData.HkPacket.TelemetryHeader));
     CFE_SB_TransmitMsg(CFE_MSG_PTR(MM_AppData.HkPacket.TelemetryHeader), true);
 
+    /*
+    ** Send load, dump and fill statistics telemetry packet, whole, while
+    ** the child task may be completing an operation
+    */
+    MM_ChildLock();
+    CFE_SB_TimeStampMsg(CFE_MSG_PTR(MM_AppData.StatsPacket.TelemetryHeader));
+    CFE_SB_TransmitMsg(CFE_MSG_PTR(MM_AppData.StatsPacket.TelemetryHeader), true);
+    MM_ChildUnlock();
+
+    /*
+    ** This command does not affect the command execution counter
+    */
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Scheduler wakeup                                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_WakeupCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    /*
+    ** Open a new slice for the child task, count first so a child
+    ** task woken by the give sees the new slice. The child task reads
+    ** the count while pacing an operation.
+    */
+    MM_ChildLock();
+    MM_AppData.WakeupCount++;
+    MM_ChildUnlock();
+
+    if (OS_ObjectIdDefined(MM_AppData.WakeupSemaphore))
+    {
+        OS_BinSemGive(MM_AppData.WakeupSemaphore);
+    }
+
     /*
     ** This command does not affect the command execution counter
     */
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Hold a command until the operation in progress completes        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_DeferCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    CFE_SB_MsgId_t MessageID = CFE_SB_INVALID_MSG_ID;
+    CFE_MSG_Size_t MsgSize   = 0;
+    uint32         Slot;
+
+    CFE_MSG_GetMsgId(&BufPtr->Msg, &MessageID);
+    CFE_MSG_GetSize(&BufPtr->Msg, &MsgSize);
+
+    if (MM_AppData.DeferredCount >= MM_DEFERRED_CMD_DEPTH)
+    {
+        MM_AppData.HkPacket.Payload.ErrCounter++;
+        CFE_EVS_SendEvent(MM_DEFER_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Command rejected during load, dump or fill: %d commands held, ID = 0x%08lX",
+                          MM_DEFERRED_CMD_DEPTH, (unsigned long)CFE_SB_MsgIdToValue(MessageID));
+    }
+    else if (MsgSize > sizeof(MM_DeferredCmdBuf_t))
+    {
+        MM_AppData.HkPacket.Payload.ErrCounter++;
+        CFE_EVS_SendEvent(MM_DEFER_CMD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Command rejected during load, dump or fill: Len = %u too large, ID = 0x%08lX",
+                          (unsigned int)MsgSize, (unsigned long)CFE_SB_MsgIdToValue(MessageID));
+    }
+    else
+    {
+        Slot = (MM_AppData.DeferredHead + MM_AppData.DeferredCount) % MM_DEFERRED_CMD_DEPTH;
+        memcpy(&MM_AppData.DeferredCmds[Slot], BufPtr, MsgSize);
+        MM_AppData.DeferredCount++;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Process the deferred commands                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_ProcessDeferredCmds(void)
+{
+    while (MM_AppData.DeferredCount != 0)
+    {
+        /*
+        ** A held load, dump or fill may hold more commands while it runs,
+        ** so its slot is only released once it completes
+        */
+        MM_AppPipe(&MM_AppData.DeferredCmds[MM_AppData.DeferredHead].Buf);
+
+        MM_AppData.DeferredHead = (MM_AppData.DeferredHead + 1) % MM_DEFERRED_CMD_DEPTH;
+        MM_AppData.DeferredCount--;
+    }
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Noop command                                                    */
@@ -428,6 +725,14 @@ bool MM_ResetCmd(const CFE_SB_Buffer_t *BufPtr)
     MM_AppData.HkPacket.Payload.CmdCounter = 0;
     MM_AppData.HkPacket.Payload.ErrCounter = 0;
 
+    MM_AppData.HkPacket.Payload.ChildCmdCounter = 0;
+    MM_AppData.HkPacket.Payload.ChildErrCounter = 0;
+
+    MM_AppData.HkPacket.Payload.SymCacheHits   = 0;
+    MM_AppData.HkPacket.Payload.SymCacheMisses = 0;
+
+    MM_ResetStats();
+
     CFE_EVS_SendEvent(MM_RESET_INF_EID, CFE_EVS_EventType_INFORMATION, "Reset counters command received");
     Result = true;
 
@@ -525,6 +830,9 @@ bool MM_SymTblToFileCmd(const CFE_SB_Buffer_t *BufPtr)
             CFE_EVS_SendEvent(MM_SYMTBL_TO_FILE_INF_EID, CFE_EVS_EventType_INFORMATION,
                               "Symbol Table Dump to File Started: Name = '%s'", FileName);
             Result = true;
+
+            /* A failed rebuild empties the reverse symbol index but doesn't fail the dump */
+            MM_SymIndexBuild(FileName);
         }
         else
         {
@@ -612,3 +920,315 @@ bool MM_EepromWriteDisCmd(const CFE_SB_Buffer_t *BufPtr)
 
     return Result;
 }
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Flush symbol cache command                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_SymCacheFlushCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    MM_SymCacheFlush();
+
+    MM_AppData.HkPacket.Payload.LastAction = MM_SYM_CACHE_FLUSH;
+
+    CFE_EVS_SendEvent(MM_SYM_CACHE_FLUSH_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "Symbol cache flushed: Hits = %u Misses = %u",
+                      (unsigned int)MM_AppData.HkPacket.Payload.SymCacheHits,
+                      (unsigned int)MM_AppData.HkPacket.Payload.SymCacheMisses);
+
+    return true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Refresh memory range map command                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_MemRangeRefreshCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    bool Valid;
+
+    Valid = MM_MemRangeRefresh();
+
+    if (Valid == true)
+    {
+        MM_AppData.HkPacket.Payload.LastAction = MM_RANGE_REFRESH;
+
+        CFE_EVS_SendEvent(MM_MEM_RANGE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Memory range map refreshed: RAM ranges = %u EEPROM ranges = %u",
+                          (unsigned int)MM_AppData.MemRangeCount[MM_MEM_RANGE_RAM],
+                          (unsigned int)MM_AppData.MemRangeCount[MM_MEM_RANGE_EEPROM]);
+    }
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Lookup address command                                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_LookupAddrCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    const MM_LookupAddrCmd_t *CmdPtr  = NULL;
+    cpuaddr                   Address = 0;
+    cpuaddr                   Offset  = 0;
+    const char *              SymName = NULL;
+    bool                      Result  = false;
+    MM_SymAddr_t              SymAddress;
+
+    CmdPtr = ((MM_LookupAddrCmd_t *)BufPtr);
+
+    SymAddress = CmdPtr->Payload.SymAddress;
+
+    if (MM_ResolveSymAddr(&SymAddress, &Address) == false)
+    {
+        CFE_EVS_SendEvent(MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Symbolic address can't be resolved: Name = '%s'", SymAddress.SymName);
+    }
+    else if (MM_SymIndexLookup(Address, &SymName, &Offset) == false)
+    {
+        CFE_EVS_SendEvent(MM_ADDR_LOOKUP_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Address not in the reverse symbol index: Addr = %p Symbols = %u", (void *)Address,
+                          (unsigned int)MM_AppData.SymIndexCount);
+    }
+    else
+    {
+        /* Update telemetry */
+        MM_AppData.HkPacket.Payload.LastAction = MM_ADDR_LOOKUP;
+        MM_AppData.HkPacket.Payload.Address    = Address;
+        MM_AppData.HkPacket.Payload.DataValue  = (uint32)Offset;
+
+        CFE_EVS_SendEvent(MM_ADDR_LOOKUP_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Address Lookup Command: Addr = %p Symbol = '%s' Offset = 0x%lX", (void *)Address, SymName,
+                          (unsigned long)Offset);
+        Result = true;
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Lookup symbols from file command                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_LookupSymFileCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    const MM_LookupSymFileCmd_t *CmdPtr    = ((MM_LookupSymFileCmd_t *)BufPtr);
+    bool                         Valid     = false;
+    int32                        OS_Status = OS_ERROR;
+    osal_id_t                    InHandle  = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t                    OutHandle = OS_OBJECT_ID_UNDEFINED;
+    char                         InName[OS_MAX_PATH_LEN];
+    char                         OutName[OS_MAX_PATH_LEN];
+    CFE_FS_Header_t              CFEHeader;
+    MM_SymLookupFileHeader_t     FileHeader;
+
+    /* Make sure strings are null terminated before attempting to process them */
+    CFE_SB_MessageStringGet(InName, CmdPtr->Payload.InFileName, NULL, sizeof(InName),
+                            sizeof(CmdPtr->Payload.InFileName));
+    CFE_SB_MessageStringGet(OutName, CmdPtr->Payload.OutFileName, NULL, sizeof(OutName),
+                            sizeof(CmdPtr->Payload.OutFileName));
+
+    OS_Status = OS_OpenCreate(&InHandle, InName, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+    if (OS_Status == OS_SUCCESS)
+    {
+        OS_Status = CFE_FS_ReadHeader(&CFEHeader, InHandle);
+        if (OS_Status != sizeof(CFE_FS_Header_t))
+        {
+            CFE_EVS_SendEvent(MM_CFE_FS_READHDR_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "CFE_FS_ReadHeader error received: RC = 0x%08X Expected = %u File = '%s'",
+                              (unsigned int)OS_Status, (unsigned int)sizeof(CFE_FS_Header_t), InName);
+        }
+        else
+        {
+            OS_Status = OS_read(InHandle, &FileHeader, sizeof(FileHeader));
+            if (OS_Status != sizeof(FileHeader))
+            {
+                CFE_EVS_SendEvent(MM_OS_READ_EXP_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "OS_read error received: RC = 0x%08X Expected = %u File = '%s'",
+                                  (unsigned int)OS_Status, (unsigned int)sizeof(FileHeader), InName);
+            }
+            else if ((FileHeader.NumOfSymbols == 0) || (FileHeader.NumOfSymbols > MM_MAX_SYM_LOOKUP_RECORDS))
+            {
+                CFE_EVS_SendEvent(MM_SYM_LOOKUP_FILE_COUNT_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Symbol lookup file count error: Symbols = %u Max = %u File = '%s'",
+                                  (unsigned int)FileHeader.NumOfSymbols, (unsigned int)MM_MAX_SYM_LOOKUP_RECORDS,
+                                  InName);
+            }
+            else
+            {
+                Valid = true;
+            }
+        }
+
+        if (Valid == true)
+        {
+            OS_Status =
+                OS_OpenCreate(&OutHandle, OutName, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+            if (OS_Status == OS_SUCCESS)
+            {
+                Valid = MM_LookupSymFile(InHandle, InName, OutHandle, OutName, &FileHeader);
+
+                OS_Status = OS_close(OutHandle);
+                if (OS_Status != OS_SUCCESS)
+                {
+                    Valid = false;
+                    CFE_EVS_SendEvent(MM_OS_CLOSE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "OS_close error received: RC = 0x%08X File = '%s'", (unsigned int)OS_Status,
+                                      OutName);
+                }
+            }
+            else
+            {
+                Valid = false;
+                CFE_EVS_SendEvent(MM_OS_CREAT_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "OS_OpenCreate error received: RC = %d File = '%s'", (int)OS_Status, OutName);
+            }
+        }
+
+        OS_close(InHandle);
+    }
+    else
+    {
+        CFE_EVS_SendEvent(MM_OS_OPEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "OS_OpenCreate error received: RC = %d File = '%s'", (int)OS_Status, InName);
+    }
+
+    if (Valid == true)
+    {
+        /* Update telemetry */
+        MM_AppData.HkPacket.Payload.LastAction     = MM_SYM_LOOKUP;
+        MM_AppData.HkPacket.Payload.DataValue      = FileHeader.NumResolved;
+        MM_AppData.HkPacket.Payload.BytesProcessed = FileHeader.NumOfSymbols;
+        snprintf(MM_AppData.HkPacket.Payload.FileName, OS_MAX_PATH_LEN, "%s", OutName);
+
+        CFE_EVS_SendEvent(MM_SYM_LOOKUP_FILE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Symbol Lookup File Command: %u of %u symbols resolved, results in '%s'",
+                          (unsigned int)FileHeader.NumResolved, (unsigned int)FileHeader.NumOfSymbols, OutName);
+    }
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Resolve the symbols of a lookup file                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_LookupSymFile(osal_id_t InHandle, const char *InName, osal_id_t OutHandle, const char *OutName,
+                      MM_SymLookupFileHeader_t *FileHeader)
+{
+    MM_SymLookupRecord_t *Records          = (MM_SymLookupRecord_t *)MM_AppData.IoBuffer;
+    uint32                RecordsPerBuffer = MM_IO_BUFFER_SIZE / sizeof(MM_SymLookupRecord_t);
+    uint32                SymbolsRemaining = FileHeader->NumOfSymbols;
+    uint32                NumOfRecords     = 0;
+    uint32                i;
+    int32                 OS_Status;
+    int32                 Length;
+    bool                  Valid = true;
+    CFE_FS_Header_t       CFEHeader;
+    MM_SymAddr_t          SymAddress;
+
+    CFE_FS_InitHeader(&CFEHeader, MM_CFE_HDR_DESCRIPTION, MM_CFE_HDR_SUBTYPE);
+
+    /* Written twice, the resolved count is only known at the end */
+    FileHeader->NumResolved = 0;
+    Valid                   = MM_WriteSymLookupHeaders(OutName, OutHandle, &CFEHeader, FileHeader);
+
+    while ((Valid == true) && (SymbolsRemaining > 0))
+    {
+        NumOfRecords = (SymbolsRemaining < RecordsPerBuffer) ? SymbolsRemaining : RecordsPerBuffer;
+        Length       = NumOfRecords * sizeof(MM_SymLookupRecord_t);
+
+        OS_Status = OS_read(InHandle, Records, Length);
+        if (OS_Status != Length)
+        {
+            Valid = false;
+            CFE_EVS_SendEvent(MM_OS_READ_EXP_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "OS_read error received: RC = 0x%08X Expected = %u File = '%s'", (unsigned int)OS_Status,
+                              (unsigned int)Length, InName);
+        }
+        else
+        {
+            for (i = 0; i < NumOfRecords; i++)
+            {
+                /* Resolved the same way as an address argument, without an offset */
+                memset(&SymAddress, 0, sizeof(SymAddress));
+                memcpy(SymAddress.SymName, Records[i].SymName, sizeof(SymAddress.SymName));
+                SymAddress.SymName[OS_MAX_SYM_LEN - 1] = '\0';
+
+                memcpy(Records[i].SymName, SymAddress.SymName, sizeof(Records[i].SymName));
+                Records[i].Address  = 0;
+                Records[i].Resolved = 0;
+                Records[i].Spare    = 0;
+
+                /* An empty name would resolve to address 0, it is reported unresolved instead */
+                if ((OS_strnlen(SymAddress.SymName, OS_MAX_SYM_LEN) != 0) &&
+                    (MM_ResolveSymAddr(&SymAddress, &Records[i].Address) == true))
+                {
+                    Records[i].Resolved = 1;
+                    FileHeader->NumResolved++;
+                }
+                else
+                {
+                    Records[i].Address = 0;
+                }
+            }
+
+            OS_Status = OS_write(OutHandle, Records, Length);
+            if (OS_Status != Length)
+            {
+                Valid = false;
+                CFE_EVS_SendEvent(MM_OS_WRITE_EXP_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "OS_write error received: RC = %d Expected = %u File = '%s'", (int)OS_Status,
+                                  (unsigned int)Length, OutName);
+            }
+
+            SymbolsRemaining -= NumOfRecords;
+        }
+    }
+
+    if (Valid == true)
+    {
+        Valid = MM_WriteSymLookupHeaders(OutName, OutHandle, &CFEHeader, FileHeader);
+    }
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write the headers of a symbol lookup result file                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_WriteSymLookupHeaders(const char *FileName, osal_id_t FileHandle, CFE_FS_Header_t *CFEHeader,
+                              const MM_SymLookupFileHeader_t *FileHeader)
+{
+    bool  Valid = true;
+    int32 OS_Status;
+
+    OS_Status = CFE_FS_WriteHeader(FileHandle, CFEHeader);
+    if (OS_Status != sizeof(CFE_FS_Header_t))
+    {
+        Valid = false;
+        CFE_EVS_SendEvent(MM_CFE_FS_WRITEHDR_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "CFE_FS_WriteHeader error received: RC = %d Expected = %d File = '%s'", (int)OS_Status,
+                          (int)sizeof(CFE_FS_Header_t), FileName);
+    }
+    else
+    {
+        OS_Status = OS_write(FileHandle, FileHeader, sizeof(MM_SymLookupFileHeader_t));
+        if (OS_Status != sizeof(MM_SymLookupFileHeader_t))
+        {
+            Valid = false;
+            CFE_EVS_SendEvent(MM_OS_WRITE_EXP_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "OS_write error received: RC = %d Expected = %u File = '%s'", (int)OS_Status,
+                              (unsigned int)sizeof(MM_SymLookupFileHeader_t), FileName);
+        }
+    }
+
+    return Valid;
+}
@@ -29,6 +29,9 @@
  * Includes
  ************************************************************************/
 #include "mm_msg.h"
+#include "mm_filedefs.h"
+#include "mm_tbldefs.h"
+#include "mm_memtype.h"
 #include "cfe.h"
 
 /************************************************************************
@@ -49,8 +52,6 @@
 #define MM_VERIFY_WID   4 /**< \brief Verify write interrupts disabled parameters */
 /**\}*/
 
-#define MM_MAX_MEM_TYPE_STR_LEN 11 /**< \brief Maximum memory type string length */
-
 /**
  * \brief Wakeup for MM
  *
@@ -60,24 +61,231 @@
  */
 #define MM_SB_TIMEOUT 1000
 
+/**
+ * \name Segmented operation types
+ * \{
+ */
+#define MM_SEG_LOAD      0 /**< \brief Load from file segments */
+#define MM_SEG_DUMP      1 /**< \brief Dump to file segments */
+#define MM_SEG_FILL      2 /**< \brief Fill memory segments */
+#define MM_SEG_COPY      3 /**< \brief Copy memory segments */
+#define MM_SEG_CRC       4 /**< \brief CRC memory segments */
+#define MM_SEG_NUM_TYPES 5 /**< \brief Number of segmented operation types */
+/**\}*/
+
+/**
+ * \brief Smallest adaptive segment size
+ *
+ * Adaptive segment sizes are kept a multiple of this so 16 and 32 bit
+ * wide memory is always accessed whole.
+ */
+#define MM_MIN_DATA_SEG 4
+
+/**
+ * \brief Largest RAM or EEPROM delta dump
+ */
+#define MM_DELTA_MAX_DATA                                                                   \
+    ((MM_MAX_DUMP_FILE_DATA_RAM > MM_MAX_DUMP_FILE_DATA_EEPROM) ? MM_MAX_DUMP_FILE_DATA_RAM \
+                                                                : MM_MAX_DUMP_FILE_DATA_EEPROM)
+
+/**
+ * \brief Delta dump block map size
+ *
+ * One bit for each #MM_DELTA_BLOCK_SIZE block of the largest delta dump.
+ */
+#define MM_DELTA_MAP_SIZE ((((MM_DELTA_MAX_DATA + MM_DELTA_BLOCK_SIZE - 1) / MM_DELTA_BLOCK_SIZE) + 7) / 8)
+
 /************************************************************************
  * Type Definitions
  ************************************************************************/
 
+/**
+ *  \brief Child task command buffer
+ *
+ *  Large enough to hold any of the commands processed by the child task.
+ */
+typedef union
+{
+    CFE_SB_Buffer_t              Buf;                     /**< \brief Software Bus buffer view */
+    MM_LoadMemFromFileCmd_t      LoadMemFromFileCmd;      /**< \brief Load memory from file command */
+    MM_LoadMemFromPatchFileCmd_t LoadMemFromPatchFileCmd; /**< \brief Load memory from patch file command */
+    MM_LoadMemFromMultiFileCmd_t LoadMemFromMultiFileCmd; /**< \brief Load memory from multi-region file command */
+    MM_DumpMemToFileCmd_t        DumpMemToFileCmd;        /**< \brief Dump memory to file command */
+    MM_DumpMemToFileEncCmd_t     DumpMemToFileEncCmd;     /**< \brief Dump memory to encoded file command */
+    MM_DumpMemToDeltaFileCmd_t   DumpMemToDeltaFileCmd;   /**< \brief Dump memory to delta file command */
+    MM_DumpMemToMultiFileCmd_t   DumpMemToMultiFileCmd;   /**< \brief Dump memory to multi-region file command */
+    MM_FillMemCmd_t              FillMemCmd;              /**< \brief Fill memory command */
+    MM_CopyMemCmd_t              CopyMemCmd;              /**< \brief Copy memory command */
+    MM_CrcMemCmd_t               CrcMemCmd;               /**< \brief CRC memory command */
+    MM_LookupSymFileCmd_t        LookupSymFileCmd;        /**< \brief Lookup symbols from file command */
+} MM_ChildCmdBuf_t;
+
+/**
+ *  \brief Deferred command buffer
+ *
+ *  Large enough to hold any MM command.
+ */
+typedef union
+{
+    CFE_SB_Buffer_t              Buf;                     /**< \brief Software Bus buffer view */
+    MM_NoArgsCmd_t               NoArgsCmd;               /**< \brief No arguments command */
+    MM_PeekCmd_t                 PeekCmd;                 /**< \brief Memory peek command */
+    MM_PokeCmd_t                 PokeCmd;                 /**< \brief Memory poke command */
+    MM_LoadMemWIDCmd_t           LoadMemWIDCmd;           /**< \brief Load memory with interrupts disabled command */
+    MM_DumpInEventCmd_t          DumpInEventCmd;          /**< \brief Dump memory in event message command */
+    MM_LoadMemFromFileCmd_t      LoadMemFromFileCmd;      /**< \brief Load memory from file command */
+    MM_LoadMemFromPatchFileCmd_t LoadMemFromPatchFileCmd; /**< \brief Load memory from patch file command */
+    MM_LoadMemFromMultiFileCmd_t LoadMemFromMultiFileCmd; /**< \brief Load memory from multi-region file command */
+    MM_DumpMemToFileCmd_t        DumpMemToFileCmd;        /**< \brief Dump memory to file command */
+    MM_DumpMemToFileEncCmd_t     DumpMemToFileEncCmd;     /**< \brief Dump memory to encoded file command */
+    MM_DumpMemToDeltaFileCmd_t   DumpMemToDeltaFileCmd;   /**< \brief Dump memory to delta file command */
+    MM_DumpMemToMultiFileCmd_t   DumpMemToMultiFileCmd;   /**< \brief Dump memory to multi-region file command */
+    MM_FillMemCmd_t              FillMemCmd;              /**< \brief Fill memory command */
+    MM_CopyMemCmd_t              CopyMemCmd;              /**< \brief Copy memory command */
+    MM_CrcMemCmd_t               CrcMemCmd;               /**< \brief CRC memory command */
+    MM_LookupSymCmd_t            LookupSymCmd;            /**< \brief Lookup symbol command */
+    MM_SymTblToFileCmd_t         SymTblToFileCmd;         /**< \brief Dump symbol table to file command */
+    MM_LookupAddrCmd_t           LookupAddrCmd;           /**< \brief Lookup address command */
+    MM_LookupSymFileCmd_t        LookupSymFileCmd;        /**< \brief Lookup symbols from file command */
+    MM_EepromWriteEnaCmd_t       EepromWriteEnaCmd;       /**< \brief EEPROM write enable command */
+    MM_EepromWriteDisCmd_t       EepromWriteDisCmd;       /**< \brief EEPROM write disable command */
+} MM_DeferredCmdBuf_t;
+
+/**
+ *  \brief Load file validation cache entry
+ *
+ *  A load file that passed its header, size and CRC checks, and the
+ *  file system key it had when it was checked.
+ */
+typedef struct
+{
+    char                    FileName[OS_MAX_PATH_LEN]; /**< \brief Path of the load file */
+    uint32                  FileSize;                  /**< \brief File size reported by OS_stat */
+    int32                   FileTime;                  /**< \brief Modification time reported by OS_stat */
+    MM_LoadDumpFileHeader_t Header;                    /**< \brief Verified MM file header, including the CRC */
+    bool                    InUse;                     /**< \brief Entry holds a verified file */
+    uint8                   Spare[3];                  /**< \brief Structure padding */
+} MM_LoadCacheEntry_t;
+
+/**
+ *  \brief Load file validation cache
+ *
+ *  Kept in the critical data store so it survives resets.
+ */
+typedef struct
+{
+    MM_LoadCacheEntry_t Entries[MM_LOAD_CACHE_ENTRIES]; /**< \brief Cached load files */
+    uint32              NextEntry;                      /**< \brief Entry replaced by the next new file */
+} MM_LoadCache_t;
+
+/**
+ *  \brief Symbol cache entry
+ */
+typedef struct
+{
+    char    SymName[OS_MAX_SYM_LEN]; /**< \brief Symbol name, empty if the entry is unused */
+    cpuaddr Address;                 /**< \brief Address the OSAL resolved the symbol to */
+} MM_SymCacheEntry_t;
+
+/**
+ *  \brief Reverse symbol index entry
+ */
+typedef struct
+{
+    cpuaddr Address;    /**< \brief Symbol address */
+    uint32  NameOffset; /**< \brief Offset of the NUL terminated symbol name in the name pool */
+} MM_SymIndexEntry_t;
+
+/**
+ * \name Valid Memory Range Map Types
+ * \{
+ */
+#define MM_MEM_RANGE_RAM    0 /**< \brief Map of the #CFE_PSP_MEM_RAM ranges */
+#define MM_MEM_RANGE_EEPROM 1 /**< \brief Map of the #CFE_PSP_MEM_EEPROM ranges */
+#define MM_MEM_RANGE_TYPES  2 /**< \brief Number of valid memory range maps */
+/**\}*/
+
+/**
+ *  \brief Valid memory range map entry
+ */
+typedef struct
+{
+    cpuaddr StartAddr;   /**< \brief First address of the PSP memory range */
+    cpuaddr EndAddr;     /**< \brief Last address of the PSP memory range */
+    uint32  RangeNum;    /**< \brief PSP memory table index of the range */
+    uint32  MaxEndRange; /**< \brief Range number of MaxEndAddr */
+    cpuaddr MaxEndAddr;  /**< \brief Highest EndAddr of this and every lower entry */
+} MM_MemRangeEntry_t;
+
 /**
  *  \brief MM global data structure
  */
 typedef struct
 {
-    MM_HkPacket_t HkPacket; /**< \brief Housekeeping telemetry packet */
+    MM_HkPacket_t    HkPacket;    /**< \brief Housekeeping telemetry packet */
+    MM_StatsPacket_t StatsPacket; /**< \brief Segmented operation statistics telemetry packet */
 
     CFE_SB_PipeId_t CmdPipe; /**< \brief Command pipe ID */
 
     uint32 RunStatus; /**< \brief Application run status */
 
-    uint32 LoadBuffer[MM_MAX_LOAD_DATA_SEG / 4]; /**< \brief Load file i/o buffer */
-    uint32 DumpBuffer[MM_MAX_DUMP_DATA_SEG / 4]; /**< \brief Dump file i/o buffer */
-    uint32 FillBuffer[MM_MAX_FILL_DATA_SEG / 4]; /**< \brief Fill memory buffer   */
+    CFE_TBL_Handle_t ConfigTblHandle; /**< \brief Configuration table handle */
+    MM_ConfigTbl_t   Config;          /**< \brief Configuration in use, copied from the configuration table */
+
+    uint32 IoBuffer[MM_IO_BUFFER_SIZE / 4]; /**< \brief Load, dump, fill and file CRC i/o buffer, one user at a time */
+    uint8  DeltaBlockMap[MM_DELTA_MAP_SIZE]; /**< \brief Changed blocks of the delta dump in progress */
+
+    MM_LoadDumpFileHeader_t FileRegions[MM_MAX_FILE_REGIONS];       /**< \brief Region table of the multi-region file */
+    cpuaddr                 FileRegionAddress[MM_MAX_FILE_REGIONS]; /**< \brief Resolved address of each region */
+
+    CFE_ES_MemHandle_t StagingPoolHandle; /**< \brief Load staging pool handle */
+    CFE_ES_STATIC_POOL_TYPE(MM_LOAD_STAGING_POOL_SIZE) StagingPool; /**< \brief Load staging pool memory */
+
+    MM_LoadCache_t     LoadCache;          /**< \brief Load file validation cache */
+    CFE_ES_CDSHandle_t LoadCacheCDSHandle; /**< \brief Load file validation cache CDS handle */
+
+    MM_SymCacheEntry_t SymCache[MM_SYM_CACHE_ENTRIES]; /**< \brief Symbol cache, indexed by symbol name hash */
+    osal_id_t          SymCacheMutex;                  /**< \brief Symbol cache mutex, undefined if not cached */
+    uint32             SymCacheGeneration;             /**< \brief Incremented each time the cache is flushed */
+
+    MM_SymIndexEntry_t SymIndex[MM_SYM_INDEX_ENTRIES];            /**< \brief Reverse symbol index, by address */
+    char               SymIndexNames[MM_SYM_INDEX_NAME_POOL_SIZE]; /**< \brief Reverse symbol index name pool */
+    uint32             SymIndexCount;                             /**< \brief Symbols in the reverse symbol index */
+    uint32             SymIndexNamesUsed;                         /**< \brief Name pool bytes in use */
+
+    MM_MemRangeEntry_t MemRangeMap[MM_MEM_RANGE_TYPES][MM_MEM_RANGE_MAP_ENTRIES]; /**< \brief Sorted by StartAddr */
+    uint32             MemRangeCount[MM_MEM_RANGE_TYPES]; /**< \brief Entries in each valid memory range map */
+    bool               MemRangeMapValid;                  /**< \brief Map built, else the PSP table is checked */
+    osal_id_t          MemRangeMutex;                     /**< \brief Valid memory range map mutex */
+
+    const MM_MemTypeDriver_t *MemTypeDrivers[MM_MAX_MEM_TYPES]; /**< \brief Drivers by memory type, NULL if invalid */
+
+    CFE_ES_TaskId_t   ChildTaskId;    /**< \brief Child task ID */
+    osal_id_t         ChildSemaphore; /**< \brief Child task wakeup semaphore, undefined if no child task */
+    osal_id_t         ChildMutex;     /**< \brief Child task state and shared data mutex, undefined if no child task */
+    CFE_MSG_FcnCode_t ChildCmdCode;   /**< \brief Command code of the command queued for the child task */
+    MM_ChildCmdBuf_t  ChildCmdBuf;    /**< \brief Command queued for the child task */
+
+    MM_DeferredCmdBuf_t DeferredCmds[MM_DEFERRED_CMD_DEPTH]; /**< \brief Commands held during a main task operation */
+    uint8               DeferredHead;                        /**< \brief Index of the oldest held command */
+    uint8               DeferredCount;                       /**< \brief Number of held commands */
+
+    osal_id_t WakeupSemaphore;  /**< \brief Scheduler wakeup semaphore, undefined if not paced */
+    uint32    WakeupCount;      /**< \brief Number of scheduler wakeups received, guarded by the child mutex */
+    uint32    SliceWakeupCount; /**< \brief Wakeup count when the current slice started */
+    size_t    SliceBytes;       /**< \brief Bytes processed in the current slice */
+
+    size_t    SegmentSize[MM_SEG_NUM_TYPES]; /**< \brief Segment size in use per operation type */
+    uint8     SegmentType;                   /**< \brief Type of the segmented operation in progress */
+    OS_time_t SegmentStartTime;              /**< \brief Start of the current segment */
+    OS_time_t OpStartTime;                   /**< \brief Start of the segmented operation in progress */
+    size_t    OpBytes;                       /**< \brief Bytes processed by the operation up to the last break */
+    uint32    OpSegments;                    /**< \brief Segments of the operation started so far */
+    int64     OpBreakUsec;                   /**< \brief Microseconds the operation spent in segment breaks */
+    int64     OpIoUsec;                      /**< \brief Microseconds the operation spent in file reads and writes */
+    OS_time_t IoStartTime;                   /**< \brief Start of the file read or write in progress */
+    uint32    Throughput;                    /**< \brief Bytes per second achieved by the last operation */
+    bool      OpMultiRegion;                 /**< \brief Operation spans regions, accounted once at its end */
 } MM_AppData_t;
 
 /** \brief Memory Manager application global */
@@ -135,6 +343,9 @@ void MM_AppPipe(const CFE_SB_Buffer_t *msg);
  *
  *  \par Description
  *       Processes an on-board housekeeping request message.
+ *       Sends the housekeeping and the load, dump and fill statistics
+ *       telemetry packets. Also gives table services the chance to
+ *       update the configuration table.
  *
  *  \par Assumptions, External Events, and Notes:
  *       This command does not affect the command execution counter
@@ -143,6 +354,51 @@ void MM_AppPipe(const CFE_SB_Buffer_t *msg);
  */
 void MM_HousekeepingCmd(const CFE_SB_Buffer_t *msg);
 
+/**
+ * \brief Process scheduler wakeup
+ *
+ *  \par Description
+ *       Processes a scheduler wakeup message. Starts a new processing
+ *       slice for a load, dump or fill in progress on the child task.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       This command does not affect the command execution counter
+ *
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ */
+void MM_WakeupCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Hold a command until the operation in progress completes
+ *
+ *  \par Description
+ *       Called between segments of a load, dump or fill running on the
+ *       main task for each command pipe message other than a
+ *       housekeeping request or scheduler wakeup. The message is copied
+ *       to the deferred command queue and processed by
+ *       #MM_ProcessDeferredCmds once the operation completes.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A message that doesn't fit in the queue is rejected and counted
+ *       as a command error.
+ *
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ */
+void MM_DeferCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Process the deferred commands
+ *
+ *  \par Description
+ *       Processes the commands held by #MM_DeferCmd in the order they
+ *       arrived. Called by the main loop after each command pipe
+ *       message.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void MM_ProcessDeferredCmds(void);
+
 /**
  * \brief Process noop command
  *
@@ -209,6 +465,74 @@ bool MM_LookupSymbolCmd(const CFE_SB_Buffer_t *msg);
  */
 bool MM_SymTblToFileCmd(const CFE_SB_Buffer_t *msg);
 
+/**
+ * \brief Lookup symbols from file command
+ *
+ *  \par Description
+ *       Processes a lookup symbols from file ground command which
+ *       resolves every symbol name in a request file and writes the
+ *       results to a result file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Runs on the child task. The MM i/o buffer stages the symbol
+ *       records.
+ *
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ *
+ *  \sa #MM_LOOKUP_SYM_FILE_CC
+ */
+bool MM_LookupSymFileCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Resolve the symbols of a lookup file
+ *
+ *  \par Description
+ *       Support function for #MM_LookupSymFileCmd. Writes the headers of
+ *       the result file, then reads the symbol records from the request
+ *       file a buffer at a time, resolves them and writes them to the
+ *       result file. The headers are rewritten at the end with the
+ *       number of symbols resolved.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The request file must be positioned at its first symbol record.
+ *
+ *  \param [in]     InHandle   Request file handle
+ *  \param [in]     InName     Request file name, for event messages
+ *  \param [in]     OutHandle  Result file handle, positioned at the start
+ *  \param [in]     OutName    Result file name, for event messages
+ *  \param [in,out] FileHeader Symbol lookup header from the request file,
+ *                             NumResolved is set on return
+ *
+ *  \return Boolean execution status
+ *  \retval true  The result file was written
+ *  \retval false A file read or write failed
+ */
+bool MM_LookupSymFile(osal_id_t InHandle, const char *InName, osal_id_t OutHandle, const char *OutName,
+                      MM_SymLookupFileHeader_t *FileHeader);
+
+/**
+ * \brief Write the headers of a symbol lookup result file
+ *
+ *  \par Description
+ *       Support function for #MM_LookupSymFile. Writes the cFE primary
+ *       file header followed by the symbol lookup secondary header.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       #CFE_FS_WriteHeader seeks to the start of the file first, so
+ *       this may be called again to update the secondary header.
+ *
+ *  \param [in]   FileName     Result file name (used only for error event messages)
+ *  \param [in]   FileHandle   File Descriptor to write the headers to
+ *  \param [in]   CFEHeader    Pointer to the cFE primary file header
+ *  \param [in]   FileHeader   Pointer to the symbol lookup secondary header
+ *
+ *  \return Boolean execution status
+ *  \retval true  Headers written successfully
+ *  \retval false Headers write failed
+ */
+bool MM_WriteSymLookupHeaders(const char *FileName, osal_id_t FileHandle, CFE_FS_Header_t *CFEHeader,
+                              const MM_SymLookupFileHeader_t *FileHeader);
+
 /**
  * \brief Write-enable EEPROM command
  *
@@ -243,4 +567,54 @@ bool MM_EepromWriteEnaCmd(const CFE_SB_Buffer_t *msg);
  */
 bool MM_EepromWriteDisCmd(const CFE_SB_Buffer_t *msg);
 
+/**
+ * \brief Flush symbol cache command
+ *
+ *  \par Description
+ *       Processes a flush symbol cache ground command which discards
+ *       every symbol address remembered by the symbol cache.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ *
+ *  \sa #MM_SYM_CACHE_FLUSH_CC
+ */
+bool MM_SymCacheFlushCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Refresh memory range map command
+ *
+ *  \par Description
+ *       Processes a refresh memory range map ground command which
+ *       copies the PSP memory table into the valid memory range map
+ *       again.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ *
+ *  \sa #MM_MEM_RANGE_REFRESH_CC
+ */
+bool MM_MemRangeRefreshCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Lookup address command
+ *
+ *  \par Description
+ *       Processes a lookup address ground command which reports the
+ *       symbol that contains an address as a symbol name plus offset,
+ *       using the reverse symbol index.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ *
+ *  \sa #MM_LOOKUP_ADDR_CC
+ */
+bool MM_LookupAddrCmd(const CFE_SB_Buffer_t *BufPtr);
+
 #endif
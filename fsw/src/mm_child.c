@@ -0,0 +1,393 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Provides the CFS Memory Manager child task that processes the long
+ *   running load, dump and fill commands so the main task remains
+ *   responsive to housekeeping requests.
+ */
+
+/*************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_child.h"
+#include "mm_app.h"
+#include "mm_load.h"
+#include "mm_dump.h"
+#include "mm_events.h"
+#include "mm_perfids.h"
+#include "mm_platform_cfg.h"
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Create the child task and its wakeup semaphore                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_ChildInit(void)
+{
+    CFE_Status_t Status;
+
+    MM_AppData.ChildSemaphore              = OS_OBJECT_ID_UNDEFINED;
+    MM_AppData.ChildMutex                  = OS_OBJECT_ID_UNDEFINED;
+    MM_AppData.WakeupSemaphore             = OS_OBJECT_ID_UNDEFINED;
+    MM_AppData.HkPacket.Payload.ChildState = MM_CHILD_DISABLED;
+
+    /*
+    ** The child task state is shared with the main task, without the
+    ** mutex every command is processed by the main task
+    */
+    Status = OS_MutSemCreate(&MM_AppData.ChildMutex, MM_CHILD_MUTEX_NAME, 0);
+    if (Status != OS_SUCCESS)
+    {
+        MM_AppData.ChildMutex = OS_OBJECT_ID_UNDEFINED;
+        CFE_EVS_SendEvent(MM_CHILD_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Child task init error: create mutex failed: RC = 0x%08X", (unsigned int)Status);
+        return Status;
+    }
+
+    Status = OS_CountSemCreate(&MM_AppData.ChildSemaphore, MM_CHILD_SEM_NAME, 0, 0);
+    if (Status != OS_SUCCESS)
+    {
+        MM_AppData.ChildSemaphore = OS_OBJECT_ID_UNDEFINED;
+        CFE_EVS_SendEvent(MM_CHILD_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Child task init error: create semaphore failed: RC = 0x%08X", (unsigned int)Status);
+        return Status;
+    }
+
+    /*
+    ** Without the wakeup semaphore the child task still runs, it just
+    ** yields with a fixed delay between segments instead of being paced
+    ** by the scheduler
+    */
+    Status = OS_BinSemCreate(&MM_AppData.WakeupSemaphore, MM_WAKEUP_SEM_NAME, 0, 0);
+    if (Status != OS_SUCCESS)
+    {
+        MM_AppData.WakeupSemaphore = OS_OBJECT_ID_UNDEFINED;
+        CFE_EVS_SendEvent(MM_CHILD_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Child task init error: create wakeup semaphore failed: RC = 0x%08X", (unsigned int)Status);
+    }
+
+    /*
+    ** The child task may start running before CFE_ES_CreateChildTask
+    ** returns, so mark it available first
+    */
+    MM_ChildSetState(MM_CHILD_IDLE);
+
+    Status = CFE_ES_CreateChildTask(&MM_AppData.ChildTaskId, MM_CHILD_TASK_NAME, MM_ChildTask, NULL,
+                                    MM_CHILD_TASK_STACK_SIZE, MM_CHILD_TASK_PRIORITY, 0);
+    if (Status != CFE_SUCCESS)
+    {
+        OS_CountSemDelete(MM_AppData.ChildSemaphore);
+        MM_AppData.ChildSemaphore = OS_OBJECT_ID_UNDEFINED;
+
+        if (OS_ObjectIdDefined(MM_AppData.WakeupSemaphore))
+        {
+            OS_BinSemDelete(MM_AppData.WakeupSemaphore);
+            MM_AppData.WakeupSemaphore = OS_OBJECT_ID_UNDEFINED;
+        }
+
+        MM_ChildSetState(MM_CHILD_DISABLED);
+        CFE_EVS_SendEvent(MM_CHILD_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Child task init error: create task failed: RC = 0x%08X", (unsigned int)Status);
+    }
+
+    return Status;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Take the child task mutex                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_ChildLock(void)
+{
+    if (OS_ObjectIdDefined(MM_AppData.ChildMutex))
+    {
+        OS_MutSemTake(MM_AppData.ChildMutex);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Give the child task mutex                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_ChildUnlock(void)
+{
+    if (OS_ObjectIdDefined(MM_AppData.ChildMutex))
+    {
+        OS_MutSemGive(MM_AppData.ChildMutex);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get the child task state                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint8 MM_ChildGetState(void)
+{
+    uint8 State;
+
+    MM_ChildLock();
+    State = MM_AppData.HkPacket.Payload.ChildState;
+    MM_ChildUnlock();
+
+    return State;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Set the child task state                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_ChildSetState(uint8 State)
+{
+    MM_ChildLock();
+    MM_AppData.HkPacket.Payload.ChildState = State;
+    MM_ChildUnlock();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify the child task is not processing a command               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_ChildVerifyIdle(CFE_MSG_FcnCode_t CommandCode)
+{
+    bool Idle = true;
+
+    if (MM_ChildGetState() == MM_CHILD_BUSY)
+    {
+        Idle = false;
+        CFE_EVS_SendEvent(MM_CHILD_BUSY_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Child task busy, command rejected: CC = %d, Active CC = %d", CommandCode,
+                          MM_AppData.ChildCmdCode);
+    }
+
+    return Idle;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Child task entry point                                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_ChildTask(void)
+{
+    CFE_ES_PerfLogEntry(MM_CHILD_TASK_PERF_ID);
+
+    MM_ChildLoop();
+
+    /*
+    ** The loop only ends on a semaphore error, stop handing commands
+    ** to this task so they are processed by the main task instead
+    */
+    MM_AppData.ChildSemaphore = OS_OBJECT_ID_UNDEFINED;
+    MM_ChildSetState(MM_CHILD_DISABLED);
+
+    CFE_ES_PerfLogExit(MM_CHILD_TASK_PERF_ID);
+
+    CFE_ES_ExitChildTask();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Child task main loop                                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_ChildLoop(void)
+{
+    int32 Status = OS_SUCCESS;
+
+    while (Status == OS_SUCCESS)
+    {
+        CFE_ES_PerfLogExit(MM_CHILD_TASK_PERF_ID);
+
+        /*
+        ** Pend until the main task queues a command
+        */
+        Status = OS_CountSemTake(MM_AppData.ChildSemaphore);
+
+        CFE_ES_PerfLogEntry(MM_CHILD_TASK_PERF_ID);
+
+        if (Status == OS_SUCCESS)
+        {
+            MM_ChildProcess();
+        }
+        else
+        {
+            CFE_EVS_SendEvent(MM_CHILD_TERM_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Child task exiting: semaphore take failed: RC = 0x%08X", (unsigned int)Status);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Process the command queued for the child task                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_ChildProcess(void)
+{
+    bool Result;
+
+    Result = MM_ChildExecuteCmd(&MM_AppData.ChildCmdBuf.Buf, MM_AppData.ChildCmdCode);
+
+    if (Result == true)
+    {
+        MM_AppData.HkPacket.Payload.ChildCmdCounter++;
+    }
+    else
+    {
+        MM_AppData.HkPacket.Payload.ChildErrCounter++;
+    }
+
+    MM_AppData.HkPacket.Payload.ChildLastCC = MM_AppData.ChildCmdCode;
+
+    /* The child task is ready for the next command */
+    MM_ChildSetState(MM_CHILD_IDLE);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Hand a long running command to the child task                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_ChildDispatchCmd(const CFE_SB_Buffer_t *BufPtr, CFE_MSG_FcnCode_t CommandCode, size_t CmdSize)
+{
+    int32 OS_Status;
+    bool  Result = false;
+
+    if (!OS_ObjectIdDefined(MM_AppData.ChildSemaphore))
+    {
+        /* No child task, process the command here as it always was */
+        Result = MM_ChildExecuteCmd(BufPtr, CommandCode);
+    }
+    else if (CmdSize > sizeof(MM_AppData.ChildCmdBuf))
+    {
+        CFE_EVS_SendEvent(MM_CHILD_QUEUE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Child task queue error: CC = %d, Size = %u exceeds %u", CommandCode, (unsigned int)CmdSize,
+                          (unsigned int)sizeof(MM_AppData.ChildCmdBuf));
+    }
+    else if (MM_ChildVerifyIdle(CommandCode))
+    {
+        memcpy(&MM_AppData.ChildCmdBuf, BufPtr, CmdSize);
+        MM_AppData.ChildCmdCode = CommandCode;
+
+        MM_ChildSetState(MM_CHILD_BUSY);
+
+        OS_Status = OS_CountSemGive(MM_AppData.ChildSemaphore);
+        if (OS_Status == OS_SUCCESS)
+        {
+            Result = true;
+        }
+        else
+        {
+            MM_ChildSetState(MM_CHILD_IDLE);
+            CFE_EVS_SendEvent(MM_CHILD_QUEUE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Child task queue error: CC = %d, semaphore give failed: RC = 0x%08X", CommandCode,
+                              (unsigned int)OS_Status);
+        }
+    }
+
+    return Result;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Execute a command processed by the child task                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_ChildExecuteCmd(const CFE_SB_Buffer_t *BufPtr, CFE_MSG_FcnCode_t CommandCode)
+{
+    bool Result = false;
+
+    /*
+    ** Housekeeping shows the operation in progress until it completes
+    */
+    switch (CommandCode)
+    {
+        case MM_LOAD_MEM_FROM_FILE_CC:
+            MM_AppData.HkPacket.Payload.ActiveAction = MM_LOAD_FROM_FILE;
+            Result                                   = MM_LoadMemFromFileCmd(BufPtr);
+            break;
+
+        case MM_DUMP_MEM_TO_FILE_CC:
+            MM_AppData.HkPacket.Payload.ActiveAction = MM_DUMP_TO_FILE;
+            Result                                   = MM_DumpMemToFileCmd(BufPtr);
+            break;
+
+        case MM_DUMP_MEM_TO_FILE_ENC_CC:
+            MM_AppData.HkPacket.Payload.ActiveAction = MM_DUMP_TO_FILE;
+            Result                                   = MM_DumpMemToFileEncCmd(BufPtr);
+            break;
+
+        case MM_DUMP_MEM_TO_DELTA_FILE_CC:
+            MM_AppData.HkPacket.Payload.ActiveAction = MM_DUMP_TO_FILE;
+            Result                                   = MM_DumpMemToDeltaFileCmd(BufPtr);
+            break;
+
+        case MM_LOAD_MEM_FROM_PATCH_FILE_CC:
+            MM_AppData.HkPacket.Payload.ActiveAction = MM_LOAD_FROM_FILE;
+            Result                                   = MM_LoadMemFromPatchFileCmd(BufPtr);
+            break;
+
+        case MM_LOAD_MEM_FROM_MULTI_FILE_CC:
+            MM_AppData.HkPacket.Payload.ActiveAction = MM_LOAD_FROM_FILE;
+            Result                                   = MM_LoadMemFromMultiFileCmd(BufPtr);
+            break;
+
+        case MM_DUMP_MEM_TO_MULTI_FILE_CC:
+            MM_AppData.HkPacket.Payload.ActiveAction = MM_DUMP_TO_FILE;
+            Result                                   = MM_DumpMemToMultiFileCmd(BufPtr);
+            break;
+
+        case MM_FILL_MEM_CC:
+            MM_AppData.HkPacket.Payload.ActiveAction = MM_FILL;
+            Result                                   = MM_FillMemCmd(BufPtr);
+            break;
+
+        case MM_COPY_MEM_CC:
+            MM_AppData.HkPacket.Payload.ActiveAction = MM_COPY;
+            Result                                   = MM_CopyMemCmd(BufPtr);
+            break;
+
+        case MM_CRC_MEM_CC:
+            MM_AppData.HkPacket.Payload.ActiveAction = MM_CRC;
+            Result                                   = MM_CrcMemCmd(BufPtr);
+            break;
+
+        case MM_LOOKUP_SYM_FILE_CC:
+            MM_AppData.HkPacket.Payload.ActiveAction = MM_SYM_LOOKUP;
+            Result                                   = MM_LookupSymFileCmd(BufPtr);
+            break;
+
+        default:
+            CFE_EVS_SendEvent(MM_CHILD_QUEUE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Child task queue error: invalid command code: CC = %d", CommandCode);
+            break;
+    }
+
+    MM_AppData.HkPacket.Payload.ActiveAction = MM_NOACTION;
+
+    return Result;
+}
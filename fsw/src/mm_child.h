@@ -0,0 +1,211 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Memory Manager child task that processes
+ *   the long running load, dump and fill commands.
+ */
+#ifndef MM_CHILD_H
+#define MM_CHILD_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+#include "cfe.h"
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Child task initialization
+ *
+ *  \par Description
+ *       Creates the child task state mutex, the child task command
+ *       semaphore, the scheduler wakeup semaphore used to pace the
+ *       child task and the child task itself. Called from #MM_AppInit.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A failure here is not fatal to the application. The child
+ *       task state is left at #MM_CHILD_DISABLED and the long running
+ *       commands are processed by the main task as before.
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+CFE_Status_t MM_ChildInit(void);
+
+/**
+ * \brief Take the child task mutex
+ *
+ *  \par Description
+ *       Takes the mutex that guards the child task state and the other
+ *       data the main task and the child task both update.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Does nothing without a child task mutex, the data is then only
+ *       used by the main task. Must be paired with #MM_ChildUnlock.
+ */
+void MM_ChildLock(void);
+
+/**
+ * \brief Give the child task mutex
+ *
+ *  \par Description
+ *       Gives the mutex taken by #MM_ChildLock.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void MM_ChildUnlock(void);
+
+/**
+ * \brief Get the child task state
+ *
+ *  \par Description
+ *       Reads the child task state under the child task state mutex,
+ *       so the main task and the child task agree on whether a command
+ *       is in progress.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Without a child task mutex the state is never changed by
+ *       another task and is read directly.
+ *
+ *  \return Child task state, see \ref MMChildStates
+ */
+uint8 MM_ChildGetState(void);
+
+/**
+ * \brief Set the child task state
+ *
+ *  \par Description
+ *       Changes the child task state under the child task state mutex.
+ *       Only the main task sets #MM_CHILD_BUSY and only the child task
+ *       returns it to #MM_CHILD_IDLE.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] State  New child task state, see \ref MMChildStates
+ */
+void MM_ChildSetState(uint8 State);
+
+/**
+ * \brief Verify the child task is idle
+ *
+ *  \par Description
+ *       Rejects a command with an error event while the child task is
+ *       processing a command. Used for the child task commands and for
+ *       the main task commands that write the last action data the
+ *       child task reports its results in.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] CommandCode  Command code of the command to verify
+ *
+ *  \return Boolean idle status
+ *  \retval true  Child task idle, disabled or not created
+ *  \retval false Child task busy, command rejected
+ */
+bool MM_ChildVerifyIdle(CFE_MSG_FcnCode_t CommandCode);
+
+/**
+ * \brief Child task entry point
+ *
+ *  \par Description
+ *       Entry point of the child task created by #MM_ChildInit. Runs
+ *       the child task loop and exits the task when the loop ends.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void MM_ChildTask(void);
+
+/**
+ * \brief Child task main loop
+ *
+ *  \par Description
+ *       Pends on the child task command semaphore and processes the
+ *       queued command each time it is given. Returns when the
+ *       semaphore can no longer be taken.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void MM_ChildLoop(void);
+
+/**
+ * \brief Process the queued child task command
+ *
+ *  \par Description
+ *       Executes the command queued by #MM_ChildDispatchCmd, updates
+ *       the child task command counters and returns the child task
+ *       to the #MM_CHILD_IDLE state.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void MM_ChildProcess(void);
+
+/**
+ * \brief Hand a long running command to the child task
+ *
+ *  \par Description
+ *       Called by #MM_AppPipe for the load from file, dump to file and
+ *       fill commands. The command is copied into the child task
+ *       command buffer and the child task is woken up to process it.
+ *       If the child task is not available the command is executed
+ *       immediately on the calling task.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only one command can be queued at a time. A command that
+ *       arrives while the child task is busy is rejected.
+ *
+ *  \param [in] BufPtr       Pointer to Software Bus buffer
+ *  \param [in] CommandCode  Command code of the command
+ *  \param [in] CmdSize      Size of the command, already verified
+ *
+ *  \return Boolean execution status
+ *  \retval true  Command queued, or executed successfully when there
+ *                is no child task
+ *  \retval false Command rejected or failed
+ */
+bool MM_ChildDispatchCmd(const CFE_SB_Buffer_t *BufPtr, CFE_MSG_FcnCode_t CommandCode, size_t CmdSize);
+
+/**
+ * \brief Execute a child task command
+ *
+ *  \par Description
+ *       Calls the command handler for the specified command code.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] BufPtr       Pointer to Software Bus buffer
+ *  \param [in] CommandCode  Command code of the command
+ *
+ *  \return Boolean execution status
+ *  \retval true  Command executed successfully
+ *  \retval false Command failed
+ */
+bool MM_ChildExecuteCmd(const CFE_SB_Buffer_t *BufPtr, CFE_MSG_FcnCode_t CommandCode);
+
+#endif
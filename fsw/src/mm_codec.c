@@ -0,0 +1,709 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Encoders and decoders for the CFS Memory Manager load and dump file
+ *   data.
+ */
+
+/*************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_codec.h"
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start run length encoding                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_RleEncodeInit(MM_RleEncoder_t *Enc, uint8 *Out, size_t OutSize)
+{
+    memset(Enc, 0, sizeof(*Enc));
+
+    Enc->Out     = Out;
+    Enc->OutSize = OutSize;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Output the repeated bytes held by the encoder                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_RleEncodeRun(MM_RleEncoder_t *Enc)
+{
+    uint32 i;
+    uint32 Length;
+
+    if (Enc->RunLength >= MM_RLE_MIN_RUN)
+    {
+        Length = Enc->RunLength - MM_RLE_MIN_RUN;
+
+        Enc->Out[Enc->OutLen++] = 0x80 | (uint8)(Length >> 8);
+        Enc->Out[Enc->OutLen++] = (uint8)(Length & 0xFF);
+        Enc->Out[Enc->OutLen++] = Enc->RunValue;
+
+        /* A literal after the run needs a new record */
+        Enc->LiteralCount = 0;
+    }
+    else
+    {
+        /* Short runs cost less as literal bytes */
+        for (i = 0; i < Enc->RunLength; i++)
+        {
+            if ((Enc->LiteralCount == 0) || (Enc->LiteralCount == MM_RLE_MAX_LITERAL))
+            {
+                Enc->LiteralIndex = Enc->OutLen++;
+                Enc->LiteralCount = 0;
+            }
+
+            Enc->Out[Enc->OutLen++] = Enc->RunValue;
+            Enc->LiteralCount++;
+            Enc->Out[Enc->LiteralIndex] = (uint8)(Enc->LiteralCount - 1);
+        }
+    }
+
+    Enc->RunLength = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Run length encode data                                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+size_t MM_RleEncode(MM_RleEncoder_t *Enc, const uint8 *Src, size_t SrcLen)
+{
+    size_t Used = 0;
+
+    /* Each input byte outputs at most one held run */
+    while ((Used < SrcLen) && ((Enc->OutSize - Enc->OutLen) >= MM_RLE_MAX_EMIT))
+    {
+        if ((Enc->RunLength != 0) && (Src[Used] == Enc->RunValue) && (Enc->RunLength < MM_RLE_MAX_RUN))
+        {
+            Enc->RunLength++;
+        }
+        else
+        {
+            MM_RleEncodeRun(Enc);
+
+            Enc->RunValue  = Src[Used];
+            Enc->RunLength = 1;
+        }
+
+        Used++;
+    }
+
+    return Used;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Rewind the run length encoder output buffer                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_RleEncodeRewind(MM_RleEncoder_t *Enc)
+{
+    Enc->OutLen       = 0;
+    Enc->LiteralCount = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Finish run length encoding                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_RleEncodeFinish(MM_RleEncoder_t *Enc)
+{
+    MM_RleEncodeRun(Enc);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start run length decoding                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_RleDecodeInit(MM_RleDecoder_t *Dec)
+{
+    memset(Dec, 0, sizeof(*Dec));
+
+    Dec->State = MM_RLE_STATE_CTRL;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Run length decode data                                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+size_t MM_RleDecode(MM_RleDecoder_t *Dec, const uint8 *Src, size_t SrcLen, size_t *SrcUsed, uint8 *Dst,
+                    size_t DstSize)
+{
+    size_t SrcPos = 0;
+    size_t DstPos = 0;
+    size_t Length;
+
+    /* A run needs no more input to fill the output */
+    while ((DstPos < DstSize) && ((SrcPos < SrcLen) || (Dec->State == MM_RLE_STATE_RUN)))
+    {
+        switch (Dec->State)
+        {
+            case MM_RLE_STATE_CTRL:
+                if ((Src[SrcPos] & 0x80) != 0)
+                {
+                    Dec->Count = (uint32)(Src[SrcPos] & 0x7F) << 8;
+                    Dec->State = MM_RLE_STATE_RUN_LEN;
+                }
+                else
+                {
+                    Dec->Count = (uint32)Src[SrcPos] + 1;
+                    Dec->State = MM_RLE_STATE_LITERAL;
+                }
+                SrcPos++;
+                break;
+
+            case MM_RLE_STATE_RUN_LEN:
+                Dec->Count = (Dec->Count | Src[SrcPos]) + MM_RLE_MIN_RUN;
+                Dec->State = MM_RLE_STATE_RUN_VAL;
+                SrcPos++;
+                break;
+
+            case MM_RLE_STATE_RUN_VAL:
+                Dec->RunValue = Src[SrcPos];
+                Dec->State    = MM_RLE_STATE_RUN;
+                SrcPos++;
+                break;
+
+            case MM_RLE_STATE_RUN:
+                Length = DstSize - DstPos;
+                if (Dec->Count < Length)
+                {
+                    Length = Dec->Count;
+                }
+
+                memset(&Dst[DstPos], Dec->RunValue, Length);
+                DstPos += Length;
+                Dec->Count -= Length;
+                break;
+
+            case MM_RLE_STATE_LITERAL:
+            default:
+                Length = DstSize - DstPos;
+                if (Dec->Count < Length)
+                {
+                    Length = Dec->Count;
+                }
+                if ((SrcLen - SrcPos) < Length)
+                {
+                    Length = SrcLen - SrcPos;
+                }
+
+                memcpy(&Dst[DstPos], &Src[SrcPos], Length);
+                SrcPos += Length;
+                DstPos += Length;
+                Dec->Count -= Length;
+                break;
+        }
+
+        /* Back to the next control byte once a record is used up */
+        if (((Dec->State == MM_RLE_STATE_RUN) || (Dec->State == MM_RLE_STATE_LITERAL)) && (Dec->Count == 0))
+        {
+            Dec->State = MM_RLE_STATE_CTRL;
+        }
+    }
+
+    *SrcUsed = SrcPos;
+
+    return DstPos;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Count leading fill bytes                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+size_t MM_SparseScanFill(const uint8 *Src, size_t SrcLen, uint8 FillValue)
+{
+    size_t i       = 0;
+    uint32 Pattern = FillValue * 0x01010101U;
+
+    /* Bytes up to a word boundary */
+    while ((i < SrcLen) && ((((cpuaddr)&Src[i]) % sizeof(uint32)) != 0) && (Src[i] == FillValue))
+    {
+        i++;
+    }
+
+    /* Whole words, then the bytes of the word that differs */
+    if ((((cpuaddr)&Src[i]) % sizeof(uint32)) == 0)
+    {
+        while (((SrcLen - i) >= sizeof(uint32)) && (*((const uint32 *)&Src[i]) == Pattern))
+        {
+            i += sizeof(uint32);
+        }
+    }
+
+    while ((i < SrcLen) && (Src[i] == FillValue))
+    {
+        i++;
+    }
+
+    return i;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Count leading data bytes                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+size_t MM_SparseScanData(const uint8 *Src, size_t SrcLen, uint8 FillValue)
+{
+    size_t i       = 0;
+    size_t FillLength;
+    uint32 Pattern = FillValue * 0x01010101U;
+    uint32 Word;
+
+    while (i < SrcLen)
+    {
+        if (Src[i] != FillValue)
+        {
+            /*
+            ** Skip aligned words with no fill byte, a word has a byte equal
+            ** to the fill value when the exclusive or has a zero byte
+            */
+            i++;
+            if ((((cpuaddr)&Src[i]) % sizeof(uint32)) == 0)
+            {
+                while ((SrcLen - i) >= sizeof(uint32))
+                {
+                    Word = *((const uint32 *)&Src[i]) ^ Pattern;
+                    if (((Word - 0x01010101U) & ~Word & 0x80808080U) != 0)
+                    {
+                        break;
+                    }
+                    i += sizeof(uint32);
+                }
+            }
+        }
+        else
+        {
+            /* Long fill runs and fill at the end are left out */
+            FillLength = MM_SparseScanFill(&Src[i], SrcLen - i, FillValue);
+            if ((FillLength >= MM_SPARSE_MIN_GAP) || ((i + FillLength) == SrcLen))
+            {
+                break;
+            }
+            i += FillLength;
+        }
+    }
+
+    return i;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start sparse encoding                                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_SparseEncodeInit(MM_SparseEncoder_t *Enc, uint8 FillValue, uint8 *Out, size_t OutSize)
+{
+    memset(Enc, 0, sizeof(*Enc));
+
+    Enc->Out       = Out;
+    Enc->OutSize   = OutSize;
+    Enc->FillValue = FillValue;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Sparse encode data                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+size_t MM_SparseEncode(MM_SparseEncoder_t *Enc, const uint8 *Src, size_t SrcLen)
+{
+    size_t            Used = 0;
+    size_t            Room;
+    MM_SparseExtent_t Extent;
+
+    while (Used < SrcLen)
+    {
+        Used += MM_SparseScanFill(&Src[Used], SrcLen - Used, Enc->FillValue);
+
+        Room = Enc->OutSize - Enc->OutLen;
+        if ((Used == SrcLen) || (Room < (sizeof(Extent) + MM_SPARSE_MIN_GAP)))
+        {
+            break;
+        }
+
+        Room -= sizeof(Extent);
+        if ((SrcLen - Used) < Room)
+        {
+            Room = SrcLen - Used;
+        }
+
+        Extent.Offset = Enc->Offset + Used;
+        Extent.Length = MM_SparseScanData(&Src[Used], Room, Enc->FillValue);
+
+        memcpy(&Enc->Out[Enc->OutLen], &Extent, sizeof(Extent));
+        memcpy(&Enc->Out[Enc->OutLen + sizeof(Extent)], &Src[Used], Extent.Length);
+
+        Enc->OutLen += sizeof(Extent) + Extent.Length;
+        Used += Extent.Length;
+    }
+
+    Enc->Offset += Used;
+
+    return Used;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start sparse decoding                                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_SparseDecodeInit(MM_SparseDecoder_t *Dec, uint8 FillValue, uint32 Size)
+{
+    memset(Dec, 0, sizeof(*Dec));
+
+    Dec->State     = MM_SPARSE_STATE_HEADER;
+    Dec->Size      = Size;
+    Dec->FillValue = FillValue;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Sparse decode data                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+size_t MM_SparseDecode(MM_SparseDecoder_t *Dec, const uint8 *Src, size_t SrcLen, size_t *SrcUsed, uint8 *Dst,
+                       size_t DstSize)
+{
+    size_t SrcPos = 0;
+    size_t DstPos = 0;
+    size_t Length;
+
+    /* A gap needs no more input to fill the output */
+    while ((Dec->State != MM_SPARSE_STATE_ERROR) && (DstPos < DstSize) &&
+           ((SrcPos < SrcLen) || (Dec->State == MM_SPARSE_STATE_GAP)))
+    {
+        switch (Dec->State)
+        {
+            case MM_SPARSE_STATE_HEADER:
+                Length = sizeof(Dec->Extent) - Dec->HeaderLength;
+                if ((SrcLen - SrcPos) < Length)
+                {
+                    Length = SrcLen - SrcPos;
+                }
+
+                memcpy(((uint8 *)&Dec->Extent) + Dec->HeaderLength, &Src[SrcPos], Length);
+                SrcPos += Length;
+                Dec->HeaderLength += Length;
+
+                if (Dec->HeaderLength == sizeof(Dec->Extent))
+                {
+                    Dec->HeaderLength = 0;
+
+                    /* Extents are in order, not empty and inside the data */
+                    if ((Dec->Extent.Length == 0) || (Dec->Extent.Offset < Dec->Position) ||
+                        (Dec->Extent.Offset > Dec->Size) || (Dec->Extent.Length > (Dec->Size - Dec->Extent.Offset)))
+                    {
+                        Dec->State = MM_SPARSE_STATE_ERROR;
+                    }
+                    else if (Dec->Extent.Offset > Dec->Position)
+                    {
+                        Dec->Count        = Dec->Extent.Offset - Dec->Position;
+                        Dec->ExtentLength = Dec->Extent.Length;
+                        Dec->State        = MM_SPARSE_STATE_GAP;
+                    }
+                    else
+                    {
+                        Dec->Count = Dec->Extent.Length;
+                        Dec->State = MM_SPARSE_STATE_DATA;
+                    }
+                }
+                break;
+
+            case MM_SPARSE_STATE_GAP:
+                Length = DstSize - DstPos;
+                if (Dec->Count < Length)
+                {
+                    Length = Dec->Count;
+                }
+
+                memset(&Dst[DstPos], Dec->FillValue, Length);
+                DstPos += Length;
+                Dec->Position += Length;
+                Dec->Count -= Length;
+
+                /* The extent after the gap, if any */
+                if (Dec->Count == 0)
+                {
+                    Dec->Count        = Dec->ExtentLength;
+                    Dec->State        = (Dec->ExtentLength != 0) ? MM_SPARSE_STATE_DATA : MM_SPARSE_STATE_HEADER;
+                    Dec->ExtentLength = 0;
+                }
+                break;
+
+            case MM_SPARSE_STATE_DATA:
+            default:
+                Length = DstSize - DstPos;
+                if (Dec->Count < Length)
+                {
+                    Length = Dec->Count;
+                }
+                if ((SrcLen - SrcPos) < Length)
+                {
+                    Length = SrcLen - SrcPos;
+                }
+
+                memcpy(&Dst[DstPos], &Src[SrcPos], Length);
+                SrcPos += Length;
+                DstPos += Length;
+                Dec->Position += Length;
+                Dec->Count -= Length;
+
+                if (Dec->Count == 0)
+                {
+                    Dec->State = MM_SPARSE_STATE_HEADER;
+                }
+                break;
+        }
+    }
+
+    *SrcUsed = SrcPos;
+
+    return DstPos;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start file data encoding                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_FileEncodeInit(MM_FileEncoder_t *Enc, uint8 Encoding, uint8 FillValue, uint8 *Out, size_t OutSize)
+{
+    Enc->Encoding = Encoding;
+
+    if (Encoding == MM_ENCODING_SPARSE)
+    {
+        MM_SparseEncodeInit(&Enc->Codec.Sparse, FillValue, Out, OutSize);
+    }
+    else
+    {
+        MM_RleEncodeInit(&Enc->Codec.Rle, Out, OutSize);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Encode file data                                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+size_t MM_FileEncode(MM_FileEncoder_t *Enc, const uint8 *Src, size_t SrcLen)
+{
+    size_t Used;
+
+    if (Enc->Encoding == MM_ENCODING_SPARSE)
+    {
+        Used = MM_SparseEncode(&Enc->Codec.Sparse, Src, SrcLen);
+    }
+    else
+    {
+        Used = MM_RleEncode(&Enc->Codec.Rle, Src, SrcLen);
+    }
+
+    return Used;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check for a full file data encoder output buffer                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_FileEncodeFull(const MM_FileEncoder_t *Enc)
+{
+    bool Full;
+
+    if (Enc->Encoding == MM_ENCODING_SPARSE)
+    {
+        Full = ((Enc->Codec.Sparse.OutSize - Enc->Codec.Sparse.OutLen) <
+                (sizeof(MM_SparseExtent_t) + MM_SPARSE_MIN_GAP));
+    }
+    else
+    {
+        Full = ((Enc->Codec.Rle.OutSize - Enc->Codec.Rle.OutLen) < MM_RLE_MAX_EMIT);
+    }
+
+    return Full;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get the file data encoder output                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+size_t MM_FileEncodeOutput(const MM_FileEncoder_t *Enc, const uint8 **Out)
+{
+    size_t OutLen;
+
+    if (Enc->Encoding == MM_ENCODING_SPARSE)
+    {
+        *Out   = Enc->Codec.Sparse.Out;
+        OutLen = Enc->Codec.Sparse.OutLen;
+    }
+    else
+    {
+        *Out   = Enc->Codec.Rle.Out;
+        OutLen = Enc->Codec.Rle.OutLen;
+    }
+
+    return OutLen;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Rewind the file data encoder output buffer                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_FileEncodeRewind(MM_FileEncoder_t *Enc)
+{
+    if (Enc->Encoding == MM_ENCODING_SPARSE)
+    {
+        Enc->Codec.Sparse.OutLen = 0;
+    }
+    else
+    {
+        MM_RleEncodeRewind(&Enc->Codec.Rle);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Finish file data encoding                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_FileEncodeFinish(MM_FileEncoder_t *Enc)
+{
+    /* The sparse encoder holds nothing back */
+    if (Enc->Encoding != MM_ENCODING_SPARSE)
+    {
+        MM_RleEncodeFinish(&Enc->Codec.Rle);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start file data decoding                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_FileDecodeInit(MM_FileDecoder_t *Dec, uint8 Encoding, uint8 FillValue, uint32 Size)
+{
+    Dec->Encoding = Encoding;
+
+    if (Encoding == MM_ENCODING_SPARSE)
+    {
+        MM_SparseDecodeInit(&Dec->Codec.Sparse, FillValue, Size);
+    }
+    else
+    {
+        MM_RleDecodeInit(&Dec->Codec.Rle);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Decode file data                                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+size_t MM_FileDecode(MM_FileDecoder_t *Dec, const uint8 *Src, size_t SrcLen, size_t *SrcUsed, uint8 *Dst,
+                     size_t DstSize)
+{
+    size_t Decoded;
+
+    if (Dec->Encoding == MM_ENCODING_SPARSE)
+    {
+        Decoded = MM_SparseDecode(&Dec->Codec.Sparse, Src, SrcLen, SrcUsed, Dst, DstSize);
+    }
+    else
+    {
+        Decoded = MM_RleDecode(&Dec->Codec.Rle, Src, SrcLen, SrcUsed, Dst, DstSize);
+    }
+
+    return Decoded;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* End the file data decoder input                                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_FileDecodeEnd(MM_FileDecoder_t *Dec)
+{
+    MM_SparseDecoder_t *Sparse = &Dec->Codec.Sparse;
+
+    /* The bytes after the last extent are fill */
+    if ((Dec->Encoding == MM_ENCODING_SPARSE) && (Sparse->State == MM_SPARSE_STATE_HEADER) &&
+        (Sparse->HeaderLength == 0) && (Sparse->Position < Sparse->Size))
+    {
+        Sparse->Count        = Sparse->Size - Sparse->Position;
+        Sparse->ExtentLength = 0;
+        Sparse->State        = MM_SPARSE_STATE_GAP;
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check for file data decoder output that needs no input          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_FileDecodePending(const MM_FileDecoder_t *Dec)
+{
+    bool Pending;
+
+    if (Dec->Encoding == MM_ENCODING_SPARSE)
+    {
+        Pending = (Dec->Codec.Sparse.State == MM_SPARSE_STATE_GAP);
+    }
+    else
+    {
+        Pending = (Dec->Codec.Rle.State == MM_RLE_STATE_RUN);
+    }
+
+    return Pending;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check for complete file data                                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_FileDecodeDone(const MM_FileDecoder_t *Dec)
+{
+    bool Done;
+
+    if (Dec->Encoding == MM_ENCODING_SPARSE)
+    {
+        Done = ((Dec->Codec.Sparse.State == MM_SPARSE_STATE_HEADER) && (Dec->Codec.Sparse.HeaderLength == 0) &&
+                (Dec->Codec.Sparse.Position == Dec->Codec.Sparse.Size));
+    }
+    else
+    {
+        Done = (Dec->Codec.Rle.State == MM_RLE_STATE_CTRL);
+    }
+
+    return Done;
+}
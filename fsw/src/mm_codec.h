@@ -0,0 +1,610 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Memory Manager load and dump file data
+ *   encoders and decoders.
+ *
+ *   Run length encoded (#MM_ENCODING_RLE) file data is a sequence of
+ *   records that each start with a control byte:
+ *   - 0x00 to 0x7F: a literal record, the control byte plus one data
+ *     bytes follow and are copied as they are
+ *   - 0x80 to 0xFF: a run record, the low 7 bits of the control byte
+ *     and the next byte hold the run length less #MM_RLE_MIN_RUN, most
+ *     significant bits first, and the byte after that is the value
+ *     repeated
+ *
+ *   Sparse (#MM_ENCODING_SPARSE) file data is a sequence of extents,
+ *   each a #MM_SparseExtent_t record followed by its data bytes. Extents
+ *   are in ascending offset order and do not overlap. Every byte not
+ *   covered by an extent, including any after the last one, holds the
+ *   fill value from the file header.
+ *
+ *   Both directions work on any split of the data, so a load, dump or
+ *   fill segment never has to line up with a record. The MM_File*
+ *   functions select the encoder or decoder for a file encoding.
+ */
+#ifndef MM_CODEC_H
+#define MM_CODEC_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+#include "cfe.h"
+#include "mm_msgdefs.h"
+
+/************************************************************************
+ * Macro Definitions
+ ************************************************************************/
+
+/**
+ * \name Run length encoding limits
+ * \{
+ */
+#define MM_RLE_MAX_LITERAL 128                       /**< \brief Most bytes in a literal record */
+#define MM_RLE_MIN_RUN     4                         /**< \brief Fewest repeated bytes stored as a run record */
+#define MM_RLE_MAX_RUN     (0x7FFF + MM_RLE_MIN_RUN) /**< \brief Most repeated bytes in a run record */
+#define MM_RLE_MAX_EMIT    8                         /**< \brief Most output bytes added for one input byte */
+/**\}*/
+
+/**
+ * \brief Bytes decoded at a time to check load file data
+ */
+#define MM_CODEC_CHECK_CHUNK 256
+
+/**
+ * \name Sparse encoding limits
+ * \{
+ */
+#define MM_SPARSE_MIN_GAP 16 /**< \brief Fewest fill bytes that end an extent */
+/**\}*/
+
+/**
+ * \brief Largest run length encoded size of a number of bytes
+ *
+ * A literal record costs one byte per #MM_RLE_MAX_LITERAL bytes and each
+ * output buffer rewind may split a literal record, so this bound is kept
+ * generous.
+ */
+#define MM_RLE_MAX_ENCODED_SIZE(n) ((n) + ((n) / 64) + 2)
+
+/**
+ * \brief Largest sparse encoded size of a number of bytes
+ *
+ * Every extent holds at least one data byte, so there is at most one
+ * extent record per byte.
+ */
+#define MM_SPARSE_MAX_ENCODED_SIZE(n) ((n) + ((n) * sizeof(MM_SparseExtent_t)))
+
+/**
+ * \name Run length decoder states
+ * \{
+ */
+#define MM_RLE_STATE_CTRL    0 /**< \brief Expecting a control byte */
+#define MM_RLE_STATE_LITERAL 1 /**< \brief Copying literal record bytes */
+#define MM_RLE_STATE_RUN_LEN 2 /**< \brief Expecting the low byte of a run length */
+#define MM_RLE_STATE_RUN_VAL 3 /**< \brief Expecting the value of a run */
+#define MM_RLE_STATE_RUN     4 /**< \brief Repeating the run value */
+/**\}*/
+
+/**
+ * \name Sparse decoder states
+ * \{
+ */
+#define MM_SPARSE_STATE_HEADER 0 /**< \brief Expecting extent record bytes */
+#define MM_SPARSE_STATE_GAP    1 /**< \brief Outputting fill bytes before an extent or the end */
+#define MM_SPARSE_STATE_DATA   2 /**< \brief Copying extent data bytes */
+#define MM_SPARSE_STATE_ERROR  3 /**< \brief Extent record out of order or out of range */
+/**\}*/
+
+/************************************************************************
+ * Type Definitions
+ ************************************************************************/
+
+/**
+ *  \brief Sparse file data extent record
+ */
+typedef struct
+{
+    uint32 Offset; /**< \brief Offset of the extent data from the start of the dumped memory */
+    uint32 Length; /**< \brief Bytes of extent data that follow the record */
+} MM_SparseExtent_t;
+
+/**
+ *  \brief Run length encoder state
+ */
+typedef struct
+{
+    uint8 *Out;          /**< \brief Output buffer */
+    size_t OutSize;      /**< \brief Size of the output buffer */
+    size_t OutLen;       /**< \brief Bytes in the output buffer */
+    size_t LiteralIndex; /**< \brief Output index of the open literal record control byte */
+    uint32 LiteralCount; /**< \brief Bytes in the open literal record, 0 if none is open */
+    uint32 RunLength;    /**< \brief Repeated bytes seen but not yet output */
+    uint8  RunValue;     /**< \brief Value of the repeated bytes */
+} MM_RleEncoder_t;
+
+/**
+ *  \brief Run length decoder state
+ */
+typedef struct
+{
+    uint32 Count;    /**< \brief Bytes left in the current record */
+    uint8  State;    /**< \brief Decoder state, see MM_RLE_STATE_* */
+    uint8  RunValue; /**< \brief Value of the current run record */
+} MM_RleDecoder_t;
+
+/**
+ *  \brief Sparse encoder state
+ */
+typedef struct
+{
+    uint8 *Out;       /**< \brief Output buffer */
+    size_t OutSize;   /**< \brief Size of the output buffer */
+    size_t OutLen;    /**< \brief Bytes in the output buffer */
+    uint32 Offset;    /**< \brief Offset of the next input byte from the start of the data */
+    uint8  FillValue; /**< \brief Value of the bytes left out */
+} MM_SparseEncoder_t;
+
+/**
+ *  \brief Sparse decoder state
+ */
+typedef struct
+{
+    uint32            Position;     /**< \brief Offset of the next output byte */
+    uint32            Size;         /**< \brief Size of the decoded data */
+    uint32            Count;        /**< \brief Bytes left in the current gap or extent */
+    uint32            ExtentLength; /**< \brief Length of the extent after the current gap, 0 at the end */
+    uint32            HeaderLength; /**< \brief Extent record bytes collected */
+    MM_SparseExtent_t Extent;       /**< \brief Extent record being collected */
+    uint8             State;        /**< \brief Decoder state, see MM_SPARSE_STATE_* */
+    uint8             FillValue;    /**< \brief Value of the bytes not in an extent */
+} MM_SparseDecoder_t;
+
+/**
+ *  \brief Load and dump file data encoder
+ */
+typedef struct
+{
+    uint8 Encoding; /**< \brief File data encoding, see \ref MMFileEncodings */
+    union
+    {
+        MM_RleEncoder_t    Rle;    /**< \brief Run length encoder state */
+        MM_SparseEncoder_t Sparse; /**< \brief Sparse encoder state */
+    } Codec;
+} MM_FileEncoder_t;
+
+/**
+ *  \brief Load and dump file data decoder
+ */
+typedef struct
+{
+    uint8 Encoding; /**< \brief File data encoding, see \ref MMFileEncodings */
+    union
+    {
+        MM_RleDecoder_t    Rle;    /**< \brief Run length decoder state */
+        MM_SparseDecoder_t Sparse; /**< \brief Sparse decoder state */
+    } Codec;
+} MM_FileDecoder_t;
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Start run length encoding
+ *
+ *  \par Description
+ *       Initializes the encoder state to encode into the output buffer.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The output buffer must be larger than #MM_RLE_MAX_EMIT.
+ *
+ *  \param [in] Enc      Pointer to the encoder state
+ *  \param [in] Out      Pointer to the output buffer
+ *  \param [in] OutSize  Size of the output buffer in bytes
+ */
+void MM_RleEncodeInit(MM_RleEncoder_t *Enc, uint8 *Out, size_t OutSize);
+
+/**
+ * \brief Output the held run
+ *
+ *  \par Description
+ *       Outputs the repeated bytes held in the encoder state as a run
+ *       record, or as literal bytes when there are fewer than
+ *       #MM_RLE_MIN_RUN of them.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called by #MM_RleEncode and #MM_RleEncodeFinish, which make sure
+ *       #MM_RLE_MAX_EMIT bytes of output buffer are free.
+ *
+ *  \param [in] Enc  Pointer to the encoder state
+ */
+void MM_RleEncodeRun(MM_RleEncoder_t *Enc);
+
+/**
+ * \brief Run length encode data
+ *
+ *  \par Description
+ *       Encodes input bytes into the output buffer until all input is
+ *       used or fewer than #MM_RLE_MAX_EMIT bytes of output buffer are
+ *       left. The caller then writes the output buffer and calls
+ *       #MM_RleEncodeRewind before encoding the rest.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Repeated bytes at the end of the input are held in the encoder
+ *       state until a different byte or #MM_RleEncodeFinish ends the run.
+ *
+ *  \param [in] Enc     Pointer to the encoder state
+ *  \param [in] Src     Pointer to the input data
+ *  \param [in] SrcLen  Number of input bytes
+ *
+ *  \return Number of input bytes used
+ */
+size_t MM_RleEncode(MM_RleEncoder_t *Enc, const uint8 *Src, size_t SrcLen);
+
+/**
+ * \brief Rewind the run length encoder output buffer
+ *
+ *  \par Description
+ *       Empties the output buffer after the caller wrote its contents.
+ *       An open literal record is closed, the next literal byte starts
+ *       a new record.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] Enc  Pointer to the encoder state
+ */
+void MM_RleEncodeRewind(MM_RleEncoder_t *Enc);
+
+/**
+ * \brief Finish run length encoding
+ *
+ *  \par Description
+ *       Outputs the run held in the encoder state. The output buffer
+ *       then holds the end of the encoded data.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The caller must leave at least #MM_RLE_MAX_EMIT bytes of output
+ *       buffer free.
+ *
+ *  \param [in] Enc  Pointer to the encoder state
+ */
+void MM_RleEncodeFinish(MM_RleEncoder_t *Enc);
+
+/**
+ * \brief Start run length decoding
+ *
+ *  \par Description
+ *       Initializes the decoder state to expect a control byte.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] Dec  Pointer to the decoder state
+ */
+void MM_RleDecodeInit(MM_RleDecoder_t *Dec);
+
+/**
+ * \brief Run length decode data
+ *
+ *  \par Description
+ *       Decodes input bytes into the output buffer until the output
+ *       buffer is full or all input is used, whichever comes first.
+ *       Records may be split anywhere between calls.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A run may still fill more output after all input is used. The
+ *       encoded data is complete when the decoder is back in the
+ *       #MM_RLE_STATE_CTRL state.
+ *
+ *  \param [in]  Dec      Pointer to the decoder state
+ *  \param [in]  Src      Pointer to the input data
+ *  \param [in]  SrcLen   Number of input bytes
+ *  \param [out] SrcUsed  Number of input bytes used
+ *  \param [in]  Dst      Pointer to the output buffer
+ *  \param [in]  DstSize  Size of the output buffer in bytes
+ *
+ *  \return Number of output bytes written
+ */
+size_t MM_RleDecode(MM_RleDecoder_t *Dec, const uint8 *Src, size_t SrcLen, size_t *SrcUsed, uint8 *Dst,
+                    size_t DstSize);
+
+/**
+ * \brief Count leading fill bytes
+ *
+ *  \par Description
+ *       Returns how many bytes at the start of the data equal the fill
+ *       value. Aligned words are compared whole.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] Src        Pointer to the data
+ *  \param [in] SrcLen     Number of bytes to scan
+ *  \param [in] FillValue  Fill value
+ *
+ *  \return Number of leading fill bytes
+ */
+size_t MM_SparseScanFill(const uint8 *Src, size_t SrcLen, uint8 FillValue);
+
+/**
+ * \brief Count leading data bytes
+ *
+ *  \par Description
+ *       Returns how many bytes at the start of the data come before a
+ *       run of at least #MM_SPARSE_MIN_GAP fill bytes or before fill
+ *       bytes that reach the end of the data. Aligned words without a
+ *       fill byte are skipped whole.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Shorter runs of fill bytes are counted as data, an extent record
+ *       costs more than they save.
+ *
+ *  \param [in] Src        Pointer to the data
+ *  \param [in] SrcLen     Number of bytes to scan
+ *  \param [in] FillValue  Fill value
+ *
+ *  \return Number of leading data bytes
+ */
+size_t MM_SparseScanData(const uint8 *Src, size_t SrcLen, uint8 FillValue);
+
+/**
+ * \brief Start sparse encoding
+ *
+ *  \par Description
+ *       Initializes the encoder state to encode into the output buffer.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The output buffer must be larger than a #MM_SparseExtent_t
+ *       record plus #MM_SPARSE_MIN_GAP.
+ *
+ *  \param [in] Enc        Pointer to the encoder state
+ *  \param [in] FillValue  Value of the bytes left out
+ *  \param [in] Out        Pointer to the output buffer
+ *  \param [in] OutSize    Size of the output buffer in bytes
+ */
+void MM_SparseEncodeInit(MM_SparseEncoder_t *Enc, uint8 FillValue, uint8 *Out, size_t OutSize);
+
+/**
+ * \brief Sparse encode data
+ *
+ *  \par Description
+ *       Skips fill bytes and adds an extent for each run of data to the
+ *       output buffer, until all input is used or the output buffer has
+ *       no room for another extent. The input continues the data passed
+ *       to the previous call.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Data that runs past the end of the input or of the output buffer
+ *       continues in an adjacent extent on the next call.
+ *
+ *  \param [in] Enc     Pointer to the encoder state
+ *  \param [in] Src     Pointer to the input data
+ *  \param [in] SrcLen  Number of input bytes
+ *
+ *  \return Number of input bytes used
+ */
+size_t MM_SparseEncode(MM_SparseEncoder_t *Enc, const uint8 *Src, size_t SrcLen);
+
+/**
+ * \brief Start sparse decoding
+ *
+ *  \par Description
+ *       Initializes the decoder state to expect an extent record.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] Dec        Pointer to the decoder state
+ *  \param [in] FillValue  Value of the bytes not in an extent
+ *  \param [in] Size       Size of the decoded data in bytes
+ */
+void MM_SparseDecodeInit(MM_SparseDecoder_t *Dec, uint8 FillValue, uint32 Size);
+
+/**
+ * \brief Sparse decode data
+ *
+ *  \par Description
+ *       Decodes input bytes into the output buffer until the output
+ *       buffer is full or all input is used, whichever comes first.
+ *       Records may be split anywhere between calls.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       An extent before the end of the previous one or past the end of
+ *       the data puts the decoder in the #MM_SPARSE_STATE_ERROR state,
+ *       which uses no more input.
+ *
+ *  \param [in]  Dec      Pointer to the decoder state
+ *  \param [in]  Src      Pointer to the input data
+ *  \param [in]  SrcLen   Number of input bytes
+ *  \param [out] SrcUsed  Number of input bytes used
+ *  \param [in]  Dst      Pointer to the output buffer
+ *  \param [in]  DstSize  Size of the output buffer in bytes
+ *
+ *  \return Number of output bytes written
+ */
+size_t MM_SparseDecode(MM_SparseDecoder_t *Dec, const uint8 *Src, size_t SrcLen, size_t *SrcUsed, uint8 *Dst,
+                       size_t DstSize);
+
+/**
+ * \brief Start file data encoding
+ *
+ *  \par Description
+ *       Initializes the encoder for a file data encoding.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The encoding must be #MM_ENCODING_RLE or #MM_ENCODING_SPARSE.
+ *
+ *  \param [in] Enc        Pointer to the encoder
+ *  \param [in] Encoding   File data encoding, see \ref MMFileEncodings
+ *  \param [in] FillValue  Fill value for #MM_ENCODING_SPARSE
+ *  \param [in] Out        Pointer to the output buffer
+ *  \param [in] OutSize    Size of the output buffer in bytes
+ */
+void MM_FileEncodeInit(MM_FileEncoder_t *Enc, uint8 Encoding, uint8 FillValue, uint8 *Out, size_t OutSize);
+
+/**
+ * \brief Encode file data
+ *
+ *  \par Description
+ *       Encodes input bytes into the output buffer until all input is
+ *       used or #MM_FileEncodeFull reports the output buffer full.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] Enc     Pointer to the encoder
+ *  \param [in] Src     Pointer to the input data
+ *  \param [in] SrcLen  Number of input bytes
+ *
+ *  \return Number of input bytes used
+ */
+size_t MM_FileEncode(MM_FileEncoder_t *Enc, const uint8 *Src, size_t SrcLen);
+
+/**
+ * \brief Check for a full file data encoder output buffer
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The output buffer must be written and rewound before encoding
+ *       more or finishing once it is full.
+ *
+ *  \param [in] Enc  Pointer to the encoder
+ *
+ *  \return true if the output buffer is full
+ */
+bool MM_FileEncodeFull(const MM_FileEncoder_t *Enc);
+
+/**
+ * \brief Get the file data encoder output
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]  Enc  Pointer to the encoder
+ *  \param [out] Out  Set to point to the output buffer
+ *
+ *  \return Number of bytes in the output buffer
+ */
+size_t MM_FileEncodeOutput(const MM_FileEncoder_t *Enc, const uint8 **Out);
+
+/**
+ * \brief Rewind the file data encoder output buffer
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] Enc  Pointer to the encoder
+ */
+void MM_FileEncodeRewind(MM_FileEncoder_t *Enc);
+
+/**
+ * \brief Finish file data encoding
+ *
+ *  \par Description
+ *       Outputs anything the encoder holds. The output buffer then holds
+ *       the end of the encoded data.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The output buffer must not be full.
+ *
+ *  \param [in] Enc  Pointer to the encoder
+ */
+void MM_FileEncodeFinish(MM_FileEncoder_t *Enc);
+
+/**
+ * \brief Start file data decoding
+ *
+ *  \par Description
+ *       Initializes the decoder for a file data encoding.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The encoding must be #MM_ENCODING_RLE or #MM_ENCODING_SPARSE.
+ *
+ *  \param [in] Dec        Pointer to the decoder
+ *  \param [in] Encoding   File data encoding, see \ref MMFileEncodings
+ *  \param [in] FillValue  Fill value for #MM_ENCODING_SPARSE
+ *  \param [in] Size       Size of the decoded data in bytes
+ */
+void MM_FileDecodeInit(MM_FileDecoder_t *Dec, uint8 Encoding, uint8 FillValue, uint32 Size);
+
+/**
+ * \brief Decode file data
+ *
+ *  \par Description
+ *       Decodes input bytes into the output buffer until the output
+ *       buffer is full or all input is used, whichever comes first.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Decoding stops using input when the data is invalid, see
+ *       #MM_FileDecodeDone.
+ *
+ *  \param [in]  Dec      Pointer to the decoder
+ *  \param [in]  Src      Pointer to the input data
+ *  \param [in]  SrcLen   Number of input bytes
+ *  \param [out] SrcUsed  Number of input bytes used
+ *  \param [in]  Dst      Pointer to the output buffer
+ *  \param [in]  DstSize  Size of the output buffer in bytes
+ *
+ *  \return Number of output bytes written
+ */
+size_t MM_FileDecode(MM_FileDecoder_t *Dec, const uint8 *Src, size_t SrcLen, size_t *SrcUsed, uint8 *Dst,
+                     size_t DstSize);
+
+/**
+ * \brief End the file data decoder input
+ *
+ *  \par Description
+ *       Tells the decoder there is no more input, so sparse data fill
+ *       bytes after the last extent can be output.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] Dec  Pointer to the decoder
+ */
+void MM_FileDecodeEnd(MM_FileDecoder_t *Dec);
+
+/**
+ * \brief Check for file data decoder output that needs no input
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] Dec  Pointer to the decoder
+ *
+ *  \return true if #MM_FileDecode can output more without input
+ */
+bool MM_FileDecodePending(const MM_FileDecoder_t *Dec);
+
+/**
+ * \brief Check for complete file data
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] Dec  Pointer to the decoder
+ *
+ *  \return true if the decoder is at the end of a record with no error
+ */
+bool MM_FileDecodeDone(const MM_FileDecoder_t *Dec);
+
+#endif
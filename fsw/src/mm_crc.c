@@ -0,0 +1,130 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   The CFS Memory Manager CRC engine.
+ */
+
+/*************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_crc.h"
+
+/*************************************************************************
+** Local Data
+*************************************************************************/
+
+/*
+** Table k holds the CRC of each byte value followed by k zero bytes,
+** so eight bytes can be folded into the CRC with eight table lookups
+*/
+static uint16 MM_CrcTable[MM_CRC_SLICES][MM_CRC_TBL_SIZE];
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Build the CRC lookup tables                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_CrcInit(void)
+{
+    uint32 i;
+    uint32 Bit;
+    uint32 Slice;
+    uint16 Crc;
+
+    for (i = 0; i < MM_CRC_TBL_SIZE; i++)
+    {
+        Crc = (uint16)i;
+        for (Bit = 0; Bit < 8; Bit++)
+        {
+            if ((Crc & 1) != 0)
+            {
+                Crc = (Crc >> 1) ^ MM_CRC16_POLY;
+            }
+            else
+            {
+                Crc = Crc >> 1;
+            }
+        }
+
+        MM_CrcTable[0][i] = Crc;
+    }
+
+    for (Slice = 1; Slice < MM_CRC_SLICES; Slice++)
+    {
+        for (i = 0; i < MM_CRC_TBL_SIZE; i++)
+        {
+            Crc = MM_CrcTable[Slice - 1][i];
+
+            MM_CrcTable[Slice][i] = (Crc >> 8) ^ MM_CrcTable[0][Crc & 0xFF];
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Calculate a CRC                                                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 MM_CalculateCRC(const void *DataPtr, size_t DataLength, uint32 InputCRC, CFE_ES_CrcType_Enum_t TypeCRC)
+{
+    const uint8 *BytePtr = DataPtr;
+    uint16       Crc;
+    uint32       Result;
+
+    if (TypeCRC != CFE_ES_CrcType_CRC_16)
+    {
+        Result = CFE_ES_CalculateCRC(DataPtr, DataLength, InputCRC, TypeCRC);
+    }
+    else if (DataLength == 0)
+    {
+        Result = InputCRC;
+    }
+    else
+    {
+        Crc = (uint16)InputCRC;
+
+        /*
+        ** The 16 bit CRC only overlaps the first two bytes of each group
+        ** of eight, the other six bytes index their tables directly
+        */
+        while (DataLength >= MM_CRC_SLICES)
+        {
+            Crc = MM_CrcTable[7][(BytePtr[0] ^ Crc) & 0xFF] ^ MM_CrcTable[6][(BytePtr[1] ^ (Crc >> 8)) & 0xFF] ^
+                  MM_CrcTable[5][BytePtr[2]] ^ MM_CrcTable[4][BytePtr[3]] ^ MM_CrcTable[3][BytePtr[4]] ^
+                  MM_CrcTable[2][BytePtr[5]] ^ MM_CrcTable[1][BytePtr[6]] ^ MM_CrcTable[0][BytePtr[7]];
+
+            BytePtr += MM_CRC_SLICES;
+            DataLength -= MM_CRC_SLICES;
+        }
+
+        while (DataLength > 0)
+        {
+            Crc = (Crc >> 8) ^ MM_CrcTable[0][(Crc ^ *BytePtr) & 0xFF];
+
+            BytePtr++;
+            DataLength--;
+        }
+
+        Result = Crc;
+    }
+
+    return Result;
+}
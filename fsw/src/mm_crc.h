@@ -0,0 +1,91 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Memory Manager CRC engine.
+ *
+ *   MM computes its load, dump and load with interrupts disabled CRCs
+ *   with #MM_CalculateCRC. It gives the same result as
+ *   #CFE_ES_CalculateCRC for every CRC type. The 16 bit CRC
+ *   (#CFE_ES_CrcType_CRC_16, CRC-16/ARC) is computed eight bytes at a
+ *   time with slicing-by-8 lookup tables built by #MM_CrcInit, and any
+ *   other type is handed to #CFE_ES_CalculateCRC.
+ */
+#ifndef MM_CRC_H
+#define MM_CRC_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+#include "cfe.h"
+
+/************************************************************************
+ * Macro Definitions
+ ************************************************************************/
+
+/**
+ * \name CRC-16/ARC engine parameters
+ * \{
+ */
+#define MM_CRC16_POLY   0xA001 /**< \brief Reflected CRC-16/ARC polynomial */
+#define MM_CRC_SLICES   8      /**< \brief Bytes processed per slicing step */
+#define MM_CRC_TBL_SIZE 256    /**< \brief Entries in each lookup table */
+/**\}*/
+
+/************************************************************************
+ * Exported Functions
+ ************************************************************************/
+
+/**
+ * \brief Build the CRC lookup tables
+ *
+ *  \par Description
+ *       Fills the slicing-by-8 lookup tables used by #MM_CalculateCRC.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called once during application initialization, before the
+ *       child task is created and before any CRC is computed.
+ */
+void MM_CrcInit(void);
+
+/**
+ * \brief Calculate a CRC
+ *
+ *  \par Description
+ *       Computes the CRC of a block of data, continuing from a previous
+ *       CRC so that data can be processed in pieces. The result is
+ *       identical to #CFE_ES_CalculateCRC for the same arguments.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The data is read a byte at a time, so it may have any alignment.
+ *       If DataLength is zero the InputCRC is returned unchanged.
+ *
+ *  \param [in] DataPtr    Pointer to the data
+ *  \param [in] DataLength Number of bytes of data
+ *  \param [in] InputCRC   CRC of the preceding data, 0 to start
+ *  \param [in] TypeCRC    CRC type to compute
+ *
+ *  \return The CRC of the data
+ *
+ *  \sa #CFE_ES_CalculateCRC
+ */
+uint32 MM_CalculateCRC(const void *DataPtr, size_t DataLength, uint32 InputCRC, CFE_ES_CrcType_Enum_t TypeCRC);
+
+#endif
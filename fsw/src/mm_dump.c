@@ -27,11 +27,13 @@
 *************************************************************************/
 #include "mm_app.h"
 #include "mm_dump.h"
+#include "mm_load.h"
 #include "mm_events.h"
-#include "mm_mem32.h"
-#include "mm_mem16.h"
-#include "mm_mem8.h"
+#include "mm_perfids.h"
+#include "mm_memtype.h"
 #include "mm_utils.h"
+#include "mm_crc.h"
+#include "mm_symidx.h"
 #include "mm_mission_cfg.h"
 #include <string.h>
 
@@ -96,110 +98,760 @@ bool MM_PeekMem(const MM_PeekCmd_t *CmdPtr, cpuaddr SrcAddress)
     uint8  ByteValue      = 0;
     uint16 WordValue      = 0;
     uint32 DWordValue     = 0;
-    int32  PSP_Status     = 0;
     size_t BytesProcessed = 0;
     uint32 DataValue      = 0;
     size_t DataSize       = 0;
     uint32 EventID        = 0;
+    char   SymString[MM_SYM_INDEX_STRING_LEN];
 
     /*
-    ** Read the requested number of bytes and report in an event message
+    ** Read the requested number of bytes with the read routine of the
+    ** memory type, which reports its own errors, and report the data in
+    ** an event message
     */
     switch (CmdPtr->Payload.DataSize)
     {
         case MM_BYTE_BIT_WIDTH:
+            ValidPeek      = MM_ReadMemBlock(SrcAddress, CmdPtr->Payload.MemType, &ByteValue, sizeof(ByteValue));
+            DataValue      = (uint32)ByteValue;
+            BytesProcessed = sizeof(uint8);
+            DataSize       = 8;
+            EventID        = MM_PEEK_BYTE_INF_EID;
+            break;
+
+        case MM_WORD_BIT_WIDTH:
+            ValidPeek      = MM_ReadMemBlock(SrcAddress, CmdPtr->Payload.MemType, &WordValue, sizeof(WordValue));
+            DataValue      = (uint32)WordValue;
+            BytesProcessed = sizeof(uint16);
+            DataSize       = 16;
+            EventID        = MM_PEEK_WORD_INF_EID;
+            break;
+
+        case MM_DWORD_BIT_WIDTH:
+            ValidPeek      = MM_ReadMemBlock(SrcAddress, CmdPtr->Payload.MemType, &DWordValue, sizeof(DWordValue));
+            DataValue      = DWordValue;
+            BytesProcessed = sizeof(uint32);
+            DataSize       = 32;
+            EventID        = MM_PEEK_DWORD_INF_EID;
+            break;
+
+        /*
+        ** We don't need a default case, a bad DataSize will get caught
+        ** in the MM_VerifyPeekPokeParams function and we won't get here
+        */
+        default:
+            break;
+    }
+
+    if (ValidPeek)
+    {
+        MM_AppData.HkPacket.Payload.LastAction     = MM_PEEK;
+        MM_AppData.HkPacket.Payload.MemType        = CmdPtr->Payload.MemType;
+        MM_AppData.HkPacket.Payload.Address        = SrcAddress;
+        MM_AppData.HkPacket.Payload.BytesProcessed = BytesProcessed;
+        MM_AppData.HkPacket.Payload.DataValue      = DataValue;
+
+        /* The symbol goes last so a long name only truncates itself */
+        if (MM_SymIndexFormat(SrcAddress, SymString, sizeof(SymString)))
+        {
+            CFE_EVS_SendEvent(EventID, CFE_EVS_EventType_INFORMATION,
+                              "Peek Command: Addr = %p Size = %u bits Data = 0x%08X Sym = %s", (void *)SrcAddress,
+                              (unsigned int)DataSize, (unsigned int)DataValue, SymString);
+        }
+        else
+        {
+            CFE_EVS_SendEvent(EventID, CFE_EVS_EventType_INFORMATION,
+                              "Peek Command: Addr = %p Size = %u bits Data = 0x%08X", (void *)SrcAddress,
+                              (unsigned int)DataSize, (unsigned int)DataValue);
+        }
+    }
+
+    return ValidPeek;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Dump memory to file command                                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_DumpMemToFileCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    const MM_DumpMemToFileCmd_t *CmdPtr = ((MM_DumpMemToFileCmd_t *)BufPtr);
+
+    return MM_DumpToFile(&CmdPtr->Payload, MM_ENCODING_RAW, 0);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Dump memory to encoded file command                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_DumpMemToFileEncCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    const MM_DumpMemToFileEncCmd_t *CmdPtr = ((MM_DumpMemToFileEncCmd_t *)BufPtr);
+
+    return MM_DumpToFile(&CmdPtr->Payload.Dump, CmdPtr->Payload.Encoding, CmdPtr->Payload.FillValue);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Dump memory to delta file command                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_DumpMemToDeltaFileCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    const MM_DumpMemToDeltaFileCmd_t *   CmdPtr  = ((MM_DumpMemToDeltaFileCmd_t *)BufPtr);
+    const MM_DumpMemToFileCmd_Payload_t *Payload = &CmdPtr->Payload.Dump;
+    bool                                 Valid;
+    int32                                OS_Status;
+    osal_id_t                            FileHandle     = OS_OBJECT_ID_UNDEFINED;
+    osal_id_t                            BaselineHandle = OS_OBJECT_ID_UNDEFINED;
+    cpuaddr                              SrcAddress     = 0;
+    char                                 FileName[OS_MAX_PATH_LEN];
+    char                                 BaselineName[OS_MAX_PATH_LEN];
+    MM_SymAddr_t                         SrcSymAddress;
+    CFE_FS_Header_t                      CFEFileHeader;
+    MM_LoadDumpFileHeader_t              MMFileHeader;
+    MM_DeltaFileHeader_t                 DeltaHeader;
+
+    CFE_ES_PerfLogEntry(MM_DUMP_FILE_PERF_ID);
+
+    SrcSymAddress = Payload->SrcSymAddress;
+
+    /* Make sure strings are null terminated before attempting to process them */
+    CFE_SB_MessageStringGet(FileName, Payload->FileName, NULL, sizeof(FileName), sizeof(Payload->FileName));
+    CFE_SB_MessageStringGet(BaselineName, CmdPtr->Payload.BaselineFileName, NULL, sizeof(BaselineName),
+                            sizeof(CmdPtr->Payload.BaselineFileName));
+
+    /* Resolve the symbolic address in command message */
+    Valid = MM_ResolveSymAddr(&(SrcSymAddress), &SrcAddress);
+    if (Valid == true)
+    {
+        /* Run necessary checks on command parameters */
+        Valid = MM_VerifyLoadDumpParams(SrcAddress, Payload->MemType, Payload->NumOfBytes, MM_VERIFY_DUMP);
+    }
+    else
+    {
+        CFE_EVS_SendEvent(MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Symbolic address can't be resolved: Name = '%s'", SrcSymAddress.SymName);
+    }
+
+    /* Blocks are compared a byte at a time */
+    if ((Valid == true) && (Payload->MemType != MM_RAM) && (Payload->MemType != MM_EEPROM))
+    {
+        Valid = false;
+        CFE_EVS_SendEvent(MM_FILE_ENCODING_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "File encoding not supported: Encoding = %u MemType = %u", (unsigned int)MM_ENCODING_DELTA,
+                          (unsigned int)Payload->MemType);
+    }
+
+    if (Valid == true)
+    {
+        memset(&MMFileHeader, 0, sizeof(MMFileHeader));
+        MMFileHeader.SymAddress.SymName[0] = MM_CLEAR_SYMNAME;
+        MMFileHeader.SymAddress.Offset     = SrcAddress;
+        MMFileHeader.MemType               = Payload->MemType;
+        MMFileHeader.NumOfBytes            = Payload->NumOfBytes;
+        MMFileHeader.Encoding              = MM_ENCODING_DELTA;
+
+        Valid = MM_OpenDeltaBaseline(BaselineName, &MMFileHeader, &BaselineHandle, &DeltaHeader);
+    }
+
+    if (Valid == true)
+    {
+        CFE_FS_InitHeader(&CFEFileHeader, MM_CFE_HDR_DESCRIPTION, MM_CFE_HDR_SUBTYPE);
+
+        CFE_ES_PerfLogEntry(MM_FILE_OPEN_PERF_ID);
+        OS_Status = OS_OpenCreate(&FileHandle, FileName, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+        CFE_ES_PerfLogExit(MM_FILE_OPEN_PERF_ID);
+        if (OS_Status == OS_SUCCESS)
+        {
+            /* The block map is written with the headers, so its space is reserved first */
+            Valid = MM_WriteFileHeaders(FileName, FileHandle, &CFEFileHeader, &MMFileHeader);
+            if (Valid == true)
+            {
+                Valid = MM_WriteDeltaHeader(FileName, FileHandle, &DeltaHeader);
+            }
+
+            if (Valid == true)
+            {
+                Valid = MM_DumpMemToDeltaFile(FileHandle, FileName, BaselineHandle, BaselineName, &MMFileHeader,
+                                              &DeltaHeader);
+            }
+
+            /* Rewrite the headers with the dump CRC and the block map */
+            if (Valid == true)
+            {
+                Valid = MM_WriteFileHeaders(FileName, FileHandle, &CFEFileHeader, &MMFileHeader);
+            }
+            if (Valid == true)
+            {
+                Valid = MM_WriteDeltaHeader(FileName, FileHandle, &DeltaHeader);
+            }
+
+            if (Valid == true)
+            {
+                CFE_EVS_SendEvent(MM_DMP_DELTA_FILE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "Dump Memory To Delta File Command: %u of %u blocks changed from address %p to "
+                                  "file '%s'",
+                                  (unsigned int)DeltaHeader.ChangedBlocks, (unsigned int)DeltaHeader.NumOfBlocks,
+                                  (void *)SrcAddress, FileName);
+            }
+
+            CFE_ES_PerfLogEntry(MM_FILE_CLOSE_PERF_ID);
+            OS_Status = OS_close(FileHandle);
+            CFE_ES_PerfLogExit(MM_FILE_CLOSE_PERF_ID);
+            if (OS_Status != OS_SUCCESS)
+            {
+                Valid = false;
+                CFE_EVS_SendEvent(MM_OS_CLOSE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "OS_close error received: RC = 0x%08X File = '%s'", (unsigned int)OS_Status,
+                                  FileName);
+            }
+        }
+        else
+        {
+            Valid = false;
+            CFE_EVS_SendEvent(MM_OS_CREAT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "OS_OpenCreate error received: RC = %d File = '%s'", (int)OS_Status, FileName);
+        }
+
+        OS_close(BaselineHandle);
+    }
+
+    CFE_ES_PerfLogExit(MM_DUMP_FILE_PERF_ID);
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Open and check the baseline file of a delta dump                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_OpenDeltaBaseline(const char *FileName, const MM_LoadDumpFileHeader_t *DumpHeader, osal_id_t *FileHandle,
+                          MM_DeltaFileHeader_t *DeltaHeader)
+{
+    bool                    Valid = false;
+    int32                   OS_Status;
+    CFE_FS_Header_t         CFEHeader;
+    MM_LoadDumpFileHeader_t BaselineHeader;
+
+    CFE_ES_PerfLogEntry(MM_FILE_OPEN_PERF_ID);
+    OS_Status = OS_OpenCreate(FileHandle, FileName, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+    CFE_ES_PerfLogExit(MM_FILE_OPEN_PERF_ID);
+    if (OS_Status == OS_SUCCESS)
+    {
+        Valid = MM_ReadFileHeaders(FileName, *FileHandle, &CFEHeader, &BaselineHeader);
+
+        /* The baseline must be a plain copy of the same memory range */
+        if ((Valid == true) &&
+            ((BaselineHeader.Encoding != MM_ENCODING_RAW) || (BaselineHeader.MemType != DumpHeader->MemType) ||
+             (BaselineHeader.NumOfBytes != DumpHeader->NumOfBytes)))
+        {
+            Valid = false;
+            CFE_EVS_SendEvent(MM_DELTA_BASELINE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Delta dump baseline mismatch: Encoding = %u MemType = %u Bytes = %u, expected raw "
+                              "MemType = %u Bytes = %u File = '%s'",
+                              (unsigned int)BaselineHeader.Encoding, (unsigned int)BaselineHeader.MemType,
+                              (unsigned int)BaselineHeader.NumOfBytes, (unsigned int)DumpHeader->MemType,
+                              (unsigned int)DumpHeader->NumOfBytes, FileName);
+        }
+
+        if (Valid == true)
+        {
+            DeltaHeader->BaselineCrc   = BaselineHeader.Crc;
+            DeltaHeader->BlockSize     = MM_DELTA_BLOCK_SIZE;
+            DeltaHeader->NumOfBlocks   = (DumpHeader->NumOfBytes + MM_DELTA_BLOCK_SIZE - 1) / MM_DELTA_BLOCK_SIZE;
+            DeltaHeader->ChangedBlocks = 0;
+
+            memset(MM_AppData.DeltaBlockMap, 0, sizeof(MM_AppData.DeltaBlockMap));
+        }
+        else
+        {
+            OS_close(*FileHandle);
+            *FileHandle = OS_OBJECT_ID_UNDEFINED;
+        }
+    }
+    else
+    {
+        CFE_EVS_SendEvent(MM_OS_OPEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "OS_OpenCreate error received: RC = %d File = '%s'", (int)OS_Status, FileName);
+    }
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Dump the blocks of memory that differ from a baseline file      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_DumpMemToDeltaFile(osal_id_t FileHandle, const char *FileName, osal_id_t BaselineHandle,
+                           const char *BaselineName, MM_LoadDumpFileHeader_t *FileHeader,
+                           MM_DeltaFileHeader_t *DeltaHeader)
+{
+    bool   ValidDump      = true;
+    int32  OS_Status;
+    uint32 BytesRemaining = FileHeader->NumOfBytes;
+    uint32 Block          = 0;
+    uint32 BaselineCrc    = 0;
+    size_t BlockSize      = MM_DELTA_BLOCK_SIZE;
+    size_t OutLen         = 0;
+    size_t SegmentFill    = 0;
+    size_t SegmentSize    = MM_SegmentStart(MM_SEG_DUMP);
+    uint8 *SourcePtr      = (uint8 *)(FileHeader->SymAddress.Offset);
+    uint8 *BaselineBlock  = (uint8 *)&MM_AppData.IoBuffer[0];
+    uint8 *OutBuffer      = &BaselineBlock[MM_DELTA_BLOCK_SIZE];
+    uint8 *MemBlock;
+
+    /* The first i/o buffer block holds the baseline, the rest holds the changed blocks */
+    while ((BytesRemaining != 0) && (ValidDump == true))
+    {
+        if (BytesRemaining < BlockSize)
+        {
+            BlockSize = BytesRemaining;
+        }
+
+        MM_SegmentIoStart();
+        OS_Status = OS_read(BaselineHandle, BaselineBlock, BlockSize);
+        MM_SegmentIoEnd();
+        if (OS_Status != BlockSize)
+        {
+            ValidDump = false;
+            CFE_EVS_SendEvent(MM_OS_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "OS_read error received: RC = 0x%08X Expected = %u File = '%s'", (unsigned int)OS_Status,
+                              (unsigned int)BlockSize, BaselineName);
+        }
+        else
+        {
+            /* Compare a copy, so the block written is the one compared and in the CRC */
+            MemBlock = &OutBuffer[OutLen];
+
+            CFE_ES_PerfLogEntry(MM_SEGCOPY_PERF_ID);
+            memcpy(MemBlock, SourcePtr, BlockSize);
+            CFE_ES_PerfLogExit(MM_SEGCOPY_PERF_ID);
+
+            CFE_ES_PerfLogEntry(MM_FILE_CRC_PERF_ID);
+            FileHeader->Crc = MM_CalculateCRC(MemBlock, BlockSize, FileHeader->Crc, MM_DUMP_FILE_CRC_TYPE);
+            BaselineCrc     = MM_CalculateCRC(BaselineBlock, BlockSize, BaselineCrc, MM_DUMP_FILE_CRC_TYPE);
+            CFE_ES_PerfLogExit(MM_FILE_CRC_PERF_ID);
+
+            /* A changed block is kept in the output, an unchanged one is overwritten by the next block */
+            if (memcmp(MemBlock, BaselineBlock, BlockSize) != 0)
+            {
+                MM_AppData.DeltaBlockMap[Block / 8] |= (uint8)(1 << (Block % 8));
+                DeltaHeader->ChangedBlocks++;
+                OutLen += BlockSize;
+            }
+
+            SourcePtr += BlockSize;
+            BytesRemaining -= BlockSize;
+            SegmentFill += BlockSize;
+            Block++;
+
+            /* Write the changed blocks once another won't fit or the dump is complete */
+            if ((OutLen != 0) &&
+                (((MM_IO_BUFFER_SIZE - MM_DELTA_BLOCK_SIZE - OutLen) < MM_DELTA_BLOCK_SIZE) || (BytesRemaining == 0)))
+            {
+                MM_SegmentIoStart();
+                OS_Status = OS_write(FileHandle, OutBuffer, OutLen);
+                MM_SegmentIoEnd();
+                if (OS_Status != OutLen)
+                {
+                    ValidDump = false;
+                    CFE_EVS_SendEvent(MM_OS_WRITE_EXP_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "OS_write error received: RC = %d, Expected = %u, File = '%s'", (int)OS_Status,
+                                      (unsigned int)OutLen, FileName);
+                }
+                OutLen = 0;
+            }
+
+            /* Prevent CPU hogging between dump segments */
+            if ((SegmentFill >= SegmentSize) && (BytesRemaining != 0) && (ValidDump == true))
+            {
+                SegmentSize = MM_SegmentBreak(SegmentFill);
+                SegmentFill = 0;
+            }
+        }
+    }
+
+    /* The delta only describes memory if the baseline is the data its CRC was computed over */
+    if ((ValidDump == true) && (BaselineCrc != DeltaHeader->BaselineCrc))
+    {
+        ValidDump = false;
+        CFE_EVS_SendEvent(MM_DELTA_BASELINE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Delta dump baseline CRC mismatch: Computed = 0x%08X Expected = 0x%08X File = '%s'",
+                          (unsigned int)BaselineCrc, (unsigned int)DeltaHeader->BaselineCrc, BaselineName);
+    }
+
+    /* Update last action statistics */
+    if (ValidDump == true)
+    {
+        MM_AppData.HkPacket.Payload.LastAction     = MM_DUMP_TO_FILE;
+        MM_AppData.HkPacket.Payload.MemType        = FileHeader->MemType;
+        MM_AppData.HkPacket.Payload.Address        = FileHeader->SymAddress.Offset;
+        MM_AppData.HkPacket.Payload.BytesProcessed = FileHeader->NumOfBytes;
+        strncpy(MM_AppData.HkPacket.Payload.FileName, FileName, OS_MAX_PATH_LEN);
+
+        MM_SegmentEnd(FileHeader->NumOfBytes);
+    }
+
+    return ValidDump;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write the delta file header and block map                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_WriteDeltaHeader(const char *FileName, osal_id_t FileHandle, const MM_DeltaFileHeader_t *DeltaHeader)
+{
+    bool   Valid   = true;
+    int32  OS_Status;
+    size_t MapSize = (DeltaHeader->NumOfBlocks + 7) / 8;
+
+    CFE_ES_PerfLogEntry(MM_FILE_HDR_PERF_ID);
+
+    OS_Status = OS_write(FileHandle, DeltaHeader, sizeof(MM_DeltaFileHeader_t));
+    if (OS_Status != sizeof(MM_DeltaFileHeader_t))
+    {
+        Valid = false;
+        CFE_EVS_SendEvent(MM_OS_WRITE_EXP_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "OS_write error received: RC = %d Expected = %u File = '%s'", (int)OS_Status,
+                          (unsigned int)sizeof(MM_DeltaFileHeader_t), FileName);
+    }
+    else
+    {
+        OS_Status = OS_write(FileHandle, MM_AppData.DeltaBlockMap, MapSize);
+        if (OS_Status != MapSize)
+        {
+            Valid = false;
+            CFE_EVS_SendEvent(MM_OS_WRITE_EXP_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "OS_write error received: RC = %d Expected = %u File = '%s'", (int)OS_Status,
+                              (unsigned int)MapSize, FileName);
+        }
+    }
+
+    CFE_ES_PerfLogExit(MM_FILE_HDR_PERF_ID);
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Dump memory to multi-region file command                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_DumpMemToMultiFileCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    const MM_DumpMemToMultiFileCmd_t *CmdPtr = ((MM_DumpMemToMultiFileCmd_t *)BufPtr);
+    bool                              Valid;
+    int32                             OS_Status;
+    osal_id_t                         FileHandle = OS_OBJECT_ID_UNDEFINED;
+    uint32                            TotalBytes = 0;
+    char                              FileName[OS_MAX_PATH_LEN];
+    char                              RegionFileName[OS_MAX_PATH_LEN];
+    CFE_FS_Header_t                   CFEFileHeader;
+    MM_LoadDumpFileHeader_t           MMFileHeader;
+    MM_MultiFileHeader_t              MultiHeader;
+
+    memset(&MultiHeader, 0, sizeof(MultiHeader));
+
+    CFE_ES_PerfLogEntry(MM_DUMP_FILE_PERF_ID);
+
+    /* Make sure strings are null terminated before attempting to process them */
+    CFE_SB_MessageStringGet(FileName, CmdPtr->Payload.FileName, NULL, sizeof(FileName),
+                            sizeof(CmdPtr->Payload.FileName));
+    CFE_SB_MessageStringGet(RegionFileName, CmdPtr->Payload.RegionFileName, NULL, sizeof(RegionFileName),
+                            sizeof(CmdPtr->Payload.RegionFileName));
+
+    /* Every region is resolved and checked before the dump file is created */
+    Valid = MM_ReadDumpRegionFile(RegionFileName, &MultiHeader, &TotalBytes);
+
+    if (Valid == true)
+    {
+        CFE_FS_InitHeader(&CFEFileHeader, MM_CFE_HDR_DESCRIPTION, MM_CFE_HDR_SUBTYPE);
+
+        memset(&MMFileHeader, 0, sizeof(MMFileHeader));
+        MMFileHeader.SymAddress.SymName[0] = MM_CLEAR_SYMNAME;
+        MMFileHeader.NumOfBytes            = TotalBytes;
+        MMFileHeader.Encoding              = MM_ENCODING_MULTI;
+
+        CFE_ES_PerfLogEntry(MM_FILE_OPEN_PERF_ID);
+        OS_Status = OS_OpenCreate(&FileHandle, FileName, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+        CFE_ES_PerfLogExit(MM_FILE_OPEN_PERF_ID);
+        if (OS_Status == OS_SUCCESS)
+        {
+            /* The region table is written with the headers, so its space is reserved first */
+            Valid = MM_WriteFileHeaders(FileName, FileHandle, &CFEFileHeader, &MMFileHeader);
+            if (Valid == true)
+            {
+                Valid = MM_WriteMultiFileTable(FileName, FileHandle, &MultiHeader);
+            }
+
+            if (Valid == true)
+            {
+                Valid = MM_DumpMemToMultiFile(FileHandle, FileName, &MultiHeader);
+            }
+
+            /* Rewrite the headers with the region CRCs and the region table CRC */
+            if (Valid == true)
+            {
+                MMFileHeader.Crc = MM_CalculateCRC(&MultiHeader, sizeof(MultiHeader), 0, MM_DUMP_FILE_CRC_TYPE);
+                MMFileHeader.Crc = MM_CalculateCRC(MM_AppData.FileRegions,
+                                                   MultiHeader.NumOfRegions * sizeof(MM_LoadDumpFileHeader_t),
+                                                   MMFileHeader.Crc, MM_DUMP_FILE_CRC_TYPE);
+
+                Valid = MM_WriteFileHeaders(FileName, FileHandle, &CFEFileHeader, &MMFileHeader);
+            }
+            if (Valid == true)
+            {
+                Valid = MM_WriteMultiFileTable(FileName, FileHandle, &MultiHeader);
+            }
+
+            if (Valid == true)
+            {
+                CFE_EVS_SendEvent(MM_DMP_MULTI_FILE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "Dump Memory To Multi-Region File Command: Dumped %u bytes from %u regions to file "
+                                  "'%s'",
+                                  (unsigned int)TotalBytes, (unsigned int)MultiHeader.NumOfRegions, FileName);
+            }
+
+            CFE_ES_PerfLogEntry(MM_FILE_CLOSE_PERF_ID);
+            OS_Status = OS_close(FileHandle);
+            CFE_ES_PerfLogExit(MM_FILE_CLOSE_PERF_ID);
+            if (OS_Status != OS_SUCCESS)
+            {
+                Valid = false;
+                CFE_EVS_SendEvent(MM_OS_CLOSE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "OS_close error received: RC = 0x%08X File = '%s'", (unsigned int)OS_Status,
+                                  FileName);
+            }
+        }
+        else
+        {
+            Valid = false;
+            CFE_EVS_SendEvent(MM_OS_CREAT_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "OS_OpenCreate error received: RC = %d File = '%s'", (int)OS_Status, FileName);
+        }
+    }
+
+    CFE_ES_PerfLogExit(MM_DUMP_FILE_PERF_ID);
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Read and resolve the regions of a multi-region dump             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_ReadDumpRegionFile(const char *FileName, MM_MultiFileHeader_t *MultiHeader, uint32 *TotalBytes)
+{
+    bool                    Valid;
+    int32                   OS_Status;
+    osal_id_t               FileHandle = OS_OBJECT_ID_UNDEFINED;
+    uint32                  i;
+    CFE_FS_Header_t         CFEFileHeader;
+    MM_LoadDumpFileHeader_t MMFileHeader;
+
+    memset(&MMFileHeader, 0, sizeof(MMFileHeader));
+
+    CFE_ES_PerfLogEntry(MM_FILE_OPEN_PERF_ID);
+    OS_Status = OS_OpenCreate(&FileHandle, FileName, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+    CFE_ES_PerfLogExit(MM_FILE_OPEN_PERF_ID);
+    if (OS_Status == OS_SUCCESS)
+    {
+        Valid = MM_ReadFileHeaders(FileName, FileHandle, &CFEFileHeader, &MMFileHeader);
+
+        if ((Valid == true) && (MMFileHeader.Encoding != MM_ENCODING_MULTI))
+        {
+            Valid = false;
+            CFE_EVS_SendEvent(MM_FILE_ENCODING_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "File encoding not supported: Encoding = %u MemType = %u",
+                              (unsigned int)MMFileHeader.Encoding, (unsigned int)MMFileHeader.MemType);
+        }
+
+        /* Only the region table is needed, any region data in the file is not read */
+        if (Valid == true)
+        {
+            Valid = MM_ReadMultiFileTable(FileHandle, FileName, &MMFileHeader, MultiHeader);
+        }
+
+        OS_close(FileHandle);
+    }
+    else
+    {
+        Valid = false;
+        CFE_EVS_SendEvent(MM_OS_OPEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "OS_OpenCreate error received: RC = %d File = '%s'", (int)OS_Status, FileName);
+    }
 
-            PSP_Status = CFE_PSP_MemRead8(SrcAddress, &ByteValue);
-            DataSize   = 8;
-            if (PSP_Status == CFE_PSP_SUCCESS)
-            {
-                DataValue      = (uint32)ByteValue;
-                BytesProcessed = sizeof(uint8);
-                EventID        = MM_PEEK_BYTE_INF_EID;
-                ValidPeek      = true;
-            }
-            break;
+    *TotalBytes = 0;
+    for (i = 0; (Valid == true) && (i < MultiHeader->NumOfRegions); i++)
+    {
+        Valid = MM_VerifyDumpRegion(FileName, &MM_AppData.FileRegions[i], i);
+        *TotalBytes += MM_AppData.FileRegions[i].NumOfBytes;
+    }
 
-        case MM_WORD_BIT_WIDTH:
+    return Valid;
+}
 
-            PSP_Status = CFE_PSP_MemRead16(SrcAddress, &WordValue);
-            DataSize   = 16;
-            if (PSP_Status == CFE_PSP_SUCCESS)
-            {
-                DataValue      = (uint32)WordValue;
-                BytesProcessed = sizeof(uint16);
-                EventID        = MM_PEEK_WORD_INF_EID;
-                ValidPeek      = true;
-            }
-            break;
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify a multi-region dump region and resolve its address       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_VerifyDumpRegion(const char *FileName, MM_LoadDumpFileHeader_t *Region, uint32 RegionNum)
+{
+    bool    Valid      = false;
+    cpuaddr SrcAddress = 0;
 
-        case MM_DWORD_BIT_WIDTH:
+    if (Region->Encoding != MM_ENCODING_RAW)
+    {
+        CFE_EVS_SendEvent(MM_MULTI_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Multi-region file region %u encoding not supported: Encoding = %u File = '%s'",
+                          (unsigned int)RegionNum, (unsigned int)Region->Encoding, FileName);
+    }
+    else if (MM_ResolveSymAddr(&(Region->SymAddress), &SrcAddress) == false)
+    {
+        CFE_EVS_SendEvent(MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Symbolic address can't be resolved: Name = '%s'", Region->SymAddress.SymName);
+    }
+    else
+    {
+        Valid = MM_VerifyLoadDumpParams(SrcAddress, Region->MemType, Region->NumOfBytes, MM_VERIFY_DUMP);
+    }
 
-            PSP_Status = CFE_PSP_MemRead32(SrcAddress, &DWordValue);
-            DataSize   = 32;
-            if (PSP_Status == CFE_PSP_SUCCESS)
-            {
-                DataValue      = DWordValue;
-                BytesProcessed = sizeof(uint32);
-                EventID        = MM_PEEK_DWORD_INF_EID;
-                ValidPeek      = true;
-            }
-            break;
+    /* The dump file holds the resolved address, the same as a single region dump */
+    if (Valid == true)
+    {
+        memset(&Region->SymAddress, 0, sizeof(Region->SymAddress));
+        Region->SymAddress.SymName[0] = MM_CLEAR_SYMNAME;
+        Region->SymAddress.Offset     = SrcAddress;
+        Region->Crc                   = 0;
+        Region->FillValue             = 0;
+    }
 
-        /*
-        ** We don't need a default case, a bad DataSize will get caught
-        ** in the MM_VerifyPeekPokeParams function and we won't get here
-        */
-        default:
-            break;
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Dump the regions of a multi-region dump                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_DumpMemToMultiFile(osal_id_t FileHandle, const char *FileName, const MM_MultiFileHeader_t *MultiHeader)
+{
+    bool   Valid          = true;
+    size_t BytesProcessed = 0;
+    uint32 i;
+
+    /* The regions make up one dump in the statistics and throughput */
+    MM_SegmentMultiStart(MM_SEG_DUMP);
+
+    for (i = 0; (Valid == true) && (i < MultiHeader->NumOfRegions); i++)
+    {
+        Valid = MM_DumpFileRegion(FileHandle, FileName, &MM_AppData.FileRegions[i]);
+        BytesProcessed += MM_AppData.FileRegions[i].NumOfBytes;
     }
 
-    if (ValidPeek)
+    MM_SegmentMultiEnd(Valid, BytesProcessed);
+
+    /* Each region dump updates the last action, report the whole file */
+    if (Valid == true)
     {
-        MM_AppData.HkPacket.Payload.LastAction     = MM_PEEK;
-        MM_AppData.HkPacket.Payload.MemType        = CmdPtr->Payload.MemType;
-        MM_AppData.HkPacket.Payload.Address        = SrcAddress;
+        MM_AppData.HkPacket.Payload.LastAction     = MM_DUMP_TO_FILE;
+        MM_AppData.HkPacket.Payload.MemType        = MM_AppData.FileRegions[0].MemType;
+        MM_AppData.HkPacket.Payload.Address        = MM_AppData.FileRegions[0].SymAddress.Offset;
         MM_AppData.HkPacket.Payload.BytesProcessed = BytesProcessed;
-        MM_AppData.HkPacket.Payload.DataValue      = DataValue;
+    }
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Dump one region of a multi-region dump                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_DumpFileRegion(osal_id_t FileHandle, const char *FileName, MM_LoadDumpFileHeader_t *Region)
+{
+    bool                      Valid  = false;
+    const MM_MemTypeDriver_t *Driver = MM_MemTypeGet(Region->MemType);
+
+    /* The dump routines accumulate the region CRC as the data is written */
+    /* A bad MemType is caught when the region is verified */
+    if (Driver != NULL)
+    {
+        Valid = Driver->DumpToFile(FileHandle, FileName, Region);
+    }
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write the multi-region header and region table                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_WriteMultiFileTable(const char *FileName, osal_id_t FileHandle, const MM_MultiFileHeader_t *MultiHeader)
+{
+    bool   Valid     = true;
+    int32  OS_Status;
+    size_t TableSize = MultiHeader->NumOfRegions * sizeof(MM_LoadDumpFileHeader_t);
 
-        CFE_EVS_SendEvent(EventID, CFE_EVS_EventType_INFORMATION,
-                          "Peek Command: Addr = %p Size = %u bits Data = 0x%08X", (void *)SrcAddress,
-                          (unsigned int)DataSize, (unsigned int)DataValue);
+    CFE_ES_PerfLogEntry(MM_FILE_HDR_PERF_ID);
+
+    OS_Status = OS_write(FileHandle, MultiHeader, sizeof(MM_MultiFileHeader_t));
+    if (OS_Status != sizeof(MM_MultiFileHeader_t))
+    {
+        Valid = false;
+        CFE_EVS_SendEvent(MM_OS_WRITE_EXP_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "OS_write error received: RC = %d Expected = %u File = '%s'", (int)OS_Status,
+                          (unsigned int)sizeof(MM_MultiFileHeader_t), FileName);
     }
     else
     {
-        CFE_EVS_SendEvent(MM_PSP_READ_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "PSP read memory error: RC=%d, Address=%p, MemType=MEM%u", (int)PSP_Status,
-                          (void *)SrcAddress, (unsigned int)DataSize);
+        OS_Status = OS_write(FileHandle, MM_AppData.FileRegions, TableSize);
+        if (OS_Status != TableSize)
+        {
+            Valid = false;
+            CFE_EVS_SendEvent(MM_OS_WRITE_EXP_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "OS_write error received: RC = %d Expected = %u File = '%s'", (int)OS_Status,
+                              (unsigned int)TableSize, FileName);
+        }
     }
 
-    return ValidPeek;
+    CFE_ES_PerfLogExit(MM_FILE_HDR_PERF_ID);
+
+    return Valid;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Dump memory to file command                                      */
+/* Dump memory to a file with the requested encoding               */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-bool MM_DumpMemToFileCmd(const CFE_SB_Buffer_t *BufPtr)
+bool MM_DumpToFile(const MM_DumpMemToFileCmd_Payload_t *Payload, uint8 Encoding, uint8 FillValue)
 {
-    bool                         Valid = false;
-    int32                        OS_Status;
-    osal_id_t                    FileHandle = OS_OBJECT_ID_UNDEFINED;
-    cpuaddr                      SrcAddress = 0;
-    char                         FileName[OS_MAX_PATH_LEN];
-    MM_SymAddr_t                 SrcSymAddress;
-    const MM_DumpMemToFileCmd_t *CmdPtr;
-    CFE_FS_Header_t              CFEFileHeader;
-    MM_LoadDumpFileHeader_t      MMFileHeader;
-
-    CmdPtr = ((MM_DumpMemToFileCmd_t *)BufPtr);
+    bool                      Valid = false;
+    int32                     OS_Status;
+    osal_id_t                 FileHandle = OS_OBJECT_ID_UNDEFINED;
+    cpuaddr                   SrcAddress = 0;
+    char                      FileName[OS_MAX_PATH_LEN];
+    MM_SymAddr_t              SrcSymAddress;
+    CFE_FS_Header_t           CFEFileHeader;
+    MM_LoadDumpFileHeader_t   MMFileHeader;
+    const MM_MemTypeDriver_t *Driver;
 
-    SrcSymAddress = CmdPtr->Payload.SrcSymAddress;
+    CFE_ES_PerfLogEntry(MM_DUMP_FILE_PERF_ID);
+
+    SrcSymAddress = Payload->SrcSymAddress;
 
     /* Make sure strings are null terminated before attempting to process them */
-    CFE_SB_MessageStringGet(FileName, CmdPtr->Payload.FileName, NULL, sizeof(FileName),
-                            sizeof(CmdPtr->Payload.FileName));
+    CFE_SB_MessageStringGet(FileName, Payload->FileName, NULL, sizeof(FileName), sizeof(Payload->FileName));
 
     /* Resolve the symbolic address in command message */
     Valid = MM_ResolveSymAddr(&(SrcSymAddress), &SrcAddress);
@@ -207,8 +859,12 @@ bool MM_DumpMemToFileCmd(const CFE_SB_Buffer_t *BufPtr)
     if (Valid == true)
     {
         /* Run necessary checks on command parameters */
-        Valid =
-            MM_VerifyLoadDumpParams(SrcAddress, CmdPtr->Payload.MemType, CmdPtr->Payload.NumOfBytes, MM_VERIFY_DUMP);
+        Valid = MM_VerifyLoadDumpParams(SrcAddress, Payload->MemType, Payload->NumOfBytes, MM_VERIFY_DUMP);
+
+        if (Valid == true)
+        {
+            Valid = MM_VerifyFileEncoding(Encoding, Payload->MemType);
+        }
 
         if (Valid == true)
         {
@@ -227,86 +883,52 @@ bool MM_DumpMemToFileCmd(const CFE_SB_Buffer_t *BufPtr)
             ** Copy command data to file secondary header
             */
             MMFileHeader.SymAddress.Offset = SrcAddress;
-            MMFileHeader.MemType           = CmdPtr->Payload.MemType;
-            MMFileHeader.NumOfBytes        = CmdPtr->Payload.NumOfBytes;
+            MMFileHeader.MemType           = Payload->MemType;
+            MMFileHeader.NumOfBytes        = Payload->NumOfBytes;
+            MMFileHeader.Encoding          = Encoding;
+            MMFileHeader.FillValue         = FillValue;
 
             /*
             ** Create and open dump file
             */
+            CFE_ES_PerfLogEntry(MM_FILE_OPEN_PERF_ID);
             OS_Status =
                 OS_OpenCreate(&FileHandle, FileName, OS_FILE_FLAG_CREATE | OS_FILE_FLAG_TRUNCATE, OS_READ_WRITE);
+            CFE_ES_PerfLogExit(MM_FILE_OPEN_PERF_ID);
             if (OS_Status == OS_SUCCESS)
             {
                 /* Write the file headers */
                 Valid = MM_WriteFileHeaders(FileName, FileHandle, &CFEFileHeader, &MMFileHeader);
                 if (Valid == true)
                 {
-                    switch (MMFileHeader.MemType)
+                    Driver = MM_MemTypeGet(MMFileHeader.MemType);
+
+                    /* Encoded dumps are limited to RAM and EEPROM by MM_VerifyFileEncoding */
+                    if (Encoding != MM_ENCODING_RAW)
+                    {
+                        Valid = MM_DumpMemToEncodedFile(FileHandle, FileName, &MMFileHeader);
+                    }
+                    else if (Driver != NULL)
                     {
-                        case MM_RAM:
-                        case MM_EEPROM:
-                            Valid = MM_DumpMemToFile(FileHandle, FileName, &MMFileHeader);
-                            break;
-
-#ifdef MM_OPT_CODE_MEM32_MEMTYPE
-                        case MM_MEM32:
-                            Valid = MM_DumpMem32ToFile(FileHandle, FileName, &MMFileHeader);
-                            break;
-#endif /* MM_OPT_CODE_MEM32_MEMTYPE */
-
-#ifdef MM_OPT_CODE_MEM16_MEMTYPE
-                        case MM_MEM16:
-                            Valid = MM_DumpMem16ToFile(FileHandle, FileName, &MMFileHeader);
-                            break;
-#endif /* MM_OPT_CODE_MEM16_MEMTYPE */
-
-#ifdef MM_OPT_CODE_MEM8_MEMTYPE
-                        case MM_MEM8:
-                            Valid = MM_DumpMem8ToFile(FileHandle, FileName, &MMFileHeader);
-                            break;
-#endif /* MM_OPT_CODE_MEM8_MEMTYPE */
-                        default:
-                            /* This branch will never be executed. MMFileHeader.MemType will always
-                             * be valid value for this switch statement it is verified via
-                             * MM_VerifyFileLoadDumpParams */
-                            Valid = false;
-                            break;
+                        Valid = Driver->DumpToFile(FileHandle, FileName, &MMFileHeader);
+                    }
+                    else
+                    {
+                        /* This branch will never be executed. MMFileHeader.MemType will always
+                         * be valid, it is verified via MM_VerifyLoadDumpParams */
+                        Valid = false;
                     }
 
                     if (Valid == true)
                     {
                         /*
-                        ** Compute CRC of dumped data
+                        ** The dump routines accumulated the CRC of the dumped data
+                        ** while writing it, so only the headers need to be rewritten.
+                        ** MM_WriteFileHeaders takes care of moving the file pointer to
+                        ** the beginning of the file so we don't need to do it here.
                         */
-                        OS_Status = OS_lseek(FileHandle, (sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t)),
-                                             OS_SEEK_SET);
-                        if (OS_Status != (sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t)))
-                        {
-                            Valid = false;
-                        }
-                        else
-                        {
-                            OS_Status = MM_ComputeCRCFromFile(FileHandle, &MMFileHeader.Crc, MM_DUMP_FILE_CRC_TYPE);
-                            if (OS_Status == OS_SUCCESS)
-                            {
-                                /*
-                                ** Rewrite the file headers. The subfunctions will take care of moving
-                                ** the file pointer to the beginning of the file so we don't need to do it
-                                ** here.
-                                */
-                                Valid = MM_WriteFileHeaders(FileName, FileHandle, &CFEFileHeader, &MMFileHeader);
-
-                            } /* end MM_ComputeCRCFromFile if */
-                            else
-                            {
-                                Valid = false;
-                                CFE_EVS_SendEvent(MM_COMPUTECRCFROMFILE_ERR_EID, CFE_EVS_EventType_ERROR,
-                                                  "MM_ComputeCRCFromFile error received: RC = 0x%08X File = '%s'",
-                                                  (unsigned int)OS_Status, FileName);
-                            }
-                        }
-
-                    } /* end Valid == true if */
+                        Valid = MM_WriteFileHeaders(FileName, FileHandle, &CFEFileHeader, &MMFileHeader);
+                    }
 
                     if (Valid == true)
                     {
@@ -319,15 +941,18 @@ bool MM_DumpMemToFileCmd(const CFE_SB_Buffer_t *BufPtr)
                         */
                         MM_AppData.HkPacket.Payload.LastAction = MM_DUMP_TO_FILE;
                         snprintf(MM_AppData.HkPacket.Payload.FileName, OS_MAX_PATH_LEN, "%s", FileName);
-                        MM_AppData.HkPacket.Payload.MemType        = CmdPtr->Payload.MemType;
+                        MM_AppData.HkPacket.Payload.MemType        = Payload->MemType;
                         MM_AppData.HkPacket.Payload.Address        = SrcAddress;
-                        MM_AppData.HkPacket.Payload.BytesProcessed = CmdPtr->Payload.NumOfBytes;
+                        MM_AppData.HkPacket.Payload.BytesProcessed = Payload->NumOfBytes;
                     }
 
                 } /* end MM_WriteFileHeaders if */
 
                 /* Close dump file */
-                if ((OS_Status = OS_close(FileHandle)) != OS_SUCCESS)
+                CFE_ES_PerfLogEntry(MM_FILE_CLOSE_PERF_ID);
+                OS_Status = OS_close(FileHandle);
+                CFE_ES_PerfLogExit(MM_FILE_CLOSE_PERF_ID);
+                if (OS_Status != OS_SUCCESS)
                 {
                     Valid = false;
                     CFE_EVS_SendEvent(MM_OS_CLOSE_ERR_EID, CFE_EVS_EventType_ERROR,
@@ -353,6 +978,8 @@ bool MM_DumpMemToFileCmd(const CFE_SB_Buffer_t *BufPtr)
                           "Symbolic address can't be resolved: Name = '%s'", SrcSymAddress.SymName);
     }
 
+    CFE_ES_PerfLogExit(MM_DUMP_FILE_PERF_ID);
+
     return Valid;
 }
 
@@ -361,44 +988,67 @@ bool MM_DumpMemToFileCmd(const CFE_SB_Buffer_t *BufPtr)
 /* Dump the requested number of bytes from memory to a file        */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-bool MM_DumpMemToFile(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader)
+bool MM_DumpMemToFile(osal_id_t FileHandle, const char *FileName, MM_LoadDumpFileHeader_t *FileHeader)
 {
     bool   ValidDump = false;
     int32  OS_Status;
     uint32 BytesRemaining = FileHeader->NumOfBytes;
     size_t BytesProcessed = 0;
-    size_t SegmentSize    = MM_MAX_DUMP_DATA_SEG;
+    size_t BlockSize      = 0;
+    size_t SegmentSize    = MM_SegmentStart(MM_SEG_DUMP);
     uint8 *SourcePtr      = (uint8 *)(FileHeader->SymAddress.Offset);
-    uint8 *ioBuffer       = (uint8 *)&MM_AppData.DumpBuffer[0];
+    uint8 *ioBuffer       = (uint8 *)&MM_AppData.IoBuffer[0];
 
     while (BytesRemaining != 0)
     {
-        if (BytesRemaining < MM_MAX_DUMP_DATA_SEG)
+        if (BytesRemaining < SegmentSize)
         {
             SegmentSize = BytesRemaining;
         }
 
-        memcpy(ioBuffer, SourcePtr, SegmentSize);
+        /* A segment never crosses an i/o block boundary */
+        if ((MM_IO_BUFFER_SIZE - BlockSize) < SegmentSize)
+        {
+            SegmentSize = MM_IO_BUFFER_SIZE - BlockSize;
+        }
+
+        CFE_ES_PerfLogEntry(MM_SEGCOPY_PERF_ID);
+        memcpy(&ioBuffer[BlockSize], SourcePtr, SegmentSize);
+        CFE_ES_PerfLogExit(MM_SEGCOPY_PERF_ID);
+
+        SourcePtr += SegmentSize;
+        BlockSize += SegmentSize;
+        BytesRemaining -= SegmentSize;
 
-        OS_Status = OS_write(FileHandle, ioBuffer, SegmentSize);
-        if (OS_Status == SegmentSize)
+        /* Write a file block once the i/o buffer is full or the dump is complete */
+        if ((BlockSize == MM_IO_BUFFER_SIZE) || (BytesRemaining == 0))
         {
-            SourcePtr += SegmentSize;
-            BytesRemaining -= SegmentSize;
-            BytesProcessed += SegmentSize;
+            MM_SegmentIoStart();
+            OS_Status = OS_write(FileHandle, ioBuffer, BlockSize);
+            MM_SegmentIoEnd();
+            if (OS_Status == BlockSize)
+            {
+                /* Accumulate the dump file CRC as each block is written */
+                CFE_ES_PerfLogEntry(MM_FILE_CRC_PERF_ID);
+                FileHeader->Crc = MM_CalculateCRC(ioBuffer, BlockSize, FileHeader->Crc, MM_DUMP_FILE_CRC_TYPE);
+                CFE_ES_PerfLogExit(MM_FILE_CRC_PERF_ID);
 
-            /* Prevent CPU hogging between dump segments */
-            if (BytesRemaining != 0)
+                BytesProcessed += BlockSize;
+                BlockSize = 0;
+            }
+            else
             {
-                MM_SegmentBreak();
+                BytesRemaining = 0;
+                CFE_EVS_SendEvent(MM_OS_WRITE_EXP_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "OS_write error received: RC = %d, Expected = %u, File = '%s'", (int)OS_Status,
+                                  (unsigned int)BlockSize, FileName);
             }
         }
-        else
+
+        /* Prevent CPU hogging between dump segments */
+        if (BytesRemaining != 0)
         {
-            BytesRemaining = 0;
-            CFE_EVS_SendEvent(MM_OS_WRITE_EXP_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "OS_write error received: RC = %d, Expected = %u, File = '%s'", (int)OS_Status,
-                              (unsigned int)SegmentSize, FileName);
+            SegmentSize = MM_SegmentBreak(SegmentSize);
         }
     }
 
@@ -411,11 +1061,132 @@ bool MM_DumpMemToFile(osal_id_t FileHandle, const char *FileName, const MM_LoadD
         MM_AppData.HkPacket.Payload.Address        = FileHeader->SymAddress.Offset;
         MM_AppData.HkPacket.Payload.BytesProcessed = BytesProcessed;
         strncpy(MM_AppData.HkPacket.Payload.FileName, FileName, OS_MAX_PATH_LEN);
+
+        MM_SegmentEnd(BytesProcessed);
+    }
+
+    return ValidDump;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Dump memory to an encoded file                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_DumpMemToEncodedFile(osal_id_t FileHandle, const char *FileName, MM_LoadDumpFileHeader_t *FileHeader)
+{
+    bool             ValidDump      = true;
+    uint32           BytesRemaining = FileHeader->NumOfBytes;
+    size_t           BytesEncoded   = 0;
+    size_t           SegmentSize    = MM_SegmentStart(MM_SEG_DUMP);
+    uint8 *          SourcePtr      = (uint8 *)(FileHeader->SymAddress.Offset);
+    uint8 *          CopyBuffer     = (uint8 *)&MM_AppData.IoBuffer[0];
+    MM_FileEncoder_t Encoder;
+
+    /* The first part of the i/o buffer holds the memory copy, the rest the encoder output */
+    MM_FileEncodeInit(&Encoder, FileHeader->Encoding, FileHeader->FillValue, &CopyBuffer[MM_ENCODE_COPY_SIZE],
+                      MM_IO_BUFFER_SIZE - MM_ENCODE_COPY_SIZE);
+
+    while ((BytesRemaining != 0) && (ValidDump == true))
+    {
+        if (BytesRemaining < SegmentSize)
+        {
+            SegmentSize = BytesRemaining;
+        }
+
+        /* A segment never exceeds the memory copy */
+        if (SegmentSize > MM_ENCODE_COPY_SIZE)
+        {
+            SegmentSize = MM_ENCODE_COPY_SIZE;
+        }
+
+        /* Encode a copy, so the bytes in the file CRC are the bytes encoded */
+        CFE_ES_PerfLogEntry(MM_SEGCOPY_PERF_ID);
+        memcpy(CopyBuffer, SourcePtr, SegmentSize);
+        CFE_ES_PerfLogExit(MM_SEGCOPY_PERF_ID);
+
+        /* The file CRC is of the memory dumped, so a load can verify what it decodes */
+        CFE_ES_PerfLogEntry(MM_FILE_CRC_PERF_ID);
+        FileHeader->Crc = MM_CalculateCRC(CopyBuffer, SegmentSize, FileHeader->Crc, MM_DUMP_FILE_CRC_TYPE);
+        CFE_ES_PerfLogExit(MM_FILE_CRC_PERF_ID);
+
+        BytesEncoded = 0;
+        while ((BytesEncoded < SegmentSize) && (ValidDump == true))
+        {
+            CFE_ES_PerfLogEntry(MM_SEGCOPY_PERF_ID);
+            BytesEncoded += MM_FileEncode(&Encoder, &CopyBuffer[BytesEncoded], SegmentSize - BytesEncoded);
+            CFE_ES_PerfLogExit(MM_SEGCOPY_PERF_ID);
+
+            /* Write a file block once the encoder can't add more to the i/o buffer */
+            if (MM_FileEncodeFull(&Encoder))
+            {
+                ValidDump = MM_WriteEncodedBlock(FileHandle, FileName, &Encoder);
+            }
+        }
+
+        SourcePtr += SegmentSize;
+        BytesRemaining -= SegmentSize;
+
+        /* Prevent CPU hogging between dump segments */
+        if ((BytesRemaining != 0) && (ValidDump == true))
+        {
+            SegmentSize = MM_SegmentBreak(SegmentSize);
+        }
+    }
+
+    if (ValidDump == true)
+    {
+        MM_FileEncodeFinish(&Encoder);
+        ValidDump = MM_WriteEncodedBlock(FileHandle, FileName, &Encoder);
+    }
+
+    /* Update last action statistics */
+    if (ValidDump == true)
+    {
+        MM_AppData.HkPacket.Payload.LastAction     = MM_DUMP_TO_FILE;
+        MM_AppData.HkPacket.Payload.MemType        = FileHeader->MemType;
+        MM_AppData.HkPacket.Payload.Address        = FileHeader->SymAddress.Offset;
+        MM_AppData.HkPacket.Payload.BytesProcessed = FileHeader->NumOfBytes;
+        strncpy(MM_AppData.HkPacket.Payload.FileName, FileName, OS_MAX_PATH_LEN);
+
+        MM_SegmentEnd(FileHeader->NumOfBytes);
     }
 
     return ValidDump;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write the file data encoder output to a dump file               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_WriteEncodedBlock(osal_id_t FileHandle, const char *FileName, MM_FileEncoder_t *Encoder)
+{
+    bool         Valid = true;
+    int32        OS_Status;
+    const uint8 *Out;
+    size_t       OutLen;
+
+    OutLen = MM_FileEncodeOutput(Encoder, &Out);
+    if (OutLen != 0)
+    {
+        MM_SegmentIoStart();
+        OS_Status = OS_write(FileHandle, Out, OutLen);
+        MM_SegmentIoEnd();
+        if (OS_Status != OutLen)
+        {
+            Valid = false;
+            CFE_EVS_SendEvent(MM_OS_WRITE_EXP_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "OS_write error received: RC = %d, Expected = %u, File = '%s'", (int)OS_Status,
+                              (unsigned int)OutLen, FileName);
+        }
+    }
+
+    MM_FileEncodeRewind(Encoder);
+
+    return Valid;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Write the cFE primary and MM secondary file headers         */
@@ -427,6 +1198,8 @@ bool MM_WriteFileHeaders(const char *FileName, osal_id_t FileHandle, CFE_FS_Head
     bool  Valid = true;
     int32 OS_Status;
 
+    CFE_ES_PerfLogEntry(MM_FILE_HDR_PERF_ID);
+
     /*
     ** Write out the primary cFE file header
     */
@@ -458,6 +1231,8 @@ bool MM_WriteFileHeaders(const char *FileName, osal_id_t FileHandle, CFE_FS_Head
 
     } /* end CFE_FS_WriteHeader else */
 
+    CFE_ES_PerfLogExit(MM_FILE_HDR_PERF_ID);
+
     return Valid;
 }
 
@@ -475,6 +1250,7 @@ bool MM_DumpInEventCmd(const CFE_SB_Buffer_t *BufPtr)
     cpuaddr                    SrcAddress             = 0;
     uint8 *                    BytePtr;
     char                       TempString[MM_DUMPINEVENT_TEMP_CHARS];
+    char                       SymString[MM_SYM_INDEX_STRING_LEN];
     const char                 HeaderString[] = "Memory Dump: ";
     static char                EventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
     MM_SymAddr_t               SrcSymAddress;
@@ -540,6 +1316,18 @@ bool MM_DumpInEventCmd(const CFE_SB_Buffer_t *BufPtr)
                 snprintf(TempString, MM_DUMPINEVENT_TEMP_CHARS, "from address: %p", (void *)SrcAddress);
                 CFE_SB_MessageStringGet(&EventString[EventStringTotalLength], TempString, NULL,
                                         sizeof(EventString) - EventStringTotalLength, sizeof(TempString));
+                EventStringTotalLength = OS_strnlen(EventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+                /*
+                ** Append the symbol containing the address, " (sym+0x10)", only if
+                ** all of it fits so the event never ends with a partial symbol
+                */
+                if (MM_SymIndexFormat(SrcAddress, SymString, sizeof(SymString)) &&
+                    ((sizeof(EventString) - EventStringTotalLength) > (OS_strnlen(SymString, sizeof(SymString)) + 3)))
+                {
+                    snprintf(&EventString[EventStringTotalLength], sizeof(EventString) - EventStringTotalLength,
+                             " (%s)", SymString);
+                }
 
                 /* Send it out */
                 CFE_EVS_SendEvent(MM_DUMP_INEVENT_INF_EID, CFE_EVS_EventType_INFORMATION, "%s", EventString);
@@ -568,102 +1356,76 @@ bool MM_DumpInEventCmd(const CFE_SB_Buffer_t *BufPtr)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 bool MM_FillDumpInEventBuffer(cpuaddr SrcAddress, const MM_DumpInEventCmd_t *CmdPtr, void *DumpBuffer)
 {
-#if defined(MM_OPT_CODE_MEM8_MEMTYPE) || defined(MM_OPT_CODE_MEM16_MEMTYPE) || defined(MM_OPT_CODE_MEM32_MEMTYPE)
-    uint32 i;
-#endif
-    /* cppcheck-suppress unusedVariable */
-    int32 PSP_Status;
-    bool  Valid = true;
+    bool                      Valid  = false;
+    const MM_MemTypeDriver_t *Driver = MM_MemTypeGet(CmdPtr->Payload.MemType);
 
     /* Initialize buffer */
     memset(DumpBuffer, 0, MM_MAX_DUMP_INEVENT_BYTES);
 
-    switch (CmdPtr->Payload.MemType)
+    /* This check will never fail. CmdPtr->Payload.MemType will always
+     * be valid, it is verified via MM_VerifyLoadDumpParams */
+    if (Driver != NULL)
     {
-        case MM_RAM:
-        case MM_EEPROM:
-            memcpy((void *)DumpBuffer, (void *)SrcAddress, CmdPtr->Payload.NumOfBytes);
-            break;
+        Valid = Driver->Read(SrcAddress, DumpBuffer, CmdPtr->Payload.NumOfBytes);
+    }
 
-#ifdef MM_OPT_CODE_MEM32_MEMTYPE
-        case MM_MEM32:
-            for (i = 0; i < (CmdPtr->Payload.NumOfBytes / 4); i++)
-            {
-                PSP_Status = CFE_PSP_MemRead32(SrcAddress, (uint32 *)DumpBuffer);
-                if (PSP_Status == CFE_PSP_SUCCESS)
-                {
-                    SrcAddress += sizeof(uint32);
-                    DumpBuffer = (uint8 *)DumpBuffer + sizeof(uint32);
-                }
-                else
-                {
-                    /* CFE_PSP_MemRead32 error */
-                    Valid = false;
-                    CFE_EVS_SendEvent(MM_PSP_READ_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "PSP read memory error: RC=%d, Src=%p, Tgt=%p, Type=MEM32", (int)PSP_Status,
-                                      (void *)SrcAddress, (void *)DumpBuffer);
-                    /* Stop load dump buffer loop */
-                    break;
-                }
-            }
-            break;
-#endif /* MM_OPT_CODE_MEM32_MEMTYPE */
+    return Valid;
+}
 
-#ifdef MM_OPT_CODE_MEM16_MEMTYPE
-        case MM_MEM16:
-            for (i = 0; i < (CmdPtr->Payload.NumOfBytes / 2); i++)
-            {
-                PSP_Status = CFE_PSP_MemRead16(SrcAddress, (uint16 *)DumpBuffer);
-                if (PSP_Status == CFE_PSP_SUCCESS)
-                {
-                    SrcAddress += sizeof(uint16);
-                    DumpBuffer = (uint8 *)DumpBuffer + sizeof(uint16);
-                }
-                else
-                {
-                    /* CFE_PSP_MemRead16 error */
-                    Valid = false;
-                    CFE_EVS_SendEvent(MM_PSP_READ_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "PSP read memory error: RC=%d, Src=%p, Tgt=%p, Type=MEM16", (int)PSP_Status,
-                                      (void *)SrcAddress, (void *)DumpBuffer);
-                    /* Stop load dump buffer loop */
-                    break;
-                }
-            }
-            break;
-#endif /* MM_OPT_CODE_MEM16_MEMTYPE */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* CRC memory command                                              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_CrcMemCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    cpuaddr               SrcAddress    = 0;
+    uint32                Crc           = 0;
+    const MM_CrcMemCmd_t *CmdPtr        = (MM_CrcMemCmd_t *)BufPtr;
+    bool                  Valid         = false;
+    MM_SymAddr_t          SrcSymAddress = CmdPtr->Payload.SrcSymAddress;
 
-#ifdef MM_OPT_CODE_MEM8_MEMTYPE
-        case MM_MEM8:
-            for (i = 0; i < CmdPtr->Payload.NumOfBytes; i++)
-            {
-                PSP_Status = CFE_PSP_MemRead8(SrcAddress, (uint8 *)DumpBuffer);
-                if (PSP_Status == CFE_PSP_SUCCESS)
-                {
-                    SrcAddress++;
-                    DumpBuffer = (uint8 *)DumpBuffer + 1;
-                }
-                else
-                {
-                    /* CFE_PSP_MemRead8 error */
-                    Valid = false;
-                    CFE_EVS_SendEvent(MM_PSP_READ_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "PSP read memory error: RC=%d, Src=%p, Tgt=%p, Type=MEM8", (int)PSP_Status,
-                                      (void *)SrcAddress, (void *)DumpBuffer);
-                    /* Stop load dump buffer loop */
-                    break;
-                }
-            }
-            break;
-#endif /* MM_OPT_CODE_MEM8_MEMTYPE */
-        default:
-            /* This branch will never be executed. CmdPtr->Payload.MemType will always
-             * be valid value for this switch statement it is verified via
-             * MM_VerifyFileLoadDumpParams */
-            Valid = false;
-            break;
+    CFE_ES_PerfLogEntry(MM_CRC_PERF_ID);
+
+    /* Resolve the symbolic source address in the command message */
+    Valid = MM_ResolveSymAddr(&(SrcSymAddress), &SrcAddress);
+    if (Valid == true)
+    {
+        /* The range is read like a dump, just without the file */
+        Valid =
+            MM_VerifyLoadDumpParams(SrcAddress, CmdPtr->Payload.MemType, CmdPtr->Payload.NumOfBytes, MM_VERIFY_DUMP);
+    }
+    else
+    {
+        CFE_EVS_SendEvent(MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Symbolic address can't be resolved: Name = '%s'", SrcSymAddress.SymName);
+    }
+
+    if (Valid == true)
+    {
+        MM_SegmentStart(MM_SEG_CRC);
+
+        Valid = MM_ComputeMemCRC(SrcAddress, CmdPtr->Payload.MemType, CmdPtr->Payload.NumOfBytes, &Crc,
+                                 MM_DUMP_FILE_CRC_TYPE);
+    }
+
+    if (Valid == true)
+    {
+        /* Update last action statistics */
+        MM_AppData.HkPacket.Payload.LastAction     = MM_CRC;
+        MM_AppData.HkPacket.Payload.MemType        = CmdPtr->Payload.MemType;
+        MM_AppData.HkPacket.Payload.Address        = SrcAddress;
+        MM_AppData.HkPacket.Payload.DataValue      = Crc;
+        MM_AppData.HkPacket.Payload.BytesProcessed = CmdPtr->Payload.NumOfBytes;
+
+        MM_SegmentEnd(CmdPtr->Payload.NumOfBytes);
+
+        CFE_EVS_SendEvent(MM_CRC_MEM_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "CRC Memory Command: %d bytes at address: %p, CRC = 0x%08X",
+                          (int)CmdPtr->Payload.NumOfBytes, (void *)SrcAddress, (unsigned int)Crc);
+    }
 
-    } /* end CmdPtr->Payload.MemType switch */
+    CFE_ES_PerfLogExit(MM_CRC_PERF_ID);
 
     return Valid;
 }
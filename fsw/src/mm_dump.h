@@ -30,6 +30,7 @@
 #include "cfe.h"
 #include "mm_msg.h"
 #include "mm_filedefs.h"
+#include "mm_codec.h"
 
 /************************************************************************
  * Macro Definitions
@@ -46,6 +47,9 @@
  *    Message head "Memory Dump: "             13 characters
  *    Message body "0xFF "                      5 characters per dump byte
  *    Message tail "from address: 0xFFFFFFFF"  33 characters including NUL on 64-bit system
+ *
+ * A " (symbol+0x10)" suffix from the reverse symbol index is only added
+ * when the whole of it fits in the space left over.
  */
 #define MM_MAX_DUMP_INEVENT_BYTES ((CFE_MISSION_EVS_MAX_MESSAGE_LENGTH - (13 + 33)) / 5)
 
@@ -58,6 +62,15 @@
  */
 #define MM_DUMPINEVENT_TEMP_CHARS 36
 
+/**
+ * \brief Encoded dump memory copy size
+ *
+ * An encoded dump copies each segment of memory into the first part of
+ * the i/o buffer and computes the file CRC of, and encodes, that copy.
+ * The rest of the i/o buffer holds the encoder output.
+ */
+#define MM_ENCODE_COPY_SIZE (MM_IO_BUFFER_SIZE / 2)
+
 /*************************************************************************
  * Exported Functions
  *************************************************************************/
@@ -67,10 +80,11 @@
  *
  *  \par Description
  *       Support function for #MM_PeekCmd. This routine will read
- *       8, 16, or 32 bits of data and send it in an event message.
+ *       8, 16, or 32 bits of data with the read routine of the memory
+ *       type driver and send it in an event message.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       The driver sends the error event if the read fails.
  *
  *  \param [in]   CmdPtr       Pointer to the command
  *  \param [in]   SrcAddress   The source address for the peek operation
@@ -85,18 +99,289 @@ bool MM_PeekMem(const MM_PeekCmd_t *CmdPtr, cpuaddr SrcAddress);
  *       read an address range and store the data in a file.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       The CRC of each segment is folded into FileHeader->Crc as it is
+ *       written, so the caller must initialize it to zero.
+ *
+ *  \param [in]   FileHandle   The open file handle of the dump file
+ *  \param [in]   FileName     A pointer to a character string holding
+ *                             the dump file name
+ *  \param [in,out] FileHeader Pointer to the dump file header structure initialized,
+ *                             returned with the CRC of the dumped data
+ *
+ *  \return Boolean execution status
+ *  \retval true Dump completed successfully
+ *  \retval false Dump failed
+ */
+bool MM_DumpMemToFile(osal_id_t FileHandle, const char *FileName, MM_LoadDumpFileHeader_t *FileHeader);
+
+/**
+ * \brief Memory dump to encoded file
+ *
+ *  \par Description
+ *       Support function for #MM_DumpToFile. This routine will read
+ *       an address range and store the data in a file with the encoding
+ *       and fill value set in the file header.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The CRC is of the memory dumped, not of the encoded file data.
+ *       It is folded into FileHeader->Crc segment by segment, so the
+ *       caller must initialize it to zero. Each segment is read from
+ *       memory once, into a copy that is both in the CRC and encoded.
  *
  *  \param [in]   FileHandle   The open file handle of the dump file
  *  \param [in]   FileName     A pointer to a character string holding
  *                             the dump file name
- *  \param [in]   FileHeader   Pointer to the dump file header structure initialized
+ *  \param [in,out] FileHeader Pointer to the dump file header structure initialized,
+ *                             returned with the CRC of the dumped data
  *
  *  \return Boolean execution status
  *  \retval true Dump completed successfully
  *  \retval false Dump failed
  */
-bool MM_DumpMemToFile(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader);
+bool MM_DumpMemToEncodedFile(osal_id_t FileHandle, const char *FileName, MM_LoadDumpFileHeader_t *FileHeader);
+
+/**
+ * \brief Write the file data encoder output to a dump file
+ *
+ *  \par Description
+ *       Support function for #MM_DumpMemToEncodedFile. Writes the encoded
+ *       data in the encoder output buffer to the dump file and rewinds
+ *       the output buffer.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   FileHandle   The open file handle of the dump file
+ *  \param [in]   FileName     A pointer to a character string holding
+ *                             the dump file name
+ *  \param [in]   Encoder      Pointer to the file data encoder
+ *
+ *  \return Boolean execution status
+ *  \retval true  Encoded data written successfully
+ *  \retval false Write failed
+ */
+bool MM_WriteEncodedBlock(osal_id_t FileHandle, const char *FileName, MM_FileEncoder_t *Encoder);
+
+/**
+ * \brief Dump memory to a file
+ *
+ *  \par Description
+ *       Support function for #MM_DumpMemToFileCmd and
+ *       #MM_DumpMemToFileEncCmd. Verifies the dump parameters, writes
+ *       the file headers and dumps the memory with the requested data
+ *       encoding.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   Payload      Pointer to the dump to file command payload
+ *  \param [in]   Encoding     File data encoding, see \ref MMFileEncodings
+ *  \param [in]   FillValue    Fill value for #MM_ENCODING_SPARSE
+ *
+ *  \return Boolean execution status
+ *  \retval true  Dump completed successfully
+ *  \retval false Dump failed
+ */
+bool MM_DumpToFile(const MM_DumpMemToFileCmd_Payload_t *Payload, uint8 Encoding, uint8 FillValue);
+
+/**
+ * \brief Open and check the baseline file of a delta dump
+ *
+ *  \par Description
+ *       Support function for #MM_DumpMemToDeltaFileCmd. Opens the
+ *       baseline dump file, checks it is an unencoded dump of the same
+ *       memory type and size as the delta dump and initializes the delta
+ *       file header and block map from it.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The baseline file is left positioned at its dump data. It is
+ *       closed and the handle undefined if the baseline is rejected.
+ *
+ *  \param [in]   FileName     A pointer to a character string holding
+ *                             the baseline file name
+ *  \param [in]   DumpHeader   Pointer to the delta dump file header
+ *  \param [out]  FileHandle   The open file handle of the baseline file
+ *  \param [out]  DeltaHeader  Pointer to the delta file header to initialize
+ *
+ *  \return Boolean execution status
+ *  \retval true  Baseline file opened and matches the dump
+ *  \retval false Baseline file can't be opened or doesn't match the dump
+ */
+bool MM_OpenDeltaBaseline(const char *FileName, const MM_LoadDumpFileHeader_t *DumpHeader, osal_id_t *FileHandle,
+                          MM_DeltaFileHeader_t *DeltaHeader);
+
+/**
+ * \brief Memory dump to delta file
+ *
+ *  \par Description
+ *       Support function for #MM_DumpMemToDeltaFileCmd. Reads the
+ *       baseline file a block at a time, compares each block against
+ *       memory and writes only the memory blocks that differ, marking
+ *       them in the block map.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       FileHeader->Crc is the CRC of all the memory dumped, so the
+ *       caller must initialize it to zero. The dump fails if the CRC
+ *       of the baseline data doesn't match DeltaHeader->BaselineCrc.
+ *
+ *  \param [in]   FileHandle     The open file handle of the delta file
+ *  \param [in]   FileName       A pointer to a character string holding
+ *                               the delta file name
+ *  \param [in]   BaselineHandle The open file handle of the baseline file
+ *  \param [in]   BaselineName   A pointer to a character string holding
+ *                               the baseline file name
+ *  \param [in,out] FileHeader   Pointer to the dump file header structure initialized,
+ *                               returned with the CRC of the dumped data
+ *  \param [in,out] DeltaHeader  Pointer to the delta file header, returned
+ *                               with the number of changed blocks
+ *
+ *  \return Boolean execution status
+ *  \retval true  Dump completed successfully
+ *  \retval false Dump failed
+ */
+bool MM_DumpMemToDeltaFile(osal_id_t FileHandle, const char *FileName, osal_id_t BaselineHandle,
+                           const char *BaselineName, MM_LoadDumpFileHeader_t *FileHeader,
+                           MM_DeltaFileHeader_t *DeltaHeader);
+
+/**
+ * \brief Write the delta file header and block map
+ *
+ *  \par Description
+ *       Support function for #MM_DumpMemToDeltaFileCmd. Writes the
+ *       delta file header followed by the block map at the current
+ *       file position.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must follow #MM_WriteFileHeaders, which leaves the file pointer
+ *       after the MM secondary header.
+ *
+ *  \param [in]   FileName     A pointer to a character string holding
+ *                             the file name (used only for error event
+ *                             messages).
+ *  \param [in]   FileHandle   File Descriptor to write the header to
+ *  \param [in]   DeltaHeader  Pointer to the delta file header to be written
+ *
+ *  \return Boolean execution status
+ *  \retval true  Header written successfully
+ *  \retval false Header write failed
+ */
+bool MM_WriteDeltaHeader(const char *FileName, osal_id_t FileHandle, const MM_DeltaFileHeader_t *DeltaHeader);
+
+/**
+ * \brief Read and resolve the regions of a multi-region dump
+ *
+ *  \par Description
+ *       Support function for #MM_DumpMemToMultiFileCmd. Reads the region
+ *       table of a region file into the MM global data with
+ *       #MM_ReadMultiFileTable and checks each region with
+ *       #MM_VerifyDumpRegion.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The region file is closed before returning.
+ *
+ *  \param [in]   FileName     A pointer to a character string holding
+ *                             the region file name
+ *  \param [out]  MultiHeader  Pointer to the multi-region header read from the file
+ *  \param [out]  TotalBytes   Number of bytes in all regions
+ *
+ *  \return Boolean execution status
+ *  \retval true  Every region can be dumped
+ *  \retval false The region file or one of its regions is invalid
+ */
+bool MM_ReadDumpRegionFile(const char *FileName, MM_MultiFileHeader_t *MultiHeader, uint32 *TotalBytes);
+
+/**
+ * \brief Verify a multi-region dump region
+ *
+ *  \par Description
+ *       Support function for #MM_ReadDumpRegionFile. Checks the region is
+ *       #MM_ENCODING_RAW, resolves its symbolic address and checks its
+ *       address, memory type and size the same way as for a dump. The
+ *       region table entry is then set up for the dump file, with the
+ *       resolved address and a cleared CRC.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   FileName   A pointer to a character string holding
+ *                           the region file name
+ *  \param [in]   Region     Pointer to the region table entry
+ *  \param [in]   RegionNum  Index of the region in the table
+ *
+ *  \return Boolean region verification result
+ *  \retval true  Region is valid
+ *  \retval false Region is invalid
+ */
+bool MM_VerifyDumpRegion(const char *FileName, MM_LoadDumpFileHeader_t *Region, uint32 RegionNum);
+
+/**
+ * \brief Dump the regions of a multi-region dump
+ *
+ *  \par Description
+ *       Support function for #MM_DumpMemToMultiFileCmd. Dumps each
+ *       region with #MM_DumpFileRegion in table order.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The file must be positioned after the region table. The regions
+ *       are recorded as one dump in the statistics telemetry, see
+ *       #MM_SegmentMultiStart.
+ *
+ *  \param [in]   FileHandle   File Descriptor to write the regions to
+ *  \param [in]   FileName     A pointer to a character string holding
+ *                             the dump file name
+ *  \param [in]   MultiHeader  Pointer to the multi-region header
+ *
+ *  \return Boolean execution status
+ *  \retval true  All regions dumped successfully
+ *  \retval false A region dump failed
+ */
+bool MM_DumpMemToMultiFile(osal_id_t FileHandle, const char *FileName, const MM_MultiFileHeader_t *MultiHeader);
+
+/**
+ * \brief Dump one region of a multi-region dump
+ *
+ *  \par Description
+ *       Support function for #MM_DumpMemToMultiFile. Dumps the region
+ *       with the dump file routine for the region memory type, which
+ *       sets the region CRC.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   FileHandle  File Descriptor to write the region to
+ *  \param [in]   FileName    A pointer to a character string holding
+ *                            the dump file name
+ *  \param [in]   Region      Pointer to the region table entry
+ *
+ *  \return Boolean execution status
+ *  \retval true  Region dumped successfully
+ *  \retval false Region dump failed
+ */
+bool MM_DumpFileRegion(osal_id_t FileHandle, const char *FileName, MM_LoadDumpFileHeader_t *Region);
+
+/**
+ * \brief Write the multi-region header and region table
+ *
+ *  \par Description
+ *       Support function for #MM_DumpMemToMultiFileCmd. Writes the
+ *       multi-region header followed by the region table at the current
+ *       file position.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Must follow #MM_WriteFileHeaders, which leaves the file pointer
+ *       after the MM secondary header.
+ *
+ *  \param [in]   FileName     A pointer to a character string holding
+ *                             the file name (used only for error event
+ *                             messages).
+ *  \param [in]   FileHandle   File Descriptor to write the table to
+ *  \param [in]   MultiHeader  Pointer to the multi-region header to be written
+ *
+ *  \return Boolean execution status
+ *  \retval true  Table written successfully
+ *  \retval false Table write failed
+ */
+bool MM_WriteMultiFileTable(const char *FileName, osal_id_t FileHandle, const MM_MultiFileHeader_t *MultiHeader);
 
 /**
  * \brief Write the cFE primary and MM secondary file headers
@@ -180,6 +465,58 @@ bool MM_PeekCmd(const CFE_SB_Buffer_t *BufPtr);
  */
 bool MM_DumpMemToFileCmd(const CFE_SB_Buffer_t *BufPtr);
 
+/**
+ * \brief Process memory dump to encoded file command
+ *
+ *  \par Description
+ *       Processes the memory dump to encoded file command that will
+ *       read an address range of memory and store the data in a
+ *       command specified file with the command specified encoding.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ *
+ *  \sa #MM_DUMP_MEM_TO_FILE_ENC_CC
+ */
+bool MM_DumpMemToFileEncCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Process memory dump to delta file command
+ *
+ *  \par Description
+ *       Processes the memory dump to delta file command that will
+ *       compare an address range of memory against a baseline dump
+ *       file and store only the blocks that changed in a command
+ *       specified file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ *
+ *  \sa #MM_DUMP_MEM_TO_DELTA_FILE_CC
+ */
+bool MM_DumpMemToDeltaFileCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Process memory dump to multi-region file command
+ *
+ *  \par Description
+ *       Processes the memory dump to multi-region file command that will
+ *       dump each region listed in a region file to one command
+ *       specified file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ *
+ *  \sa #MM_DUMP_MEM_TO_MULTI_FILE_CC
+ */
+bool MM_DumpMemToMultiFileCmd(const CFE_SB_Buffer_t *BufPtr);
+
 /**
  * \brief Process memory dump in event command
  *
@@ -197,4 +534,22 @@ bool MM_DumpMemToFileCmd(const CFE_SB_Buffer_t *BufPtr);
  */
 bool MM_DumpInEventCmd(const CFE_SB_Buffer_t *BufPtr);
 
+/**
+ * \brief Process memory CRC command
+ *
+ *  \par Description
+ *       Processes the memory CRC command that will compute the CRC of
+ *       an address range of memory without dumping it to a file, and
+ *       report the CRC in an event message and housekeeping telemetry.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The CRC is computed with #MM_DUMP_FILE_CRC_TYPE, so it matches
+ *       the CRC of a dump file of the same range.
+ *
+ *  \param[in] BufPtr Pointer to Software Bus buffer
+ *
+ *  \sa #MM_CRC_MEM_CC
+ */
+bool MM_CrcMemCmd(const CFE_SB_Buffer_t *BufPtr);
+
 #endif
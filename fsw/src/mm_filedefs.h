@@ -44,9 +44,91 @@ typedef struct
 {
     MM_SymAddr_t SymAddress; /**< \brief Symbolic load address or fully resolved dump address */
     uint32       NumOfBytes; /**< \brief Bytes to load or bytes dumped      */
-    uint32       Crc;        /**< \brief CRC value for load or dump data    */
+    uint32       Crc;        /**< \brief CRC value for load or dump data before encoding */
     MM_MemType_t MemType;    /**< \brief Memory type used                   */
-    uint8        Spare[3];   /**< \brief Structure Padding                  */
+    uint8        Encoding;   /**< \brief File data encoding, see \ref MMFileEncodings */
+    uint8        FillValue;  /**< \brief Value of the bytes left out of #MM_ENCODING_SPARSE data */
+    uint8        Spare;      /**< \brief Structure Padding                  */
 } MM_LoadDumpFileHeader_t;
 
+/**
+ * \brief MM Delta dump file header structure
+ *
+ * Follows the MM secondary header in a #MM_ENCODING_DELTA dump file, see
+ * #MM_DUMP_MEM_TO_DELTA_FILE_CC. The block map and the changed blocks
+ * come after it.
+ */
+typedef struct
+{
+    uint32 BaselineCrc;   /**< \brief CRC of the baseline file data the memory was compared with */
+    uint32 BlockSize;     /**< \brief Bytes in each block, the last block may be shorter */
+    uint32 NumOfBlocks;   /**< \brief Blocks dumped, the block map has one bit for each */
+    uint32 ChangedBlocks; /**< \brief Blocks that differ from the baseline and are in the file */
+} MM_DeltaFileHeader_t;
+
+/**
+ * \brief MM Patch load file header structure
+ *
+ * Follows the MM secondary header in a #MM_ENCODING_PATCH load file, see
+ * #MM_LOAD_MEM_FROM_PATCH_FILE_CC. The #MM_PatchRecord_t records come after
+ * it, each followed by the bytes to write.
+ */
+typedef struct
+{
+    uint32 PreImageCrc;  /**< \brief CRC of the memory the records replace, in record order */
+    uint32 NumOfRecords; /**< \brief Patch records in the file */
+} MM_PatchFileHeader_t;
+
+/**
+ * \brief MM Patch load file record structure
+ *
+ * Starts each patch record, the bytes to write follow it. The layout is
+ * the same as a #MM_ENCODING_SPARSE extent record.
+ */
+typedef struct
+{
+    uint32 Offset; /**< \brief Offset of the bytes to write from the patch base address */
+    uint32 Length; /**< \brief Bytes to write that follow the record */
+} MM_PatchRecord_t;
+
+/**
+ * \brief MM Multi-region file header structure
+ *
+ * Follows the MM secondary header in a #MM_ENCODING_MULTI file, see
+ * #MM_LOAD_MEM_FROM_MULTI_FILE_CC. The region table comes after it, one
+ * #MM_LoadDumpFileHeader_t for each region, then the data of each region
+ * in table order.
+ */
+typedef struct
+{
+    uint32 NumOfRegions; /**< \brief Entries in the region table */
+    uint32 Spare;        /**< \brief Structure Padding */
+} MM_MultiFileHeader_t;
+
+/**
+ * \brief MM Symbol lookup file header structure
+ *
+ * Follows the cFE file header in a #MM_LOOKUP_SYM_FILE_CC request or
+ * result file. The #MM_SymLookupRecord_t records come after it.
+ */
+typedef struct
+{
+    uint32 NumOfSymbols; /**< \brief Symbol records in the file */
+    uint32 NumResolved;  /**< \brief Symbols resolved, set in the result file only */
+} MM_SymLookupFileHeader_t;
+
+/**
+ * \brief MM Symbol lookup file record structure
+ *
+ * One symbol of a #MM_LOOKUP_SYM_FILE_CC request or result file. Only the
+ * name is used from a request file.
+ */
+typedef struct
+{
+    char    SymName[OS_MAX_SYM_LEN]; /**< \brief Symbol name string */
+    cpuaddr Address;                 /**< \brief Resolved address, 0 if not resolved */
+    uint32  Resolved;                /**< \brief 1 if the symbol was resolved, otherwise 0 */
+    uint32  Spare;                   /**< \brief Structure Padding */
+} MM_SymLookupRecord_t;
+
 #endif
@@ -31,9 +31,9 @@
 #include "mm_perfids.h"
 #include "mm_events.h"
 #include "mm_utils.h"
-#include "mm_mem32.h"
-#include "mm_mem16.h"
-#include "mm_mem8.h"
+#include "mm_crc.h"
+#include "mm_codec.h"
+#include "mm_memtype.h"
 #include "mm_mission_cfg.h"
 #include <string.h>
 
@@ -97,21 +97,24 @@ bool MM_PokeCmd(const CFE_SB_Buffer_t *BufPtr)
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Write 8, 16, or 32 bits of data to any RAM memory address       */
+/* Write 8, 16, or 32 bits of data to any non-EEPROM memory        */
+/* address                                                         */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 bool MM_PokeMem(const MM_PokeCmd_t *CmdPtr, cpuaddr DestAddress)
 {
-    uint8        ByteValue;
-    uint16       WordValue;
-    CFE_Status_t PSP_Status     = CFE_PSP_SUCCESS;
-    uint32       DataValue      = 0;
-    size_t       BytesProcessed = 0;
-    bool         ValidPoke      = false;
-    size_t       DataSize       = 0; /* only used for giving MEM type/size in events */
-    uint32       EventID        = 0;
+    uint8  ByteValue;
+    uint16 WordValue;
+    uint32 DataValue      = 0;
+    size_t BytesProcessed = 0;
+    bool   ValidPoke      = false;
+    size_t DataSize       = 0; /* only used for giving MEM type/size in events */
+    uint32 EventID        = 0;
 
-    /* Write input number of bits to destination address */
+    /*
+    ** Write input number of bits to destination address with the write
+    ** routine of the memory type, which reports its own errors
+    */
     switch (CmdPtr->Payload.DataSize)
     {
         case MM_BYTE_BIT_WIDTH:
@@ -119,11 +122,8 @@ bool MM_PokeMem(const MM_PokeCmd_t *CmdPtr, cpuaddr DestAddress)
             DataValue      = (uint32)ByteValue;
             BytesProcessed = sizeof(uint8);
             DataSize       = 8;
-            if ((PSP_Status = CFE_PSP_MemWrite8(DestAddress, ByteValue)) == CFE_PSP_SUCCESS)
-            {
-                EventID   = MM_POKE_BYTE_INF_EID;
-                ValidPoke = true;
-            }
+            EventID        = MM_POKE_BYTE_INF_EID;
+            ValidPoke      = MM_WriteMemBlock(DestAddress, CmdPtr->Payload.MemType, &ByteValue, sizeof(ByteValue));
             break;
 
         case MM_WORD_BIT_WIDTH:
@@ -131,22 +131,16 @@ bool MM_PokeMem(const MM_PokeCmd_t *CmdPtr, cpuaddr DestAddress)
             DataValue      = (uint32)WordValue;
             BytesProcessed = sizeof(uint16);
             DataSize       = 16;
-            if ((PSP_Status = CFE_PSP_MemWrite16(DestAddress, WordValue)) == CFE_PSP_SUCCESS)
-            {
-                EventID   = MM_POKE_WORD_INF_EID;
-                ValidPoke = true;
-            }
+            EventID        = MM_POKE_WORD_INF_EID;
+            ValidPoke      = MM_WriteMemBlock(DestAddress, CmdPtr->Payload.MemType, &WordValue, sizeof(WordValue));
             break;
 
         case MM_DWORD_BIT_WIDTH:
             DataValue      = CmdPtr->Payload.Data;
             BytesProcessed = sizeof(uint32);
             DataSize       = 32;
-            if ((PSP_Status = CFE_PSP_MemWrite32(DestAddress, DataValue)) == CFE_PSP_SUCCESS)
-            {
-                EventID   = MM_POKE_DWORD_INF_EID;
-                ValidPoke = true;
-            }
+            EventID        = MM_POKE_DWORD_INF_EID;
+            ValidPoke      = MM_WriteMemBlock(DestAddress, CmdPtr->Payload.MemType, &DataValue, sizeof(DataValue));
             break;
 
         /*
@@ -170,12 +164,6 @@ bool MM_PokeMem(const MM_PokeCmd_t *CmdPtr, cpuaddr DestAddress)
                           "Poke Command: Addr = %p, Size = %u bits, Data = 0x%08X", (void *)DestAddress,
                           (unsigned int)DataSize, (unsigned int)DataValue);
     }
-    else
-    {
-        CFE_EVS_SendEvent(MM_PSP_WRITE_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "PSP write memory error: RC=0x%08X, Address=%p, MemType=MEM%u", (unsigned int)PSP_Status,
-                          (void *)DestAddress, (unsigned int)DataSize);
-    }
 
     return ValidPoke;
 }
@@ -309,7 +297,8 @@ bool MM_LoadMemWIDCmd(const CFE_SB_Buffer_t *BufPtr)
             if (MM_VerifyLoadDumpParams(DestAddress, MM_RAM, CmdPtr->Payload.NumOfBytes, MM_VERIFY_WID) == true)
             {
                 /* Verify data integrity check value */
-                ComputedCRC = CFE_ES_CalculateCRC(CmdPtr->Payload.DataArray, CmdPtr->Payload.NumOfBytes, 0, MM_LOAD_WID_CRC_TYPE);
+                ComputedCRC =
+                    MM_CalculateCRC(CmdPtr->Payload.DataArray, CmdPtr->Payload.NumOfBytes, 0, MM_LOAD_WID_CRC_TYPE);
                 /*
                 ** If the CRC matches do the load
                 */
@@ -364,43 +353,98 @@ bool MM_LoadMemFromFileCmd(const CFE_SB_Buffer_t *BufPtr)
     CFE_FS_Header_t                CFEFileHeader;
     MM_LoadDumpFileHeader_t        MMFileHeader;
     uint32                         ComputedCRC;
+    uint8 *                        StagingBuf = NULL;
+    MM_LoadCacheEntry_t            CacheKey;
+    bool                           CacheHit = false;
+    const MM_MemTypeDriver_t *     Driver;
 
     memset(&MMFileHeader, 0, sizeof(MMFileHeader));
 
+    CFE_ES_PerfLogEntry(MM_LOAD_FILE_PERF_ID);
+
         CmdPtr = ((MM_LoadMemFromFileCmd_t *)BufPtr);
 
         /* Make sure string is null terminated before attempting to process it */
         CFE_SB_MessageStringGet(FileName, CmdPtr->Payload.FileName, NULL, sizeof(FileName), sizeof(CmdPtr->Payload.FileName));
 
         /* Open load file for reading */
+        CFE_ES_PerfLogEntry(MM_FILE_OPEN_PERF_ID);
         OS_Status = OS_OpenCreate(&FileHandle, FileName, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+        CFE_ES_PerfLogExit(MM_FILE_OPEN_PERF_ID);
         if (OS_Status == OS_SUCCESS)
         {
             /* Read in the file headers */
             Valid = MM_ReadFileHeaders(FileName, FileHandle, &CFEFileHeader, &MMFileHeader);
             if (Valid == true)
             {
-                /* Verify the file size is correct */
-                Valid = MM_VerifyLoadFileSize(FileName, &MMFileHeader);
+                /* Verify the file data encoding and size are correct */
+                Valid = MM_VerifyFileEncoding(MMFileHeader.Encoding, MMFileHeader.MemType);
+                if (Valid == true)
+                {
+                    Valid = MM_VerifyLoadFileSize(FileName, &MMFileHeader);
+                }
                 if (Valid == true)
                 {
-                    /* Verify data integrity check value */
-                    OS_Status = MM_ComputeCRCFromFile(FileHandle, &ComputedCRC, MM_LOAD_FILE_CRC_TYPE);
+                    /*
+                    ** A file that was verified before and hasn't changed since
+                    ** skips the CRC pass and is read only once, by the load
+                    */
+                    CacheHit = MM_LoadCacheLookup(FileName, &MMFileHeader, &CacheKey);
+                    if (CacheHit == true)
+                    {
+                        ComputedCRC = MMFileHeader.Crc;
+                        OS_Status   = OS_SUCCESS;
+                        CFE_EVS_SendEvent(MM_LOAD_CACHE_HIT_DBG_EID, CFE_EVS_EventType_DEBUG,
+                                          "Load file unchanged since verified, CRC pass skipped: File = '%s'",
+                                          FileName);
+                    }
+                    else
+                    {
+                        /*
+                        ** Verify data integrity check value, small enough loads are read
+                        ** once into a staging buffer and verified there
+                        */
+                        StagingBuf = MM_GetLoadStagingBuf(&MMFileHeader);
+                        if (StagingBuf != NULL)
+                        {
+                            OS_Status = MM_StageLoadFile(FileHandle, &MMFileHeader, StagingBuf, &ComputedCRC);
+                        }
+                        else if (MMFileHeader.Encoding != MM_ENCODING_RAW)
+                        {
+                            OS_Status =
+                                MM_ComputeDecodedCRCFromFile(FileHandle, FileName, &MMFileHeader, &ComputedCRC);
+                        }
+                        else
+                        {
+                            OS_Status = MM_ComputeCRCFromFile(FileHandle, &ComputedCRC, MM_LOAD_FILE_CRC_TYPE);
+                        }
+                    }
+
                     if (OS_Status == OS_SUCCESS)
                     {
                         /*
                         ** Reset the file pointer to the start of the load data, need to do this
                         ** because MM_ComputeCRCFromFile reads to the end of file
                         */
-                        OS_Status = OS_lseek(FileHandle, (sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t)),
-                                             OS_SEEK_SET);
-                        if (OS_Status != (sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t)))
+                        if (StagingBuf == NULL)
                         {
-                            Valid = false;
+                            OS_Status = OS_lseek(FileHandle,
+                                                 (sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t)),
+                                                 OS_SEEK_SET);
+                            if (OS_Status != (sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t)))
+                            {
+                                Valid = false;
+                            }
                         }
                         /* Check the computed CRC against the file header CRC */
                         if ((ComputedCRC == MMFileHeader.Crc) && (Valid == true))
                         {
+                            /* Remember the verified file, even if the load itself is rejected */
+                            if (CacheHit == false)
+                            {
+                                MM_LoadCacheUpdate(&CacheKey);
+                            }
+
                             /* Resolve symbolic address in file header */
                             Valid = MM_ResolveSymAddr(&(MMFileHeader.SymAddress), &DestAddress);
 
@@ -412,42 +456,30 @@ bool MM_LoadMemFromFileCmd(const CFE_SB_Buffer_t *BufPtr)
                                 if (Valid == true)
                                 {
                                     /* Call the load routine for the specified memory type */
-                                    switch (MMFileHeader.MemType)
+                                    Driver = MM_MemTypeGet(MMFileHeader.MemType);
+
+                                    /* Staged and encoded loads are limited to RAM and EEPROM */
+                                    if (StagingBuf != NULL)
+                                    {
+                                        Valid = MM_LoadMemFromStaging(StagingBuf, FileName, &MMFileHeader,
+                                                                      DestAddress);
+                                    }
+                                    else if (MMFileHeader.Encoding != MM_ENCODING_RAW)
+                                    {
+                                        Valid = MM_LoadMemFromEncodedFile(FileHandle, FileName, &MMFileHeader,
+                                                                          DestAddress);
+                                    }
+                                    /*
+                                    ** A bad MemType will get caught in the
+                                    ** MM_VerifyLoadDumpParams function and we won't get here
+                                    */
+                                    else if (Driver != NULL)
+                                    {
+                                        Valid = Driver->LoadFromFile(FileHandle, FileName, &MMFileHeader, DestAddress);
+                                    }
+                                    else
                                     {
-                                        case MM_RAM:
-                                        case MM_EEPROM:
-                                            Valid =
-                                                MM_LoadMemFromFile(FileHandle, FileName, &MMFileHeader, DestAddress);
-                                            break;
-
-#ifdef MM_OPT_CODE_MEM32_MEMTYPE
-                                        case MM_MEM32:
-                                            Valid =
-                                                MM_LoadMem32FromFile(FileHandle, FileName, &MMFileHeader, DestAddress);
-                                            break;
-#endif /* MM_OPT_CODE_MEM32_MEMTYPE */
-
-#ifdef MM_OPT_CODE_MEM16_MEMTYPE
-                                        case MM_MEM16:
-                                            Valid =
-                                                MM_LoadMem16FromFile(FileHandle, FileName, &MMFileHeader, DestAddress);
-                                            break;
-#endif /* MM_OPT_CODE_MEM16_MEMTYPE */
-
-#ifdef MM_OPT_CODE_MEM8_MEMTYPE
-                                        case MM_MEM8:
-                                            Valid =
-                                                MM_LoadMem8FromFile(FileHandle, FileName, &MMFileHeader, DestAddress);
-                                            break;
-#endif /* MM_OPT_CODE_MEM8_MEMTYPE */
-
-                                        /*
-                                        ** We don't need a default case, a bad MemType will get caught
-                                        ** in the MM_VerifyFileLoadParams function and we won't get here
-                                        */
-                                        default:
-                                            Valid = false;
-                                            break;
+                                        Valid = false;
                                     }
 
                                     if (Valid == true)
@@ -511,8 +543,15 @@ bool MM_LoadMemFromFileCmd(const CFE_SB_Buffer_t *BufPtr)
             ** the error counter and generate an event message if needed.
             */
 
+            if (StagingBuf != NULL)
+            {
+                CFE_ES_PutPoolBuf(MM_AppData.StagingPoolHandle, StagingBuf);
+            }
+
             /* Close the load file for all cases after the open call succeeds */
+            CFE_ES_PerfLogEntry(MM_FILE_CLOSE_PERF_ID);
             OS_Status = OS_close(FileHandle);
+            CFE_ES_PerfLogExit(MM_FILE_CLOSE_PERF_ID);
             if (OS_Status != OS_SUCCESS)
             {
                 Valid = false;
@@ -529,6 +568,8 @@ bool MM_LoadMemFromFileCmd(const CFE_SB_Buffer_t *BufPtr)
                               "OS_OpenCreate error received: RC = %d File = '%s'", (int)OS_Status, CmdPtr->Payload.FileName);
         }
 
+    CFE_ES_PerfLogExit(MM_LOAD_FILE_PERF_ID);
+
     return Valid;
 }
 
@@ -543,10 +584,12 @@ bool MM_LoadMemFromFile(osal_id_t FileHandle, const char *FileName, const MM_Loa
     bool   Valid          = false;
     int32  BytesRemaining = FileHeader->NumOfBytes;
     size_t BytesProcessed = 0;
-    int32  ReadLength;
-    size_t SegmentSize   = MM_MAX_LOAD_DATA_SEG;
-    uint8 *ioBuffer      = (uint8 *)&MM_AppData.LoadBuffer[0];
-    uint8 *TargetPointer = (uint8 *)DestAddress;
+    int32  ReadLength     = 0;
+    size_t BlockSize      = 0;
+    size_t BlockOffset    = 0;
+    size_t SegmentSize    = MM_SegmentStart(MM_SEG_LOAD);
+    uint8 *ioBuffer       = (uint8 *)&MM_AppData.IoBuffer[0];
+    uint8 *TargetPointer  = (uint8 *)DestAddress;
 
     if (FileHeader->MemType == MM_EEPROM)
     {
@@ -555,15 +598,34 @@ bool MM_LoadMemFromFile(osal_id_t FileHandle, const char *FileName, const MM_Loa
 
     while (BytesRemaining != 0)
     {
-        if (BytesRemaining < MM_MAX_LOAD_DATA_SEG)
+        /* Read the next file block once the i/o buffer is used up */
+        if (BlockOffset == BlockSize)
         {
-            SegmentSize = BytesRemaining;
+            BlockOffset = 0;
+            BlockSize   = MM_IO_BUFFER_SIZE;
+            if (BytesRemaining < BlockSize)
+            {
+                BlockSize = BytesRemaining;
+            }
+
+            MM_SegmentIoStart();
+            ReadLength = OS_read(FileHandle, ioBuffer, BlockSize);
+            MM_SegmentIoEnd();
+        }
+
+        /* A segment never crosses an i/o block boundary */
+        if ((BlockSize - BlockOffset) < SegmentSize)
+        {
+            SegmentSize = BlockSize - BlockOffset;
         }
 
-        if ((ReadLength = OS_read(FileHandle, ioBuffer, SegmentSize)) == SegmentSize)
+        if (ReadLength == BlockSize)
         {
-            memcpy(TargetPointer, ioBuffer, SegmentSize);
+            CFE_ES_PerfLogEntry(MM_SEGCOPY_PERF_ID);
+            memcpy(TargetPointer, &ioBuffer[BlockOffset], SegmentSize);
+            CFE_ES_PerfLogExit(MM_SEGCOPY_PERF_ID);
 
+            BlockOffset += SegmentSize;
             BytesRemaining -= SegmentSize;
             BytesProcessed += SegmentSize;
             TargetPointer += SegmentSize;
@@ -571,14 +633,14 @@ bool MM_LoadMemFromFile(osal_id_t FileHandle, const char *FileName, const MM_Loa
             /* Prevent CPU hogging between load segments */
             if (BytesRemaining != 0)
             {
-                MM_SegmentBreak();
+                SegmentSize = MM_SegmentBreak(SegmentSize);
             }
         }
         else
         {
             CFE_EVS_SendEvent(MM_OS_READ_ERR_EID, CFE_EVS_EventType_ERROR,
                               "OS_read error received: RC = 0x%08X Expected = %u File = '%s'", (unsigned int)ReadLength,
-                              (unsigned int)SegmentSize, FileName);
+                              (unsigned int)BlockSize, FileName);
             BytesRemaining = 0;
         }
     }
@@ -597,6 +659,8 @@ bool MM_LoadMemFromFile(osal_id_t FileHandle, const char *FileName, const MM_Loa
         MM_AppData.HkPacket.Payload.Address        = DestAddress;
         MM_AppData.HkPacket.Payload.BytesProcessed = BytesProcessed;
         strncpy(MM_AppData.HkPacket.Payload.FileName, FileName, OS_MAX_PATH_LEN);
+
+        MM_SegmentEnd(BytesProcessed);
     }
 
     return Valid;
@@ -604,218 +668,1294 @@ bool MM_LoadMemFromFile(osal_id_t FileHandle, const char *FileName, const MM_Loa
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Verify load file size                                           */
+/* Get a staging buffer for a load file                            */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-bool MM_VerifyLoadFileSize(const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader)
+uint8 *MM_GetLoadStagingBuf(const MM_LoadDumpFileHeader_t *FileHeader)
 {
-    bool       Valid = true;
-    int32      OS_Status;
-    size_t     ExpectedSize;
-    int32      ActualSize; /* The size returned by OS_stat is signed */
-    os_fstat_t FileStats;
-
-    memset(&FileStats, 0, sizeof(FileStats));
+    CFE_ES_MemPoolBuf_t PoolBuf = NULL;
+    int32               Status;
 
     /*
-    ** Get the filesystem statistics on our load file
+    ** The optional memory types need width specific writes from the file
+    ** and encoded files are decoded straight from the i/o buffer
     */
-    OS_Status = OS_stat(FileName, &FileStats);
-    if (OS_Status != OS_SUCCESS)
+    if (((FileHeader->MemType != MM_RAM) && (FileHeader->MemType != MM_EEPROM)) ||
+        (FileHeader->Encoding != MM_ENCODING_RAW) ||
+        (FileHeader->NumOfBytes == 0) || (FileHeader->NumOfBytes > MM_AppData.Config.MaxStagedLoad))
     {
-        Valid = false;
-        CFE_EVS_SendEvent(MM_OS_STAT_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "OS_stat error received: RC = 0x%08X File = '%s'", (unsigned int)OS_Status, FileName);
+        return NULL;
     }
-    else
+
+    /* No buffer just means the file is read twice */
+    Status = CFE_ES_GetPoolBuf(&PoolBuf, MM_AppData.StagingPoolHandle, FileHeader->NumOfBytes);
+    if (Status < (int32)FileHeader->NumOfBytes)
     {
-        /*
-        ** Check the reported size of the file against what it should be based
-        ** upon the number of load bytes specified in the file header
-        */
-        ActualSize   = OS_FILESTAT_SIZE(FileStats);
-        ExpectedSize = FileHeader->NumOfBytes + sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t);
-        if (ActualSize != ExpectedSize)
-        {
-            Valid = false;
+        PoolBuf = NULL;
+    }
 
-            /*
-            ** Note: passing FileStats.st_size in this event message will cause
-            ** a segmentation fault under cygwin during unit testing, so we added
-            ** the variable ActualSize to this function.
-            */
-            CFE_EVS_SendEvent(MM_LD_FILE_SIZE_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "Load file size error: Reported by OS = %d Expected = %u File = '%s'", (int)ActualSize,
-                              (unsigned int)ExpectedSize, FileName);
-        }
+    return (uint8 *)PoolBuf;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Read load file data into a staging buffer and compute its CRC   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 MM_StageLoadFile(osal_id_t FileHandle, const MM_LoadDumpFileHeader_t *FileHeader, uint8 *StagingBuf,
+                       uint32 *CrcPtr)
+{
+    int32 ReadLength;
+    int32 OS_Status = OS_SUCCESS;
+
+    /* The file size was verified, so the load data is the rest of the file */
+    CFE_ES_PerfLogEntry(MM_FILE_IO_PERF_ID);
+    ReadLength = OS_read(FileHandle, StagingBuf, FileHeader->NumOfBytes);
+    CFE_ES_PerfLogExit(MM_FILE_IO_PERF_ID);
+    if (ReadLength == (int32)FileHeader->NumOfBytes)
+    {
+        CFE_ES_PerfLogEntry(MM_FILE_CRC_PERF_ID);
+        *CrcPtr = MM_CalculateCRC(StagingBuf, FileHeader->NumOfBytes, 0, MM_LOAD_FILE_CRC_TYPE);
+        CFE_ES_PerfLogExit(MM_FILE_CRC_PERF_ID);
+    }
+    else if (ReadLength < 0)
+    {
+        OS_Status = ReadLength;
+    }
+    else
+    {
+        OS_Status = OS_ERROR;
     }
 
-    return Valid;
+    return OS_Status;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Read the cFE primary and MM secondary file headers          */
+/* Loads memory from a staged load file                            */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-bool MM_ReadFileHeaders(const char *FileName, osal_id_t FileHandle, CFE_FS_Header_t *CFEHeader,
-                        MM_LoadDumpFileHeader_t *MMHeader)
+bool MM_LoadMemFromStaging(const uint8 *StagingBuf, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader,
+                           cpuaddr DestAddress)
 {
-    bool  Valid = true;
-    int32 OS_Status;
+    size_t       BytesRemaining = FileHeader->NumOfBytes;
+    size_t       SegmentSize    = MM_SegmentStart(MM_SEG_LOAD);
+    const uint8 *SourcePointer  = StagingBuf;
+    uint8 *      TargetPointer  = (uint8 *)DestAddress;
 
-    /*
-    ** Read in the primary cFE file header
-    */
-    OS_Status = CFE_FS_ReadHeader(CFEHeader, FileHandle);
-    if (OS_Status != sizeof(CFE_FS_Header_t))
+    if (FileHeader->MemType == MM_EEPROM)
     {
-        /* We either got an error or didn't read as much data as expected */
-        Valid = false;
-        CFE_EVS_SendEvent(MM_CFE_FS_READHDR_ERR_EID, CFE_EVS_EventType_ERROR,
-                          "CFE_FS_ReadHeader error received: RC = 0x%08X Expected = %u File = '%s'",
-                          (unsigned int)OS_Status, (unsigned int)sizeof(CFE_FS_Header_t), FileName);
+        CFE_ES_PerfLogEntry(MM_EEPROM_FILELOAD_PERF_ID);
+    }
 
-    } /* end CFE_FS_ReadHeader if */
-    else
+    while (BytesRemaining != 0)
     {
-        /*
-        ** Read in the secondary MM file header
-        */
-        OS_Status = OS_read(FileHandle, MMHeader, sizeof(MM_LoadDumpFileHeader_t));
-        if (OS_Status != sizeof(MM_LoadDumpFileHeader_t))
+        if (BytesRemaining < SegmentSize)
         {
-            /* We either got an error or didn't read as much data as expected */
-            Valid = false;
-            CFE_EVS_SendEvent(MM_OS_READ_EXP_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "OS_read error received: RC = 0x%08X Expected = %u File = '%s'", (unsigned int)OS_Status,
-                              (unsigned int)sizeof(MM_LoadDumpFileHeader_t), FileName);
+            SegmentSize = BytesRemaining;
+        }
 
-        } /* end OS_read if */
+        CFE_ES_PerfLogEntry(MM_SEGCOPY_PERF_ID);
+        memcpy(TargetPointer, SourcePointer, SegmentSize);
+        CFE_ES_PerfLogExit(MM_SEGCOPY_PERF_ID);
 
-    } /* end CFE_FS_ReadHeader else */
+        SourcePointer += SegmentSize;
+        TargetPointer += SegmentSize;
+        BytesRemaining -= SegmentSize;
 
-    return Valid;
+        /* Prevent CPU hogging between load segments */
+        if (BytesRemaining != 0)
+        {
+            SegmentSize = MM_SegmentBreak(SegmentSize);
+        }
+    }
+
+    if (FileHeader->MemType == MM_EEPROM)
+    {
+        CFE_ES_PerfLogExit(MM_EEPROM_FILELOAD_PERF_ID);
+    }
+
+    /* Update last action statistics */
+    MM_AppData.HkPacket.Payload.LastAction     = MM_LOAD_FROM_FILE;
+    MM_AppData.HkPacket.Payload.MemType        = FileHeader->MemType;
+    MM_AppData.HkPacket.Payload.Address        = DestAddress;
+    MM_AppData.HkPacket.Payload.BytesProcessed = FileHeader->NumOfBytes;
+    strncpy(MM_AppData.HkPacket.Payload.FileName, FileName, OS_MAX_PATH_LEN);
+
+    MM_SegmentEnd(FileHeader->NumOfBytes);
+
+    return true;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Fill memory command                                             */
+/* Compute the CRC of encoded load file data                       */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-bool MM_FillMemCmd(const CFE_SB_Buffer_t *BufPtr)
+int32 MM_ComputeDecodedCRCFromFile(osal_id_t FileHandle, const char *FileName,
+                                   const MM_LoadDumpFileHeader_t *FileHeader, uint32 *CrcPtr)
 {
-    cpuaddr                DestAddress    = 0;
-    const MM_FillMemCmd_t *CmdPtr         = (MM_FillMemCmd_t *)BufPtr;
-    bool                   CmdResult      = false;
-    MM_SymAddr_t           DestSymAddress = CmdPtr->Payload.DestSymAddress;
+    int32            ReadLength;
+    int32            OS_Status      = OS_SUCCESS;
+    bool             DecodeError    = false;
+    uint32           TempCrc        = 0;
+    size_t           BytesRemaining = FileHeader->NumOfBytes;
+    size_t           BlockOffset;
+    size_t           SrcUsed;
+    size_t           DecodeSize;
+    size_t           Decoded;
+    uint8 *          ioBuffer = (uint8 *)&MM_AppData.IoBuffer[0];
+    uint32           DecodeBuffer[MM_CODEC_CHECK_CHUNK / sizeof(uint32)];
+    MM_FileDecoder_t Decoder;
+
+    CFE_ES_PerfLogEntry(MM_FILE_CRC_PERF_ID);
+
+    MM_FileDecodeInit(&Decoder, FileHeader->Encoding, FileHeader->FillValue, FileHeader->NumOfBytes);
+
+    do
+    {
+        ReadLength  = OS_read(FileHandle, ioBuffer, MM_IO_BUFFER_SIZE);
+        BlockOffset = 0;
 
-        /* Resolve symbolic address */
-        if (MM_ResolveSymAddr(&(DestSymAddress), &DestAddress) == true)
+        if (ReadLength < 0)
         {
-            /* Run necessary checks on command parameters */
-            if (MM_VerifyLoadDumpParams(DestAddress, CmdPtr->Payload.MemType, CmdPtr->Payload.NumOfBytes, MM_VERIFY_FILL) == true)
+            OS_Status = ReadLength;
+        }
+        else
+        {
+            if (ReadLength == 0)
             {
-                switch (CmdPtr->Payload.MemType)
-                {
-                    case MM_RAM:
-                    case MM_EEPROM:
-                        CmdResult = MM_FillMem(DestAddress, CmdPtr);
-                        break;
-
-#ifdef MM_OPT_CODE_MEM32_MEMTYPE
-                    case MM_MEM32:
-                        CmdResult = MM_FillMem32(DestAddress, CmdPtr);
-                        break;
-#endif
-
-#ifdef MM_OPT_CODE_MEM16_MEMTYPE
-                    case MM_MEM16:
-                        CmdResult = MM_FillMem16(DestAddress, CmdPtr);
-                        break;
-#endif
-
-#ifdef MM_OPT_CODE_MEM8_MEMTYPE
-                    case MM_MEM8:
-                        CmdResult = MM_FillMem8(DestAddress, CmdPtr);
-                        break;
-#endif
+                MM_FileDecodeEnd(&Decoder);
+            }
 
-                    /*
-                    ** We don't need a default case, a bad MemType will get caught
-                    ** in the MM_VerifyLoadDumpParams function and we won't get here
-                    */
-                    default:
-                        CmdResult = false;
-                        break;
+            /*
+            ** Decode the block, the end of the data may still have bytes
+            ** to output after the last read
+            */
+            while (((BlockOffset < (size_t)ReadLength) || MM_FileDecodePending(&Decoder)) &&
+                   (BytesRemaining != 0) && (DecodeError == false))
+            {
+                DecodeSize = sizeof(DecodeBuffer);
+                if (BytesRemaining < DecodeSize)
+                {
+                    DecodeSize = BytesRemaining;
                 }
 
-                if (MM_AppData.HkPacket.Payload.LastAction == MM_FILL)
+                Decoded = MM_FileDecode(&Decoder, &ioBuffer[BlockOffset], ReadLength - BlockOffset, &SrcUsed,
+                                        (uint8 *)DecodeBuffer, DecodeSize);
+
+                TempCrc = MM_CalculateCRC(DecodeBuffer, Decoded, TempCrc, MM_LOAD_FILE_CRC_TYPE);
+
+                BlockOffset += SrcUsed;
+                BytesRemaining -= Decoded;
+
+                /* The decoder stops on invalid data */
+                if ((Decoded == 0) && (SrcUsed == 0))
                 {
-                    CFE_EVS_SendEvent(MM_FILL_INF_EID, CFE_EVS_EventType_INFORMATION,
-                                      "Fill Memory Command: Filled %d bytes at address: %p with pattern: 0x%08X",
-                                      (int)MM_AppData.HkPacket.Payload.BytesProcessed, (void *)DestAddress,
-                                      (unsigned int)MM_AppData.HkPacket.Payload.DataValue);
+                    DecodeError = true;
                 }
             }
-        }
-        else
-        {
-            CFE_EVS_SendEvent(MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
-                              "Symbolic address can't be resolved: Name = '%s'", DestSymAddress.SymName);
+
+            /* Data left over once all load bytes are decoded is an error */
+            if (BlockOffset < (size_t)ReadLength)
+            {
+                DecodeError = true;
+            }
         }
 
-    return CmdResult;
+    } while ((ReadLength > 0) && (OS_Status == OS_SUCCESS) && (DecodeError == false));
+
+    /* The data must end with the last load byte */
+    if ((BytesRemaining != 0) || !MM_FileDecodeDone(&Decoder))
+    {
+        DecodeError = true;
+    }
+
+    /* Read errors are reported by the caller */
+    if ((OS_Status == OS_SUCCESS) && (DecodeError == true))
+    {
+        OS_Status = OS_ERROR;
+        CFE_EVS_SendEvent(MM_LOAD_DECODE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Load file decode error: %u of %u bytes decoded, File = '%s'",
+                          (unsigned int)(FileHeader->NumOfBytes - BytesRemaining),
+                          (unsigned int)FileHeader->NumOfBytes, FileName);
+    }
+    else if (OS_Status == OS_SUCCESS)
+    {
+        *CrcPtr = TempCrc;
+    }
+
+    CFE_ES_PerfLogExit(MM_FILE_CRC_PERF_ID);
+
+    return OS_Status;
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Fill memory with the command specified fill pattern             */
+/* Loads memory from an encoded file                               */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-bool MM_FillMem(cpuaddr DestAddress, const MM_FillMemCmd_t *CmdPtr)
+bool MM_LoadMemFromEncodedFile(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader,
+                               cpuaddr DestAddress)
 {
-    uint16 i;
-    bool   Valid          = true;
-    size_t BytesProcessed = 0;
-    uint32 BytesRemaining = CmdPtr->Payload.NumOfBytes;
-    uint32 SegmentSize    = MM_MAX_FILL_DATA_SEG;
-    uint8 *TargetPointer  = (uint8 *)DestAddress;
-    uint8 *FillBuffer     = (uint8 *)&MM_AppData.FillBuffer[0];
-
-    /* Create a scratch buffer with one fill segment */
-    for (i = 0; i < (MM_MAX_FILL_DATA_SEG / sizeof(uint32)); i++)
-    {
-        FillBuffer[i] = CmdPtr->Payload.FillPattern;
-    }
+    bool             Valid          = false;
+    size_t           BytesRemaining = FileHeader->NumOfBytes;
+    size_t           BytesProcessed = 0;
+    int32            ReadLength     = 0;
+    int32            BlockOffset    = 0;
+    size_t           SegmentSize    = MM_SegmentStart(MM_SEG_LOAD);
+    size_t           SegmentFill    = 0;
+    size_t           SrcUsed;
+    size_t           Decoded;
+    uint8 *          ioBuffer      = (uint8 *)&MM_AppData.IoBuffer[0];
+    uint8 *          TargetPointer = (uint8 *)DestAddress;
+    MM_FileDecoder_t Decoder;
+
+    MM_FileDecodeInit(&Decoder, FileHeader->Encoding, FileHeader->FillValue, FileHeader->NumOfBytes);
 
-    /* Start EEPROM performance monitor */
-    if (CmdPtr->Payload.MemType == MM_EEPROM)
+    if (FileHeader->MemType == MM_EEPROM)
     {
-        CFE_ES_PerfLogEntry(MM_EEPROM_FILL_PERF_ID);
+        CFE_ES_PerfLogEntry(MM_EEPROM_FILELOAD_PERF_ID);
     }
 
-    /* Fill memory one segment at a time */
     while (BytesRemaining != 0)
     {
-        /* Last fill segment may be partial size */
-        if (BytesRemaining < MM_MAX_FILL_DATA_SEG)
+        /* Read the next file block once the i/o buffer is used up, some data needs no more input */
+        if ((BlockOffset == ReadLength) && !MM_FileDecodePending(&Decoder))
         {
-            SegmentSize = BytesRemaining;
-        }
+            BlockOffset = 0;
 
-        memcpy(TargetPointer, FillBuffer, SegmentSize);
+            MM_SegmentIoStart();
+            ReadLength = OS_read(FileHandle, ioBuffer, MM_IO_BUFFER_SIZE);
+            MM_SegmentIoEnd();
 
-        TargetPointer += SegmentSize;
-        BytesProcessed += SegmentSize;
-        BytesRemaining -= SegmentSize;
+            if (ReadLength == 0)
+            {
+                MM_FileDecodeEnd(&Decoder);
+            }
+
+            /* The data was checked, so running out of it means the file changed */
+            if ((ReadLength < 0) || ((ReadLength == 0) && !MM_FileDecodePending(&Decoder)))
+            {
+                CFE_EVS_SendEvent(MM_OS_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "OS_read error received: RC = 0x%08X Expected = %u File = '%s'",
+                                  (unsigned int)ReadLength, (unsigned int)MM_IO_BUFFER_SIZE, FileName);
+                ReadLength     = 0;
+                BytesRemaining = 0;
+            }
+        }
 
-        /* Prevent CPU hogging between load segments */
         if (BytesRemaining != 0)
         {
-            MM_SegmentBreak();
-        }
-    }
+            if (BytesRemaining < (SegmentSize - SegmentFill))
+            {
+                SegmentSize = SegmentFill + BytesRemaining;
+            }
+
+            /* Decode straight to the destination, a segment may take more than one file block */
+            CFE_ES_PerfLogEntry(MM_SEGCOPY_PERF_ID);
+            Decoded = MM_FileDecode(&Decoder, &ioBuffer[BlockOffset], ReadLength - BlockOffset, &SrcUsed,
+                                    TargetPointer, SegmentSize - SegmentFill);
+            CFE_ES_PerfLogExit(MM_SEGCOPY_PERF_ID);
+
+            BlockOffset += SrcUsed;
+            SegmentFill += Decoded;
+            BytesRemaining -= Decoded;
+            BytesProcessed += Decoded;
+            TargetPointer += Decoded;
+
+            /* The data was checked, so a decoder that stops means the file changed */
+            if ((Decoded == 0) && (SrcUsed == 0))
+            {
+                CFE_EVS_SendEvent(MM_LOAD_DECODE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Load file decode error: %u of %u bytes decoded, File = '%s'",
+                                  (unsigned int)BytesProcessed, (unsigned int)FileHeader->NumOfBytes, FileName);
+                BytesRemaining = 0;
+            }
+
+            /* Prevent CPU hogging between load segments */
+            if ((SegmentFill == SegmentSize) && (BytesRemaining != 0))
+            {
+                SegmentSize = MM_SegmentBreak(SegmentSize);
+                SegmentFill = 0;
+            }
+        }
+    }
+
+    if (FileHeader->MemType == MM_EEPROM)
+    {
+        CFE_ES_PerfLogExit(MM_EEPROM_FILELOAD_PERF_ID);
+    }
+
+    /* Update last action statistics */
+    if (BytesProcessed == FileHeader->NumOfBytes)
+    {
+        Valid                                      = true;
+        MM_AppData.HkPacket.Payload.LastAction     = MM_LOAD_FROM_FILE;
+        MM_AppData.HkPacket.Payload.MemType        = FileHeader->MemType;
+        MM_AppData.HkPacket.Payload.Address        = DestAddress;
+        MM_AppData.HkPacket.Payload.BytesProcessed = BytesProcessed;
+        strncpy(MM_AppData.HkPacket.Payload.FileName, FileName, OS_MAX_PATH_LEN);
+
+        MM_SegmentEnd(BytesProcessed);
+    }
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Load memory from patch file command                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_LoadMemFromPatchFileCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    bool                                Valid      = false;
+    osal_id_t                           FileHandle = OS_OBJECT_ID_UNDEFINED;
+    int32                               OS_Status;
+    cpuaddr                             DestAddress = 0;
+    char                                FileName[OS_MAX_PATH_LEN];
+    const MM_LoadMemFromPatchFileCmd_t *CmdPtr = ((MM_LoadMemFromPatchFileCmd_t *)BufPtr);
+    CFE_FS_Header_t                     CFEFileHeader;
+    MM_LoadDumpFileHeader_t             MMFileHeader;
+    MM_PatchFileHeader_t                PatchHeader;
+
+    memset(&MMFileHeader, 0, sizeof(MMFileHeader));
+    memset(&PatchHeader, 0, sizeof(PatchHeader));
+
+    CFE_ES_PerfLogEntry(MM_LOAD_FILE_PERF_ID);
+
+    /* Make sure string is null terminated before attempting to process it */
+    CFE_SB_MessageStringGet(FileName, CmdPtr->Payload.FileName, NULL, sizeof(FileName),
+                            sizeof(CmdPtr->Payload.FileName));
+
+    CFE_ES_PerfLogEntry(MM_FILE_OPEN_PERF_ID);
+    OS_Status = OS_OpenCreate(&FileHandle, FileName, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+    CFE_ES_PerfLogExit(MM_FILE_OPEN_PERF_ID);
+    if (OS_Status == OS_SUCCESS)
+    {
+        Valid = MM_ReadFileHeaders(FileName, FileHandle, &CFEFileHeader, &MMFileHeader);
+
+        /* Patches are written a byte at a time */
+        if ((Valid == true) &&
+            ((MMFileHeader.Encoding != MM_ENCODING_PATCH) ||
+             ((MMFileHeader.MemType != MM_RAM) && (MMFileHeader.MemType != MM_EEPROM))))
+        {
+            Valid = false;
+            CFE_EVS_SendEvent(MM_FILE_ENCODING_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "File encoding not supported: Encoding = %u MemType = %u",
+                              (unsigned int)MMFileHeader.Encoding, (unsigned int)MMFileHeader.MemType);
+        }
+
+        if (Valid == true)
+        {
+            Valid = MM_ResolveSymAddr(&(MMFileHeader.SymAddress), &DestAddress);
+            if (Valid == false)
+            {
+                CFE_EVS_SendEvent(MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Symbolic address can't be resolved: Name = '%s'", MMFileHeader.SymAddress.SymName);
+            }
+        }
+
+        if (Valid == true)
+        {
+            Valid =
+                MM_VerifyLoadDumpParams(DestAddress, MMFileHeader.MemType, MMFileHeader.NumOfBytes, MM_VERIFY_LOAD);
+            if (Valid == false)
+            {
+                CFE_EVS_SendEvent(MM_FILE_LOAD_PARAMS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Load file failed parameters check: File = '%s'", FileName);
+            }
+        }
+
+        /* Nothing is written until the whole patch and the memory it replaces are checked */
+        if (Valid == true)
+        {
+            Valid = MM_VerifyPatchFile(FileHandle, FileName, &MMFileHeader, DestAddress, &PatchHeader);
+        }
+
+        if (Valid == true)
+        {
+            OS_Status = OS_lseek(FileHandle,
+                                 sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t) +
+                                     sizeof(MM_PatchFileHeader_t),
+                                 OS_SEEK_SET);
+            if (OS_Status !=
+                (sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t) + sizeof(MM_PatchFileHeader_t)))
+            {
+                Valid = false;
+            }
+        }
+
+        if (Valid == true)
+        {
+            Valid = MM_LoadMemFromPatchFile(FileHandle, FileName, &MMFileHeader, DestAddress, &PatchHeader);
+        }
+
+        if (Valid == true)
+        {
+            CFE_EVS_SendEvent(MM_LD_PATCH_FILE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "Load Memory From Patch File Command: Patched %u bytes in %u records at address %p "
+                              "from file '%s'",
+                              (unsigned int)MM_AppData.HkPacket.Payload.BytesProcessed,
+                              (unsigned int)PatchHeader.NumOfRecords, (void *)DestAddress, FileName);
+        }
+
+        CFE_ES_PerfLogEntry(MM_FILE_CLOSE_PERF_ID);
+        OS_Status = OS_close(FileHandle);
+        CFE_ES_PerfLogExit(MM_FILE_CLOSE_PERF_ID);
+        if (OS_Status != OS_SUCCESS)
+        {
+            Valid = false;
+            CFE_EVS_SendEvent(MM_OS_CLOSE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "OS_close error received: RC = 0x%08X File = '%s'", (unsigned int)OS_Status, FileName);
+        }
+    }
+    else
+    {
+        CFE_EVS_SendEvent(MM_OS_OPEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "OS_OpenCreate error received: RC = %d File = '%s'", (int)OS_Status, FileName);
+    }
+
+    CFE_ES_PerfLogExit(MM_LOAD_FILE_PERF_ID);
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify a patch file and the memory it replaces                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_VerifyPatchFile(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader,
+                        cpuaddr DestAddress, MM_PatchFileHeader_t *PatchHeader)
+{
+    bool             Valid       = true;
+    bool             EndOfFile   = false;
+    int32            ReadLength;
+    uint32           FileCrc     = 0;
+    uint32           PreImageCrc = 0;
+    uint32           NextOffset  = 0;
+    uint32           RecordCount = 0;
+    size_t           BytesRemaining;
+    size_t           ReadSize;
+    size_t           CrcSize;
+    size_t           SegmentSize = MM_SegmentStart(MM_SEG_CRC);
+    size_t           SegmentFill = 0;
+    cpuaddr          PreImageAddress;
+    uint8 *          ioBuffer = (uint8 *)&MM_AppData.IoBuffer[0];
+    MM_PatchRecord_t Record;
+
+    CFE_ES_PerfLogEntry(MM_FILE_CRC_PERF_ID);
+
+    ReadLength = OS_read(FileHandle, PatchHeader, sizeof(MM_PatchFileHeader_t));
+    if (ReadLength == sizeof(MM_PatchFileHeader_t))
+    {
+        FileCrc = MM_CalculateCRC(PatchHeader, sizeof(MM_PatchFileHeader_t), FileCrc, MM_LOAD_FILE_CRC_TYPE);
+    }
+    else
+    {
+        Valid = false;
+        CFE_EVS_SendEvent(MM_OS_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "OS_read error received: RC = 0x%08X Expected = %u File = '%s'", (unsigned int)ReadLength,
+                          (unsigned int)sizeof(MM_PatchFileHeader_t), FileName);
+    }
+
+    while ((Valid == true) && (EndOfFile == false))
+    {
+        ReadLength = OS_read(FileHandle, &Record, sizeof(Record));
+        if (ReadLength == 0)
+        {
+            EndOfFile = true;
+        }
+        else if (ReadLength != sizeof(Record))
+        {
+            Valid = false;
+            CFE_EVS_SendEvent(MM_PATCH_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Patch file record %u cut short: RC = %d File = '%s'", (unsigned int)RecordCount,
+                              (int)ReadLength, FileName);
+        }
+        else
+        {
+            FileCrc = MM_CalculateCRC(&Record, sizeof(Record), FileCrc, MM_LOAD_FILE_CRC_TYPE);
+            Valid   = MM_VerifyPatchRecord(FileName, &Record, RecordCount, NextOffset, FileHeader->NumOfBytes);
+        }
+
+        if ((Valid == true) && (EndOfFile == false))
+        {
+            /* The pre-image is the memory the record replaces */
+            PreImageAddress = DestAddress + Record.Offset;
+            BytesRemaining  = Record.Length;
+            while (BytesRemaining != 0)
+            {
+                /* Prevent CPU hogging between CRC segments, a segment may span records */
+                if (SegmentFill >= SegmentSize)
+                {
+                    SegmentSize = MM_SegmentBreak(SegmentFill);
+                    SegmentFill = 0;
+                }
+
+                CrcSize = SegmentSize - SegmentFill;
+                if (BytesRemaining < CrcSize)
+                {
+                    CrcSize = BytesRemaining;
+                }
+
+                PreImageCrc =
+                    MM_CalculateCRC((void *)PreImageAddress, CrcSize, PreImageCrc, MM_LOAD_FILE_CRC_TYPE);
+
+                PreImageAddress += CrcSize;
+                BytesRemaining -= CrcSize;
+                SegmentFill += CrcSize;
+            }
+
+            BytesRemaining = Record.Length;
+            while ((BytesRemaining != 0) && (Valid == true))
+            {
+                ReadSize = MM_IO_BUFFER_SIZE;
+                if (BytesRemaining < ReadSize)
+                {
+                    ReadSize = BytesRemaining;
+                }
+
+                ReadLength = OS_read(FileHandle, ioBuffer, ReadSize);
+                if (ReadLength == (int32)ReadSize)
+                {
+                    FileCrc = MM_CalculateCRC(ioBuffer, ReadSize, FileCrc, MM_LOAD_FILE_CRC_TYPE);
+                    BytesRemaining -= ReadSize;
+                }
+                else
+                {
+                    Valid = false;
+                    CFE_EVS_SendEvent(MM_PATCH_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "Patch file record %u cut short: RC = %d File = '%s'",
+                                      (unsigned int)RecordCount, (int)ReadLength, FileName);
+                }
+            }
+
+            NextOffset = Record.Offset + Record.Length;
+            RecordCount++;
+        }
+    }
+
+    if ((Valid == true) && (FileCrc != FileHeader->Crc))
+    {
+        Valid = false;
+        CFE_EVS_SendEvent(MM_LOAD_FILE_CRC_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Load file CRC failure: Expected = 0x%X Calculated = 0x%X File = '%s'",
+                          (unsigned int)FileHeader->Crc, (unsigned int)FileCrc, FileName);
+    }
+
+    if ((Valid == true) && (RecordCount != PatchHeader->NumOfRecords))
+    {
+        Valid = false;
+        CFE_EVS_SendEvent(MM_PATCH_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Patch file record count error: Expected = %u Found = %u File = '%s'",
+                          (unsigned int)PatchHeader->NumOfRecords, (unsigned int)RecordCount, FileName);
+    }
+
+    if ((Valid == true) && (PreImageCrc != PatchHeader->PreImageCrc))
+    {
+        Valid = false;
+        CFE_EVS_SendEvent(MM_PATCH_PREIMAGE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Patch pre-image CRC failure: Expected = 0x%X Calculated = 0x%X File = '%s'",
+                          (unsigned int)PatchHeader->PreImageCrc, (unsigned int)PreImageCrc, FileName);
+    }
+
+    CFE_ES_PerfLogExit(MM_FILE_CRC_PERF_ID);
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify a patch record                                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_VerifyPatchRecord(const char *FileName, const MM_PatchRecord_t *Record, uint32 RecordNum, uint32 NextOffset,
+                          uint32 NumOfBytes)
+{
+    bool Valid = true;
+
+    /* Records are in order, don't overlap and stay within the patched range */
+    if ((Record->Offset < NextOffset) || (Record->Offset > NumOfBytes) ||
+        (Record->Length > (NumOfBytes - Record->Offset)))
+    {
+        Valid = false;
+        CFE_EVS_SendEvent(MM_PATCH_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Patch file record %u out of order or range: Offset = %u Length = %u Bytes = %u File = '%s'",
+                          (unsigned int)RecordNum, (unsigned int)Record->Offset, (unsigned int)Record->Length,
+                          (unsigned int)NumOfBytes, FileName);
+    }
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Loads memory from a verified patch file                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_LoadMemFromPatchFile(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader,
+                             cpuaddr DestAddress, const MM_PatchFileHeader_t *PatchHeader)
+{
+    bool             Valid          = true;
+    int32            ReadLength;
+    uint32           RecordNum      = 0;
+    uint32           NextOffset     = 0;
+    size_t           BytesProcessed = 0;
+    size_t           BytesRemaining;
+    size_t           ReadSize;
+    size_t           SegmentSize = MM_SegmentStart(MM_SEG_LOAD);
+    size_t           SegmentFill = 0;
+    uint8 *          ioBuffer    = (uint8 *)&MM_AppData.IoBuffer[0];
+    uint8 *          TargetPointer;
+    MM_PatchRecord_t Record;
+
+    if (FileHeader->MemType == MM_EEPROM)
+    {
+        CFE_ES_PerfLogEntry(MM_EEPROM_FILELOAD_PERF_ID);
+    }
+
+    while ((RecordNum < PatchHeader->NumOfRecords) && (Valid == true))
+    {
+        MM_SegmentIoStart();
+        ReadLength = OS_read(FileHandle, &Record, sizeof(Record));
+        MM_SegmentIoEnd();
+
+        /* The file was verified, so a bad record means the file changed */
+        if (ReadLength != sizeof(Record))
+        {
+            Valid = false;
+            CFE_EVS_SendEvent(MM_OS_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "OS_read error received: RC = 0x%08X Expected = %u File = '%s'",
+                              (unsigned int)ReadLength, (unsigned int)sizeof(Record), FileName);
+        }
+        else
+        {
+            Valid = MM_VerifyPatchRecord(FileName, &Record, RecordNum, NextOffset, FileHeader->NumOfBytes);
+        }
+
+        BytesRemaining = 0;
+        if (Valid == true)
+        {
+            TargetPointer  = (uint8 *)(DestAddress + Record.Offset);
+            BytesRemaining = Record.Length;
+            NextOffset     = Record.Offset + Record.Length;
+            RecordNum++;
+        }
+
+        while ((BytesRemaining != 0) && (Valid == true))
+        {
+            /* A segment may span records, a read never spans segments */
+            ReadSize = SegmentSize - SegmentFill;
+            if (ReadSize > MM_IO_BUFFER_SIZE)
+            {
+                ReadSize = MM_IO_BUFFER_SIZE;
+            }
+            if (BytesRemaining < ReadSize)
+            {
+                ReadSize = BytesRemaining;
+            }
+
+            MM_SegmentIoStart();
+            ReadLength = OS_read(FileHandle, ioBuffer, ReadSize);
+            MM_SegmentIoEnd();
+            if (ReadLength == (int32)ReadSize)
+            {
+                CFE_ES_PerfLogEntry(MM_SEGCOPY_PERF_ID);
+                memcpy(TargetPointer, ioBuffer, ReadSize);
+                CFE_ES_PerfLogExit(MM_SEGCOPY_PERF_ID);
+
+                TargetPointer += ReadSize;
+                BytesRemaining -= ReadSize;
+                BytesProcessed += ReadSize;
+                SegmentFill += ReadSize;
+            }
+            else
+            {
+                Valid = false;
+                CFE_EVS_SendEvent(MM_OS_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "OS_read error received: RC = 0x%08X Expected = %u File = '%s'",
+                                  (unsigned int)ReadLength, (unsigned int)ReadSize, FileName);
+            }
+
+            /* Prevent CPU hogging between load segments */
+            if ((SegmentFill >= SegmentSize) && (Valid == true) &&
+                ((BytesRemaining != 0) || (RecordNum < PatchHeader->NumOfRecords)))
+            {
+                SegmentSize = MM_SegmentBreak(SegmentFill);
+                SegmentFill = 0;
+            }
+        }
+    }
+
+    if (FileHeader->MemType == MM_EEPROM)
+    {
+        CFE_ES_PerfLogExit(MM_EEPROM_FILELOAD_PERF_ID);
+    }
+
+    /* Update last action statistics */
+    if (Valid == true)
+    {
+        MM_AppData.HkPacket.Payload.LastAction     = MM_LOAD_FROM_FILE;
+        MM_AppData.HkPacket.Payload.MemType        = FileHeader->MemType;
+        MM_AppData.HkPacket.Payload.Address        = DestAddress;
+        MM_AppData.HkPacket.Payload.BytesProcessed = BytesProcessed;
+        strncpy(MM_AppData.HkPacket.Payload.FileName, FileName, OS_MAX_PATH_LEN);
+
+        MM_SegmentEnd(BytesProcessed);
+    }
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Load memory from multi-region file command                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_LoadMemFromMultiFileCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    bool                                Valid      = false;
+    osal_id_t                           FileHandle = OS_OBJECT_ID_UNDEFINED;
+    int32                               OS_Status;
+    size_t                              DataOffset;
+    char                                FileName[OS_MAX_PATH_LEN];
+    const MM_LoadMemFromMultiFileCmd_t *CmdPtr = ((MM_LoadMemFromMultiFileCmd_t *)BufPtr);
+    CFE_FS_Header_t                     CFEFileHeader;
+    MM_LoadDumpFileHeader_t             MMFileHeader;
+    MM_MultiFileHeader_t                MultiHeader;
+
+    memset(&MMFileHeader, 0, sizeof(MMFileHeader));
+    memset(&MultiHeader, 0, sizeof(MultiHeader));
+
+    CFE_ES_PerfLogEntry(MM_LOAD_FILE_PERF_ID);
+
+    /* Make sure string is null terminated before attempting to process it */
+    CFE_SB_MessageStringGet(FileName, CmdPtr->Payload.FileName, NULL, sizeof(FileName),
+                            sizeof(CmdPtr->Payload.FileName));
+
+    CFE_ES_PerfLogEntry(MM_FILE_OPEN_PERF_ID);
+    OS_Status = OS_OpenCreate(&FileHandle, FileName, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+    CFE_ES_PerfLogExit(MM_FILE_OPEN_PERF_ID);
+    if (OS_Status == OS_SUCCESS)
+    {
+        Valid = MM_ReadFileHeaders(FileName, FileHandle, &CFEFileHeader, &MMFileHeader);
+
+        if ((Valid == true) && (MMFileHeader.Encoding != MM_ENCODING_MULTI))
+        {
+            Valid = false;
+            CFE_EVS_SendEvent(MM_FILE_ENCODING_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "File encoding not supported: Encoding = %u MemType = %u",
+                              (unsigned int)MMFileHeader.Encoding, (unsigned int)MMFileHeader.MemType);
+        }
+
+        /* Nothing is written until every region is resolved and its data checked */
+        if (Valid == true)
+        {
+            Valid = MM_VerifyMultiFile(FileHandle, FileName, &MMFileHeader, &MultiHeader);
+        }
+
+        if (Valid == true)
+        {
+            DataOffset = sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t) + sizeof(MM_MultiFileHeader_t) +
+                         (MultiHeader.NumOfRegions * sizeof(MM_LoadDumpFileHeader_t));
+
+            OS_Status = OS_lseek(FileHandle, DataOffset, OS_SEEK_SET);
+            if (OS_Status != DataOffset)
+            {
+                Valid = false;
+            }
+        }
+
+        if (Valid == true)
+        {
+            Valid = MM_LoadMemFromMultiFile(FileHandle, FileName, &MultiHeader);
+        }
+
+        if (Valid == true)
+        {
+            CFE_EVS_SendEvent(MM_LD_MULTI_FILE_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "Load Memory From Multi-Region File Command: Loaded %u bytes to %u regions from file "
+                              "'%s'",
+                              (unsigned int)MM_AppData.HkPacket.Payload.BytesProcessed,
+                              (unsigned int)MultiHeader.NumOfRegions, FileName);
+        }
+
+        CFE_ES_PerfLogEntry(MM_FILE_CLOSE_PERF_ID);
+        OS_Status = OS_close(FileHandle);
+        CFE_ES_PerfLogExit(MM_FILE_CLOSE_PERF_ID);
+        if (OS_Status != OS_SUCCESS)
+        {
+            Valid = false;
+            CFE_EVS_SendEvent(MM_OS_CLOSE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "OS_close error received: RC = 0x%08X File = '%s'", (unsigned int)OS_Status, FileName);
+        }
+    }
+    else
+    {
+        CFE_EVS_SendEvent(MM_OS_OPEN_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "OS_OpenCreate error received: RC = %d File = '%s'", (int)OS_Status, FileName);
+    }
+
+    CFE_ES_PerfLogExit(MM_LOAD_FILE_PERF_ID);
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify a multi-region file and resolve its regions              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_VerifyMultiFile(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader,
+                        MM_MultiFileHeader_t *MultiHeader)
+{
+    bool                     Valid;
+    int32                    ReadLength;
+    uint32                   RegionCrc  = 0;
+    uint32                   TotalBytes = 0;
+    uint32                   i;
+    size_t                   BytesRemaining;
+    size_t                   ReadSize;
+    uint8 *                  ioBuffer = (uint8 *)&MM_AppData.IoBuffer[0];
+    MM_LoadDumpFileHeader_t *Region;
+
+    CFE_ES_PerfLogEntry(MM_FILE_CRC_PERF_ID);
+
+    Valid = MM_ReadMultiFileTable(FileHandle, FileName, FileHeader, MultiHeader);
+
+    for (i = 0; (Valid == true) && (i < MultiHeader->NumOfRegions); i++)
+    {
+        Valid = MM_VerifyFileRegion(FileName, &MM_AppData.FileRegions[i], i, &MM_AppData.FileRegionAddress[i]);
+        TotalBytes += MM_AppData.FileRegions[i].NumOfBytes;
+    }
+
+    if ((Valid == true) && (TotalBytes != FileHeader->NumOfBytes))
+    {
+        Valid = false;
+        CFE_EVS_SendEvent(MM_MULTI_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Multi-region file size error: Header = %u Regions = %u File = '%s'",
+                          (unsigned int)FileHeader->NumOfBytes, (unsigned int)TotalBytes, FileName);
+    }
+
+    /* The region data follows the table in table order */
+    for (i = 0; (Valid == true) && (i < MultiHeader->NumOfRegions); i++)
+    {
+        Region         = &MM_AppData.FileRegions[i];
+        RegionCrc      = 0;
+        BytesRemaining = Region->NumOfBytes;
+
+        while ((BytesRemaining != 0) && (Valid == true))
+        {
+            ReadSize = MM_IO_BUFFER_SIZE;
+            if (BytesRemaining < ReadSize)
+            {
+                ReadSize = BytesRemaining;
+            }
+
+            ReadLength = OS_read(FileHandle, ioBuffer, ReadSize);
+            if (ReadLength == (int32)ReadSize)
+            {
+                RegionCrc = MM_CalculateCRC(ioBuffer, ReadSize, RegionCrc, MM_LOAD_FILE_CRC_TYPE);
+                BytesRemaining -= ReadSize;
+            }
+            else
+            {
+                Valid = false;
+                CFE_EVS_SendEvent(MM_OS_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "OS_read error received: RC = 0x%08X Expected = %u File = '%s'",
+                                  (unsigned int)ReadLength, (unsigned int)ReadSize, FileName);
+            }
+        }
+
+        if ((Valid == true) && (RegionCrc != Region->Crc))
+        {
+            Valid = false;
+            CFE_EVS_SendEvent(MM_LOAD_FILE_CRC_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Load file region %u CRC failure: Expected = 0x%X Calculated = 0x%X File = '%s'",
+                              (unsigned int)i, (unsigned int)Region->Crc, (unsigned int)RegionCrc, FileName);
+        }
+    }
+
+    CFE_ES_PerfLogExit(MM_FILE_CRC_PERF_ID);
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Read and check the region table of a multi-region file          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_ReadMultiFileTable(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader,
+                           MM_MultiFileHeader_t *MultiHeader)
+{
+    bool   Valid = true;
+    int32  ReadLength;
+    uint32 TableCrc = 0;
+    size_t TableSize;
+
+    ReadLength = OS_read(FileHandle, MultiHeader, sizeof(MM_MultiFileHeader_t));
+    if (ReadLength != sizeof(MM_MultiFileHeader_t))
+    {
+        Valid = false;
+        CFE_EVS_SendEvent(MM_OS_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "OS_read error received: RC = 0x%08X Expected = %u File = '%s'", (unsigned int)ReadLength,
+                          (unsigned int)sizeof(MM_MultiFileHeader_t), FileName);
+    }
+    else if ((MultiHeader->NumOfRegions == 0) || (MultiHeader->NumOfRegions > MM_MAX_FILE_REGIONS))
+    {
+        Valid = false;
+        CFE_EVS_SendEvent(MM_MULTI_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Multi-region file region count error: Regions = %u Max = %u File = '%s'",
+                          (unsigned int)MultiHeader->NumOfRegions, (unsigned int)MM_MAX_FILE_REGIONS, FileName);
+    }
+    else
+    {
+        /* The MM header CRC covers the region table, each region CRC covers its data */
+        TableCrc  = MM_CalculateCRC(MultiHeader, sizeof(MM_MultiFileHeader_t), TableCrc, MM_LOAD_FILE_CRC_TYPE);
+        TableSize = MultiHeader->NumOfRegions * sizeof(MM_LoadDumpFileHeader_t);
+
+        ReadLength = OS_read(FileHandle, MM_AppData.FileRegions, TableSize);
+        if (ReadLength == (int32)TableSize)
+        {
+            TableCrc = MM_CalculateCRC(MM_AppData.FileRegions, TableSize, TableCrc, MM_LOAD_FILE_CRC_TYPE);
+        }
+        else
+        {
+            Valid = false;
+            CFE_EVS_SendEvent(MM_OS_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "OS_read error received: RC = 0x%08X Expected = %u File = '%s'",
+                              (unsigned int)ReadLength, (unsigned int)TableSize, FileName);
+        }
+    }
+
+    if ((Valid == true) && (TableCrc != FileHeader->Crc))
+    {
+        Valid = false;
+        CFE_EVS_SendEvent(MM_LOAD_FILE_CRC_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Load file CRC failure: Expected = 0x%X Calculated = 0x%X File = '%s'",
+                          (unsigned int)FileHeader->Crc, (unsigned int)TableCrc, FileName);
+    }
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify a multi-region file region and resolve its address       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_VerifyFileRegion(const char *FileName, MM_LoadDumpFileHeader_t *Region, uint32 RegionNum,
+                         cpuaddr *DestAddress)
+{
+    bool Valid = false;
+
+    if (Region->Encoding != MM_ENCODING_RAW)
+    {
+        CFE_EVS_SendEvent(MM_MULTI_FILE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Multi-region file region %u encoding not supported: Encoding = %u File = '%s'",
+                          (unsigned int)RegionNum, (unsigned int)Region->Encoding, FileName);
+    }
+    else if (MM_ResolveSymAddr(&(Region->SymAddress), DestAddress) == false)
+    {
+        CFE_EVS_SendEvent(MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Symbolic address can't be resolved: Name = '%s'", Region->SymAddress.SymName);
+    }
+    else if (MM_VerifyLoadDumpParams(*DestAddress, Region->MemType, Region->NumOfBytes, MM_VERIFY_LOAD) == false)
+    {
+        CFE_EVS_SendEvent(MM_FILE_LOAD_PARAMS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Load file region %u failed parameters check: File = '%s'", (unsigned int)RegionNum,
+                          FileName);
+    }
+    else
+    {
+        Valid = true;
+    }
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Loads memory from a verified multi-region file                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_LoadMemFromMultiFile(osal_id_t FileHandle, const char *FileName, const MM_MultiFileHeader_t *MultiHeader)
+{
+    bool   Valid          = true;
+    size_t BytesProcessed = 0;
+    uint32 i;
+
+    /* The regions make up one load in the statistics and throughput */
+    MM_SegmentMultiStart(MM_SEG_LOAD);
+
+    for (i = 0; (Valid == true) && (i < MultiHeader->NumOfRegions); i++)
+    {
+        Valid = MM_LoadFileRegion(FileHandle, FileName, &MM_AppData.FileRegions[i], MM_AppData.FileRegionAddress[i]);
+        BytesProcessed += MM_AppData.FileRegions[i].NumOfBytes;
+    }
+
+    MM_SegmentMultiEnd(Valid, BytesProcessed);
+
+    /* Each region load updates the last action, report the whole file */
+    if (Valid == true)
+    {
+        MM_AppData.HkPacket.Payload.LastAction     = MM_LOAD_FROM_FILE;
+        MM_AppData.HkPacket.Payload.MemType        = MM_AppData.FileRegions[0].MemType;
+        MM_AppData.HkPacket.Payload.Address        = MM_AppData.FileRegionAddress[0];
+        MM_AppData.HkPacket.Payload.BytesProcessed = BytesProcessed;
+    }
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Loads one region of a multi-region file                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_LoadFileRegion(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *Region,
+                       cpuaddr DestAddress)
+{
+    bool                      Valid  = false;
+    const MM_MemTypeDriver_t *Driver = MM_MemTypeGet(Region->MemType);
+
+    /* The region data is the same as a raw load file of its memory type */
+    /* A bad MemType is caught when the region is verified */
+    if (Driver != NULL)
+    {
+        Valid = Driver->LoadFromFile(FileHandle, FileName, Region, DestAddress);
+    }
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify load file size                                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_VerifyLoadFileSize(const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader)
+{
+    bool       Valid = true;
+    int32      OS_Status;
+    size_t     ExpectedSize;
+    size_t     MinimumSize;
+    int32      ActualSize; /* The size returned by OS_stat is signed */
+    os_fstat_t FileStats;
+
+    memset(&FileStats, 0, sizeof(FileStats));
+
+    /*
+    ** Get the filesystem statistics on our load file
+    */
+    OS_Status = OS_stat(FileName, &FileStats);
+    if (OS_Status != OS_SUCCESS)
+    {
+        Valid = false;
+        CFE_EVS_SendEvent(MM_OS_STAT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "OS_stat error received: RC = 0x%08X File = '%s'", (unsigned int)OS_Status, FileName);
+    }
+    else
+    {
+        /*
+        ** Check the reported size of the file against what it should be based
+        ** upon the number of load bytes specified in the file header
+        */
+        ActualSize   = OS_FILESTAT_SIZE(FileStats);
+        ExpectedSize = FileHeader->NumOfBytes + sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t);
+        MinimumSize  = ExpectedSize;
+
+        /*
+        ** The size of encoded data depends on the data, so only check it is
+        ** within what the encoding can produce for the number of load bytes
+        */
+        if (FileHeader->Encoding == MM_ENCODING_RLE)
+        {
+            MinimumSize  = sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t) + 1;
+            ExpectedSize = MM_RLE_MAX_ENCODED_SIZE(FileHeader->NumOfBytes) + sizeof(CFE_FS_Header_t) +
+                           sizeof(MM_LoadDumpFileHeader_t);
+        }
+        else if (FileHeader->Encoding == MM_ENCODING_SPARSE)
+        {
+            /* Memory that is all fill has no extents */
+            MinimumSize  = sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t);
+            ExpectedSize = MM_SPARSE_MAX_ENCODED_SIZE(FileHeader->NumOfBytes) + sizeof(CFE_FS_Header_t) +
+                           sizeof(MM_LoadDumpFileHeader_t);
+        }
+
+        if ((ActualSize < (int32)MinimumSize) || (ActualSize > (int32)ExpectedSize))
+        {
+            Valid = false;
+
+            /*
+            ** Note: passing FileStats.st_size in this event message will cause
+            ** a segmentation fault under cygwin during unit testing, so we added
+            ** the variable ActualSize to this function.
+            */
+            CFE_EVS_SendEvent(MM_LD_FILE_SIZE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Load file size error: Reported by OS = %d Expected = %u File = '%s'", (int)ActualSize,
+                              (unsigned int)ExpectedSize, FileName);
+        }
+    }
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Read the cFE primary and MM secondary file headers          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_ReadFileHeaders(const char *FileName, osal_id_t FileHandle, CFE_FS_Header_t *CFEHeader,
+                        MM_LoadDumpFileHeader_t *MMHeader)
+{
+    bool  Valid = true;
+    int32 OS_Status;
+
+    CFE_ES_PerfLogEntry(MM_FILE_HDR_PERF_ID);
+
+    /*
+    ** Read in the primary cFE file header
+    */
+    OS_Status = CFE_FS_ReadHeader(CFEHeader, FileHandle);
+    if (OS_Status != sizeof(CFE_FS_Header_t))
+    {
+        /* We either got an error or didn't read as much data as expected */
+        Valid = false;
+        CFE_EVS_SendEvent(MM_CFE_FS_READHDR_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "CFE_FS_ReadHeader error received: RC = 0x%08X Expected = %u File = '%s'",
+                          (unsigned int)OS_Status, (unsigned int)sizeof(CFE_FS_Header_t), FileName);
+
+    } /* end CFE_FS_ReadHeader if */
+    else
+    {
+        /*
+        ** Read in the secondary MM file header
+        */
+        OS_Status = OS_read(FileHandle, MMHeader, sizeof(MM_LoadDumpFileHeader_t));
+        if (OS_Status != sizeof(MM_LoadDumpFileHeader_t))
+        {
+            /* We either got an error or didn't read as much data as expected */
+            Valid = false;
+            CFE_EVS_SendEvent(MM_OS_READ_EXP_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "OS_read error received: RC = 0x%08X Expected = %u File = '%s'", (unsigned int)OS_Status,
+                              (unsigned int)sizeof(MM_LoadDumpFileHeader_t), FileName);
+
+        } /* end OS_read if */
+
+    } /* end CFE_FS_ReadHeader else */
+
+    CFE_ES_PerfLogExit(MM_FILE_HDR_PERF_ID);
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Fill memory command                                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_FillMemCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    cpuaddr                   DestAddress    = 0;
+    const MM_FillMemCmd_t *   CmdPtr         = (MM_FillMemCmd_t *)BufPtr;
+    bool                      CmdResult      = false;
+    MM_SymAddr_t              DestSymAddress = CmdPtr->Payload.DestSymAddress;
+    const MM_MemTypeDriver_t *Driver;
+
+    CFE_ES_PerfLogEntry(MM_FILL_PERF_ID);
+
+        /* Resolve symbolic address */
+        if (MM_ResolveSymAddr(&(DestSymAddress), &DestAddress) == true)
+        {
+            /* Run necessary checks on command parameters */
+            if (MM_VerifyLoadDumpParams(DestAddress, CmdPtr->Payload.MemType, CmdPtr->Payload.NumOfBytes, MM_VERIFY_FILL) == true)
+            {
+                Driver = MM_MemTypeGet(CmdPtr->Payload.MemType);
+
+                /*
+                ** A bad MemType will get caught in the
+                ** MM_VerifyLoadDumpParams function and we won't get here
+                */
+                if (Driver != NULL)
+                {
+                    CmdResult = Driver->Fill(DestAddress, CmdPtr);
+                }
+
+                if (MM_AppData.HkPacket.Payload.LastAction == MM_FILL)
+                {
+                    CFE_EVS_SendEvent(MM_FILL_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                      "Fill Memory Command: Filled %d bytes at address: %p with pattern: 0x%08X",
+                                      (int)MM_AppData.HkPacket.Payload.BytesProcessed, (void *)DestAddress,
+                                      (unsigned int)MM_AppData.HkPacket.Payload.DataValue);
+                }
+            }
+        }
+        else
+        {
+            CFE_EVS_SendEvent(MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Symbolic address can't be resolved: Name = '%s'", DestSymAddress.SymName);
+        }
+
+    CFE_ES_PerfLogExit(MM_FILL_PERF_ID);
+
+    return CmdResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Fill memory with the command specified fill pattern             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_FillMem(cpuaddr DestAddress, const MM_FillMemCmd_t *CmdPtr)
+{
+    uint16  i;
+    bool    Valid          = true;
+    size_t  BytesProcessed = 0;
+    uint32  BytesRemaining = CmdPtr->Payload.NumOfBytes;
+    uint32  SegmentSize    = MM_SegmentStart(MM_SEG_FILL);
+    uint8 * TargetPointer  = (uint8 *)DestAddress;
+    uint32 *FillBuffer     = &MM_AppData.IoBuffer[0];
+
+    /* Create a scratch buffer with one fill segment */
+    for (i = 0; i < (MM_MAX_FILL_DATA_SEG / sizeof(uint32)); i++)
+    {
+        FillBuffer[i] = CmdPtr->Payload.FillPattern;
+    }
+
+    /* Start EEPROM performance monitor */
+    if (CmdPtr->Payload.MemType == MM_EEPROM)
+    {
+        CFE_ES_PerfLogEntry(MM_EEPROM_FILL_PERF_ID);
+    }
+
+    /* Fill memory one segment at a time */
+    while (BytesRemaining != 0)
+    {
+        /* Last fill segment may be partial size */
+        if (BytesRemaining < SegmentSize)
+        {
+            SegmentSize = BytesRemaining;
+        }
+
+        CFE_ES_PerfLogEntry(MM_SEGCOPY_PERF_ID);
+        memcpy(TargetPointer, FillBuffer, SegmentSize);
+        CFE_ES_PerfLogExit(MM_SEGCOPY_PERF_ID);
+
+        TargetPointer += SegmentSize;
+        BytesProcessed += SegmentSize;
+        BytesRemaining -= SegmentSize;
+
+        /* Prevent CPU hogging between load segments */
+        if (BytesRemaining != 0)
+        {
+            SegmentSize = MM_SegmentBreak(SegmentSize);
+        }
+    }
 
     /* Stop EEPROM performance monitor */
     if (CmdPtr->Payload.MemType == MM_EEPROM)
@@ -830,5 +1970,298 @@ bool MM_FillMem(cpuaddr DestAddress, const MM_FillMemCmd_t *CmdPtr)
     MM_AppData.HkPacket.Payload.DataValue      = CmdPtr->Payload.FillPattern;
     MM_AppData.HkPacket.Payload.BytesProcessed = BytesProcessed;
 
+    MM_SegmentEnd(BytesProcessed);
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Copy memory command                                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_CopyMemCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    cpuaddr                SrcAddress     = 0;
+    cpuaddr                DestAddress    = 0;
+    const MM_CopyMemCmd_t *CmdPtr         = (MM_CopyMemCmd_t *)BufPtr;
+    bool                   CmdResult      = false;
+    uint32                 Crc            = 0;
+    MM_SymAddr_t           SrcSymAddress  = CmdPtr->Payload.SrcSymAddress;
+    MM_SymAddr_t           DestSymAddress = CmdPtr->Payload.DestSymAddress;
+
+    CFE_ES_PerfLogEntry(MM_COPY_PERF_ID);
+
+    /* Resolve symbolic addresses */
+    if (MM_ResolveSymAddr(&SrcSymAddress, &SrcAddress) != true)
+    {
+        CFE_EVS_SendEvent(MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Symbolic address can't be resolved: Name = '%s'", SrcSymAddress.SymName);
+    }
+    else if (MM_ResolveSymAddr(&DestSymAddress, &DestAddress) != true)
+    {
+        CFE_EVS_SendEvent(MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Symbolic address can't be resolved: Name = '%s'", DestSymAddress.SymName);
+    }
+    /* The source is read like a dump and the destination written like a load */
+    else if ((MM_VerifyLoadDumpParams(SrcAddress, CmdPtr->Payload.SrcMemType, CmdPtr->Payload.NumOfBytes,
+                                      MM_VERIFY_DUMP) == true) &&
+             (MM_VerifyLoadDumpParams(DestAddress, CmdPtr->Payload.DestMemType, CmdPtr->Payload.NumOfBytes,
+                                      MM_VERIFY_LOAD) == true))
+    {
+        CmdResult = MM_CopyMem(SrcAddress, DestAddress, CmdPtr, &Crc);
+
+        if (CmdResult == true)
+        {
+            CFE_EVS_SendEvent(MM_COPY_INF_EID, CFE_EVS_EventType_INFORMATION,
+                              "Copy Memory Command: Copied %d bytes from address: %p to address: %p, CRC = 0x%08X",
+                              (int)CmdPtr->Payload.NumOfBytes, (void *)SrcAddress, (void *)DestAddress,
+                              (unsigned int)Crc);
+        }
+    }
+
+    CFE_ES_PerfLogExit(MM_COPY_PERF_ID);
+
+    return CmdResult;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Copy memory a segment at a time through the i/o buffer          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_CopyMem(cpuaddr SrcAddress, cpuaddr DestAddress, const MM_CopyMemCmd_t *CmdPtr, uint32 *CrcPtr)
+{
+    bool   Valid          = true;
+    uint32 Crc            = 0;
+    size_t NumOfBytes     = CmdPtr->Payload.NumOfBytes;
+    size_t BytesRemaining = NumOfBytes;
+    size_t BytesProcessed = 0;
+    size_t SegmentSize    = MM_SegmentStart(MM_SEG_COPY);
+    uint8 *ioBuffer       = (uint8 *)&MM_AppData.IoBuffer[0];
+    size_t Offset;
+    bool   Backward;
+
+    /*
+    ** When the destination starts inside the source range a forward
+    ** copy would overwrite source bytes before they are read, so the
+    ** copy runs from the end of the range instead
+    */
+    Backward = (DestAddress > SrcAddress) && (DestAddress < (SrcAddress + NumOfBytes));
+
+    if (CmdPtr->Payload.DestMemType == MM_EEPROM)
+    {
+        CFE_ES_PerfLogEntry(MM_EEPROM_FILELOAD_PERF_ID);
+    }
+
+    while (Valid && (BytesRemaining != 0))
+    {
+        if (BytesRemaining < SegmentSize)
+        {
+            SegmentSize = BytesRemaining;
+        }
+
+        if (Backward)
+        {
+            Offset = BytesRemaining - SegmentSize;
+        }
+        else
+        {
+            Offset = BytesProcessed;
+        }
+
+        CFE_ES_PerfLogEntry(MM_SEGCOPY_PERF_ID);
+        Valid = MM_ReadMemBlock(SrcAddress + Offset, CmdPtr->Payload.SrcMemType, ioBuffer, SegmentSize) &&
+                MM_WriteMemBlock(DestAddress + Offset, CmdPtr->Payload.DestMemType, ioBuffer, SegmentSize);
+        CFE_ES_PerfLogExit(MM_SEGCOPY_PERF_ID);
+
+        if (Valid)
+        {
+            /* A forward copy takes the CRC of each segment as it goes by */
+            if (!Backward)
+            {
+                Crc = MM_CalculateCRC(ioBuffer, SegmentSize, Crc, MM_DUMP_FILE_CRC_TYPE);
+            }
+
+            BytesRemaining -= SegmentSize;
+            BytesProcessed += SegmentSize;
+
+            /* Prevent CPU hogging between copy segments */
+            if (BytesRemaining != 0)
+            {
+                SegmentSize = MM_SegmentBreak(SegmentSize);
+            }
+        }
+    }
+
+    if (CmdPtr->Payload.DestMemType == MM_EEPROM)
+    {
+        CFE_ES_PerfLogExit(MM_EEPROM_FILELOAD_PERF_ID);
+    }
+
+    /*
+    ** A backward copy sees the data end first, so its CRC is taken from
+    ** the destination, which now holds exactly what the source held
+    */
+    if (Valid && Backward)
+    {
+        MM_SegmentBreak(SegmentSize);
+        Valid = MM_ComputeMemCRC(DestAddress, CmdPtr->Payload.DestMemType, NumOfBytes, &Crc, MM_DUMP_FILE_CRC_TYPE);
+    }
+
+    if (Valid)
+    {
+        /* Update last action statistics */
+        MM_AppData.HkPacket.Payload.LastAction     = MM_COPY;
+        MM_AppData.HkPacket.Payload.MemType        = CmdPtr->Payload.DestMemType;
+        MM_AppData.HkPacket.Payload.Address        = DestAddress;
+        MM_AppData.HkPacket.Payload.DataValue      = Crc;
+        MM_AppData.HkPacket.Payload.BytesProcessed = BytesProcessed;
+
+        MM_SegmentEnd(BytesProcessed);
+
+        *CrcPtr = Crc;
+    }
+
     return Valid;
 }
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Restore the load file validation cache                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_LoadCacheInit(void)
+{
+    CFE_Status_t Status;
+    uint32       i;
+
+    memset(&MM_AppData.LoadCache, 0, sizeof(MM_AppData.LoadCache));
+
+    Status = CFE_ES_RegisterCDS(&MM_AppData.LoadCacheCDSHandle, sizeof(MM_AppData.LoadCache), MM_LOAD_CACHE_CDS_NAME);
+    if (Status == CFE_ES_CDS_ALREADY_EXISTS)
+    {
+        /* Files verified before the reset are still known */
+        Status = CFE_ES_RestoreFromCDS(&MM_AppData.LoadCache, MM_AppData.LoadCacheCDSHandle);
+        if (Status != CFE_SUCCESS)
+        {
+            memset(&MM_AppData.LoadCache, 0, sizeof(MM_AppData.LoadCache));
+        }
+    }
+    else if (Status != CFE_SUCCESS)
+    {
+        MM_AppData.LoadCacheCDSHandle = CFE_ES_CDS_BAD_HANDLE;
+        CFE_EVS_SendEvent(MM_LOAD_CACHE_CDS_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error Registering Load Cache CDS, RC = 0x%08X", (unsigned int)Status);
+    }
+
+    /* Don't trust a restored cache any further than its own bounds */
+    if (MM_AppData.LoadCache.NextEntry >= MM_LOAD_CACHE_ENTRIES)
+    {
+        MM_AppData.LoadCache.NextEntry = 0;
+    }
+
+    for (i = 0; i < MM_LOAD_CACHE_ENTRIES; i++)
+    {
+        MM_AppData.LoadCache.Entries[i].FileName[OS_MAX_PATH_LEN - 1] = '\0';
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Look up a load file in the validation cache                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_LoadCacheLookup(const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader, MM_LoadCacheEntry_t *CacheKey)
+{
+    bool                 Hit = false;
+    int32                OS_Status;
+    os_fstat_t           FileStats;
+    MM_LoadCacheEntry_t *Entry;
+    uint32               i;
+
+    memset(CacheKey, 0, sizeof(*CacheKey));
+    memset(&FileStats, 0, sizeof(FileStats));
+
+    /* The key is taken before the file is verified, so a later change can't be missed */
+    OS_Status = OS_stat(FileName, &FileStats);
+    if (OS_Status == OS_SUCCESS)
+    {
+        strncpy(CacheKey->FileName, FileName, sizeof(CacheKey->FileName) - 1);
+        CacheKey->FileSize = OS_FILESTAT_SIZE(FileStats);
+        CacheKey->FileTime = OS_FILESTAT_TIME(FileStats);
+        CacheKey->Header   = *FileHeader;
+        CacheKey->InUse    = true;
+
+        for (i = 0; i < MM_LOAD_CACHE_ENTRIES; i++)
+        {
+            Entry = &MM_AppData.LoadCache.Entries[i];
+
+            if ((Entry->InUse == true) && (strncmp(Entry->FileName, FileName, sizeof(Entry->FileName)) == 0))
+            {
+                if ((Entry->FileSize == CacheKey->FileSize) && (Entry->FileTime == CacheKey->FileTime) &&
+                    (memcmp(&Entry->Header, FileHeader, sizeof(Entry->Header)) == 0))
+                {
+                    Hit = true;
+                }
+                else
+                {
+                    /* The file has changed, it must be verified again */
+                    memset(Entry, 0, sizeof(*Entry));
+                    MM_LoadCacheSave();
+                }
+                break;
+            }
+        }
+    }
+
+    return Hit;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Add a verified load file to the validation cache                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_LoadCacheUpdate(const MM_LoadCacheEntry_t *CacheKey)
+{
+    MM_LoadCacheEntry_t *Entry = NULL;
+    uint32               i;
+
+    /* A file that couldn't be stat'ed has no key to remember it by */
+    if (CacheKey->InUse == true)
+    {
+        for (i = 0; i < MM_LOAD_CACHE_ENTRIES; i++)
+        {
+            if ((MM_AppData.LoadCache.Entries[i].InUse == true) &&
+                (strncmp(MM_AppData.LoadCache.Entries[i].FileName, CacheKey->FileName, OS_MAX_PATH_LEN) == 0))
+            {
+                Entry = &MM_AppData.LoadCache.Entries[i];
+                break;
+            }
+        }
+
+        if (Entry == NULL)
+        {
+            Entry                          = &MM_AppData.LoadCache.Entries[MM_AppData.LoadCache.NextEntry];
+            MM_AppData.LoadCache.NextEntry = (MM_AppData.LoadCache.NextEntry + 1) % MM_LOAD_CACHE_ENTRIES;
+        }
+
+        *Entry = *CacheKey;
+        MM_LoadCacheSave();
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Save the load file validation cache to the CDS                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_LoadCacheSave(void)
+{
+    /* Without a CDS block the cache only lasts until the next reset */
+    if (CFE_RESOURCEID_TEST_DEFINED(MM_AppData.LoadCacheCDSHandle))
+    {
+        CFE_ES_CopyToCDS(MM_AppData.LoadCacheCDSHandle, &MM_AppData.LoadCache);
+    }
+}
@@ -31,6 +31,7 @@
 #include "cfe.h"
 #include "mm_msg.h"
 #include "mm_filedefs.h"
+#include "mm_app.h"
 
 /*************************************************************************
  * Exported Functions
@@ -41,10 +42,11 @@
  *
  *  \par Description
  *       Support function for #MM_PokeCmd. This routine will write
- *       8, 16, or 32 bits of data to a single ram address.
+ *       8, 16, or 32 bits of data to a single address of any memory
+ *       type but EEPROM, using the write routine of its driver.
  *
  *  \par Assumptions, External Events, and Notes:
- *       None
+ *       The driver sends the error event if the write fails.
  *
  *  \param [in]   CmdPtr        Pointer to command
  *  \param [in]   DestAddress   The destination address for the poke
@@ -109,6 +111,325 @@ bool MM_LoadMemWID(const MM_LoadMemWIDCmd_t *CmdPtr, cpuaddr DestAddress);
 bool MM_LoadMemFromFile(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader,
                         cpuaddr DestAddress);
 
+/**
+ * \brief Get a load file staging buffer
+ *
+ *  \par Description
+ *       Support function for #MM_LoadMemFromFileCmd. Allocates a buffer
+ *       from the load staging pool for a RAM or EEPROM load that is no
+ *       larger than the configured maximum staged load.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The caller returns the buffer to the pool with CFE_ES_PutPoolBuf.
+ *
+ *  \param [in]   FileHeader   Pointer to file header
+ *
+ *  \return Pointer to the staging buffer, NULL if the load is not staged
+ */
+uint8 *MM_GetLoadStagingBuf(const MM_LoadDumpFileHeader_t *FileHeader);
+
+/**
+ * \brief Read load file data into a staging buffer
+ *
+ *  \par Description
+ *       Support function for #MM_LoadMemFromFileCmd. This routine reads
+ *       the load data from the current file position into the staging
+ *       buffer with a single read and computes its CRC, so the file only
+ *       has to be read once.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The load file size has already been verified.
+ *
+ *  \param [in]   FileHandle   The open file handle of the load file
+ *  \param [in]   FileHeader   Pointer to file header
+ *  \param [out]  StagingBuf   Buffer of at least the load size
+ *  \param [out]  CrcPtr       CRC of the load data
+ *
+ *  \return OSAL status
+ *  \retval #OS_SUCCESS \copybrief OS_SUCCESS
+ *  \retval #OS_ERROR   The file held less data than expected
+ */
+int32 MM_StageLoadFile(osal_id_t FileHandle, const MM_LoadDumpFileHeader_t *FileHeader, uint8 *StagingBuf,
+                       uint32 *CrcPtr);
+
+/**
+ * \brief Memory load from a staged load file
+ *
+ *  \par Description
+ *       Support function for #MM_LoadMemFromFileCmd. This routine copies
+ *       the load data read by #MM_StageLoadFile to memory, one load
+ *       segment at a time.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   StagingBuf   The staged load data
+ *  \param [in]   FileName     A pointer to a character string holding
+ *                             the load file name
+ *  \param [in]   FileHeader   Pointer to file header
+ *  \param [in]   DestAddress  The destination address for the requested
+ *                             load operation
+ *
+ *  \return Boolean execution status
+ *  \retval true Load from staged file successful
+ */
+bool MM_LoadMemFromStaging(const uint8 *StagingBuf, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader,
+                           cpuaddr DestAddress);
+
+/**
+ * \brief Compute the CRC of encoded load file data
+ *
+ *  \par Description
+ *       Support function for #MM_LoadMemFromFileCmd. This routine
+ *       decodes the load data from the current file position to the end
+ *       of the file and computes the CRC of the decoded data, so it can
+ *       be checked against the file header CRC before memory is changed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The decoded data is discarded in small pieces, nothing the size
+ *       of the load is buffered.
+ *
+ *  \param [in]   FileHandle   The open file handle of the load file
+ *  \param [in]   FileName     A pointer to a character string holding
+ *                             the load file name
+ *  \param [in]   FileHeader   Pointer to file header
+ *  \param [out]  CrcPtr       CRC of the decoded load data
+ *
+ *  \return OSAL status
+ *  \retval #OS_SUCCESS \copybrief OS_SUCCESS
+ *  \retval #OS_ERROR   The data doesn't decode to the number of bytes
+ *                      in the file header
+ */
+int32 MM_ComputeDecodedCRCFromFile(osal_id_t FileHandle, const char *FileName,
+                                   const MM_LoadDumpFileHeader_t *FileHeader, uint32 *CrcPtr);
+
+/**
+ * \brief Memory load from an encoded load file
+ *
+ *  \par Description
+ *       Support function for #MM_LoadMemFromFileCmd. This routine reads
+ *       encoded load data from the file and decodes it directly to
+ *       memory, one load segment at a time.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The file data was already checked by #MM_ComputeDecodedCRCFromFile.
+ *
+ *  \param [in]   FileHandle   The open file handle of the load file
+ *  \param [in]   FileName     A pointer to a character string holding
+ *                             the load file name
+ *  \param [in]   FileHeader   Pointer to file header
+ *  \param [in]   DestAddress  The destination address for the requested
+ *                             load operation
+ *
+ *  \return Boolean execution status
+ *  \retval true  Load completed successfully
+ *  \retval false Load failed
+ */
+bool MM_LoadMemFromEncodedFile(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader,
+                               cpuaddr DestAddress);
+
+/**
+ * \brief Verify a patch file and the memory it replaces
+ *
+ *  \par Description
+ *       Support function for #MM_LoadMemFromPatchFileCmd. Reads the patch
+ *       header and every record, checks each record with
+ *       #MM_VerifyPatchRecord, the CRC of the file data against the MM
+ *       file header and the CRC of the memory the records replace against
+ *       the patch pre-image CRC.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The file must be positioned after the MM secondary header. Memory
+ *       is only read, in CRC segments with a segment break between them.
+ *
+ *  \param [in]   FileHandle   The open file handle of the patch file
+ *  \param [in]   FileName     A pointer to a character string holding
+ *                             the patch file name
+ *  \param [in]   FileHeader   Pointer to the MM file header
+ *  \param [in]   DestAddress  The resolved patch base address
+ *  \param [out]  PatchHeader  Pointer to the patch header read from the file
+ *
+ *  \return Boolean patch file verification result
+ *  \retval true  The patch can be applied
+ *  \retval false The patch file is invalid or was made for other memory contents
+ */
+bool MM_VerifyPatchFile(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader,
+                        cpuaddr DestAddress, MM_PatchFileHeader_t *PatchHeader);
+
+/**
+ * \brief Verify a patch record
+ *
+ *  \par Description
+ *       Support function for #MM_VerifyPatchFile and #MM_LoadMemFromPatchFile.
+ *       Checks a record starts at or after the end of the record before
+ *       it and ends within the patched range.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   FileName     A pointer to a character string holding
+ *                             the patch file name
+ *  \param [in]   Record       Pointer to the patch record
+ *  \param [in]   RecordNum    Index of the record in the file
+ *  \param [in]   NextOffset   Offset just past the record before it
+ *  \param [in]   NumOfBytes   Size of the patched range
+ *
+ *  \return Boolean patch record verification result
+ *  \retval true  Record is valid
+ *  \retval false Record is out of order or out of range
+ */
+bool MM_VerifyPatchRecord(const char *FileName, const MM_PatchRecord_t *Record, uint32 RecordNum, uint32 NextOffset,
+                          uint32 NumOfBytes);
+
+/**
+ * \brief Memory load from patch file
+ *
+ *  \par Description
+ *       Support function for #MM_LoadMemFromPatchFileCmd. Writes the
+ *       bytes of each patch record to memory at the patch base address
+ *       plus the record offset.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The patch must have been checked by #MM_VerifyPatchFile and the
+ *       file positioned at the first record.
+ *
+ *  \param [in]   FileHandle   The open file handle of the patch file
+ *  \param [in]   FileName     A pointer to a character string holding
+ *                             the patch file name
+ *  \param [in]   FileHeader   Pointer to the MM file header
+ *  \param [in]   DestAddress  The resolved patch base address
+ *  \param [in]   PatchHeader  Pointer to the patch header
+ *
+ *  \return Boolean execution status
+ *  \retval true  Patch applied successfully
+ *  \retval false Patch failed
+ */
+bool MM_LoadMemFromPatchFile(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader,
+                             cpuaddr DestAddress, const MM_PatchFileHeader_t *PatchHeader);
+
+/**
+ * \brief Verify a multi-region file and resolve its regions
+ *
+ *  \par Description
+ *       Support function for #MM_LoadMemFromMultiFileCmd. Reads the
+ *       multi-region header and the region table with
+ *       #MM_ReadMultiFileTable, checks each region with
+ *       #MM_VerifyFileRegion and then reads the data of each region to
+ *       check it against the region CRC.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The file must be positioned after the MM secondary header. Memory
+ *       is not written.
+ *
+ *  \param [in]   FileHandle   The open file handle of the multi-region file
+ *  \param [in]   FileName     A pointer to a character string holding
+ *                             the file name
+ *  \param [in]   FileHeader   Pointer to the MM file header
+ *  \param [out]  MultiHeader  Pointer to the multi-region header read from the file
+ *
+ *  \return Boolean multi-region file verification result
+ *  \retval true  Every region can be loaded
+ *  \retval false The file or one of its regions is invalid
+ */
+bool MM_VerifyMultiFile(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader,
+                        MM_MultiFileHeader_t *MultiHeader);
+
+/**
+ * \brief Read the region table of a multi-region file
+ *
+ *  \par Description
+ *       Support function for #MM_VerifyMultiFile and the multi-region
+ *       dump. Reads the multi-region header and the region table into
+ *       the MM global data and checks the table CRC against the MM file
+ *       header.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The file must be positioned after the MM secondary header.
+ *
+ *  \param [in]   FileHandle   The open file handle of the multi-region file
+ *  \param [in]   FileName     A pointer to a character string holding
+ *                             the file name
+ *  \param [in]   FileHeader   Pointer to the MM file header
+ *  \param [out]  MultiHeader  Pointer to the multi-region header read from the file
+ *
+ *  \return Boolean region table read result
+ *  \retval true  The region table was read and is intact
+ *  \retval false The region table is too large, unreadable or corrupted
+ */
+bool MM_ReadMultiFileTable(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader,
+                           MM_MultiFileHeader_t *MultiHeader);
+
+/**
+ * \brief Verify a multi-region file region
+ *
+ *  \par Description
+ *       Support function for #MM_VerifyMultiFile. Checks the region is
+ *       #MM_ENCODING_RAW, resolves its symbolic address and checks its
+ *       address, memory type and size the same way as for a load file.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   FileName     A pointer to a character string holding
+ *                             the file name
+ *  \param [in]   Region       Pointer to the region table entry
+ *  \param [in]   RegionNum    Index of the region in the table
+ *  \param [out]  DestAddress  The resolved region address
+ *
+ *  \return Boolean region verification result
+ *  \retval true  Region is valid
+ *  \retval false Region is invalid
+ */
+bool MM_VerifyFileRegion(const char *FileName, MM_LoadDumpFileHeader_t *Region, uint32 RegionNum,
+                         cpuaddr *DestAddress);
+
+/**
+ * \brief Memory load from multi-region file
+ *
+ *  \par Description
+ *       Support function for #MM_LoadMemFromMultiFileCmd. Loads each
+ *       region with #MM_LoadFileRegion in table order.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The file must have been checked by #MM_VerifyMultiFile and
+ *       positioned at the data of the first region. The regions are
+ *       recorded as one load in the statistics telemetry, see
+ *       #MM_SegmentMultiStart.
+ *
+ *  \param [in]   FileHandle   The open file handle of the multi-region file
+ *  \param [in]   FileName     A pointer to a character string holding
+ *                             the file name
+ *  \param [in]   MultiHeader  Pointer to the multi-region header
+ *
+ *  \return Boolean execution status
+ *  \retval true  All regions loaded successfully
+ *  \retval false A region load failed, later regions are not loaded
+ */
+bool MM_LoadMemFromMultiFile(osal_id_t FileHandle, const char *FileName, const MM_MultiFileHeader_t *MultiHeader);
+
+/**
+ * \brief Memory load of one multi-region file region
+ *
+ *  \par Description
+ *       Support function for #MM_LoadMemFromMultiFile. Loads the region
+ *       data with the load file routine for the region memory type.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The file must be positioned at the region data.
+ *
+ *  \param [in]   FileHandle   The open file handle of the multi-region file
+ *  \param [in]   FileName     A pointer to a character string holding
+ *                             the file name
+ *  \param [in]   Region       Pointer to the region table entry
+ *  \param [in]   DestAddress  The resolved region address
+ *
+ *  \return Boolean execution status
+ *  \retval true  Region loaded successfully
+ *  \retval false Region load failed
+ */
+bool MM_LoadFileRegion(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *Region,
+                       cpuaddr DestAddress);
+
 /**
  * \brief Verify load file size
  *
@@ -173,6 +494,33 @@ bool MM_ReadFileHeaders(const char *FileName, osal_id_t FileHandle, CFE_FS_Heade
  */
 bool MM_FillMem(cpuaddr DestAddress, const MM_FillMemCmd_t *CmdPtr);
 
+/**
+ * \brief Copy memory
+ *
+ *  \par Description
+ *       Support function for #MM_CopyMemCmd. This routine copies memory
+ *       a segment at a time through the i/o buffer, reading the source
+ *       and writing the destination with the access width of their
+ *       memory types, and computes the CRC of the copied data.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Both ranges have been checked with #MM_VerifyLoadDumpParams.
+ *       When the destination starts inside the source range the copy
+ *       runs from the end of the range, and the CRC is then computed
+ *       from the destination once the copy is complete.
+ *
+ *  \param [in]   SrcAddress  The source address for the copy operation
+ *  \param [in]   DestAddress The destination address for the copy operation
+ *  \param [in]   CmdPtr      Pointer to command
+ *  \param [out]  CrcPtr      CRC of the copied data, set only when
+ *                            the copy is successful
+ *
+ *  \return Boolean execution status
+ *  \retval true  Copy successful
+ *  \retval false A memory read or write failed
+ */
+bool MM_CopyMem(cpuaddr SrcAddress, cpuaddr DestAddress, const MM_CopyMemCmd_t *CmdPtr, uint32 *CrcPtr);
+
 /**
  * \brief Process memory poke command
  *
@@ -223,6 +571,40 @@ bool MM_LoadMemWIDCmd(const CFE_SB_Buffer_t *BufPtr);
  */
 bool MM_LoadMemFromFileCmd(const CFE_SB_Buffer_t *BufPtr);
 
+/**
+ * \brief Process memory load from patch file command
+ *
+ *  \par Description
+ *       Processes the memory load from patch file command that will
+ *       check a patch file against the memory it replaces and then
+ *       write the patch records to memory.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   BufPtr   Pointer to Software Bus buffer
+ *
+ *  \sa #MM_LOAD_MEM_FROM_PATCH_FILE_CC
+ */
+bool MM_LoadMemFromPatchFileCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Process memory load from multi-region file command
+ *
+ *  \par Description
+ *       Processes the memory load from multi-region file command that
+ *       will check every region of a multi-region file and then load
+ *       each region to memory.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   BufPtr   Pointer to Software Bus buffer
+ *
+ *  \sa #MM_LOAD_MEM_FROM_MULTI_FILE_CC
+ */
+bool MM_LoadMemFromMultiFileCmd(const CFE_SB_Buffer_t *BufPtr);
+
 /**
  * \brief Process memory fill command
  *
@@ -239,4 +621,88 @@ bool MM_LoadMemFromFileCmd(const CFE_SB_Buffer_t *BufPtr);
  */
 bool MM_FillMemCmd(const CFE_SB_Buffer_t *BufPtr);
 
+/**
+ * \brief Process memory copy command
+ *
+ *  \par Description
+ *       Processes the memory copy command that will copy an address
+ *       range of memory to another address, checking the source range
+ *       like a dump and the destination range like a load
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]   BufPtr   Pointer to Software Bus buffer
+ *
+ *  \sa #MM_COPY_MEM_CC
+ */
+bool MM_CopyMemCmd(const CFE_SB_Buffer_t *BufPtr);
+
+/**
+ * \brief Restore the load file validation cache
+ *
+ *  \par Description
+ *       Registers the critical data store block that holds the load
+ *       file validation cache and restores the cache from it if the
+ *       block already exists.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called during application initialization. If the block can't
+ *       be registered or restored the cache starts empty, and without
+ *       a block it only lasts until the next reset.
+ */
+void MM_LoadCacheInit(void);
+
+/**
+ * \brief Look up a load file in the validation cache
+ *
+ *  \par Description
+ *       Support function for #MM_LoadMemFromFileCmd. Checks if the load
+ *       file was verified before and still has the same size,
+ *       modification time and MM file header. An entry for the file
+ *       that no longer matches is removed.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The cache key of the file is returned in CacheKey so that
+ *       #MM_LoadCacheUpdate can add the file once it has been verified.
+ *       Its InUse flag is false if the file can't be stat'ed.
+ *
+ *  \param [in]  FileName   Pointer to the load file name
+ *  \param [in]  FileHeader Pointer to the MM file header read from the file
+ *  \param [out] CacheKey   Cache entry describing the file as it is now
+ *
+ *  \return Boolean lookup status
+ *  \retval true  The file is unchanged since it was verified
+ *  \retval false The file must be verified
+ */
+bool MM_LoadCacheLookup(const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader, MM_LoadCacheEntry_t *CacheKey);
+
+/**
+ * \brief Add a verified load file to the validation cache
+ *
+ *  \par Description
+ *       Support function for #MM_LoadMemFromFileCmd. Stores the cache
+ *       key returned by #MM_LoadCacheLookup once the file has passed its
+ *       CRC check, replacing an older entry for the same file or else
+ *       the least recently added entry, and saves the cache to the CDS.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A key whose InUse flag is false is ignored.
+ *
+ *  \param [in] CacheKey Cache entry describing the verified file
+ */
+void MM_LoadCacheUpdate(const MM_LoadCacheEntry_t *CacheKey);
+
+/**
+ * \brief Save the load file validation cache
+ *
+ *  \par Description
+ *       Copies the load file validation cache to its critical data store
+ *       block, if it has one.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void MM_LoadCacheSave(void);
+
 #endif
@@ -70,18 +70,20 @@ bool MM_LoadMem16FromFile(osal_id_t FileHandle, const char *FileName, const MM_L
  *
  *  \par Assumptions, External Events, and Notes:
  *       This function is specific to the optional #MM_MEM16 memory
- *       type
+ *       type. The CRC of each segment is folded into FileHeader->Crc
+ *       as it is written, so the caller must initialize it to zero.
  *
  *  \param [in]   FileHandle   The open file handle of the dump file
  *  \param [in]   FileName     A pointer to a character string holding
  *                             the dump file name
- *  \param [in]   FileHeader   Pointer to file header
+ *  \param [in,out] FileHeader Pointer to file header, returned with the
+ *                             CRC of the dumped data
  *
  *  \return Boolean execution status
  *  \retval true  Dump successful
  *  \retval false Dump failed
  */
-bool MM_DumpMem16ToFile(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader);
+bool MM_DumpMem16ToFile(osal_id_t FileHandle, const char *FileName, MM_LoadDumpFileHeader_t *FileHeader);
 
 /**
  * \brief Fill memory16
@@ -101,4 +103,48 @@ bool MM_DumpMem16ToFile(osal_id_t FileHandle, const char *FileName, const MM_Loa
  */
 bool MM_FillMem16(cpuaddr DestAddress, const MM_FillMemCmd_t *CmdPtr);
 
+/**
+ * \brief Read memory16 block
+ *
+ *  \par Description
+ *       Support function for #MM_ReadMemBlock. This routine will
+ *       copy memory that is defined to only be 16 bit accessible
+ *       into a buffer
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       This function is specific to the optional #MM_MEM16 memory
+ *       type
+ *
+ *  \param [in]  SrcAddress  The source address of the read
+ *  \param [out] Buffer      The buffer receiving the memory contents
+ *  \param [in]  NumOfBytes  Number of bytes to read
+ *
+ *  \return Boolean execution status
+ *  \retval true  Read successful
+ *  \retval false A PSP memory read failed
+ */
+bool MM_ReadMem16(cpuaddr SrcAddress, void *Buffer, size_t NumOfBytes);
+
+/**
+ * \brief Write memory16 block
+ *
+ *  \par Description
+ *       Support function for #MM_WriteMemBlock. This routine will
+ *       copy a buffer into memory that is defined to only be 16 bit
+ *       accessible
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       This function is specific to the optional #MM_MEM16 memory
+ *       type
+ *
+ *  \param [in] DestAddress  The destination address of the write
+ *  \param [in] Buffer       The buffer holding the new memory contents
+ *  \param [in] NumOfBytes   Number of bytes to write
+ *
+ *  \return Boolean execution status
+ *  \retval true  Write successful
+ *  \retval false A PSP memory write failed
+ */
+bool MM_WriteMem16(cpuaddr DestAddress, const void *Buffer, size_t NumOfBytes);
+
 #endif
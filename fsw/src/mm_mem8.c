@@ -29,7 +29,10 @@
 #include "mm_mem8.h"
 #include "mm_app.h"
 #include "mm_events.h"
+#include "mm_perfids.h"
 #include "mm_utils.h"
+#include "mm_crc.h"
+#include "mm_mission_cfg.h"
 #include <string.h>
 
 /*
@@ -52,36 +55,54 @@ bool MM_LoadMem8FromFile(osal_id_t FileHandle, const char *FileName, const MM_Lo
                          cpuaddr DestAddress)
 {
     uint32       i;
-    int32        ReadLength;
+    int32        ReadLength     = 0;
     CFE_Status_t PSP_Status     = CFE_PSP_SUCCESS;
     size_t       BytesProcessed = 0;
     int32        BytesRemaining = FileHeader->NumOfBytes;
     uint8 *      DataPointer8   = (uint8 *)DestAddress;
-    uint8 *      ioBuffer8      = (uint8 *)&MM_AppData.LoadBuffer[0];
-    size_t       SegmentSize    = MM_MAX_LOAD_DATA_SEG;
+    uint8 *      ioBuffer8      = (uint8 *)&MM_AppData.IoBuffer[0];
+    size_t       BlockSize      = 0;
+    size_t       BlockOffset    = 0;
+    size_t       SegmentSize    = MM_SegmentStart(MM_SEG_LOAD);
     bool         Valid          = false;
 
     while (BytesRemaining != 0)
     {
-        if (BytesRemaining < MM_MAX_LOAD_DATA_SEG)
+        /* Read the next file block once the i/o buffer is used up */
+        if (BlockOffset == BlockSize)
         {
-            SegmentSize = BytesRemaining;
+            BlockOffset = 0;
+            BlockSize   = MM_IO_BUFFER_SIZE;
+            if (BytesRemaining < BlockSize)
+            {
+                BlockSize = BytesRemaining;
+            }
+
+            MM_SegmentIoStart();
+            ReadLength = OS_read(FileHandle, ioBuffer8, BlockSize);
+            MM_SegmentIoEnd();
+        }
+
+        /* A segment never crosses an i/o block boundary */
+        if ((BlockSize - BlockOffset) < SegmentSize)
+        {
+            SegmentSize = BlockSize - BlockOffset;
         }
 
-        /* Read file data into i/o buffer */
-        if ((ReadLength = OS_read(FileHandle, ioBuffer8, SegmentSize)) != SegmentSize)
+        if (ReadLength != BlockSize)
         {
             BytesRemaining = 0;
             CFE_EVS_SendEvent(MM_OS_READ_ERR_EID, CFE_EVS_EventType_ERROR,
                               "OS_read error received: RC = 0x%08X Expected = %u File = '%s'", (unsigned int)ReadLength,
-                              (unsigned int)SegmentSize, FileName);
+                              (unsigned int)BlockSize, FileName);
         }
         else
         {
             /* Load memory from i/o buffer using 8 bit wide writes */
+            CFE_ES_PerfLogEntry(MM_SEGCOPY_PERF_ID);
             for (i = 0; i < SegmentSize; i++)
             {
-                PSP_Status = CFE_PSP_MemWrite8((cpuaddr)DataPointer8, ioBuffer8[i]);
+                PSP_Status = CFE_PSP_MemWrite8((cpuaddr)DataPointer8, ioBuffer8[BlockOffset + i]);
                 if (PSP_Status == CFE_PSP_SUCCESS)
                 {
                     DataPointer8++;
@@ -97,16 +118,18 @@ bool MM_LoadMem8FromFile(osal_id_t FileHandle, const char *FileName, const MM_Lo
                     break;
                 }
             }
+            CFE_ES_PerfLogExit(MM_SEGCOPY_PERF_ID);
 
             if (PSP_Status == CFE_PSP_SUCCESS)
             {
+                BlockOffset += SegmentSize;
                 BytesProcessed += SegmentSize;
                 BytesRemaining -= SegmentSize;
 
                 /* Prevent CPU hogging between load segments */
                 if (BytesRemaining != 0)
                 {
-                    MM_SegmentBreak();
+                    SegmentSize = MM_SegmentBreak(SegmentSize);
                 }
             }
         }
@@ -121,6 +144,8 @@ bool MM_LoadMem8FromFile(osal_id_t FileHandle, const char *FileName, const MM_Lo
         MM_AppData.HkPacket.Payload.Address        = DestAddress;
         MM_AppData.HkPacket.Payload.BytesProcessed = BytesProcessed;
         strncpy(MM_AppData.HkPacket.Payload.FileName, FileName, OS_MAX_PATH_LEN);
+
+        MM_SegmentEnd(BytesProcessed);
     }
 
     return Valid;
@@ -132,7 +157,7 @@ bool MM_LoadMem8FromFile(osal_id_t FileHandle, const char *FileName, const MM_Lo
 /* only 8 bit wide reads                                           */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-bool MM_DumpMem8ToFile(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader)
+bool MM_DumpMem8ToFile(osal_id_t FileHandle, const char *FileName, MM_LoadDumpFileHeader_t *FileHeader)
 {
     bool         Valid = true;
     int32        OS_Status;
@@ -141,20 +166,28 @@ bool MM_DumpMem8ToFile(osal_id_t FileHandle, const char *FileName, const MM_Load
     size_t       BytesProcessed = 0;
     uint32       BytesRemaining = FileHeader->NumOfBytes;
     uint8 *      DataPointer8   = (uint8 *)(FileHeader->SymAddress.Offset);
-    uint8 *      ioBuffer8      = (uint8 *)&MM_AppData.DumpBuffer[0];
-    size_t       SegmentSize    = MM_MAX_DUMP_DATA_SEG;
+    uint8 *      ioBuffer8      = (uint8 *)&MM_AppData.IoBuffer[0];
+    size_t       BlockSize      = 0;
+    size_t       SegmentSize    = MM_SegmentStart(MM_SEG_DUMP);
 
     while (BytesRemaining != 0)
     {
-        if (BytesRemaining < MM_MAX_DUMP_DATA_SEG)
+        if (BytesRemaining < SegmentSize)
         {
             SegmentSize = BytesRemaining;
         }
 
+        /* A segment never crosses an i/o block boundary */
+        if ((MM_IO_BUFFER_SIZE - BlockSize) < SegmentSize)
+        {
+            SegmentSize = MM_IO_BUFFER_SIZE - BlockSize;
+        }
+
         /* Load RAM data into i/o buffer */
+        CFE_ES_PerfLogEntry(MM_SEGCOPY_PERF_ID);
         for (i = 0; i < SegmentSize; i++)
         {
-            if ((PSP_Status = CFE_PSP_MemRead8((cpuaddr)DataPointer8, &ioBuffer8[i])) == CFE_PSP_SUCCESS)
+            if ((PSP_Status = CFE_PSP_MemRead8((cpuaddr)DataPointer8, &ioBuffer8[BlockSize + i])) == CFE_PSP_SUCCESS)
             {
                 DataPointer8++;
             }
@@ -165,36 +198,51 @@ bool MM_DumpMem8ToFile(osal_id_t FileHandle, const char *FileName, const MM_Load
                 BytesRemaining = 0;
                 CFE_EVS_SendEvent(MM_PSP_READ_ERR_EID, CFE_EVS_EventType_ERROR,
                                   "PSP read memory error: RC=0x%08X, Src=%p, Tgt=%p, Type=MEM8",
-                                  (unsigned int)PSP_Status, (void *)DataPointer8, (void *)&ioBuffer8[i]);
+                                  (unsigned int)PSP_Status, (void *)DataPointer8, (void *)&ioBuffer8[BlockSize + i]);
                 /* Stop load i/o buffer loop */
                 break;
             }
         }
+        CFE_ES_PerfLogExit(MM_SEGCOPY_PERF_ID);
 
         /* Check for error loading i/o buffer */
         if (PSP_Status == CFE_PSP_SUCCESS)
         {
-            /* Write i/o buffer contents to file */
-            if ((OS_Status = OS_write(FileHandle, ioBuffer8, SegmentSize)) == SegmentSize)
+            BlockSize += SegmentSize;
+            BytesRemaining -= SegmentSize;
+
+            /* Write a file block once the i/o buffer is full or the dump is complete */
+            if ((BlockSize == MM_IO_BUFFER_SIZE) || (BytesRemaining == 0))
             {
-                /* Update process counters */
-                BytesRemaining -= SegmentSize;
-                BytesProcessed += SegmentSize;
+                MM_SegmentIoStart();
+                OS_Status = OS_write(FileHandle, ioBuffer8, BlockSize);
+                MM_SegmentIoEnd();
 
-                /* Prevent CPU hogging between dump segments */
-                if (BytesRemaining != 0)
+                if (OS_Status == BlockSize)
                 {
-                    MM_SegmentBreak();
+                    /* Accumulate the dump file CRC as each block is written */
+                    CFE_ES_PerfLogEntry(MM_FILE_CRC_PERF_ID);
+                    FileHeader->Crc = MM_CalculateCRC(ioBuffer8, BlockSize, FileHeader->Crc, MM_DUMP_FILE_CRC_TYPE);
+                    CFE_ES_PerfLogExit(MM_FILE_CRC_PERF_ID);
+
+                    BytesProcessed += BlockSize;
+                    BlockSize = 0;
+                }
+                else
+                {
+                    /* OS_write error */
+                    Valid          = false;
+                    BytesRemaining = 0;
+                    CFE_EVS_SendEvent(MM_OS_WRITE_EXP_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "OS_write error received: RC = 0x%08X Expected = %u File = '%s'",
+                                      (unsigned int)OS_Status, (unsigned int)BlockSize, FileName);
                 }
             }
-            else
+
+            /* Prevent CPU hogging between dump segments */
+            if (BytesRemaining != 0)
             {
-                /* OS_write error */
-                Valid          = false;
-                BytesRemaining = 0;
-                CFE_EVS_SendEvent(MM_OS_WRITE_EXP_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "OS_write error received: RC = 0x%08X Expected = %u File = '%s'",
-                                  (unsigned int)OS_Status, (unsigned int)SegmentSize, FileName);
+                SegmentSize = MM_SegmentBreak(SegmentSize);
             }
         }
     }
@@ -207,6 +255,8 @@ bool MM_DumpMem8ToFile(osal_id_t FileHandle, const char *FileName, const MM_Load
         MM_AppData.HkPacket.Payload.Address    = FileHeader->SymAddress.Offset;
         strncpy(MM_AppData.HkPacket.Payload.FileName, FileName, OS_MAX_PATH_LEN);
         MM_AppData.HkPacket.Payload.BytesProcessed = BytesProcessed;
+
+        MM_SegmentEnd(BytesProcessed);
     }
 
     return Valid;
@@ -226,18 +276,19 @@ bool MM_FillMem8(cpuaddr DestAddress, const MM_FillMemCmd_t *CmdPtr)
     uint32       BytesRemaining = CmdPtr->Payload.NumOfBytes;
     uint8        FillPattern8   = (uint8)CmdPtr->Payload.FillPattern;
     uint8 *      DataPointer8   = (uint8 *)DestAddress;
-    size_t       SegmentSize    = MM_MAX_FILL_DATA_SEG;
+    size_t       SegmentSize    = MM_SegmentStart(MM_SEG_FILL);
     bool         Result         = true;
 
     while (BytesRemaining != 0)
     {
         /* Set size of next segment */
-        if (BytesRemaining < MM_MAX_FILL_DATA_SEG)
+        if (BytesRemaining < SegmentSize)
         {
             SegmentSize = BytesRemaining;
         }
 
         /* Fill next segment */
+        CFE_ES_PerfLogEntry(MM_SEGCOPY_PERF_ID);
         for (i = 0; i < SegmentSize; i++)
         {
             PSP_Status = CFE_PSP_MemWrite8((cpuaddr)DataPointer8, FillPattern8);
@@ -257,6 +308,7 @@ bool MM_FillMem8(cpuaddr DestAddress, const MM_FillMemCmd_t *CmdPtr)
                 break;
             }
         }
+        CFE_ES_PerfLogExit(MM_SEGCOPY_PERF_ID);
 
         if (PSP_Status == CFE_PSP_SUCCESS)
         {
@@ -267,7 +319,7 @@ bool MM_FillMem8(cpuaddr DestAddress, const MM_FillMemCmd_t *CmdPtr)
             /* Prevent CPU hogging between fill segments */
             if (BytesRemaining != 0)
             {
-                MM_SegmentBreak();
+                SegmentSize = MM_SegmentBreak(SegmentSize);
             }
         }
     }
@@ -280,9 +332,71 @@ bool MM_FillMem8(cpuaddr DestAddress, const MM_FillMemCmd_t *CmdPtr)
         MM_AppData.HkPacket.Payload.Address        = DestAddress;
         MM_AppData.HkPacket.Payload.DataValue      = (uint32)FillPattern8;
         MM_AppData.HkPacket.Payload.BytesProcessed = BytesProcessed;
+
+        MM_SegmentEnd(BytesProcessed);
     }
 
     return Result;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Read a block of memory into a buffer using only 8 bit wide      */
+/* reads                                                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_ReadMem8(cpuaddr SrcAddress, void *Buffer, size_t NumOfBytes)
+{
+    size_t       i;
+    CFE_Status_t PSP_Status   = CFE_PSP_SUCCESS;
+    uint8 *      DataPointer8 = (uint8 *)SrcAddress;
+    uint8 *      Buffer8      = Buffer;
+    bool         Valid        = true;
+
+    for (i = 0; i < NumOfBytes; i++)
+    {
+        PSP_Status = CFE_PSP_MemRead8((cpuaddr)&DataPointer8[i], &Buffer8[i]);
+        if (PSP_Status != CFE_PSP_SUCCESS)
+        {
+            Valid = false;
+            CFE_EVS_SendEvent(MM_PSP_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "PSP read memory error: RC=0x%08X, Src=%p, Tgt=%p, Type=MEM8", (unsigned int)PSP_Status,
+                              (void *)&DataPointer8[i], (void *)&Buffer8[i]);
+            break;
+        }
+    }
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write a buffer to a block of memory using only 8 bit wide       */
+/* writes                                                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_WriteMem8(cpuaddr DestAddress, const void *Buffer, size_t NumOfBytes)
+{
+    size_t        i;
+    CFE_Status_t  PSP_Status   = CFE_PSP_SUCCESS;
+    uint8 *       DataPointer8 = (uint8 *)DestAddress;
+    const uint8 * Buffer8      = Buffer;
+    bool          Valid        = true;
+
+    for (i = 0; i < NumOfBytes; i++)
+    {
+        PSP_Status = CFE_PSP_MemWrite8((cpuaddr)&DataPointer8[i], Buffer8[i]);
+        if (PSP_Status != CFE_PSP_SUCCESS)
+        {
+            Valid = false;
+            CFE_EVS_SendEvent(MM_PSP_WRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "PSP write memory error: RC=0x%08X, Address=%p, MemType=MEM8", (unsigned int)PSP_Status,
+                              (void *)&DataPointer8[i]);
+            break;
+        }
+    }
+
+    return Valid;
+}
+
 #endif /* MM_OPT_CODE_MEM8_MEMTYPE */
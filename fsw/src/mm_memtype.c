@@ -0,0 +1,270 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   The CFS Memory Manager (MM) memory type driver table, which holds
+ *   the access routines and limits of each memory type.
+ */
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+#include "mm_memtype.h"
+#include "mm_app.h"
+#include "mm_events.h"
+#include "mm_load.h"
+#include "mm_dump.h"
+#include "mm_mem32.h"
+#include "mm_mem16.h"
+#include "mm_mem8.h"
+#include "mm_platform_cfg.h"
+#include <string.h>
+
+/*************************************************************************
+ * Built-in Memory Type Drivers
+ *************************************************************************/
+
+static const MM_MemTypeDriver_t MM_RamDriver = {.Name         = "MEM_RAM",
+                                                .PSP_MemType  = CFE_PSP_MEM_RAM,
+                                                .AccessWidth  = 0,
+                                                .Limits       = &MM_AppData.Config.Ram,
+                                                .LoadFromFile = MM_LoadMemFromFile,
+                                                .DumpToFile   = MM_DumpMemToFile,
+                                                .Fill         = MM_FillMem,
+                                                .Read         = MM_ReadMemRam,
+                                                .Write        = MM_WriteMemRam};
+
+static const MM_MemTypeDriver_t MM_EepromDriver = {.Name         = "MEM_EEPROM",
+                                                   .PSP_MemType  = CFE_PSP_MEM_EEPROM,
+                                                   .AccessWidth  = 0,
+                                                   .Limits       = &MM_AppData.Config.Eeprom,
+                                                   .LoadFromFile = MM_LoadMemFromFile,
+                                                   .DumpToFile   = MM_DumpMemToFile,
+                                                   .Fill         = MM_FillMem,
+                                                   .Read         = MM_ReadMemRam,
+                                                   .Write        = MM_WriteMemRam};
+
+#ifdef MM_OPT_CODE_MEM32_MEMTYPE
+static const MM_MemTypeDriver_t MM_Mem32Driver = {.Name         = "MEM32",
+                                                  .PSP_MemType  = CFE_PSP_MEM_RAM,
+                                                  .AccessWidth  = 4,
+                                                  .Limits       = &MM_AppData.Config.Mem32,
+                                                  .LoadFromFile = MM_LoadMem32FromFile,
+                                                  .DumpToFile   = MM_DumpMem32ToFile,
+                                                  .Fill         = MM_FillMem32,
+                                                  .Read         = MM_ReadMem32,
+                                                  .Write        = MM_WriteMem32};
+#endif /* MM_OPT_CODE_MEM32_MEMTYPE */
+
+#ifdef MM_OPT_CODE_MEM16_MEMTYPE
+static const MM_MemTypeDriver_t MM_Mem16Driver = {.Name         = "MEM16",
+                                                  .PSP_MemType  = CFE_PSP_MEM_RAM,
+                                                  .AccessWidth  = 2,
+                                                  .Limits       = &MM_AppData.Config.Mem16,
+                                                  .LoadFromFile = MM_LoadMem16FromFile,
+                                                  .DumpToFile   = MM_DumpMem16ToFile,
+                                                  .Fill         = MM_FillMem16,
+                                                  .Read         = MM_ReadMem16,
+                                                  .Write        = MM_WriteMem16};
+#endif /* MM_OPT_CODE_MEM16_MEMTYPE */
+
+#ifdef MM_OPT_CODE_MEM8_MEMTYPE
+static const MM_MemTypeDriver_t MM_Mem8Driver = {.Name         = "MEM8",
+                                                 .PSP_MemType  = CFE_PSP_MEM_RAM,
+                                                 .AccessWidth  = 1,
+                                                 .Limits       = &MM_AppData.Config.Mem8,
+                                                 .LoadFromFile = MM_LoadMem8FromFile,
+                                                 .DumpToFile   = MM_DumpMem8ToFile,
+                                                 .Fill         = MM_FillMem8,
+                                                 .Read         = MM_ReadMem8,
+                                                 .Write        = MM_WriteMem8};
+#endif /* MM_OPT_CODE_MEM8_MEMTYPE */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Initialize the memory type driver table                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_MemTypeInit(void)
+{
+    memset(MM_AppData.MemTypeDrivers, 0, sizeof(MM_AppData.MemTypeDrivers));
+
+    MM_AppData.MemTypeDrivers[MM_RAM]    = &MM_RamDriver;
+    MM_AppData.MemTypeDrivers[MM_EEPROM] = &MM_EepromDriver;
+
+#ifdef MM_OPT_CODE_MEM32_MEMTYPE
+    MM_AppData.MemTypeDrivers[MM_MEM32] = &MM_Mem32Driver;
+#endif
+
+#ifdef MM_OPT_CODE_MEM16_MEMTYPE
+    MM_AppData.MemTypeDrivers[MM_MEM16] = &MM_Mem16Driver;
+#endif
+
+#ifdef MM_OPT_CODE_MEM8_MEMTYPE
+    MM_AppData.MemTypeDrivers[MM_MEM8] = &MM_Mem8Driver;
+#endif
+
+#ifdef MM_MISSION_MEM_TYPE_INIT
+    MM_MISSION_MEM_TYPE_INIT();
+#endif
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Register a mission memory type                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_MemTypeRegister(MM_MemType_t MemType, const MM_MemTypeDriver_t *Driver)
+{
+    bool Valid = false;
+
+    /* Built-in memory type numbers stay reserved even when not compiled in */
+    if ((MemType > MM_MEM32) && (MemType < MM_MAX_MEM_TYPES) && (MM_AppData.MemTypeDrivers[MemType] == NULL) &&
+        (Driver != NULL))
+    {
+        Valid = (Driver->Name != NULL) && (Driver->Limits != NULL) && (Driver->LoadFromFile != NULL) &&
+                (Driver->DumpToFile != NULL) && (Driver->Fill != NULL) && (Driver->Read != NULL) &&
+                (Driver->Write != NULL) &&
+                ((Driver->AccessWidth == 0) || (Driver->AccessWidth == 1) || (Driver->AccessWidth == 2) ||
+                 (Driver->AccessWidth == 4));
+    }
+
+    if (Valid)
+    {
+        MM_AppData.MemTypeDrivers[MemType] = Driver;
+    }
+    else
+    {
+        CFE_EVS_SendEvent(MM_MEMTYPE_REG_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Memory type registration rejected: MemType = %d", MemType);
+    }
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get a memory type driver                                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+const MM_MemTypeDriver_t *MM_MemTypeGet(MM_MemType_t MemType)
+{
+    const MM_MemTypeDriver_t *Driver = NULL;
+
+    /* Cast catches memory type numbers that are negative as an int */
+    if ((uint32)MemType < MM_MAX_MEM_TYPES)
+    {
+        Driver = MM_AppData.MemTypeDrivers[MemType];
+    }
+
+    return Driver;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Read a block of RAM or EEPROM                                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_ReadMemRam(cpuaddr SrcAddress, void *Buffer, size_t NumOfBytes)
+{
+    CFE_Status_t PSP_Status = CFE_PSP_SUCCESS;
+    uint8        ByteValue  = 0;
+    uint16       WordValue  = 0;
+    uint32       DWordValue = 0;
+
+    /*
+    ** A single aligned item, such as the data of a peek, is read with one
+    ** access of its own width so device registers see the width asked for
+    */
+    if ((NumOfBytes == sizeof(uint32)) && ((SrcAddress % sizeof(uint32)) == 0))
+    {
+        PSP_Status = CFE_PSP_MemRead32(SrcAddress, &DWordValue);
+        memcpy(Buffer, &DWordValue, sizeof(DWordValue));
+    }
+    else if ((NumOfBytes == sizeof(uint16)) && ((SrcAddress % sizeof(uint16)) == 0))
+    {
+        PSP_Status = CFE_PSP_MemRead16(SrcAddress, &WordValue);
+        memcpy(Buffer, &WordValue, sizeof(WordValue));
+    }
+    else if (NumOfBytes == sizeof(uint8))
+    {
+        PSP_Status = CFE_PSP_MemRead8(SrcAddress, &ByteValue);
+        memcpy(Buffer, &ByteValue, sizeof(ByteValue));
+    }
+    else
+    {
+        memcpy(Buffer, (void *)SrcAddress, NumOfBytes);
+    }
+
+    if (PSP_Status != CFE_PSP_SUCCESS)
+    {
+        CFE_EVS_SendEvent(MM_PSP_READ_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "PSP read memory error: RC=0x%08X, Src=%p, Size=%u", (unsigned int)PSP_Status,
+                          (void *)SrcAddress, (unsigned int)NumOfBytes);
+    }
+
+    return (PSP_Status == CFE_PSP_SUCCESS);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write a block of RAM or EEPROM                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_WriteMemRam(cpuaddr DestAddress, const void *Buffer, size_t NumOfBytes)
+{
+    CFE_Status_t PSP_Status = CFE_PSP_SUCCESS;
+    uint8        ByteValue;
+    uint16       WordValue;
+    uint32       DWordValue;
+
+    /*
+    ** A single aligned item, such as the data of a poke, is written with
+    ** one access of its own width so device registers see the width asked for
+    */
+    if ((NumOfBytes == sizeof(uint32)) && ((DestAddress % sizeof(uint32)) == 0))
+    {
+        memcpy(&DWordValue, Buffer, sizeof(DWordValue));
+        PSP_Status = CFE_PSP_MemWrite32(DestAddress, DWordValue);
+    }
+    else if ((NumOfBytes == sizeof(uint16)) && ((DestAddress % sizeof(uint16)) == 0))
+    {
+        memcpy(&WordValue, Buffer, sizeof(WordValue));
+        PSP_Status = CFE_PSP_MemWrite16(DestAddress, WordValue);
+    }
+    else if (NumOfBytes == sizeof(uint8))
+    {
+        memcpy(&ByteValue, Buffer, sizeof(ByteValue));
+        PSP_Status = CFE_PSP_MemWrite8(DestAddress, ByteValue);
+    }
+    else
+    {
+        memcpy((void *)DestAddress, Buffer, NumOfBytes);
+    }
+
+    if (PSP_Status != CFE_PSP_SUCCESS)
+    {
+        CFE_EVS_SendEvent(MM_PSP_WRITE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "PSP write memory error: RC=0x%08X, Tgt=%p, Size=%u", (unsigned int)PSP_Status,
+                          (void *)DestAddress, (unsigned int)NumOfBytes);
+    }
+
+    return (PSP_Status == CFE_PSP_SUCCESS);
+}
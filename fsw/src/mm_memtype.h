@@ -0,0 +1,170 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Memory Manager memory type driver table,
+ *   which holds the access routines and limits of each memory type.
+ */
+#ifndef MM_MEMTYPE_H
+#define MM_MEMTYPE_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+#include "mm_filedefs.h"
+#include "mm_tbldefs.h"
+
+/*************************************************************************
+ * Type Definitions
+ *************************************************************************/
+
+/**
+ *  \brief Memory type driver
+ *
+ *  Everything MM needs to verify and access one memory type. The
+ *  routines of a driver are called once per command and loop over the
+ *  whole address range themselves, with the segment breaks of the
+ *  built-in routines. They send their own error events on failure.
+ */
+typedef struct
+{
+    const char *Name;        /**< \brief Memory type name used in event messages */
+    uint32      PSP_MemType; /**< \brief CFE_PSP_MEM_RAM or CFE_PSP_MEM_EEPROM, for address validation */
+    uint8       AccessWidth; /**< \brief Required access width in bytes, or 0 if any width is allowed */
+
+    const MM_MemTypeLimits_t *Limits; /**< \brief Load, dump and fill size limits */
+
+    /** \brief Load a raw file, see #MM_LoadMemFromFile */
+    bool (*LoadFromFile)(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader,
+                         cpuaddr DestAddress);
+
+    /** \brief Dump to a raw file, see #MM_DumpMemToFile */
+    bool (*DumpToFile)(osal_id_t FileHandle, const char *FileName, MM_LoadDumpFileHeader_t *FileHeader);
+
+    /** \brief Fill with a pattern, see #MM_FillMem */
+    bool (*Fill)(cpuaddr DestAddress, const MM_FillMemCmd_t *CmdPtr);
+
+    /** \brief Read a block into a buffer, also used for peeks, see #MM_ReadMemRam */
+    bool (*Read)(cpuaddr SrcAddress, void *Buffer, size_t NumOfBytes);
+
+    /** \brief Write a buffer to a block, also used for pokes, see #MM_WriteMemRam */
+    bool (*Write)(cpuaddr DestAddress, const void *Buffer, size_t NumOfBytes);
+} MM_MemTypeDriver_t;
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Initialize the memory type driver table
+ *
+ *  \par Description
+ *       Registers the drivers of the RAM and EEPROM memory types and of
+ *       the optional memory types that are compiled in, then calls the
+ *       MM_MISSION_MEM_TYPE_INIT hook if the platform defines one.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called once from MM_AppInit before any command is processed.
+ */
+void MM_MemTypeInit(void);
+
+/**
+ * \brief Register a mission memory type
+ *
+ *  \par Description
+ *       Adds the driver of a mission specific memory type, such as a
+ *       bank of FPGA registers, to the driver table. Commands with that
+ *       memory type are then verified and carried out like those of the
+ *       built-in memory types.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Intended to be called from the MM_MISSION_MEM_TYPE_INIT hook.
+ *       The driver isn't copied, so it must stay valid for the life of
+ *       the application.
+ *
+ *  \param [in] MemType   The memory type number, greater than #MM_MEM32
+ *                        and less than #MM_MAX_MEM_TYPES
+ *  \param [in] Driver    Pointer to the driver of the memory type
+ *
+ *  \return Boolean execution status
+ *  \retval true  Memory type registered
+ *  \retval false Memory type number in use or invalid, or driver incomplete
+ */
+bool MM_MemTypeRegister(MM_MemType_t MemType, const MM_MemTypeDriver_t *Driver);
+
+/**
+ * \brief Get a memory type driver
+ *
+ *  \par Description
+ *       Looks up the driver of a memory type.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] MemType   The memory type number
+ *
+ *  \return Pointer to the driver, or NULL if the memory type is invalid
+ *          or not compiled in
+ */
+const MM_MemTypeDriver_t *MM_MemTypeGet(MM_MemType_t MemType);
+
+/**
+ * \brief Read RAM or EEPROM block
+ *
+ *  \par Description
+ *       Read routine of the RAM and EEPROM drivers. Copies memory into
+ *       a buffer with no restriction on the access width.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A single aligned 8, 16 or 32 bit item, such as the data of a
+ *       peek, is read with one PSP access of that width.
+ *
+ *  \param [in]  SrcAddress  The source address of the read
+ *  \param [out] Buffer      The buffer receiving the memory contents
+ *  \param [in]  NumOfBytes  Number of bytes to read
+ *
+ *  \return Boolean execution status
+ *  \retval true  Read successful
+ *  \retval false PSP read failed
+ */
+bool MM_ReadMemRam(cpuaddr SrcAddress, void *Buffer, size_t NumOfBytes);
+
+/**
+ * \brief Write RAM or EEPROM block
+ *
+ *  \par Description
+ *       Write routine of the RAM and EEPROM drivers. Copies a buffer
+ *       into memory with no restriction on the access width.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       A single aligned 8, 16 or 32 bit item, such as the data of a
+ *       poke, is written with one PSP access of that width.
+ *
+ *  \param [in] DestAddress  The destination address of the write
+ *  \param [in] Buffer       The buffer holding the new memory contents
+ *  \param [in] NumOfBytes   Number of bytes to write
+ *
+ *  \return Boolean execution status
+ *  \retval true  Write successful
+ *  \retval false PSP write failed
+ */
+bool MM_WriteMemRam(cpuaddr DestAddress, const void *Buffer, size_t NumOfBytes);
+
+#endif
@@ -0,0 +1,249 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   The CFS Memory Manager reverse symbol index.
+ */
+
+/*************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_symidx.h"
+#include "mm_app.h"
+#include "mm_events.h"
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Empty the reverse symbol index                                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_SymIndexReset(void)
+{
+    MM_AppData.SymIndexCount                    = 0;
+    MM_AppData.SymIndexNamesUsed                = 0;
+    MM_AppData.HkPacket.Payload.SymIndexEntries = 0;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Build the reverse symbol index from a symbol table dump file    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_SymIndexBuild(const char *FileName)
+{
+    osal_id_t         FileHandle = OS_OBJECT_ID_UNDEFINED;
+    int32             OS_Status  = OS_ERROR;
+    int32             ReadLength = 0;
+    size_t            NameLength = 0;
+    bool              Full       = false;
+    bool              Valid      = false;
+    OS_SymbolRecord_t Record;
+
+    MM_SymIndexReset();
+
+    OS_Status = OS_OpenCreate(&FileHandle, FileName, OS_FILE_FLAG_NONE, OS_READ_ONLY);
+    if (OS_Status == OS_SUCCESS)
+    {
+        do
+        {
+            ReadLength = OS_read(FileHandle, &Record, sizeof(Record));
+            if (ReadLength == (int32)sizeof(Record))
+            {
+                NameLength = OS_strnlen(Record.SymbolName, sizeof(Record.SymbolName));
+
+                /* Records with an empty name are skipped */
+                if (NameLength > 0)
+                {
+                    if ((MM_AppData.SymIndexCount == MM_SYM_INDEX_ENTRIES) ||
+                        ((MM_SYM_INDEX_NAME_POOL_SIZE - MM_AppData.SymIndexNamesUsed) <= NameLength))
+                    {
+                        Full = true;
+                    }
+                    else
+                    {
+                        /* The name may fill the record, so it is terminated here */
+                        memcpy(&MM_AppData.SymIndexNames[MM_AppData.SymIndexNamesUsed], Record.SymbolName,
+                               NameLength);
+                        MM_AppData.SymIndexNames[MM_AppData.SymIndexNamesUsed + NameLength] = '\0';
+
+                        MM_AppData.SymIndex[MM_AppData.SymIndexCount].Address    = Record.SymbolAddress;
+                        MM_AppData.SymIndex[MM_AppData.SymIndexCount].NameOffset = MM_AppData.SymIndexNamesUsed;
+
+                        MM_AppData.SymIndexNamesUsed += NameLength + 1;
+                        MM_AppData.SymIndexCount++;
+                    }
+                }
+            }
+        } while ((ReadLength == (int32)sizeof(Record)) && !Full);
+
+        OS_close(FileHandle);
+
+        if ((ReadLength == 0) || Full)
+        {
+            MM_SymIndexSort();
+            MM_AppData.HkPacket.Payload.SymIndexEntries = MM_AppData.SymIndexCount;
+            Valid                                       = true;
+
+            if (Full)
+            {
+                CFE_EVS_SendEvent(MM_SYM_INDEX_FULL_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "Reverse symbol index full: Symbols = %u Name pool bytes = %u File = '%s'",
+                                  (unsigned int)MM_AppData.SymIndexCount,
+                                  (unsigned int)MM_AppData.SymIndexNamesUsed, FileName);
+            }
+            else
+            {
+                CFE_EVS_SendEvent(MM_SYM_INDEX_INF_EID, CFE_EVS_EventType_INFORMATION,
+                                  "Reverse symbol index built: Symbols = %u File = '%s'",
+                                  (unsigned int)MM_AppData.SymIndexCount, FileName);
+            }
+        }
+        else
+        {
+            MM_SymIndexReset();
+
+            CFE_EVS_SendEvent(MM_SYM_INDEX_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Reverse symbol index read error: RC = %d File = '%s'", (int)ReadLength, FileName);
+        }
+    }
+    else
+    {
+        CFE_EVS_SendEvent(MM_SYM_INDEX_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Reverse symbol index open error: RC = %d File = '%s'", (int)OS_Status, FileName);
+    }
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Heap sort the reverse symbol index by address                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_SymIndexSort(void)
+{
+    MM_SymIndexEntry_t *Index = MM_AppData.SymIndex;
+    MM_SymIndexEntry_t  Temp;
+    uint32              Count;
+    uint32              Start;
+    uint32              Root;
+    uint32              Child;
+
+    /*
+    ** Build a max heap, then repeatedly move the highest address left
+    ** in the heap to the end of the unsorted part and repair the heap
+    */
+    Start = MM_AppData.SymIndexCount / 2;
+    Count = MM_AppData.SymIndexCount;
+
+    while (Count > 1)
+    {
+        if (Start > 0)
+        {
+            Start--;
+        }
+        else
+        {
+            Count--;
+            Temp         = Index[0];
+            Index[0]     = Index[Count];
+            Index[Count] = Temp;
+        }
+
+        Root  = Start;
+        Child = (2 * Root) + 1;
+        while (Child < Count)
+        {
+            if (((Child + 1) < Count) && (Index[Child + 1].Address > Index[Child].Address))
+            {
+                Child++;
+            }
+
+            if (Index[Root].Address >= Index[Child].Address)
+            {
+                break;
+            }
+
+            Temp         = Index[Root];
+            Index[Root]  = Index[Child];
+            Index[Child] = Temp;
+
+            Root  = Child;
+            Child = (2 * Root) + 1;
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Find the symbol containing an address                           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_SymIndexLookup(cpuaddr Address, const char **SymName, cpuaddr *Offset)
+{
+    uint32 Low   = 0;
+    uint32 High  = MM_AppData.SymIndexCount;
+    uint32 Mid   = 0;
+    bool   Found = false;
+
+    /* Find the first entry above the address, the entry before it is the candidate */
+    while (Low < High)
+    {
+        Mid = Low + ((High - Low) / 2);
+        if (MM_AppData.SymIndex[Mid].Address <= Address)
+        {
+            Low = Mid + 1;
+        }
+        else
+        {
+            High = Mid;
+        }
+    }
+
+    if ((Low > 0) && ((Address - MM_AppData.SymIndex[Low - 1].Address) <= MM_SYM_INDEX_MAX_OFFSET))
+    {
+        *SymName = &MM_AppData.SymIndexNames[MM_AppData.SymIndex[Low - 1].NameOffset];
+        *Offset  = Address - MM_AppData.SymIndex[Low - 1].Address;
+        Found    = true;
+    }
+
+    return Found;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Format an address as symbol plus offset                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_SymIndexFormat(cpuaddr Address, char *Buffer, size_t BufferSize)
+{
+    const char *SymName = NULL;
+    cpuaddr     Offset  = 0;
+    bool        Found   = false;
+
+    Found = MM_SymIndexLookup(Address, &SymName, &Offset);
+    if (Found)
+    {
+        snprintf(Buffer, BufferSize, "%s+0x%lX", SymName, (unsigned long)Offset);
+    }
+
+    return Found;
+}
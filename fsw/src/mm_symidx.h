@@ -0,0 +1,147 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Memory Manager reverse symbol index.
+ *
+ *   Each time #MM_SYMTBL_TO_FILE_CC dumps the symbol table, MM reads the
+ *   dump file back into an index of symbol addresses sorted in ascending
+ *   order, with the symbol names kept in a separate name pool. An
+ *   address is resolved to the nearest symbol at or below it with a
+ *   binary search, for #MM_LOOKUP_ADDR_CC and to annotate peek and dump
+ *   in event messages.
+ *
+ *   The index is only built and searched by the main task, so it needs
+ *   no lock.
+ */
+#ifndef MM_SYMIDX_H
+#define MM_SYMIDX_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+#include "cfe.h"
+
+/************************************************************************
+ * Macro Definitions
+ ************************************************************************/
+
+/**
+ * \brief Symbolic address string size
+ *
+ * Size of a buffer that holds any string built by #MM_SymIndexFormat, a
+ * symbol name, "+0x", up to 16 hex digits and a NUL terminator.
+ */
+#define MM_SYM_INDEX_STRING_LEN (OS_MAX_SYM_LEN + 20)
+
+/************************************************************************
+ * Exported Functions
+ ************************************************************************/
+
+/**
+ * \brief Empty the reverse symbol index
+ *
+ *  \par Description
+ *       Removes every symbol from the reverse symbol index.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void MM_SymIndexReset(void);
+
+/**
+ * \brief Build the reverse symbol index
+ *
+ *  \par Description
+ *       Replaces the reverse symbol index with the symbols in a symbol
+ *       table dump file, then sorts it by address. Records with an empty
+ *       name are skipped. Once the index or its name pool is full the
+ *       rest of the file is ignored.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       If the file can't be opened or read the index is left empty.
+ *
+ *  \param [in] FileName Symbol table dump file written by #OS_SymbolTableDump
+ *
+ *  \return Boolean index status
+ *  \retval true  The index was built from the file
+ *  \retval false The file can't be opened or read
+ *
+ *  \sa #MM_SYMTBL_TO_FILE_CC
+ */
+bool MM_SymIndexBuild(const char *FileName);
+
+/**
+ * \brief Sort the reverse symbol index
+ *
+ *  \par Description
+ *       Heap sorts the reverse symbol index entries by ascending
+ *       address, in place.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void MM_SymIndexSort(void);
+
+/**
+ * \brief Look up an address in the reverse symbol index
+ *
+ *  \par Description
+ *       Finds the indexed symbol with the highest address at or below
+ *       the given address. When several symbols share that address any
+ *       one of them is returned.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The returned name points into the name pool and is only valid
+ *       until the index is next rebuilt.
+ *
+ *  \param [in]  Address Address to look up
+ *  \param [out] SymName Name of the symbol containing the address
+ *  \param [out] Offset  Offset of the address from the symbol
+ *
+ *  \return Boolean lookup status
+ *  \retval true  The address was resolved
+ *  \retval false The index is empty, or no indexed symbol is within
+ *                #MM_SYM_INDEX_MAX_OFFSET bytes below the address
+ */
+bool MM_SymIndexLookup(cpuaddr Address, const char **SymName, cpuaddr *Offset);
+
+/**
+ * \brief Format an address as symbol plus offset
+ *
+ *  \par Description
+ *       Looks up an address with #MM_SymIndexLookup and writes it to a
+ *       string as the symbol name followed by "+0x" and the offset in
+ *       hex.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The string is left unchanged if the address can't be resolved.
+ *
+ *  \param [in]  Address    Address to look up
+ *  \param [out] Buffer     String to write, at least #MM_SYM_INDEX_STRING_LEN bytes
+ *  \param [in]  BufferSize Size of the string buffer in bytes
+ *
+ *  \return Boolean lookup status
+ *  \retval true  The address was resolved and written to the string
+ *  \retval false The address can't be resolved
+ */
+bool MM_SymIndexFormat(cpuaddr Address, char *Buffer, size_t BufferSize);
+
+#endif
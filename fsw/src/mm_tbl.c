@@ -0,0 +1,266 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Functions used to manage the CFS Memory Manager configuration table
+ */
+
+/*************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_tbl.h"
+#include "mm_app.h"
+#include "mm_events.h"
+#include "mm_child.h"
+#include "mm_platform_cfg.h"
+#include <string.h>
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Register and load the configuration table                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+CFE_Status_t MM_TableInit(void)
+{
+    CFE_Status_t Status;
+
+    /* Run with the compile time values until a table is loaded */
+    MM_TableSetDefaults(&MM_AppData.Config);
+
+    Status = CFE_TBL_Register(&MM_AppData.ConfigTblHandle, MM_CONFIG_TBL_NAME, sizeof(MM_ConfigTbl_t),
+                              CFE_TBL_OPT_DEFAULT, MM_TableValidate);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(MM_CONFIG_TBL_REG_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error Registering Config Table, RC = 0x%08X", (unsigned int)Status);
+        return Status;
+    }
+
+    Status = CFE_TBL_Load(MM_AppData.ConfigTblHandle, CFE_TBL_SRC_FILE, MM_CONFIG_TBL_FILENAME);
+    if (Status != CFE_SUCCESS)
+    {
+        CFE_EVS_SendEvent(MM_CONFIG_TBL_LOAD_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Error Loading Config Table '%s', using defaults, RC = 0x%08X", MM_CONFIG_TBL_FILENAME,
+                          (unsigned int)Status);
+    }
+    else
+    {
+        MM_TableManage();
+    }
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Fill a configuration table with the compile time values         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_TableSetDefaults(MM_ConfigTbl_t *TblPtr)
+{
+    TblPtr->Ram.MaxLoadFileData    = MM_MAX_LOAD_FILE_DATA_RAM;
+    TblPtr->Ram.MaxDumpFileData    = MM_MAX_DUMP_FILE_DATA_RAM;
+    TblPtr->Ram.MaxFillData        = MM_MAX_FILL_DATA_RAM;
+    TblPtr->Eeprom.MaxLoadFileData = MM_MAX_LOAD_FILE_DATA_EEPROM;
+    TblPtr->Eeprom.MaxDumpFileData = MM_MAX_DUMP_FILE_DATA_EEPROM;
+    TblPtr->Eeprom.MaxFillData     = MM_MAX_FILL_DATA_EEPROM;
+    TblPtr->Mem32.MaxLoadFileData  = MM_MAX_LOAD_FILE_DATA_MEM32;
+    TblPtr->Mem32.MaxDumpFileData  = MM_MAX_DUMP_FILE_DATA_MEM32;
+    TblPtr->Mem32.MaxFillData      = MM_MAX_FILL_DATA_MEM32;
+    TblPtr->Mem16.MaxLoadFileData  = MM_MAX_LOAD_FILE_DATA_MEM16;
+    TblPtr->Mem16.MaxDumpFileData  = MM_MAX_DUMP_FILE_DATA_MEM16;
+    TblPtr->Mem16.MaxFillData      = MM_MAX_FILL_DATA_MEM16;
+    TblPtr->Mem8.MaxLoadFileData   = MM_MAX_LOAD_FILE_DATA_MEM8;
+    TblPtr->Mem8.MaxDumpFileData   = MM_MAX_DUMP_FILE_DATA_MEM8;
+    TblPtr->Mem8.MaxFillData       = MM_MAX_FILL_DATA_MEM8;
+
+    TblPtr->LoadDataSeg       = MM_MAX_LOAD_DATA_SEG;
+    TblPtr->DumpDataSeg       = MM_MAX_DUMP_DATA_SEG;
+    TblPtr->FillDataSeg       = MM_MAX_FILL_DATA_SEG;
+    TblPtr->ProcessorCycle    = MM_PROCESSOR_CYCLE;
+    TblPtr->SegmentTimeBudget = MM_SEGMENT_TIME_BUDGET;
+    TblPtr->WakeupByteBudget  = MM_WAKEUP_BYTE_BUDGET;
+    TblPtr->MaxStagedLoad     = MM_MAX_STAGED_LOAD;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Pick up a new configuration table                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_TableManage(void)
+{
+    CFE_Status_t    Status;
+    MM_ConfigTbl_t *TblPtr = NULL;
+
+    /*
+    ** Leave a pending table update with table services until no memory
+    ** operation is in progress, the operation keeps the limits and
+    ** segment parameters it started with. Only the main task starts the
+    ** child task, so it stays idle until this call returns.
+    */
+    if ((MM_AppData.HkPacket.Payload.ActiveAction != MM_NOACTION) || (MM_ChildGetState() == MM_CHILD_BUSY))
+    {
+        return;
+    }
+
+    CFE_TBL_Manage(MM_AppData.ConfigTblHandle);
+
+    Status = CFE_TBL_GetAddress((void **)&TblPtr, MM_AppData.ConfigTblHandle);
+
+    /*
+    ** Keep the current configuration unless the table changed, a table
+    ** that was never loaded leaves the compile time values in use
+    */
+    if ((Status == CFE_TBL_INFO_UPDATED) && (TblPtr != NULL))
+    {
+        memcpy(&MM_AppData.Config, TblPtr, sizeof(MM_AppData.Config));
+    }
+
+    if ((Status == CFE_SUCCESS) || (Status == CFE_TBL_INFO_UPDATED))
+    {
+        CFE_TBL_ReleaseAddress(MM_AppData.ConfigTblHandle);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Validate the configuration table                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 MM_TableValidate(void *TblData)
+{
+    MM_ConfigTbl_t *TblPtr = (MM_ConfigTbl_t *)TblData;
+    uint32          MaxDataSeg;
+    bool            Valid;
+
+    Valid = MM_TableValidateLimit("Ram.MaxLoadFileData", TblPtr->Ram.MaxLoadFileData, MM_MAX_LOAD_FILE_DATA_RAM) &&
+            MM_TableValidateLimit("Ram.MaxDumpFileData", TblPtr->Ram.MaxDumpFileData, MM_MAX_DUMP_FILE_DATA_RAM) &&
+            MM_TableValidateLimit("Ram.MaxFillData", TblPtr->Ram.MaxFillData, MM_MAX_FILL_DATA_RAM) &&
+            MM_TableValidateLimit("Eeprom.MaxLoadFileData", TblPtr->Eeprom.MaxLoadFileData,
+                                  MM_MAX_LOAD_FILE_DATA_EEPROM) &&
+            MM_TableValidateLimit("Eeprom.MaxDumpFileData", TblPtr->Eeprom.MaxDumpFileData,
+                                  MM_MAX_DUMP_FILE_DATA_EEPROM) &&
+            MM_TableValidateLimit("Eeprom.MaxFillData", TblPtr->Eeprom.MaxFillData, MM_MAX_FILL_DATA_EEPROM) &&
+            MM_TableValidateLimit("Mem32.MaxLoadFileData", TblPtr->Mem32.MaxLoadFileData,
+                                  MM_MAX_LOAD_FILE_DATA_MEM32) &&
+            MM_TableValidateLimit("Mem32.MaxDumpFileData", TblPtr->Mem32.MaxDumpFileData,
+                                  MM_MAX_DUMP_FILE_DATA_MEM32) &&
+            MM_TableValidateLimit("Mem32.MaxFillData", TblPtr->Mem32.MaxFillData, MM_MAX_FILL_DATA_MEM32) &&
+            MM_TableValidateLimit("Mem16.MaxLoadFileData", TblPtr->Mem16.MaxLoadFileData,
+                                  MM_MAX_LOAD_FILE_DATA_MEM16) &&
+            MM_TableValidateLimit("Mem16.MaxDumpFileData", TblPtr->Mem16.MaxDumpFileData,
+                                  MM_MAX_DUMP_FILE_DATA_MEM16) &&
+            MM_TableValidateLimit("Mem16.MaxFillData", TblPtr->Mem16.MaxFillData, MM_MAX_FILL_DATA_MEM16) &&
+            MM_TableValidateLimit("Mem8.MaxLoadFileData", TblPtr->Mem8.MaxLoadFileData, MM_MAX_LOAD_FILE_DATA_MEM8) &&
+            MM_TableValidateLimit("Mem8.MaxDumpFileData", TblPtr->Mem8.MaxDumpFileData, MM_MAX_DUMP_FILE_DATA_MEM8) &&
+            MM_TableValidateLimit("Mem8.MaxFillData", TblPtr->Mem8.MaxFillData, MM_MAX_FILL_DATA_MEM8) &&
+            MM_TableValidateSegment("LoadDataSeg", TblPtr->LoadDataSeg, MM_MAX_LOAD_DATA_SEG) &&
+            MM_TableValidateSegment("DumpDataSeg", TblPtr->DumpDataSeg, MM_MAX_DUMP_DATA_SEG) &&
+            MM_TableValidateSegment("FillDataSeg", TblPtr->FillDataSeg, MM_MAX_FILL_DATA_SEG) &&
+            MM_TableValidateLimit("MaxStagedLoad", TblPtr->MaxStagedLoad, MM_MAX_STAGED_LOAD) &&
+            MM_TableValidateLimit("ProcessorCycle", TblPtr->ProcessorCycle, MM_MAX_PROCESSOR_CYCLE) &&
+            MM_TableValidateLimit("SegmentTimeBudget", TblPtr->SegmentTimeBudget, MM_MAX_SEGMENT_TIME_BUDGET);
+
+    if (Valid)
+    {
+        /* A paced operation must be able to finish a whole segment within one wakeup */
+        MaxDataSeg = TblPtr->LoadDataSeg;
+        if (TblPtr->DumpDataSeg > MaxDataSeg)
+        {
+            MaxDataSeg = TblPtr->DumpDataSeg;
+        }
+        if (TblPtr->FillDataSeg > MaxDataSeg)
+        {
+            MaxDataSeg = TblPtr->FillDataSeg;
+        }
+
+        Valid = MM_TableValidateBudget("WakeupByteBudget", TblPtr->WakeupByteBudget, MaxDataSeg);
+    }
+
+    if (!Valid)
+    {
+        return MM_CONFIG_TBL_VALIDATION_ERR;
+    }
+
+    CFE_EVS_SendEvent(MM_CONFIG_TBL_VAL_INF_EID, CFE_EVS_EventType_INFORMATION, "Config Table validation passed");
+
+    return CFE_SUCCESS;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Validate a configuration table limit                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_TableValidateLimit(const char *Name, uint32 Value, uint32 Max)
+{
+    bool Valid = true;
+
+    if (Value > Max)
+    {
+        Valid = false;
+        CFE_EVS_SendEvent(MM_CONFIG_TBL_VAL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Config Table validation error: %s = %u exceeds %u", Name, (unsigned int)Value,
+                          (unsigned int)Max);
+    }
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Validate a configuration table segment size                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_TableValidateSegment(const char *Name, uint32 Value, uint32 Max)
+{
+    bool Valid = MM_TableValidateLimit(Name, Value, Max);
+
+    if (Valid && ((Value < MM_MIN_DATA_SEG) || ((Value % MM_MIN_DATA_SEG) != 0)))
+    {
+        Valid = false;
+        CFE_EVS_SendEvent(MM_CONFIG_TBL_VAL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Config Table validation error: %s = %u is not a non-zero multiple of %u", Name,
+                          (unsigned int)Value, (unsigned int)MM_MIN_DATA_SEG);
+    }
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Validate a configuration table byte budget                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_TableValidateBudget(const char *Name, uint32 Value, uint32 Min)
+{
+    bool Valid = true;
+
+    if ((Value != 0) && (Value < Min))
+    {
+        Valid = false;
+        CFE_EVS_SendEvent(MM_CONFIG_TBL_VAL_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Config Table validation error: %s = %u is below %u", Name, (unsigned int)Value,
+                          (unsigned int)Min);
+    }
+
+    return Valid;
+}
@@ -0,0 +1,174 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Specification for the CFS Memory Manager configuration table
+ *   functions.
+ */
+#ifndef MM_TBL_H
+#define MM_TBL_H
+
+/*************************************************************************
+ * Includes
+ *************************************************************************/
+#include "cfe.h"
+#include "mm_tbldefs.h"
+
+/*************************************************************************
+ * Macro Definitions
+ *************************************************************************/
+
+/** \brief Configuration table validation error return code */
+#define MM_CONFIG_TBL_VALIDATION_ERR (-1)
+
+/*************************************************************************
+ * Exported Functions
+ *************************************************************************/
+
+/**
+ * \brief Configuration table initialization
+ *
+ *  \par Description
+ *       Sets the run time configuration to the compile time values,
+ *       registers the configuration table and loads it from
+ *       #MM_CONFIG_TBL_FILENAME. Called from #MM_AppInit.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Only a registration failure is fatal. If the table file can't
+ *       be loaded the compile time values stay in use until a table
+ *       load is commanded.
+ *
+ *  \return Execution status, see \ref CFEReturnCodes
+ *  \retval #CFE_SUCCESS \copybrief CFE_SUCCESS
+ */
+CFE_Status_t MM_TableInit(void);
+
+/**
+ * \brief Set the compile time configuration
+ *
+ *  \par Description
+ *       Fills a configuration table with the values from
+ *       mm_platform_cfg.h
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [out] TblPtr  Configuration table to fill
+ */
+void MM_TableSetDefaults(MM_ConfigTbl_t *TblPtr);
+
+/**
+ * \brief Configuration table management
+ *
+ *  \par Description
+ *       Gives table services the chance to update the configuration
+ *       table and copies a new table into the run time configuration
+ *       used by MM. Called on each housekeeping request.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Does nothing while a memory operation is in progress, so a
+ *       table update takes effect between operations. The table
+ *       address is only held for the duration of the call, so the
+ *       child task always works from the copy.
+ */
+void MM_TableManage(void);
+
+/**
+ * \brief Configuration table validation
+ *
+ *  \par Description
+ *       Table services validation function for the configuration
+ *       table. Checks every limit and the segment pacing parameters
+ *       against their compile time upper bounds, the segment sizes
+ *       against the alignment the segment loops depend on and the
+ *       wakeup byte budget against the largest segment size.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The first invalid value is reported in the
+ *       #MM_CONFIG_TBL_VAL_ERR_EID event.
+ *
+ *  \param [in] TblData  Pointer to the table to validate
+ *
+ *  \return Validation status
+ *  \retval #CFE_SUCCESS                  \copybrief CFE_SUCCESS
+ *  \retval #MM_CONFIG_TBL_VALIDATION_ERR \copybrief MM_CONFIG_TBL_VALIDATION_ERR
+ */
+int32 MM_TableValidate(void *TblData);
+
+/**
+ * \brief Validate a configuration table limit
+ *
+ *  \par Description
+ *       Checks a limit against its compile time upper bound.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Sends #MM_CONFIG_TBL_VAL_ERR_EID if the limit is invalid
+ *
+ *  \param [in] Name   Name of the table field, for the event message
+ *  \param [in] Value  Table value
+ *  \param [in] Max    Compile time upper bound
+ *
+ *  \return Boolean validation status
+ *  \retval true  Limit is valid
+ *  \retval false Limit is invalid
+ */
+bool MM_TableValidateLimit(const char *Name, uint32 Value, uint32 Max);
+
+/**
+ * \brief Validate a configuration table segment size
+ *
+ *  \par Description
+ *       Checks a segment size against its compile time upper bound and
+ *       that it is a non-zero multiple of #MM_MIN_DATA_SEG.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Sends #MM_CONFIG_TBL_VAL_ERR_EID if the segment size is invalid
+ *
+ *  \param [in] Name   Name of the table field, for the event message
+ *  \param [in] Value  Table value
+ *  \param [in] Max    Compile time upper bound
+ *
+ *  \return Boolean validation status
+ *  \retval true  Segment size is valid
+ *  \retval false Segment size is invalid
+ */
+bool MM_TableValidateSegment(const char *Name, uint32 Value, uint32 Max);
+
+/**
+ * \brief Validate a configuration table byte budget
+ *
+ *  \par Description
+ *       Checks that a byte budget is either zero, which turns off the
+ *       feature it controls, or no smaller than the given minimum.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Sends #MM_CONFIG_TBL_VAL_ERR_EID if the budget is invalid
+ *
+ *  \param [in] Name   Name of the table field, for the event message
+ *  \param [in] Value  Table value
+ *  \param [in] Min    Smallest non-zero value
+ *
+ *  \return Boolean validation status
+ *  \retval true  Budget is valid
+ *  \retval false Budget is invalid
+ */
+bool MM_TableValidateBudget(const char *Name, uint32 Value, uint32 Min);
+
+#endif
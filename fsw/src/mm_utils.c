@@ -27,18 +27,15 @@
 *************************************************************************/
 #include "mm_app.h"
 #include "mm_utils.h"
+#include "mm_crc.h"
 #include "mm_perfids.h"
 #include "mm_msgids.h"
 #include "mm_events.h"
 #include "mm_dump.h"
+#include "mm_memtype.h"
+#include "mm_child.h"
 #include <string.h>
 
-/*************************************************************************
-** Macro Definitions
-*************************************************************************/
-
-#define FILE_CRC_BUFFER_SIZE 200 /**< \brief Number of bytes per read when computing file CRC */
-
 /*************************************************************************
 ** External Data
 *************************************************************************/
@@ -59,27 +56,483 @@ void MM_ResetHk(void)
     MM_AppData.HkPacket.Payload.FileName[0]    = MM_CLEAR_FNAME;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Maximum segment size of a segmented operation type              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+size_t MM_SegmentMaxSize(uint8 SegmentType)
+{
+    size_t MaxSize;
+    size_t BufferSize;
+
+    switch (SegmentType)
+    {
+        /* A copy writes memory a segment at a time, just like a load */
+        case MM_SEG_LOAD:
+        case MM_SEG_COPY:
+            MaxSize    = MM_AppData.Config.LoadDataSeg;
+            BufferSize = MM_MAX_LOAD_DATA_SEG;
+            break;
+
+        /* A CRC reads memory a segment at a time, just like a dump */
+        case MM_SEG_DUMP:
+        case MM_SEG_CRC:
+            MaxSize    = MM_AppData.Config.DumpDataSeg;
+            BufferSize = MM_MAX_DUMP_DATA_SEG;
+            break;
+
+        default:
+            MaxSize    = MM_AppData.Config.FillDataSeg;
+            BufferSize = MM_MAX_FILL_DATA_SEG;
+            break;
+    }
+
+    /* The table is validated, but never exceed the compile time segment limit */
+    if ((MaxSize < MM_MIN_DATA_SEG) || (MaxSize > BufferSize))
+    {
+        MaxSize = BufferSize;
+    }
+
+    return MaxSize;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start a segmented load, dump, or fill operation                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+size_t MM_SegmentStart(uint8 SegmentType)
+{
+    size_t MaxSize;
+
+    /* A region of a multi-region operation continues the operation in progress */
+    if (MM_AppData.OpMultiRegion)
+    {
+        MM_AppData.OpSegments++;
+        return MM_AppData.SegmentSize[MM_AppData.SegmentType];
+    }
+
+    if (SegmentType >= MM_SEG_NUM_TYPES)
+    {
+        SegmentType = MM_SEG_FILL;
+    }
+
+    MaxSize = MM_SegmentMaxSize(SegmentType);
+
+    /* Fixed sizes, or a size that was never set or no longer fits the buffer */
+    if ((MM_AppData.Config.SegmentTimeBudget == 0) || (MM_AppData.SegmentSize[SegmentType] < MM_MIN_DATA_SEG) ||
+        (MM_AppData.SegmentSize[SegmentType] > MaxSize))
+    {
+        MM_AppData.SegmentSize[SegmentType] = MaxSize;
+    }
+
+    MM_AppData.SegmentType = SegmentType;
+    MM_AppData.OpBytes     = 0;
+    MM_AppData.OpSegments  = 1;
+    MM_AppData.OpBreakUsec = 0;
+    MM_AppData.OpIoUsec    = 0;
+
+    OS_GetLocalTime(&MM_AppData.OpStartTime);
+    MM_AppData.SegmentStartTime = MM_AppData.OpStartTime;
+
+    return MM_AppData.SegmentSize[SegmentType];
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Resize the segments of the operation to fit the time budget     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_SegmentAdapt(size_t SegmentSize, int64 ElapsedUsec)
+{
+    uint64 NewSize;
+    size_t MaxSize = MM_SegmentMaxSize(MM_AppData.SegmentType);
+
+    /*
+    ** Only a full segment says anything about the current size, a
+    ** short one is the tail end of the operation
+    */
+    if ((MM_AppData.SegmentType < MM_SEG_NUM_TYPES) && (SegmentSize == MM_AppData.SegmentSize[MM_AppData.SegmentType]))
+    {
+        if (ElapsedUsec <= 0)
+        {
+            /* Faster than the clock can measure */
+            NewSize = (uint64)SegmentSize * 2;
+        }
+        else
+        {
+            /*
+            ** Move half way to the size that would have taken exactly the
+            ** budget, so one noisy measurement does not swing the size
+            */
+            NewSize = ((uint64)SegmentSize * MM_AppData.Config.SegmentTimeBudget) / (uint64)ElapsedUsec;
+            NewSize = (NewSize + SegmentSize) / 2;
+        }
+
+        /* Grow at most by a factor of two per segment */
+        if (NewSize > (uint64)SegmentSize * 2)
+        {
+            NewSize = (uint64)SegmentSize * 2;
+        }
+
+        if (NewSize > MaxSize)
+        {
+            NewSize = MaxSize;
+        }
+
+        NewSize -= NewSize % MM_MIN_DATA_SEG;
+
+        if (NewSize < MM_MIN_DATA_SEG)
+        {
+            NewSize = MM_MIN_DATA_SEG;
+        }
+
+        MM_AppData.SegmentSize[MM_AppData.SegmentType] = NewSize;
+    }
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Process a load, dump, or fill segment break                     */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void MM_SegmentBreak(void)
+size_t MM_SegmentBreak(size_t SegmentSize)
 {
+    int32     OS_Status = OS_SUCCESS;
+    OS_time_t Now;
+    int64     ElapsedUsec;
+    uint64    Throughput;
+    uint32    WakeupCount;
+
     /*
     ** Performance Log entry stamp
     */
     CFE_ES_PerfLogEntry(MM_SEGBREAK_PERF_ID);
 
+    OS_GetLocalTime(&Now);
+
+    if (MM_AppData.Config.SegmentTimeBudget != 0)
+    {
+        ElapsedUsec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(Now, MM_AppData.SegmentStartTime));
+        MM_SegmentAdapt(SegmentSize, ElapsedUsec);
+    }
+
+    /* Achieved throughput includes the time spent yielding */
+    MM_AppData.OpBytes += SegmentSize;
+    MM_AppData.OpSegments++;
+    ElapsedUsec = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(Now, MM_AppData.OpStartTime));
+    if (ElapsedUsec > 0)
+    {
+        Throughput = ((uint64)MM_AppData.OpBytes * 1000000) / (uint64)ElapsedUsec;
+        if (Throughput > UINT32_MAX)
+        {
+            Throughput = UINT32_MAX;
+        }
+
+        MM_AppData.Throughput = Throughput;
+    }
+
     /*
-    ** Give something else the chance to run
+    ** On the main task nothing else reads the command pipe until the
+    ** operation completes, answer housekeeping requests so MM is not
+    ** reported late
     */
-    OS_TaskDelay(MM_PROCESSOR_CYCLE);
+    if (MM_ChildGetState() != MM_CHILD_BUSY)
+    {
+        MM_SegmentPollCmds();
+    }
+
+    if ((MM_AppData.Config.WakeupByteBudget != 0) && OS_ObjectIdDefined(MM_AppData.WakeupSemaphore) &&
+        (MM_ChildGetState() == MM_CHILD_BUSY))
+    {
+        /*
+        ** Running on the child task and paced by scheduler wakeups.
+        ** Start a new slice if a wakeup arrived since the last one began.
+        ** The main task counts the wakeups, read the count under the mutex.
+        */
+        MM_ChildLock();
+        WakeupCount = MM_AppData.WakeupCount;
+        MM_ChildUnlock();
+
+        if (MM_AppData.SliceWakeupCount != WakeupCount)
+        {
+            MM_AppData.SliceWakeupCount = WakeupCount;
+            MM_AppData.SliceBytes       = 0;
+        }
+
+        MM_AppData.SliceBytes += SegmentSize;
+
+        if (MM_AppData.SliceBytes >= MM_AppData.Config.WakeupByteBudget)
+        {
+            /*
+            ** Budget for this wakeup is used up, wait for the next one.
+            ** The semaphore may still hold a give from the wakeup that
+            ** started this slice, so wait on the count instead.
+            */
+            while ((MM_AppData.SliceWakeupCount == WakeupCount) && (OS_Status == OS_SUCCESS))
+            {
+                OS_Status = OS_BinSemTimedWait(MM_AppData.WakeupSemaphore, MM_WAKEUP_TIMEOUT);
+
+                MM_ChildLock();
+                WakeupCount = MM_AppData.WakeupCount;
+                MM_ChildUnlock();
+            }
+
+            MM_AppData.SliceWakeupCount = WakeupCount;
+            MM_AppData.SliceBytes       = 0;
+        }
+    }
+    else
+    {
+        /*
+        ** Give something else the chance to run
+        */
+        OS_TaskDelay(MM_AppData.Config.ProcessorCycle);
+    }
+
+    /* Time spent yielding does not count against the next segment */
+    OS_GetLocalTime(&MM_AppData.SegmentStartTime);
+    MM_AppData.OpBreakUsec += OS_TimeGetTotalMicroseconds(OS_TimeSubtract(MM_AppData.SegmentStartTime, Now));
 
     /*
     ** Performance Log exit stamp
     */
     CFE_ES_PerfLogExit(MM_SEGBREAK_PERF_ID);
+
+    return MM_AppData.SegmentSize[MM_AppData.SegmentType];
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Poll the command pipe during a segment break                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_SegmentPollCmds(void)
+{
+    CFE_Status_t     Status;
+    CFE_SB_Buffer_t *BufPtr    = NULL;
+    CFE_SB_MsgId_t   MessageID = CFE_SB_INVALID_MSG_ID;
+    uint32           i;
+
+    for (i = 0; i < MM_CMD_PIPE_DEPTH; i++)
+    {
+        Status = CFE_SB_ReceiveBuffer(&BufPtr, MM_AppData.CmdPipe, CFE_SB_POLL);
+        if ((Status != CFE_SUCCESS) || (BufPtr == NULL))
+        {
+            /* Pipe is empty */
+            break;
+        }
+
+        CFE_MSG_GetMsgId(&BufPtr->Msg, &MessageID);
+
+        if ((CFE_SB_MsgIdToValue(MessageID) == MM_SEND_HK_MID) || (CFE_SB_MsgIdToValue(MessageID) == MM_WAKEUP_MID))
+        {
+            MM_AppPipe(BufPtr);
+        }
+        else
+        {
+            MM_DeferCmd(BufPtr);
+        }
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start timing a segmented operation file read or write           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_SegmentIoStart(void)
+{
+    CFE_ES_PerfLogEntry(MM_FILE_IO_PERF_ID);
+
+    OS_GetLocalTime(&MM_AppData.IoStartTime);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* End timing a segmented operation file read or write             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_SegmentIoEnd(void)
+{
+    OS_time_t Now;
+
+    OS_GetLocalTime(&Now);
+    MM_AppData.OpIoUsec += OS_TimeGetTotalMicroseconds(OS_TimeSubtract(Now, MM_AppData.IoStartTime));
+
+    CFE_ES_PerfLogExit(MM_FILE_IO_PERF_ID);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Complete a segmented load, dump, or fill operation              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_SegmentEnd(size_t BytesProcessed)
+{
+    MM_OpStats_t *Stats;
+    OS_time_t     Now;
+    int64         Duration;
+    int64         BreakTime;
+    int64         IoTime;
+    uint64        Throughput;
+
+    /* The multi-region operation is accounted once, when its last region is done */
+    if (MM_AppData.OpMultiRegion)
+    {
+        return;
+    }
+
+    OS_GetLocalTime(&Now);
+
+    switch (MM_AppData.SegmentType)
+    {
+        case MM_SEG_LOAD:
+            Stats = &MM_AppData.StatsPacket.Payload.LoadFromFile;
+            break;
+
+        case MM_SEG_DUMP:
+            Stats = &MM_AppData.StatsPacket.Payload.DumpToFile;
+            break;
+
+        case MM_SEG_COPY:
+            Stats = &MM_AppData.StatsPacket.Payload.Copy;
+            break;
+
+        case MM_SEG_CRC:
+            Stats = &MM_AppData.StatsPacket.Payload.Crc;
+            break;
+
+        default:
+            Stats = &MM_AppData.StatsPacket.Payload.Fill;
+            break;
+    }
+
+    /*
+    ** Keep every time within the operation duration, so they all fit
+    ** the telemetry and the memory access time is never negative
+    */
+    Duration = OS_TimeGetTotalMicroseconds(OS_TimeSubtract(Now, MM_AppData.OpStartTime));
+    if (Duration < 0)
+    {
+        Duration = 0;
+    }
+    else if (Duration > UINT32_MAX)
+    {
+        Duration = UINT32_MAX;
+    }
+
+    BreakTime = (MM_AppData.OpBreakUsec < Duration) ? MM_AppData.OpBreakUsec : Duration;
+    IoTime    = (MM_AppData.OpIoUsec < (Duration - BreakTime)) ? MM_AppData.OpIoUsec : (Duration - BreakTime);
+
+    /* An operation faster than the clock can measure counts as one microsecond */
+    Throughput = ((uint64)BytesProcessed * 1000000) / (uint64)((Duration > 0) ? Duration : 1);
+    if (Throughput > UINT32_MAX)
+    {
+        Throughput = UINT32_MAX;
+    }
+
+    MM_AppData.Throughput = Throughput;
+
+    /* The main task may be resetting or sending the statistics */
+    MM_ChildLock();
+
+    Stats->OpCount++;
+    Stats->LastBytes      = BytesProcessed;
+    Stats->LastDuration   = Duration;
+    Stats->LastSegments   = MM_AppData.OpSegments;
+    Stats->LastBreakTime  = BreakTime;
+    Stats->LastIoTime     = IoTime;
+    Stats->LastCopyTime   = Duration - BreakTime - IoTime;
+    Stats->LastThroughput = Throughput;
+
+    if (Stats->OpCount == 1)
+    {
+        Stats->MinDuration    = Duration;
+        Stats->MaxDuration    = Duration;
+        Stats->MeanDuration   = Duration;
+        Stats->MinThroughput  = Throughput;
+        Stats->MaxThroughput  = Throughput;
+        Stats->MeanThroughput = Throughput;
+    }
+    else
+    {
+        if (Duration < Stats->MinDuration)
+        {
+            Stats->MinDuration = Duration;
+        }
+        if (Duration > Stats->MaxDuration)
+        {
+            Stats->MaxDuration = Duration;
+        }
+        if (Throughput < Stats->MinThroughput)
+        {
+            Stats->MinThroughput = Throughput;
+        }
+        if (Throughput > Stats->MaxThroughput)
+        {
+            Stats->MaxThroughput = Throughput;
+        }
+
+        /* Running mean, no sum to overflow */
+        Stats->MeanDuration += (Duration - (int64)Stats->MeanDuration) / (int64)Stats->OpCount;
+        Stats->MeanThroughput += ((int64)Throughput - (int64)Stats->MeanThroughput) / (int64)Stats->OpCount;
+    }
+
+    MM_ChildUnlock();
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start a segmented operation over several regions                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_SegmentMultiStart(uint8 SegmentType)
+{
+    MM_AppData.OpMultiRegion = false;
+
+    MM_SegmentStart(SegmentType);
+
+    /* Each region counts its own first segment */
+    MM_AppData.OpSegments    = 0;
+    MM_AppData.OpMultiRegion = true;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Complete a segmented operation over several regions             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_SegmentMultiEnd(bool Completed, size_t BytesProcessed)
+{
+    MM_AppData.OpMultiRegion = false;
+
+    if (Completed)
+    {
+        MM_SegmentEnd(BytesProcessed);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Reset the segmented operation statistics                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_ResetStats(void)
+{
+    /* The child task may be recording a completed operation */
+    MM_ChildLock();
+
+    memset(&MM_AppData.StatsPacket.Payload, 0, sizeof(MM_AppData.StatsPacket.Payload));
+
+    MM_AppData.StatsPacket.Payload.LoadFromFile.CommandCode = MM_LOAD_MEM_FROM_FILE_CC;
+    MM_AppData.StatsPacket.Payload.DumpToFile.CommandCode   = MM_DUMP_MEM_TO_FILE_CC;
+    MM_AppData.StatsPacket.Payload.Fill.CommandCode         = MM_FILL_MEM_CC;
+    MM_AppData.StatsPacket.Payload.Copy.CommandCode         = MM_COPY_MEM_CC;
+    MM_AppData.StatsPacket.Payload.Crc.CommandCode          = MM_CRC_MEM_CC;
+
+    MM_ChildUnlock();
 }
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -136,9 +589,11 @@ bool MM_VerifyCmdLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLength)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 bool MM_VerifyPeekPokeParams(cpuaddr Address, MM_MemType_t MemType, size_t SizeInBits)
 {
-    bool   Valid = true;
-    size_t SizeInBytes;
-    int32  OS_Status;
+    bool                      Valid = true;
+    size_t                    SizeInBytes;
+    int32                     OS_Status;
+    uint32                    RangeNum = MM_MEM_RANGE_UNKNOWN;
+    const MM_MemTypeDriver_t *Driver;
 
     switch (SizeInBits)
     {
@@ -178,115 +633,42 @@ bool MM_VerifyPeekPokeParams(cpuaddr Address, MM_MemType_t MemType, size_t SizeI
     /* Do other checks if this one passed */
     if (Valid == true)
     {
-        switch (MemType)
+        Driver = MM_MemTypeGet(MemType);
+
+        if (Driver == NULL)
+        {
+            Valid = false;
+            CFE_EVS_SendEvent(MM_MEMTYPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Invalid memory type specified: MemType = %d", MemType);
+        }
+        else
         {
-            case MM_RAM:
-                OS_Status = CFE_PSP_MemValidateRange(Address, SizeInBytes, CFE_PSP_MEM_RAM);
+            OS_Status = MM_MemRangeValidate(Address, SizeInBytes, Driver->PSP_MemType, &RangeNum);
 
-                if (OS_Status != CFE_PSP_SUCCESS)
-                {
-                    Valid = false;
-                    CFE_EVS_SendEvent(MM_OS_MEMVALIDATE_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "CFE_PSP_MemValidateRange error received: RC = 0x%08X Addr = %p Size = %u "
-                                      "MemType = MEM_RAM",
-                                      (unsigned int)OS_Status, (void *)Address, (unsigned int)SizeInBytes);
-                }
-                break;
+            if (OS_Status != CFE_PSP_SUCCESS)
+            {
+                Valid = false;
+                CFE_EVS_SendEvent(MM_OS_MEMVALIDATE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "CFE_PSP_MemValidateRange error received: RC = 0x%08X Addr = %p Size = %u "
+                                  "MemType = %s",
+                                  (unsigned int)OS_Status, (void *)Address, (unsigned int)SizeInBytes, Driver->Name);
+            }
+            /*
+            ** Peeks and Pokes must match the access width of the memory type, if it has one
+            */
+            else if ((Driver->AccessWidth != 0) && (SizeInBytes != Driver->AccessWidth))
+            {
+                Valid = false;
+                CFE_EVS_SendEvent(MM_DATA_SIZE_BITS_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Data size in bits invalid: Data Size = %u", (unsigned int)SizeInBits);
+            }
+        }
+    }
 
-            case MM_EEPROM:
-                OS_Status = CFE_PSP_MemValidateRange(Address, SizeInBytes, CFE_PSP_MEM_EEPROM);
-
-                if (OS_Status != CFE_PSP_SUCCESS)
-                {
-                    Valid = false;
-                    CFE_EVS_SendEvent(MM_OS_MEMVALIDATE_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "CFE_PSP_MemValidateRange error received: RC = 0x%08X Addr = %p Size = %u "
-                                      "MemType = MEM_EEPROM",
-                                      (unsigned int)OS_Status, (void *)Address, (unsigned int)SizeInBytes);
-                }
-                break;
-
-#ifdef MM_OPT_CODE_MEM32_MEMTYPE
-            case MM_MEM32:
-                OS_Status = CFE_PSP_MemValidateRange(Address, SizeInBytes, CFE_PSP_MEM_RAM);
-
-                if (OS_Status != CFE_PSP_SUCCESS)
-                {
-                    Valid = false;
-                    CFE_EVS_SendEvent(
-                        MM_OS_MEMVALIDATE_ERR_EID, CFE_EVS_EventType_ERROR,
-                        "CFE_PSP_MemValidateRange error received: RC = 0x%08X Addr = %p Size = %u MemType = MEM32",
-                        (unsigned int)OS_Status, (void *)Address, (unsigned int)SizeInBytes);
-                }
-                /*
-                ** Peeks and Pokes must be 32 bits wide for this memory type
-                */
-                else if (SizeInBytes != 4)
-                {
-                    Valid = false;
-                    CFE_EVS_SendEvent(MM_DATA_SIZE_BITS_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "Data size in bits invalid: Data Size = %u", (unsigned int)SizeInBits);
-                }
-                break;
-#endif /* MM_OPT_CODE_MEM32_MEMTYPE */
-
-#ifdef MM_OPT_CODE_MEM16_MEMTYPE
-            case MM_MEM16:
-                OS_Status = CFE_PSP_MemValidateRange(Address, SizeInBytes, CFE_PSP_MEM_RAM);
-
-                if (OS_Status != CFE_PSP_SUCCESS)
-                {
-                    Valid = false;
-                    CFE_EVS_SendEvent(
-                        MM_OS_MEMVALIDATE_ERR_EID, CFE_EVS_EventType_ERROR,
-                        "CFE_PSP_MemValidateRange error received: RC = 0x%08X Addr = %p Size = %u MemType = MEM16",
-                        (unsigned int)OS_Status, (void *)Address, (unsigned int)SizeInBytes);
-                }
-                /*
-                ** Peeks and Pokes must be 16 bits wide for this memory type
-                */
-                else if (SizeInBytes != 2)
-                {
-                    Valid = false;
-                    CFE_EVS_SendEvent(MM_DATA_SIZE_BITS_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "Data size in bits invalid: Data Size = %u", (unsigned int)SizeInBits);
-                }
-                break;
-#endif /* MM_OPT_CODE_MEM16_MEMTYPE */
-
-#ifdef MM_OPT_CODE_MEM8_MEMTYPE
-            case MM_MEM8:
-                OS_Status = CFE_PSP_MemValidateRange(Address, SizeInBytes, CFE_PSP_MEM_RAM);
-
-                if (OS_Status != CFE_PSP_SUCCESS)
-                {
-                    Valid = false;
-                    CFE_EVS_SendEvent(
-                        MM_OS_MEMVALIDATE_ERR_EID, CFE_EVS_EventType_ERROR,
-                        "CFE_PSP_MemValidateRange error received: RC = 0x%08X Addr = %p Size = %u MemType = MEM8",
-                        (unsigned int)OS_Status, (void *)Address, (unsigned int)SizeInBytes);
-                }
-                /*
-                ** Peeks and Pokes must be 8 bits wide for this memory type
-                */
-                else if (SizeInBytes != 1)
-                {
-                    Valid = false;
-                    CFE_EVS_SendEvent(MM_DATA_SIZE_BITS_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "Data size in bits invalid: Data Size = %u", (unsigned int)SizeInBits);
-                }
-                break;
-#endif /* MM_OPT_CODE_MEM8_MEMTYPE */
-
-            default:
-                Valid = false;
-                CFE_EVS_SendEvent(MM_MEMTYPE_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "Invalid memory type specified: MemType = %d", MemType);
-                break;
-
-        } /* end switch */
-
-    } /* end Valid == true if */
+    if (Valid == true)
+    {
+        MM_AppData.HkPacket.Payload.LastMemRange = RangeNum;
+    }
 
     return Valid;
 }
@@ -298,11 +680,11 @@ bool MM_VerifyPeekPokeParams(cpuaddr Address, MM_MemType_t MemType, size_t SizeI
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 bool MM_VerifyLoadDumpParams(cpuaddr Address, MM_MemType_t MemType, size_t SizeInBytes, uint8 VerifyType)
 {
-    bool         Valid = true;
-    CFE_Status_t PSP_Status;
-    size_t       MaxSize     = 0;
-    uint32       PSP_MemType = 0;
-    char         MemTypeStr[MM_MAX_MEM_TYPE_STR_LEN];
+    bool                      Valid = true;
+    CFE_Status_t              PSP_Status;
+    size_t                    MaxSize  = 0;
+    uint32                    RangeNum = MM_MEM_RANGE_UNKNOWN;
+    const MM_MemTypeDriver_t *Driver   = NULL;
 
     if ((VerifyType != MM_VERIFY_LOAD) && (VerifyType != MM_VERIFY_DUMP) && (VerifyType != MM_VERIFY_EVENT) &&
         (VerifyType != MM_VERIFY_FILL) && (VerifyType != MM_VERIFY_WID))
@@ -325,127 +707,50 @@ bool MM_VerifyLoadDumpParams(cpuaddr Address, MM_MemType_t MemType, size_t SizeI
     if (Valid)
     {
         /* All memory types and verification types do fundamentally the same set
-           of checks.  This switch-case statement sets up the values used to
-           perform the checks at the end of the function.  Two memory types
-           also require special handling which is performed in the appropriate
-           case. */
-        switch (MemType)
+           of checks, with the values the memory type driver holds. Memory types
+           with an access width wider than a byte also need aligned addresses
+           and sizes. */
+        Driver = MM_MemTypeGet(MemType);
+
+        if (Driver == NULL)
+        {
+            Valid = false;
+            CFE_EVS_SendEvent(MM_MEMTYPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                              "Invalid memory type specified: MemType = %d", MemType);
+        }
+        else
         {
             /* else clauses are not needed in the VerifyType checks because the
                 VerifyType is checked above and if the MaxSize is left unchanged,
                 it will force an error when the size is checked as it should */
-            case MM_RAM:
-                if (VerifyType == MM_VERIFY_LOAD)
-                {
-                    MaxSize = MM_MAX_LOAD_FILE_DATA_RAM;
-                }
-                else if (VerifyType == MM_VERIFY_DUMP)
-                {
-                    MaxSize = MM_MAX_DUMP_FILE_DATA_RAM;
-                }
-                else if (VerifyType == MM_VERIFY_FILL)
-                {
-                    MaxSize = MM_MAX_FILL_DATA_RAM;
-                }
-                PSP_MemType = CFE_PSP_MEM_RAM;
-                /* SAD: No need to check snprintf return value; buffer size can store "MEM_RAM" without overflow */
-                snprintf(MemTypeStr, MM_MAX_MEM_TYPE_STR_LEN, "%s", "MEM_RAM");
-                break;
-            case MM_EEPROM:
-                if (VerifyType == MM_VERIFY_LOAD)
-                {
-                    MaxSize = MM_MAX_LOAD_FILE_DATA_EEPROM;
-                }
-                else if (VerifyType == MM_VERIFY_DUMP)
-                {
-                    MaxSize = MM_MAX_DUMP_FILE_DATA_EEPROM;
-                }
-                else if (VerifyType == MM_VERIFY_FILL)
-                {
-                    MaxSize = MM_MAX_FILL_DATA_EEPROM;
-                }
-                PSP_MemType = CFE_PSP_MEM_EEPROM;
-                /* SAD: No need to check snprintf return value; buffer size can store "MEM_EEPROM" without overflow */
-                snprintf(MemTypeStr, MM_MAX_MEM_TYPE_STR_LEN, "%s", "MEM_EEPROM");
-                break;
-#ifdef MM_OPT_CODE_MEM32_MEMTYPE
-            case MM_MEM32:
-                if (VerifyType == MM_VERIFY_LOAD)
-                {
-                    MaxSize = MM_MAX_LOAD_FILE_DATA_MEM32;
-                }
-                else if (VerifyType == MM_VERIFY_DUMP)
-                {
-                    MaxSize = MM_MAX_DUMP_FILE_DATA_MEM32;
-                }
-                else if (VerifyType == MM_VERIFY_FILL)
-                {
-                    MaxSize = MM_MAX_FILL_DATA_MEM32;
-                }
-                PSP_MemType = CFE_PSP_MEM_RAM;
-                /* SAD: No need to check snprintf return value; buffer size can store "MEM32" without overflow */
-                snprintf(MemTypeStr, MM_MAX_MEM_TYPE_STR_LEN, "%s", "MEM32");
-                if (MM_Verify32Aligned(Address, SizeInBytes) != true)
-                {
-                    Valid = false;
-                    CFE_EVS_SendEvent(MM_ALIGN32_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "Data and address not 32 bit aligned: Addr = %p Size = %u", (void *)Address,
-                                      (unsigned int)SizeInBytes);
-                }
-                break;
-#endif
-#ifdef MM_OPT_CODE_MEM16_MEMTYPE
-            case MM_MEM16:
-                if (VerifyType == MM_VERIFY_LOAD)
-                {
-                    MaxSize = MM_MAX_LOAD_FILE_DATA_MEM16;
-                }
-                else if (VerifyType == MM_VERIFY_DUMP)
-                {
-                    MaxSize = MM_MAX_DUMP_FILE_DATA_MEM16;
-                }
-                else if (VerifyType == MM_VERIFY_FILL)
-                {
-                    MaxSize = MM_MAX_FILL_DATA_MEM16;
-                }
-                PSP_MemType = CFE_PSP_MEM_RAM;
-                /* SAD: No need to check snprintf return value; buffer size can store "MEM16" without overflow */
-                snprintf(MemTypeStr, MM_MAX_MEM_TYPE_STR_LEN, "%s", "MEM16");
-                if (MM_Verify16Aligned(Address, SizeInBytes) != true)
-                {
-                    Valid = false;
-                    CFE_EVS_SendEvent(MM_ALIGN16_ERR_EID, CFE_EVS_EventType_ERROR,
-                                      "Data and address not 16 bit aligned: Addr = %p Size = %u", (void *)Address,
-                                      (unsigned int)SizeInBytes);
-                }
-                break;
-#endif
-#ifdef MM_OPT_CODE_MEM8_MEMTYPE
-            case MM_MEM8:
-                if (VerifyType == MM_VERIFY_LOAD)
-                {
-                    MaxSize = MM_MAX_LOAD_FILE_DATA_MEM8;
-                }
-                else if (VerifyType == MM_VERIFY_DUMP)
-                {
-                    MaxSize = MM_MAX_DUMP_FILE_DATA_MEM8;
-                }
-                else if (VerifyType == MM_VERIFY_FILL)
-                {
-                    MaxSize = MM_MAX_FILL_DATA_MEM8;
-                }
-                PSP_MemType = CFE_PSP_MEM_RAM;
-                /* SAD: No need to check snprintf return value; buffer size can store "MEM8" without overflow */
-                snprintf(MemTypeStr, MM_MAX_MEM_TYPE_STR_LEN, "%s", "MEM8");
-                break;
-#endif
-            default:
-                Valid = false;
-                CFE_EVS_SendEvent(MM_MEMTYPE_ERR_EID, CFE_EVS_EventType_ERROR,
-                                  "Invalid memory type specified: MemType = %d", MemType);
+            if (VerifyType == MM_VERIFY_LOAD)
+            {
+                MaxSize = Driver->Limits->MaxLoadFileData;
+            }
+            else if (VerifyType == MM_VERIFY_DUMP)
+            {
+                MaxSize = Driver->Limits->MaxDumpFileData;
+            }
+            else if (VerifyType == MM_VERIFY_FILL)
+            {
+                MaxSize = Driver->Limits->MaxFillData;
+            }
 
-                break;
-        } /* end MemType switch */
+            if ((Driver->AccessWidth == 4) && (MM_Verify32Aligned(Address, SizeInBytes) != true))
+            {
+                Valid = false;
+                CFE_EVS_SendEvent(MM_ALIGN32_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Data and address not 32 bit aligned: Addr = %p Size = %u", (void *)Address,
+                                  (unsigned int)SizeInBytes);
+            }
+            else if ((Driver->AccessWidth == 2) && (MM_Verify16Aligned(Address, SizeInBytes) != true))
+            {
+                Valid = false;
+                CFE_EVS_SendEvent(MM_ALIGN16_ERR_EID, CFE_EVS_EventType_ERROR,
+                                  "Data and address not 16 bit aligned: Addr = %p Size = %u", (void *)Address,
+                                  (unsigned int)SizeInBytes);
+            }
+        }
     }
 
     if (Valid)
@@ -461,20 +766,61 @@ bool MM_VerifyLoadDumpParams(cpuaddr Address, MM_MemType_t MemType, size_t SizeI
 
     if (Valid)
     {
-        PSP_Status = CFE_PSP_MemValidateRange(Address, SizeInBytes, PSP_MemType);
+        PSP_Status = MM_MemRangeValidate(Address, SizeInBytes, Driver->PSP_MemType, &RangeNum);
 
         if (PSP_Status != CFE_PSP_SUCCESS)
         {
             Valid = false;
             CFE_EVS_SendEvent(MM_OS_MEMVALIDATE_ERR_EID, CFE_EVS_EventType_ERROR,
                               "CFE_PSP_MemValidateRange error received: RC = 0x%08X Addr = %p Size = %u MemType = %s",
-                              (unsigned int)PSP_Status, (void *)Address, (unsigned int)SizeInBytes, MemTypeStr);
+                              (unsigned int)PSP_Status, (void *)Address, (unsigned int)SizeInBytes, Driver->Name);
+        }
+        else
+        {
+            MM_AppData.HkPacket.Payload.LastMemRange = RangeNum;
         }
     }
 
     return Valid;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify a load or dump file data encoding                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_VerifyFileEncoding(uint8 Encoding, MM_MemType_t MemType)
+{
+    bool Valid = true;
+
+    switch (Encoding)
+    {
+        case MM_ENCODING_RAW:
+            break;
+
+        case MM_ENCODING_RLE:
+        case MM_ENCODING_SPARSE:
+            if ((MemType != MM_RAM) && (MemType != MM_EEPROM))
+            {
+                Valid = false;
+            }
+            break;
+
+        default:
+            Valid = false;
+            break;
+    }
+
+    if (Valid == false)
+    {
+        CFE_EVS_SendEvent(MM_FILE_ENCODING_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "File encoding not supported: Encoding = %u MemType = %u", (unsigned int)Encoding,
+                          (unsigned int)MemType);
+    }
+
+    return Valid;
+}
+
 /******************************************************************************/
 
 bool MM_Verify32Aligned(cpuaddr Address, size_t Size)
@@ -507,8 +853,11 @@ bool MM_Verify16Aligned(cpuaddr Address, size_t Size)
 
 bool MM_ResolveSymAddr(MM_SymAddr_t *SymAddr, cpuaddr *ResolvedAddr)
 {
-    bool  Valid = false;
-    int32 OS_Status;
+    bool   Valid = false;
+    int32  OS_Status;
+    uint32 Generation = 0;
+
+    CFE_ES_PerfLogEntry(MM_SYMRESOLVE_PERF_ID);
 
     /*
     ** NUL terminate the very end of the symbol name string array as a
@@ -528,10 +877,23 @@ bool MM_ResolveSymAddr(MM_SymAddr_t *SymAddr, cpuaddr *ResolvedAddr)
     else
     {
         /*
-        ** If symbol name is not an empty string look it up
-        ** using the OSAL API and add the offset if it succeeds
+        ** If symbol name is not an empty string look it up in the
+        ** symbol cache, or else using the OSAL API, and add the offset
+        ** if it succeeds
         */
-        OS_Status = OS_SymbolLookup(ResolvedAddr, SymAddr->SymName);
+        if (MM_SymCacheLookup(SymAddr->SymName, ResolvedAddr, &Generation) == true)
+        {
+            OS_Status = OS_SUCCESS;
+        }
+        else
+        {
+            OS_Status = OS_SymbolLookup(ResolvedAddr, SymAddr->SymName);
+            if (OS_Status == OS_SUCCESS)
+            {
+                MM_SymCacheAdd(SymAddr->SymName, *ResolvedAddr, Generation);
+            }
+        }
+
         if (OS_Status == OS_SUCCESS)
         {
             *ResolvedAddr += SymAddr->Offset;
@@ -540,9 +902,349 @@ bool MM_ResolveSymAddr(MM_SymAddr_t *SymAddr, cpuaddr *ResolvedAddr)
         else
             Valid = false;
     }
+
+    CFE_ES_PerfLogExit(MM_SYMRESOLVE_PERF_ID);
+
     return Valid;
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Create the symbol cache                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_SymCacheInit(void)
+{
+    int32 OS_Status;
+
+    memset(MM_AppData.SymCache, 0, sizeof(MM_AppData.SymCache));
+    MM_AppData.SymCacheGeneration = 0;
+
+    /*
+    ** Both tasks resolve symbols, without the mutex every symbol is
+    ** looked up in the OSAL symbol table instead
+    */
+    OS_Status = OS_MutSemCreate(&MM_AppData.SymCacheMutex, MM_SYM_CACHE_MUTEX_NAME, 0);
+    if (OS_Status != OS_SUCCESS)
+    {
+        MM_AppData.SymCacheMutex = OS_OBJECT_ID_UNDEFINED;
+        CFE_EVS_SendEvent(MM_SYM_CACHE_INIT_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Symbol cache init error: create mutex failed: RC = 0x%08X", (unsigned int)OS_Status);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Symbol cache index of a symbol name                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 MM_SymCacheHash(const char *SymName)
+{
+    uint32 Hash = 2166136261u;
+    uint32 i;
+
+    /* 32 bit FNV-1a, cheap and spreads similar names well */
+    for (i = 0; (i < OS_MAX_SYM_LEN) && (SymName[i] != '\0'); i++)
+    {
+        Hash ^= (uint8)SymName[i];
+        Hash *= 16777619u;
+    }
+
+    return Hash & (MM_SYM_CACHE_ENTRIES - 1);
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Look up a symbol in the symbol cache                            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_SymCacheLookup(const char *SymName, cpuaddr *Address, uint32 *Generation)
+{
+    bool                Hit = false;
+    MM_SymCacheEntry_t *Entry;
+
+    if (OS_ObjectIdDefined(MM_AppData.SymCacheMutex))
+    {
+        Entry = &MM_AppData.SymCache[MM_SymCacheHash(SymName)];
+
+        OS_MutSemTake(MM_AppData.SymCacheMutex);
+
+        if ((Entry->SymName[0] != '\0') && (strncmp(Entry->SymName, SymName, OS_MAX_SYM_LEN) == 0))
+        {
+            *Address = Entry->Address;
+            Hit      = true;
+            MM_AppData.HkPacket.Payload.SymCacheHits++;
+        }
+        else
+        {
+            MM_AppData.HkPacket.Payload.SymCacheMisses++;
+        }
+
+        *Generation = MM_AppData.SymCacheGeneration;
+
+        OS_MutSemGive(MM_AppData.SymCacheMutex);
+    }
+
+    return Hit;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Add a resolved symbol to the symbol cache                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_SymCacheAdd(const char *SymName, cpuaddr Address, uint32 Generation)
+{
+    MM_SymCacheEntry_t *Entry;
+
+    if (OS_ObjectIdDefined(MM_AppData.SymCacheMutex))
+    {
+        Entry = &MM_AppData.SymCache[MM_SymCacheHash(SymName)];
+
+        OS_MutSemTake(MM_AppData.SymCacheMutex);
+
+        /*
+        ** A flush since the lookup started means the address may already
+        ** be stale, so it isn't remembered
+        */
+        if (Generation == MM_AppData.SymCacheGeneration)
+        {
+            strncpy(Entry->SymName, SymName, OS_MAX_SYM_LEN - 1);
+            Entry->SymName[OS_MAX_SYM_LEN - 1] = '\0';
+            Entry->Address                     = Address;
+        }
+
+        OS_MutSemGive(MM_AppData.SymCacheMutex);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Discard every symbol in the symbol cache                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_SymCacheFlush(void)
+{
+    if (OS_ObjectIdDefined(MM_AppData.SymCacheMutex))
+    {
+        OS_MutSemTake(MM_AppData.SymCacheMutex);
+
+        memset(MM_AppData.SymCache, 0, sizeof(MM_AppData.SymCache));
+        MM_AppData.SymCacheGeneration++;
+
+        OS_MutSemGive(MM_AppData.SymCacheMutex);
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Create the valid memory range map                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void MM_MemRangeInit(void)
+{
+    int32 OS_Status;
+
+    memset(MM_AppData.MemRangeCount, 0, sizeof(MM_AppData.MemRangeCount));
+    MM_AppData.MemRangeMapValid              = false;
+    MM_AppData.HkPacket.Payload.LastMemRange = MM_MEM_RANGE_UNKNOWN;
+
+    /*
+    ** Both tasks check addresses, without the mutex every address is
+    ** checked against the PSP memory table instead
+    */
+    OS_Status = OS_MutSemCreate(&MM_AppData.MemRangeMutex, MM_MEM_RANGE_MUTEX_NAME, 0);
+    if (OS_Status != OS_SUCCESS)
+    {
+        MM_AppData.MemRangeMutex = OS_OBJECT_ID_UNDEFINED;
+        CFE_EVS_SendEvent(MM_MEM_RANGE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "Memory range map init error: create mutex failed: RC = 0x%08X", (unsigned int)OS_Status);
+    }
+    else
+    {
+        MM_MemRangeRefresh();
+    }
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Build the valid memory range map                                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_MemRangeRefresh(void)
+{
+    bool                Valid = false;
+    int32               PSP_Status;
+    uint32              NumRanges;
+    uint32              RangeNum;
+    uint32              MemType;
+    uint32              MapType;
+    cpuaddr             StartAddr;
+    size_t              Size;
+    size_t              WordSize;
+    uint32              Attributes;
+    uint32              i;
+    MM_MemRangeEntry_t *Map;
+
+    if (OS_ObjectIdDefined(MM_AppData.MemRangeMutex))
+    {
+        Valid     = true;
+        NumRanges = CFE_PSP_MemRanges();
+
+        OS_MutSemTake(MM_AppData.MemRangeMutex);
+
+        memset(MM_AppData.MemRangeCount, 0, sizeof(MM_AppData.MemRangeCount));
+
+        for (RangeNum = 0; (Valid == true) && (RangeNum < NumRanges); RangeNum++)
+        {
+            PSP_Status = CFE_PSP_MemRangeGet(RangeNum, &MemType, &StartAddr, &Size, &WordSize, &Attributes);
+            if (PSP_Status != CFE_PSP_SUCCESS)
+            {
+                Valid = false;
+                CFE_EVS_SendEvent(
+                    MM_MEM_RANGE_ERR_EID, CFE_EVS_EventType_ERROR,
+                    "Memory range map not built: CFE_PSP_MemRangeGet error received: RC = 0x%08X Range = %u",
+                    (unsigned int)PSP_Status, (unsigned int)RangeNum);
+            }
+            else if ((Size != 0) && ((MemType == CFE_PSP_MEM_RAM) || (MemType == CFE_PSP_MEM_EEPROM)))
+            {
+                MapType = (MemType == CFE_PSP_MEM_RAM) ? MM_MEM_RANGE_RAM : MM_MEM_RANGE_EEPROM;
+                Map     = MM_AppData.MemRangeMap[MapType];
+
+                if (MM_AppData.MemRangeCount[MapType] == MM_MEM_RANGE_MAP_ENTRIES)
+                {
+                    Valid = false;
+                    CFE_EVS_SendEvent(MM_MEM_RANGE_ERR_EID, CFE_EVS_EventType_ERROR,
+                                      "Memory range map not built: more than %u ranges of PSP memory type %u",
+                                      (unsigned int)MM_MEM_RANGE_MAP_ENTRIES, (unsigned int)MemType);
+                }
+                else
+                {
+                    /* Insertion sort on start address, the PSP memory table is short */
+                    for (i = MM_AppData.MemRangeCount[MapType]; (i > 0) && (Map[i - 1].StartAddr > StartAddr); i--)
+                    {
+                        Map[i] = Map[i - 1];
+                    }
+
+                    Map[i].StartAddr = StartAddr;
+                    Map[i].EndAddr   = StartAddr + Size - 1;
+                    Map[i].RangeNum  = RangeNum;
+
+                    MM_AppData.MemRangeCount[MapType]++;
+                }
+            }
+        }
+
+        /*
+        ** PSP memory ranges may overlap, so each entry also records the
+        ** furthest reaching range that starts at or below it. Any range
+        ** that can hold an address then is the one a binary search ends on.
+        */
+        for (MapType = 0; (Valid == true) && (MapType < MM_MEM_RANGE_TYPES); MapType++)
+        {
+            Map = MM_AppData.MemRangeMap[MapType];
+
+            for (i = 0; i < MM_AppData.MemRangeCount[MapType]; i++)
+            {
+                if ((i == 0) || (Map[i].EndAddr > Map[i - 1].MaxEndAddr))
+                {
+                    Map[i].MaxEndAddr  = Map[i].EndAddr;
+                    Map[i].MaxEndRange = Map[i].RangeNum;
+                }
+                else
+                {
+                    Map[i].MaxEndAddr  = Map[i - 1].MaxEndAddr;
+                    Map[i].MaxEndRange = Map[i - 1].MaxEndRange;
+                }
+            }
+        }
+
+        if (Valid == false)
+        {
+            memset(MM_AppData.MemRangeCount, 0, sizeof(MM_AppData.MemRangeCount));
+        }
+
+        MM_AppData.MemRangeMapValid = Valid;
+
+        OS_MutSemGive(MM_AppData.MemRangeMutex);
+    }
+
+    MM_AppData.HkPacket.Payload.MemRangeEntries =
+        MM_AppData.MemRangeCount[MM_MEM_RANGE_RAM] + MM_AppData.MemRangeCount[MM_MEM_RANGE_EEPROM];
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Validate a memory range                                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 MM_MemRangeValidate(cpuaddr Address, size_t Size, uint32 MemoryType, uint32 *RangeNum)
+{
+    int32                     PSP_Status = CFE_PSP_INVALID_MEM_RANGE;
+    bool                      Checked    = false;
+    uint32                    MapType    = MM_MEM_RANGE_TYPES;
+    uint32                    Low;
+    uint32                    High;
+    uint32                    Mid;
+    cpuaddr                   LastAddr = Address + Size - 1;
+    const MM_MemRangeEntry_t *Map;
+
+    *RangeNum = MM_MEM_RANGE_UNKNOWN;
+
+    if (MemoryType == CFE_PSP_MEM_RAM)
+    {
+        MapType = MM_MEM_RANGE_RAM;
+    }
+    else if (MemoryType == CFE_PSP_MEM_EEPROM)
+    {
+        MapType = MM_MEM_RANGE_EEPROM;
+    }
+
+    if (OS_ObjectIdDefined(MM_AppData.MemRangeMutex) && (MapType < MM_MEM_RANGE_TYPES))
+    {
+        OS_MutSemTake(MM_AppData.MemRangeMutex);
+
+        if (MM_AppData.MemRangeMapValid == true)
+        {
+            Checked = true;
+            Map     = MM_AppData.MemRangeMap[MapType];
+
+            /* Find the first entry that starts above the address */
+            Low  = 0;
+            High = MM_AppData.MemRangeCount[MapType];
+            while (Low < High)
+            {
+                Mid = Low + ((High - Low) / 2);
+                if (Map[Mid].StartAddr <= Address)
+                {
+                    Low = Mid + 1;
+                }
+                else
+                {
+                    High = Mid;
+                }
+            }
+
+            if ((Low > 0) && (Size != 0) && (LastAddr >= Address) && (Map[Low - 1].MaxEndAddr >= LastAddr))
+            {
+                PSP_Status = CFE_PSP_SUCCESS;
+                *RangeNum  = Map[Low - 1].MaxEndRange;
+            }
+        }
+
+        OS_MutSemGive(MM_AppData.MemRangeMutex);
+    }
+
+    if (Checked == false)
+    {
+        PSP_Status = CFE_PSP_MemValidateRange(Address, Size, MemoryType);
+    }
+
+    return PSP_Status;
+}
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Compute the CRC of data in a file                               */
@@ -551,17 +1253,19 @@ bool MM_ResolveSymAddr(MM_SymAddr_t *SymAddr, cpuaddr *ResolvedAddr)
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 int32 MM_ComputeCRCFromFile(osal_id_t FileHandle, uint32 *CrcPtr, uint32 TypeCRC)
 {
-    int32        ByteCntr;
-    int32        OS_Status = OS_SUCCESS;
-    uint32       TempCrc   = 0;
-    static uint8 DataArray[FILE_CRC_BUFFER_SIZE];
+    int32  ByteCntr;
+    int32  OS_Status = OS_SUCCESS;
+    uint32 TempCrc   = 0;
+    uint8 *ioBuffer  = (uint8 *)&MM_AppData.IoBuffer[0];
+
+    CFE_ES_PerfLogEntry(MM_FILE_CRC_PERF_ID);
 
     do
     {
         /*
         ** Read in some data
         */
-        ByteCntr = OS_read(FileHandle, DataArray, sizeof(DataArray));
+        ByteCntr = OS_read(FileHandle, ioBuffer, MM_IO_BUFFER_SIZE);
 
         /*
         ** If we didn't hit end of file on the last read...
@@ -571,7 +1275,7 @@ int32 MM_ComputeCRCFromFile(osal_id_t FileHandle, uint32 *CrcPtr, uint32 TypeCRC
             /*
             ** Calculate the CRC based upon the previous CRC calculation
             */
-            TempCrc = CFE_ES_CalculateCRC(DataArray, ByteCntr, TempCrc, TypeCRC);
+            TempCrc = MM_CalculateCRC(ioBuffer, ByteCntr, TempCrc, TypeCRC);
         }
 
     } while (ByteCntr > 0);
@@ -589,5 +1293,100 @@ int32 MM_ComputeCRCFromFile(osal_id_t FileHandle, uint32 *CrcPtr, uint32 TypeCRC
         *CrcPtr = TempCrc;
     }
 
+    CFE_ES_PerfLogExit(MM_FILE_CRC_PERF_ID);
+
     return OS_Status;
 }
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Read a block of memory with the width its memory type requires  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_ReadMemBlock(cpuaddr SrcAddress, MM_MemType_t MemType, void *Buffer, size_t NumOfBytes)
+{
+    bool                      Valid  = false;
+    const MM_MemTypeDriver_t *Driver = MM_MemTypeGet(MemType);
+
+    /*
+    ** A bad MemType is caught by MM_VerifyLoadDumpParams
+    ** before we get here
+    */
+    if (Driver != NULL)
+    {
+        Valid = Driver->Read(SrcAddress, Buffer, NumOfBytes);
+    }
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Write a block of memory with the width its memory type requires */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_WriteMemBlock(cpuaddr DestAddress, MM_MemType_t MemType, const void *Buffer, size_t NumOfBytes)
+{
+    bool                      Valid  = false;
+    const MM_MemTypeDriver_t *Driver = MM_MemTypeGet(MemType);
+
+    /*
+    ** A bad MemType is caught by MM_VerifyLoadDumpParams
+    ** before we get here
+    */
+    if (Driver != NULL)
+    {
+        Valid = Driver->Write(DestAddress, Buffer, NumOfBytes);
+    }
+
+    return Valid;
+}
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compute the CRC of a memory range as part of a segmented        */
+/* operation                                                       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool MM_ComputeMemCRC(cpuaddr Address, MM_MemType_t MemType, size_t NumOfBytes, uint32 *CrcPtr, uint32 TypeCRC)
+{
+    uint32                    TempCrc        = 0;
+    size_t                    BytesRemaining = NumOfBytes;
+    size_t                    SegmentSize    = MM_AppData.SegmentSize[MM_AppData.SegmentType];
+    uint8 *                   ioBuffer       = (uint8 *)&MM_AppData.IoBuffer[0];
+    const MM_MemTypeDriver_t *Driver         = MM_MemTypeGet(MemType);
+    bool                      Valid          = (Driver != NULL);
+
+    while (Valid && (BytesRemaining != 0))
+    {
+        if (BytesRemaining < SegmentSize)
+        {
+            SegmentSize = BytesRemaining;
+        }
+
+        CFE_ES_PerfLogEntry(MM_SEGCOPY_PERF_ID);
+        Valid = Driver->Read(Address, ioBuffer, SegmentSize);
+        CFE_ES_PerfLogExit(MM_SEGCOPY_PERF_ID);
+
+        if (Valid)
+        {
+            TempCrc = MM_CalculateCRC(ioBuffer, SegmentSize, TempCrc, TypeCRC);
+
+            Address += SegmentSize;
+            BytesRemaining -= SegmentSize;
+
+            /* Prevent CPU hogging between segments */
+            if (BytesRemaining != 0)
+            {
+                SegmentSize = MM_SegmentBreak(SegmentSize);
+            }
+        }
+    }
+
+    if (Valid)
+    {
+        *CrcPtr = TempCrc;
+    }
+
+    return Valid;
+}
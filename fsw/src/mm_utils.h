@@ -47,6 +47,64 @@
  */
 void MM_ResetHk(void);
 
+/**
+ * \brief Maximum segment size
+ *
+ *  \par Description
+ *       Returns the configuration table maximum segment size of a load,
+ *       dump, fill or copy operation. A copy uses the load limits.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       An unknown type is treated as #MM_SEG_FILL. The size never
+ *       exceeds the compile time maximum, which is the size of the
+ *       i/o buffer.
+ *
+ *  \param [in] SegmentType  Segmented operation type, #MM_SEG_LOAD,
+ *                            #MM_SEG_DUMP, #MM_SEG_FILL or #MM_SEG_COPY
+ *
+ *  \return Maximum segment size in bytes
+ */
+size_t MM_SegmentMaxSize(uint8 SegmentType);
+
+/**
+ * \brief Segmented operation start
+ *
+ *  \par Description
+ *       This routine gets called before the first segment of a load,
+ *       dump, or memory fill operation. It records the start time of
+ *       the operation and returns the size of its first segment.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The segment size carries over from the previous operation of
+ *       the same type when adaptive sizing is enabled.
+ *
+ *  \param [in] SegmentType  Segmented operation type, #MM_SEG_LOAD,
+ *                            #MM_SEG_DUMP, #MM_SEG_FILL or #MM_SEG_COPY
+ *
+ *  \return Size of the first segment in bytes
+ */
+size_t MM_SegmentStart(uint8 SegmentType);
+
+/**
+ * \brief Adapt the segment size
+ *
+ *  \par Description
+ *       Grows or shrinks the segment size of the operation in progress
+ *       so a segment takes about the configured segment time budget,
+ *       based on how long the segment just completed took.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The new size is moved half way towards the ideal size, grows
+ *       at most by a factor of two and is kept a multiple of
+ *       #MM_MIN_DATA_SEG no larger than #MM_SegmentMaxSize. Partial
+ *       segments are ignored.
+ *
+ *  \param [in] SegmentSize  Number of bytes processed in the segment
+ *                            just completed
+ *  \param [in] ElapsedUsec  Microseconds the segment took
+ */
+void MM_SegmentAdapt(size_t SegmentSize, int64 ElapsedUsec);
+
 /**
  * \brief Segment break
  *
@@ -56,9 +114,135 @@ void MM_ResetHk(void);
  *       that needs to be done during those breaks
  *
  *  \par Assumptions, External Events, and Notes:
+ *       When the operation runs on the child task and a wakeup byte
+ *       budget is configured, the processed bytes are charged against
+ *       the budget of the current scheduler wakeup and the routine only
+ *       blocks once that budget is used up, until the next #MM_WAKEUP_MID
+ *       arrives or #MM_WAKEUP_TIMEOUT expires. Otherwise the routine
+ *       delays for the configured processor cycle. The wakeup count is
+ *       read under the child mutex, see #MM_ChildLock.
+ *
+ *       When the operation runs on the main task the command pipe is
+ *       polled first, see #MM_SegmentPollCmds.
+ *
+ *       The segment is timed from the previous break, or from
+ *       #MM_SegmentStart, to adapt the segment size and update the
+ *       achieved throughput.
+ *
+ *  \param [in] SegmentSize  Number of bytes processed in the segment
+ *                            just completed
+ *
+ *  \return Size of the next segment in bytes
+ */
+size_t MM_SegmentBreak(size_t SegmentSize);
+
+/**
+ * \brief Poll the command pipe during a segment break
+ *
+ *  \par Description
+ *       Called by #MM_SegmentBreak when a load, dump or fill runs on the
+ *       main task. Reads the messages waiting on the command pipe
+ *       without blocking, answers housekeeping requests and scheduler
+ *       wakeups right away and holds every other command with
+ *       #MM_DeferCmd until the operation completes.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       At most #MM_CMD_PIPE_DEPTH messages are read per break so a
+ *       steady stream of messages can't stall the operation.
+ */
+void MM_SegmentPollCmds(void);
+
+/**
+ * \brief Segmented operation file i/o start
+ *
+ *  \par Description
+ *       Called right before a load or dump operation reads or writes
+ *       its file, so the time spent in file i/o can be reported in the
+ *       statistics telemetry.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Each call is followed by a call to #MM_SegmentIoEnd.
+ */
+void MM_SegmentIoStart(void);
+
+/**
+ * \brief Segmented operation file i/o end
+ *
+ *  \par Description
+ *       Called right after a load or dump operation reads or writes its
+ *       file. Adds the time since #MM_SegmentIoStart to the file i/o
+ *       time of the operation in progress.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ */
+void MM_SegmentIoEnd(void);
+
+/**
+ * \brief Segmented operation end
+ *
+ *  \par Description
+ *       Called when a load, dump, or memory fill operation completes
+ *       successfully. Updates the achieved throughput and the statistics
+ *       telemetry of the operation type with its duration, segment count
+ *       and the time spent in segment breaks, file i/o and memory access.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The memory access time is what remains of the duration after
+ *       the segment break and file i/o times, so it includes the
+ *       processing around the copy. The statistics are updated under
+ *       the child task mutex.
+ *
+ *  \param [in] BytesProcessed  Number of bytes the operation processed
+ */
+void MM_SegmentEnd(size_t BytesProcessed);
+
+/**
+ * \brief Multi-region segmented operation start
+ *
+ *  \par Description
+ *       Called before the first region of a multi-region load or dump.
+ *       Starts a segmented operation like #MM_SegmentStart, then makes
+ *       the #MM_SegmentStart and #MM_SegmentEnd calls of each region
+ *       continue that operation instead of starting and recording one
+ *       of their own.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Each call is followed by a call to #MM_SegmentMultiEnd, whether
+ *       or not the regions complete.
+ *
+ *  \param [in] SegmentType  Segmented operation type, #MM_SEG_LOAD or
+ *                            #MM_SEG_DUMP
+ */
+void MM_SegmentMultiStart(uint8 SegmentType);
+
+/**
+ * \brief Multi-region segmented operation end
+ *
+ *  \par Description
+ *       Called after the last region of a multi-region load or dump.
+ *       Ends the multi-region operation and, if every region completed,
+ *       records it once with #MM_SegmentEnd.
+ *
+ *  \par Assumptions, External Events, and Notes:
  *       None
+ *
+ *  \param [in] Completed       true if every region completed
+ *  \param [in] BytesProcessed  Number of bytes of all the regions
+ */
+void MM_SegmentMultiEnd(bool Completed, size_t BytesProcessed);
+
+/**
+ * \brief Reset statistics
+ *
+ *  \par Description
+ *       Clears the load, dump, fill, copy and CRC statistics telemetry.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Holds the child task mutex, so an operation the child task
+ *       completes meanwhile is recorded before or after the reset.
  */
-void MM_SegmentBreak(void);
+void MM_ResetStats(void);
 
 /**
  * \brief Verify command message length
@@ -132,6 +316,27 @@ bool MM_VerifyPeekPokeParams(cpuaddr Address, MM_MemType_t MemType, size_t SizeI
  */
 bool MM_VerifyLoadDumpParams(cpuaddr Address, MM_MemType_t MemType, size_t SizeInBytes, uint8 VerifyType);
 
+/**
+ * \brief Verify a load or dump file data encoding
+ *
+ *  \par Description
+ *       This routine will check that the file data encoding is known
+ *       and supported for the memory type of the load or dump.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Encoded data is only supported for the RAM and EEPROM memory
+ *       types, the optional memory types need width specific access.
+ *
+ *  \param [in]   Encoding     File data encoding, see \ref MMFileEncodings
+ *  \param [in]   MemType      The source or destination memory type for
+ *                             the requested load or dump operation
+ *
+ *  \return Boolean encoding validation status
+ *  \retval true  Validation passed
+ *  \retval false Validation failed
+ */
+bool MM_VerifyFileEncoding(uint8 Encoding, MM_MemType_t MemType);
+
 /**
  * \brief Verify 32 bit alignment
  *
@@ -220,8 +425,229 @@ bool MM_ResolveSymAddr(MM_SymAddr_t *SymAddr, cpuaddr *ResolvedAddr);
  *  \return Execution status, see \ref OSReturnCodes
  *  \retval #OS_SUCCESS \copybrief OS_SUCCESS
  *
- *  \sa #CFE_ES_CalculateCRC, #OS_read
+ *  \sa #MM_CalculateCRC, #OS_read
  */
 int32 MM_ComputeCRCFromFile(osal_id_t FileHandle, uint32 *CrcPtr, uint32 TypeCRC);
 
+/**
+ * \brief Read a block of memory
+ *
+ *  \par Description
+ *       Copies a block of memory of any memory type into a buffer,
+ *       using only the access width the memory type allows.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The address, size and memory type have been checked with
+ *       #MM_VerifyLoadDumpParams. The buffer must be 32 bit aligned.
+ *       A PSP read error is reported by the memory type routine.
+ *
+ *  \param [in]  SrcAddress  Address of the memory to read
+ *  \param [in]  MemType     Memory type of the memory to read
+ *  \param [out] Buffer      Buffer receiving the memory contents
+ *  \param [in]  NumOfBytes  Number of bytes to read
+ *
+ *  \return Boolean execution status
+ *  \retval true  Read successful
+ *  \retval false Read failed or the memory type is not supported
+ */
+bool MM_ReadMemBlock(cpuaddr SrcAddress, MM_MemType_t MemType, void *Buffer, size_t NumOfBytes);
+
+/**
+ * \brief Write a block of memory
+ *
+ *  \par Description
+ *       Copies a buffer into a block of memory of any memory type,
+ *       using only the access width the memory type allows.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The address, size and memory type have been checked with
+ *       #MM_VerifyLoadDumpParams. The buffer must be 32 bit aligned.
+ *       A PSP write error is reported by the memory type routine.
+ *
+ *  \param [in] DestAddress  Address of the memory to write
+ *  \param [in] MemType      Memory type of the memory to write
+ *  \param [in] Buffer       Buffer holding the new memory contents
+ *  \param [in] NumOfBytes   Number of bytes to write
+ *
+ *  \return Boolean execution status
+ *  \retval true  Write successful
+ *  \retval false Write failed or the memory type is not supported
+ */
+bool MM_WriteMemBlock(cpuaddr DestAddress, MM_MemType_t MemType, const void *Buffer, size_t NumOfBytes);
+
+/**
+ * \brief Compute CRC of a memory range
+ *
+ *  \par Description
+ *       Computes the cyclic redundancy check (CRC) value of a memory
+ *       range of any memory type, reading it through the i/o buffer a
+ *       segment at a time.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Runs as part of the segmented operation in progress, started
+ *       with #MM_SegmentStart, and takes a segment break between its
+ *       segments. The range has been checked with #MM_VerifyLoadDumpParams.
+ *
+ *  \param [in]  Address     Address of the memory range
+ *  \param [in]  MemType     Memory type of the memory range
+ *  \param [in]  NumOfBytes  Number of bytes in the memory range
+ *  \param [out] CrcPtr      The computed CRC. Only updated if the
+ *                            return value is true
+ *  \param [in]  TypeCRC     CRC type to compute
+ *
+ *  \return Boolean execution status
+ *  \retval true  CRC computed
+ *  \retval false A memory read failed
+ *
+ *  \sa #MM_CalculateCRC, #MM_ReadMemBlock
+ */
+bool MM_ComputeMemCRC(cpuaddr Address, MM_MemType_t MemType, size_t NumOfBytes, uint32 *CrcPtr, uint32 TypeCRC);
+
+/**
+ * \brief Create the symbol cache
+ *
+ *  \par Description
+ *       Clears the symbol cache and creates the mutex that serializes
+ *       its use by the main task and the child task.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called during application initialization, before the child
+ *       task is created. If the mutex can't be created the cache is
+ *       not used and every symbol is looked up in the OSAL symbol table.
+ */
+void MM_SymCacheInit(void);
+
+/**
+ * \brief Symbol cache index of a symbol name
+ *
+ *  \par Description
+ *       Hashes a symbol name to the index of the only symbol cache
+ *       entry that can hold it.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in] SymName Pointer to the symbol name
+ *
+ *  \return Symbol cache index, less than #MM_SYM_CACHE_ENTRIES
+ */
+uint32 MM_SymCacheHash(const char *SymName);
+
+/**
+ * \brief Look up a symbol in the symbol cache
+ *
+ *  \par Description
+ *       Support function for #MM_ResolveSymAddr. Returns the address a
+ *       symbol was resolved to before, and counts the symbol cache hit
+ *       or miss in housekeeping telemetry.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The cache generation returned in Generation is passed to
+ *       #MM_SymCacheAdd after a miss, so that a symbol looked up while
+ *       the cache is flushed isn't added back.
+ *
+ *  \param [in]  SymName    Pointer to the non-empty symbol name
+ *  \param [out] Address    The cached symbol address. Only valid if the
+ *                          return value is true
+ *  \param [out] Generation The symbol cache generation
+ *
+ *  \return Boolean lookup status
+ *  \retval true  Symbol found in the cache
+ *  \retval false Symbol must be looked up in the OSAL symbol table
+ */
+bool MM_SymCacheLookup(const char *SymName, cpuaddr *Address, uint32 *Generation);
+
+/**
+ * \brief Add a resolved symbol to the symbol cache
+ *
+ *  \par Description
+ *       Support function for #MM_ResolveSymAddr. Remembers the address
+ *       the OSAL resolved a symbol to, replacing any other symbol held
+ *       by the same cache entry.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Nothing is added if the cache was flushed since the lookup
+ *       that returned Generation.
+ *
+ *  \param [in] SymName    Pointer to the symbol name
+ *  \param [in] Address    Address of the symbol
+ *  \param [in] Generation Symbol cache generation returned by
+ *                         #MM_SymCacheLookup
+ */
+void MM_SymCacheAdd(const char *SymName, cpuaddr Address, uint32 Generation);
+
+/**
+ * \brief Discard every symbol in the symbol cache
+ *
+ *  \par Description
+ *       Empties the symbol cache so that every symbol is looked up in
+ *       the OSAL symbol table again.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       The hit and miss counters are not changed.
+ *
+ *  \sa #MM_SYM_CACHE_FLUSH_CC
+ */
+void MM_SymCacheFlush(void);
+
+/**
+ * \brief Create the valid memory range map
+ *
+ *  \par Description
+ *       Creates the mutex that serializes use of the valid memory range
+ *       map by the main task and the child task, then builds the map
+ *       from the PSP memory table.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Called during application initialization, before the child
+ *       task is created. If the mutex can't be created the map is not
+ *       used and every address is checked against the PSP memory table.
+ */
+void MM_MemRangeInit(void);
+
+/**
+ * \brief Build the valid memory range map
+ *
+ *  \par Description
+ *       Copies the RAM and EEPROM ranges of the PSP memory table into a
+ *       map per memory type, sorted by start address, and sets
+ *       #MM_HkPacket_Payload_t.MemRangeEntries.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       Ranges of other memory types are left out. If a range can't be
+ *       read or a map is full the map is not used until it is built
+ *       again, so addresses are checked against the PSP memory table.
+ *
+ *  \return Boolean execution status
+ *  \retval true  Map built
+ *  \retval false Map not built, the PSP memory table is used
+ *
+ *  \sa #MM_MEM_RANGE_REFRESH_CC
+ */
+bool MM_MemRangeRefresh(void);
+
+/**
+ * \brief Validate a memory range
+ *
+ *  \par Description
+ *       Checks that an address range lies entirely within one PSP memory
+ *       range of a memory type, using a binary search of the valid
+ *       memory range map. Replaces #CFE_PSP_MemValidateRange, which it
+ *       calls instead when the map isn't built.
+ *
+ *  \par Assumptions, External Events, and Notes:
+ *       None
+ *
+ *  \param [in]  Address     First address of the range
+ *  \param [in]  Size        Range size in bytes
+ *  \param [in]  MemoryType  #CFE_PSP_MEM_RAM or #CFE_PSP_MEM_EEPROM
+ *  \param [out] RangeNum    PSP memory table index of the range that
+ *                            holds the address, #MM_MEM_RANGE_UNKNOWN
+ *                            if the PSP memory table was checked
+ *
+ *  \return #CFE_PSP_SUCCESS if the range is valid, otherwise a PSP
+ *          error code such as #CFE_PSP_INVALID_MEM_RANGE
+ */
+int32 MM_MemRangeValidate(cpuaddr Address, size_t Size, uint32 MemoryType, uint32 *RangeNum);
+
 #endif
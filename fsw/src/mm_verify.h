@@ -155,6 +155,114 @@
 #error MM_MAX_FILL_DATA_SEG should be longword aligned
 #endif
 
+/*
+ * Shared i/o buffer size
+ */
+#if (MM_IO_BUFFER_SIZE % 4) != 0
+#error MM_IO_BUFFER_SIZE should be longword aligned
+#endif
+
+#if MM_IO_BUFFER_SIZE < MM_MAX_LOAD_DATA_SEG
+#error MM_IO_BUFFER_SIZE cannot be less than MM_MAX_LOAD_DATA_SEG
+#endif
+
+#if MM_IO_BUFFER_SIZE < MM_MAX_DUMP_DATA_SEG
+#error MM_IO_BUFFER_SIZE cannot be less than MM_MAX_DUMP_DATA_SEG
+#endif
+
+#if MM_IO_BUFFER_SIZE < MM_MAX_FILL_DATA_SEG
+#error MM_IO_BUFFER_SIZE cannot be less than MM_MAX_FILL_DATA_SEG
+#endif
+
+#if MM_IO_BUFFER_SIZE < 256
+#error MM_IO_BUFFER_SIZE cannot be less than 256
+#endif
+
+/*
+ * Delta dump block size
+ */
+#if MM_DELTA_BLOCK_SIZE < 4
+#error MM_DELTA_BLOCK_SIZE cannot be less than 4
+#endif
+
+#if (MM_DELTA_BLOCK_SIZE % 4) != 0
+#error MM_DELTA_BLOCK_SIZE should be longword aligned
+#endif
+
+#if (2 * MM_DELTA_BLOCK_SIZE) > MM_IO_BUFFER_SIZE
+#error MM_DELTA_BLOCK_SIZE cannot be more than half of MM_IO_BUFFER_SIZE
+#endif
+
+/*
+ * Segment pacing
+ */
+#if MM_PROCESSOR_CYCLE > MM_MAX_PROCESSOR_CYCLE
+#error MM_PROCESSOR_CYCLE cannot be larger than MM_MAX_PROCESSOR_CYCLE
+#endif
+
+#if MM_SEGMENT_TIME_BUDGET > MM_MAX_SEGMENT_TIME_BUDGET
+#error MM_SEGMENT_TIME_BUDGET cannot be larger than MM_MAX_SEGMENT_TIME_BUDGET
+#endif
+
+#if (MM_WAKEUP_BYTE_BUDGET != 0) &&                                                                      \
+    ((MM_WAKEUP_BYTE_BUDGET < MM_MAX_LOAD_DATA_SEG) || (MM_WAKEUP_BYTE_BUDGET < MM_MAX_DUMP_DATA_SEG) || \
+     (MM_WAKEUP_BYTE_BUDGET < MM_MAX_FILL_DATA_SEG))
+#error MM_WAKEUP_BYTE_BUDGET cannot be smaller than the largest segment size
+#endif
+
+/*
+ * Load staging pool
+ */
+#if MM_MAX_STAGED_LOAD > MM_LOAD_STAGING_POOL_SIZE
+#error MM_MAX_STAGED_LOAD cannot be larger than MM_LOAD_STAGING_POOL_SIZE
+#endif
+
+#if MM_DEFERRED_CMD_DEPTH < 1
+#error MM_DEFERRED_CMD_DEPTH cannot be less than 1
+#elif MM_DEFERRED_CMD_DEPTH > 255
+#error MM_DEFERRED_CMD_DEPTH cannot be greater than 255
+#endif
+
+#if MM_LOAD_CACHE_ENTRIES < 1
+#error MM_LOAD_CACHE_ENTRIES cannot be less than 1
+#elif MM_LOAD_CACHE_ENTRIES > 255
+#error MM_LOAD_CACHE_ENTRIES cannot be greater than 255
+#endif
+
+#if MM_SYM_CACHE_ENTRIES < 1
+#error MM_SYM_CACHE_ENTRIES cannot be less than 1
+#elif MM_SYM_CACHE_ENTRIES > 1024
+#error MM_SYM_CACHE_ENTRIES cannot be greater than 1024
+#elif (MM_SYM_CACHE_ENTRIES & (MM_SYM_CACHE_ENTRIES - 1)) != 0
+#error MM_SYM_CACHE_ENTRIES must be a power of two
+#endif
+
+#if MM_MAX_SYM_LOOKUP_RECORDS < 1
+#error MM_MAX_SYM_LOOKUP_RECORDS cannot be less than 1
+#elif MM_MAX_SYM_LOOKUP_RECORDS > 65535
+#error MM_MAX_SYM_LOOKUP_RECORDS cannot be greater than 65535
+#endif
+
+#if MM_SYM_INDEX_ENTRIES < 1
+#error MM_SYM_INDEX_ENTRIES cannot be less than 1
+#elif MM_SYM_INDEX_ENTRIES > 65536
+#error MM_SYM_INDEX_ENTRIES cannot be greater than 65536
+#endif
+
+#if MM_SYM_INDEX_NAME_POOL_SIZE < OS_MAX_SYM_LEN
+#error MM_SYM_INDEX_NAME_POOL_SIZE cannot be less than OS_MAX_SYM_LEN
+#endif
+
+#if MM_SYM_INDEX_MAX_OFFSET < 1
+#error MM_SYM_INDEX_MAX_OFFSET cannot be less than 1
+#endif
+
+#if MM_MEM_RANGE_MAP_ENTRIES < 1
+#error MM_MEM_RANGE_MAP_ENTRIES cannot be less than 1
+#elif MM_MEM_RANGE_MAP_ENTRIES > 256
+#error MM_MEM_RANGE_MAP_ENTRIES cannot be greater than 256
+#endif
+
 /*
  * Optional MEM32 Configurable Parameters
  */
@@ -255,4 +363,53 @@
 #error MM_DUMP_FILE_CRC_TYPE must be a type supported by CFE_ES_CalculateCRC
 #endif
 
+/*
+ * Multi-region files
+ */
+#if MM_MAX_FILE_REGIONS < 1
+#error MM_MAX_FILE_REGIONS cannot be less than 1
+#elif MM_MAX_FILE_REGIONS > 255
+#error MM_MAX_FILE_REGIONS cannot be greater than 255
+#endif
+
+/*
+ * Child task configuration
+ */
+#if MM_CHILD_TASK_STACK_SIZE < 1
+#error MM_CHILD_TASK_STACK_SIZE cannot be less than 1
+#endif
+
+#if MM_CHILD_TASK_PRIORITY < 1
+#error MM_CHILD_TASK_PRIORITY cannot be less than 1
+#elif MM_CHILD_TASK_PRIORITY > 255
+#error MM_CHILD_TASK_PRIORITY cannot be greater than 255
+#endif
+
+/*
+ * Scheduler wakeup pacing
+ */
+#if MM_WAKEUP_BYTE_BUDGET > UINT32_MAX
+#error MM_WAKEUP_BYTE_BUDGET cannot exceed the uint32 maximum value
+#endif
+
+#if MM_WAKEUP_TIMEOUT < 1
+#error MM_WAKEUP_TIMEOUT cannot be less than 1
+#endif
+
+/*
+ * Adaptive segment sizing
+ */
+#if MM_SEGMENT_TIME_BUDGET > UINT32_MAX
+#error MM_SEGMENT_TIME_BUDGET cannot exceed the uint32 maximum value
+#endif
+
+/*
+ * Memory type driver table, which must hold the built-in types up to MM_MEM32 (5)
+ */
+#if MM_MAX_MEM_TYPES < 6
+#error MM_MAX_MEM_TYPES cannot be less than 6
+#elif MM_MAX_MEM_TYPES > 256
+#error MM_MAX_MEM_TYPES cannot be greater than 256
+#endif
+
 #endif
@@ -0,0 +1,65 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Default contents of the CFS Memory Manager configuration table
+ */
+
+/*************************************************************************
+** Includes
+*************************************************************************/
+#include "cfe.h"
+#include "cfe_tbl_filedef.h"
+#include "mm_platform_cfg.h"
+#include "mm_tbldefs.h"
+
+/*
+** Configuration table, the compile time values are the upper bounds
+*/
+MM_ConfigTbl_t MM_ConfigTbl = {
+    .Ram    = {.MaxLoadFileData = MM_MAX_LOAD_FILE_DATA_RAM,
+               .MaxDumpFileData = MM_MAX_DUMP_FILE_DATA_RAM,
+               .MaxFillData     = MM_MAX_FILL_DATA_RAM},
+    .Eeprom = {.MaxLoadFileData = MM_MAX_LOAD_FILE_DATA_EEPROM,
+               .MaxDumpFileData = MM_MAX_DUMP_FILE_DATA_EEPROM,
+               .MaxFillData     = MM_MAX_FILL_DATA_EEPROM},
+    .Mem32  = {.MaxLoadFileData = MM_MAX_LOAD_FILE_DATA_MEM32,
+               .MaxDumpFileData = MM_MAX_DUMP_FILE_DATA_MEM32,
+               .MaxFillData     = MM_MAX_FILL_DATA_MEM32},
+    .Mem16  = {.MaxLoadFileData = MM_MAX_LOAD_FILE_DATA_MEM16,
+               .MaxDumpFileData = MM_MAX_DUMP_FILE_DATA_MEM16,
+               .MaxFillData     = MM_MAX_FILL_DATA_MEM16},
+    .Mem8   = {.MaxLoadFileData = MM_MAX_LOAD_FILE_DATA_MEM8,
+               .MaxDumpFileData = MM_MAX_DUMP_FILE_DATA_MEM8,
+               .MaxFillData     = MM_MAX_FILL_DATA_MEM8},
+
+    .LoadDataSeg       = MM_MAX_LOAD_DATA_SEG,
+    .DumpDataSeg       = MM_MAX_DUMP_DATA_SEG,
+    .FillDataSeg       = MM_MAX_FILL_DATA_SEG,
+    .ProcessorCycle    = MM_PROCESSOR_CYCLE,
+    .SegmentTimeBudget = MM_SEGMENT_TIME_BUDGET,
+    .WakeupByteBudget  = MM_WAKEUP_BYTE_BUDGET,
+    .MaxStagedLoad     = MM_MAX_STAGED_LOAD,
+};
+
+/*
+** Table file header
+*/
+CFE_TBL_FILEDEF(MM_ConfigTbl, MM.ConfigTbl, MM Configuration Table, mm_config.tbl)
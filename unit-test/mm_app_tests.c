@@ -29,11 +29,15 @@
 #include "mm_msg.h"
 #include "mm_load.h"
 #include "mm_dump.h"
+#include "mm_child.h"
 #include "mm_msgdefs.h"
 #include "mm_msgids.h"
 #include "mm_events.h"
 #include "mm_version.h"
 #include "mm_utils.h"
+#include "mm_crc.h"
+#include "mm_symidx.h"
+#include "mm_tbl.h"
 #include "mm_test_utils.h"
 
 /************************************************************************
@@ -61,6 +65,18 @@ CFE_Status_t MM_APP_TEST_CFE_SB_RcvMsgHook(void *UserObj, int32 StubRetcode, uin
     return CFE_SUCCESS;
 }
 
+int32 MM_APP_TEST_MM_SymIndexLookupHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                        const UT_StubContext_t *Context)
+{
+    const char **SymName = UT_Hook_GetArgValueByName(Context, "SymName", const char **);
+    cpuaddr *    Offset  = UT_Hook_GetArgValueByName(Context, "Offset", cpuaddr *);
+
+    *SymName = "Alpha";
+    *Offset  = 0x10;
+
+    return true;
+}
+
 int32 MM_APP_TEST_CFE_ES_ExitAppHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
                                      const UT_StubContext_t *Context)
 {
@@ -228,6 +244,9 @@ void MM_AppInit_Test_Nominal(void)
      * initialized */
     memset(&MM_AppData, 1, sizeof(MM_AppData));
 
+    /* Segment size limit from the configuration table */
+    UT_SetDefaultReturnValue(UT_KEY(MM_SegmentMaxSize), 100);
+
     /* Execute the function being tested */
     Result = MM_AppInit();
 
@@ -238,6 +257,19 @@ void MM_AppInit_Test_Nominal(void)
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 
+    UtAssert_STUB_COUNT(MM_TableInit, 1);
+    UtAssert_UINT32_EQ(MM_AppData.SegmentSize[MM_SEG_LOAD], 100);
+    UtAssert_UINT32_EQ(MM_AppData.SegmentSize[MM_SEG_DUMP], 100);
+    UtAssert_UINT32_EQ(MM_AppData.SegmentSize[MM_SEG_FILL], 100);
+
+    UtAssert_STUB_COUNT(MM_ChildInit, 1);
+    UtAssert_STUB_COUNT(MM_CrcInit, 1);
+    UtAssert_STUB_COUNT(MM_SymCacheInit, 1);
+    UtAssert_STUB_COUNT(MM_MemRangeInit, 1);
+    UtAssert_STUB_COUNT(MM_MemTypeInit, 1);
+    UtAssert_STUB_COUNT(MM_LoadCacheInit, 1);
+    UtAssert_STUB_COUNT(MM_ResetStats, 1);
+
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_INIT_INF_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
 
@@ -251,6 +283,48 @@ void MM_AppInit_Test_Nominal(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void MM_AppInit_Test_ChildInitError(void)
+{
+    CFE_Status_t Result;
+
+    /* A child task failure is not fatal, commands are then processed by the main task */
+    UT_SetDefaultReturnValue(UT_KEY(MM_ChildInit), CFE_ES_ERR_CHILD_TASK_CREATE);
+
+    /* Execute the function being tested */
+    Result = MM_AppInit();
+
+    /* Verify results */
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+    UtAssert_True(MM_AppData.RunStatus == CFE_ES_RunStatus_APP_RUN, "MM_AppData.RunStatus == CFE_ES_RunStatus_APP_RUN");
+
+    UtAssert_STUB_COUNT(MM_ChildInit, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_INIT_INF_EID);
+}
+
+void MM_AppInit_Test_StagingPoolError(void)
+{
+    CFE_Status_t Result;
+
+    /* A staging pool failure is not fatal, load files are then read twice */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_PoolCreate), CFE_ES_BAD_ARGUMENT);
+
+    /* Execute the function being tested */
+    Result = MM_AppInit();
+
+    /* Verify results */
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+    UtAssert_True(MM_AppData.RunStatus == CFE_ES_RunStatus_APP_RUN, "MM_AppData.RunStatus == CFE_ES_RunStatus_APP_RUN");
+    UtAssert_True(CFE_RESOURCEID_TEST_EQUAL(MM_AppData.StagingPoolHandle, CFE_ES_MEMHANDLE_UNDEFINED),
+                  "MM_AppData.StagingPoolHandle == CFE_ES_MEMHANDLE_UNDEFINED");
+
+    UtAssert_STUB_COUNT(MM_ChildInit, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_STAGING_POOL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, MM_INIT_INF_EID);
+}
+
 void MM_AppInit_Test_EVSRegisterError(void)
 {
     CFE_Status_t Result;
@@ -388,6 +462,46 @@ void MM_AppInit_Test_SBSubscribeMMError(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void MM_AppInit_Test_SBSubscribeWakeupError(void)
+{
+    CFE_Status_t Result;
+
+    /* Set to generate event message "Error Subscribing to Wakeup" */
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_Subscribe), 3, -1);
+
+    /* Execute the function being tested */
+    Result = MM_AppInit();
+
+    /* Verify results */
+    UtAssert_True(Result == -1, "Result == -1");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_WAKEUP_SUB_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MM_AppInit_Test_TableInitError(void)
+{
+    CFE_Status_t Result;
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_TableInit), -1);
+
+    /* Execute the function being tested */
+    Result = MM_AppInit();
+
+    /* Verify results, MM_TableInit reports the error itself */
+    UtAssert_True(Result == -1, "Result == -1");
+
+    UtAssert_STUB_COUNT(MM_ChildInit, 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
 void MM_AppPipe_Test_SendHKSuccess(void)
 {
     CFE_SB_MsgId_t TestMsgId = CFE_SB_ValueToMsgId(MM_SEND_HK_MID);
@@ -430,6 +544,52 @@ void MM_AppPipe_Test_SendHKFail(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void MM_AppPipe_Test_WakeupSuccess(void)
+{
+    CFE_SB_MsgId_t TestMsgId = CFE_SB_ValueToMsgId(MM_WAKEUP_MID);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyCmdLength), true);
+
+    MM_AppData.WakeupSemaphore = MM_UT_OBJID_1;
+
+    /* Execute the function being tested */
+    MM_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MM_AppData.WakeupCount, 1);
+    UtAssert_STUB_COUNT(MM_ChildLock, 1);
+    UtAssert_STUB_COUNT(MM_ChildUnlock, 1);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 1);
+
+    /* Wakeups are not commands and are not counted */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MM_AppPipe_Test_WakeupFail(void)
+{
+    CFE_SB_MsgId_t TestMsgId = CFE_SB_ValueToMsgId(MM_WAKEUP_MID);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyCmdLength), false);
+
+    /* Execute the function being tested */
+    MM_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MM_AppData.WakeupCount, 0);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 0);
+}
+
 void MM_AppPipe_Test_NoopSuccess(void)
 {
     CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
@@ -455,6 +615,7 @@ void MM_AppPipe_Test_NoopSuccess(void)
                   "MM_AppData.HkPacket.Payload.LastAction == MM_NOOP");
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 1);
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+    UtAssert_STUB_COUNT(MM_ResetHk, 1);
 
     /* Note: this event message is generated in subfunction MM_NoopCmd.Payload.  It is checked here to verify that the
      * subfunction has been reached. */
@@ -498,6 +659,30 @@ void MM_AppPipe_Test_NoopFail(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void MM_AppPipe_Test_NoopChildBusy(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = MM_NOOP_CC;
+    size_t            MsgSize   = sizeof(UT_CmdBuf.NoArgsCmd);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyCmdLength), true);
+
+    /* The child task is still working on a command */
+    UT_SetDefaultReturnValue(UT_KEY(MM_ChildGetState), MM_CHILD_BUSY);
+
+    /* Execute the function being tested */
+    MM_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MM_ResetHk, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+}
+
 void MM_AppPipe_Test_ResetSuccess(void)
 {
     CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
@@ -512,6 +697,11 @@ void MM_AppPipe_Test_ResetSuccess(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
 
+    MM_AppData.HkPacket.Payload.ChildCmdCounter = 1;
+    MM_AppData.HkPacket.Payload.ChildErrCounter = 1;
+    MM_AppData.HkPacket.Payload.SymCacheHits    = 1;
+    MM_AppData.HkPacket.Payload.SymCacheMisses  = 1;
+
     /* ignore dummy message length check */
     UT_SetDefaultReturnValue(UT_KEY(MM_VerifyCmdLength), true);
 
@@ -523,6 +713,11 @@ void MM_AppPipe_Test_ResetSuccess(void)
                   "MM_AppData.HkPacket.Payload.LastAction == MM_RESET");
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ChildCmdCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ChildErrCounter, 0);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.SymCacheHits, 0);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.SymCacheMisses, 0);
+    UtAssert_STUB_COUNT(MM_ResetStats, 1);
 
     /* Note: this event message is generated in subfunction MM_ResetCmd.Payload.  It is checked here to verify that the
      * subfunction has been reached. */
@@ -604,6 +799,27 @@ void MM_AppPipe_Test_PeekFail(void)
     UtAssert_STUB_COUNT(MM_PeekCmd, 0);
 }
 
+void MM_AppPipe_Test_PeekChildBusy(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = MM_PEEK_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ChildVerifyIdle), false);
+
+    /* Execute the function being tested */
+    MM_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 1);
+
+    UtAssert_STUB_COUNT(MM_ChildVerifyIdle, 1);
+    UtAssert_STUB_COUNT(MM_PeekCmd, 0);
+}
+
 void MM_AppPipe_Test_PokeSuccess(void)
 {
     CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
@@ -697,7 +913,7 @@ void MM_AppPipe_Test_LoadMemFromFileSuccess(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
 
     UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, true);
-    UT_SetDefaultReturnValue(UT_KEY(MM_LoadMemFromFileCmd), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ChildDispatchCmd), true);
 
     /* Execute the function being tested */
     MM_AppPipe(&UT_CmdBuf.Buf);
@@ -706,7 +922,7 @@ void MM_AppPipe_Test_LoadMemFromFileSuccess(void)
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 1);
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 
-    UtAssert_STUB_COUNT(MM_LoadMemFromFileCmd, 1);
+    UtAssert_STUB_COUNT(MM_ChildDispatchCmd, 1);
 }
 
 void MM_AppPipe_Test_LoadMemFromFileFail(void)
@@ -718,7 +934,7 @@ void MM_AppPipe_Test_LoadMemFromFileFail(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
 
     UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, false);
-    UT_SetDefaultReturnValue(UT_KEY(MM_LoadMemFromFileCmd), false);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ChildDispatchCmd), false);
 
     /* Execute the function being tested */
     MM_AppPipe(&UT_CmdBuf.Buf);
@@ -727,7 +943,7 @@ void MM_AppPipe_Test_LoadMemFromFileFail(void)
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 1);
 
-    UtAssert_STUB_COUNT(MM_LoadMemFromFileCmd, 0);
+    UtAssert_STUB_COUNT(MM_ChildDispatchCmd, 0);
 }
 
 void MM_AppPipe_Test_DumpMemToFileSuccess(void)
@@ -739,7 +955,7 @@ void MM_AppPipe_Test_DumpMemToFileSuccess(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
 
     UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, true);
-    UT_SetDefaultReturnValue(UT_KEY(MM_DumpMemToFileCmd), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ChildDispatchCmd), true);
 
     /* Execute the function being tested */
     MM_AppPipe(&UT_CmdBuf.Buf);
@@ -748,7 +964,7 @@ void MM_AppPipe_Test_DumpMemToFileSuccess(void)
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 1);
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 
-    UtAssert_STUB_COUNT(MM_DumpMemToFileCmd, 1);
+    UtAssert_STUB_COUNT(MM_ChildDispatchCmd, 1);
 }
 
 void MM_AppPipe_Test_DumpMemToFileFail(void)
@@ -760,7 +976,7 @@ void MM_AppPipe_Test_DumpMemToFileFail(void)
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
 
     UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, false);
-    UT_SetDefaultReturnValue(UT_KEY(MM_DumpMemToFileCmd), false);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ChildDispatchCmd), false);
 
     /* Execute the function being tested */
     MM_AppPipe(&UT_CmdBuf.Buf);
@@ -769,19 +985,19 @@ void MM_AppPipe_Test_DumpMemToFileFail(void)
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 1);
 
-    UtAssert_STUB_COUNT(MM_DumpMemToFileCmd, 0);
+    UtAssert_STUB_COUNT(MM_ChildDispatchCmd, 0);
 }
 
-void MM_AppPipe_Test_DumpInEventSuccess(void)
+void MM_AppPipe_Test_DumpMemToFileEncSuccess(void)
 {
     CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
-    CFE_MSG_FcnCode_t FcnCode   = MM_DUMP_IN_EVENT_CC;
+    CFE_MSG_FcnCode_t FcnCode   = MM_DUMP_MEM_TO_FILE_ENC_CC;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
 
     UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, true);
-    UT_SetDefaultReturnValue(UT_KEY(MM_DumpInEventCmd), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ChildDispatchCmd), true);
 
     /* Execute the function being tested */
     MM_AppPipe(&UT_CmdBuf.Buf);
@@ -790,40 +1006,40 @@ void MM_AppPipe_Test_DumpInEventSuccess(void)
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 1);
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 
-    UtAssert_STUB_COUNT(MM_DumpInEventCmd, 1);
+    UtAssert_STUB_COUNT(MM_ChildDispatchCmd, 1);
 }
 
-void MM_AppPipe_Test_DumpInEventFail(void)
+void MM_AppPipe_Test_DumpMemToDeltaFileSuccess(void)
 {
     CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
-    CFE_MSG_FcnCode_t FcnCode   = MM_DUMP_IN_EVENT_CC;
+    CFE_MSG_FcnCode_t FcnCode   = MM_DUMP_MEM_TO_DELTA_FILE_CC;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
 
-    UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, false);
-    UT_SetDefaultReturnValue(UT_KEY(MM_DumpInEventCmd), false);
+    UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ChildDispatchCmd), true);
 
     /* Execute the function being tested */
     MM_AppPipe(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
-    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 1);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 1);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 
-    UtAssert_STUB_COUNT(MM_DumpInEventCmd, 0);
+    UtAssert_STUB_COUNT(MM_ChildDispatchCmd, 1);
 }
 
-void MM_AppPipe_Test_FillMemSuccess(void)
+void MM_AppPipe_Test_LoadMemFromPatchFileSuccess(void)
 {
     CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
-    CFE_MSG_FcnCode_t FcnCode   = MM_FILL_MEM_CC;
+    CFE_MSG_FcnCode_t FcnCode   = MM_LOAD_MEM_FROM_PATCH_FILE_CC;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
 
     UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, true);
-    UT_SetDefaultReturnValue(UT_KEY(MM_FillMemCmd), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ChildDispatchCmd), true);
 
     /* Execute the function being tested */
     MM_AppPipe(&UT_CmdBuf.Buf);
@@ -832,46 +1048,61 @@ void MM_AppPipe_Test_FillMemSuccess(void)
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 1);
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 
-    UtAssert_STUB_COUNT(MM_FillMemCmd, 1);
+    UtAssert_STUB_COUNT(MM_ChildDispatchCmd, 1);
 }
 
-void MM_AppPipe_Test_FillMemFail(void)
+void MM_AppPipe_Test_LoadMemFromMultiFileSuccess(void)
 {
     CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
-    CFE_MSG_FcnCode_t FcnCode   = MM_FILL_MEM_CC;
+    CFE_MSG_FcnCode_t FcnCode   = MM_LOAD_MEM_FROM_MULTI_FILE_CC;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
 
-    UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, false);
-    UT_SetDefaultReturnValue(UT_KEY(MM_FillMemCmd), false);
+    UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ChildDispatchCmd), true);
 
     /* Execute the function being tested */
     MM_AppPipe(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
-    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 1);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 1);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 
-    UtAssert_STUB_COUNT(MM_FillMemCmd, 0);
+    UtAssert_STUB_COUNT(MM_ChildDispatchCmd, 1);
 }
 
-void MM_AppPipe_Test_LookupSymbolSuccess(void)
+void MM_AppPipe_Test_DumpMemToMultiFileSuccess(void)
 {
-    CFE_SB_MsgId_t    TestMsgId    = CFE_SB_ValueToMsgId(MM_CMD_MID);
-    CFE_MSG_FcnCode_t FcnCode      = MM_LOOKUP_SYM_CC;
-    size_t            MsgSize      = sizeof(UT_CmdBuf.LookupSymCmd);
-    cpuaddr           ResolvedAddr = 0;
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = MM_DUMP_MEM_TO_MULTI_FILE_CC;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
 
-    strncpy(UT_CmdBuf.LookupSymCmd.Payload.SymName, "name", sizeof(UT_CmdBuf.LookupSymCmd.Payload.SymName) - 1);
-    UT_SetDataBuffer(UT_KEY(OS_SymbolLookup), &ResolvedAddr, sizeof(ResolvedAddr), false);
+    UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ChildDispatchCmd), true);
 
-    /* ignore dummy message length check */
-    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyCmdLength), true);
+    /* Execute the function being tested */
+    MM_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 1);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+
+    UtAssert_STUB_COUNT(MM_ChildDispatchCmd, 1);
+}
+
+void MM_AppPipe_Test_DumpInEventSuccess(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = MM_DUMP_IN_EVENT_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+
+    UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_DumpInEventCmd), true);
 
     /* Execute the function being tested */
     MM_AppPipe(&UT_CmdBuf.Buf);
@@ -880,25 +1111,19 @@ void MM_AppPipe_Test_LookupSymbolSuccess(void)
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 1);
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 
-    /* Generates 1 event message in subfunction MM_LookupSymbolCmd.Payload.  Event message count = 1 verifies that the
-     * subfunction has been reached. */
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
-                  call_count_CFE_EVS_SendEvent);
+    UtAssert_STUB_COUNT(MM_DumpInEventCmd, 1);
 }
 
-void MM_AppPipe_Test_LookupSymbolFail(void)
+void MM_AppPipe_Test_DumpInEventFail(void)
 {
     CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
-    CFE_MSG_FcnCode_t FcnCode   = MM_LOOKUP_SYM_CC;
-    size_t            MsgSize   = sizeof(UT_CmdBuf.LookupSymCmd);
+    CFE_MSG_FcnCode_t FcnCode   = MM_DUMP_IN_EVENT_CC;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
 
-    /* ignore dummy message length check */
-    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyCmdLength), false);
+    UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, false);
+    UT_SetDefaultReturnValue(UT_KEY(MM_DumpInEventCmd), false);
 
     /* Execute the function being tested */
     MM_AppPipe(&UT_CmdBuf.Buf);
@@ -907,28 +1132,19 @@ void MM_AppPipe_Test_LookupSymbolFail(void)
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 1);
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
-                  call_count_CFE_EVS_SendEvent);
+    UtAssert_STUB_COUNT(MM_DumpInEventCmd, 0);
 }
 
-void MM_AppPipe_Test_SymTblToFileSuccess(void)
+void MM_AppPipe_Test_FillMemSuccess(void)
 {
     CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
-    CFE_MSG_FcnCode_t FcnCode   = MM_SYMTBL_TO_FILE_CC;
-    size_t            MsgSize   = sizeof(UT_CmdBuf.SymTblToFileCmd);
+    CFE_MSG_FcnCode_t FcnCode   = MM_FILL_MEM_CC;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
-
-    strncpy(UT_CmdBuf.SymTblToFileCmd.Payload.FileName, "name", sizeof(UT_CmdBuf.SymTblToFileCmd.Payload.FileName) - 1);
-
-    /* Set to satisfy condition "OS_Status == OS_SUCCESS" */
-    UT_SetDeferredRetcode(UT_KEY(OS_SymbolTableDump), 1, CFE_SUCCESS);
 
-    /* ignore dummy message length check */
-    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyCmdLength), true);
+    UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ChildDispatchCmd), true);
 
     /* Execute the function being tested */
     MM_AppPipe(&UT_CmdBuf.Buf);
@@ -937,25 +1153,19 @@ void MM_AppPipe_Test_SymTblToFileSuccess(void)
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 1);
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 
-    /* Generates 1 event message in subfunction MM_SymTblToFileCmd.Payload.  Event message count = 1 verifies that the
-     * subfunction has been reached. */
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
-                  call_count_CFE_EVS_SendEvent);
+    UtAssert_STUB_COUNT(MM_ChildDispatchCmd, 1);
 }
 
-void MM_AppPipe_Test_SymTblToFileFail(void)
+void MM_AppPipe_Test_FillMemFail(void)
 {
     CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
-    CFE_MSG_FcnCode_t FcnCode   = MM_SYMTBL_TO_FILE_CC;
-    size_t            MsgSize   = sizeof(UT_CmdBuf.SymTblToFileCmd);
+    CFE_MSG_FcnCode_t FcnCode   = MM_FILL_MEM_CC;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
 
-    /* ignore dummy message length check */
-    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyCmdLength), false);
+    UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, false);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ChildDispatchCmd), false);
 
     /* Execute the function being tested */
     MM_AppPipe(&UT_CmdBuf.Buf);
@@ -964,25 +1174,342 @@ void MM_AppPipe_Test_SymTblToFileFail(void)
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 1);
 
-    /* Generates 1 event message in subfunction MM_SymTblToFileCmd.Payload.  Event message count = 1 verifies that the
-     * subfunction has been reached. */
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
-                  call_count_CFE_EVS_SendEvent);
+    UtAssert_STUB_COUNT(MM_ChildDispatchCmd, 0);
 }
 
-void MM_AppPipe_Test_EnableEepromWriteSuccess(void)
+void MM_AppPipe_Test_CopyMemSuccess(void)
 {
     CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
-    CFE_MSG_FcnCode_t FcnCode   = MM_ENABLE_EEPROM_WRITE_CC;
-    size_t            MsgSize   = sizeof(UT_CmdBuf.EepromWriteEnaCmd);
+    CFE_MSG_FcnCode_t FcnCode   = MM_COPY_MEM_CC;
 
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
 
-    /* ignore dummy message length check */
-    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyCmdLength), true);
+    UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ChildDispatchCmd), true);
+
+    /* Execute the function being tested */
+    MM_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 1);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+
+    UtAssert_STUB_COUNT(MM_ChildDispatchCmd, 1);
+}
+
+void MM_AppPipe_Test_CrcMemSuccess(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = MM_CRC_MEM_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+
+    UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ChildDispatchCmd), true);
+
+    /* Execute the function being tested */
+    MM_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 1);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+
+    UtAssert_STUB_COUNT(MM_ChildDispatchCmd, 1);
+}
+
+void MM_AppPipe_Test_SymCacheFlushSuccess(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = MM_SYM_CACHE_FLUSH_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+
+    UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, true);
+
+    /* Execute the function being tested */
+    MM_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 1);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+
+    UtAssert_STUB_COUNT(MM_SymCacheFlush, 1);
+}
+
+void MM_AppPipe_Test_SymCacheFlushFail(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = MM_SYM_CACHE_FLUSH_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+
+    UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, false);
+
+    /* Execute the function being tested */
+    MM_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 1);
+
+    UtAssert_STUB_COUNT(MM_SymCacheFlush, 0);
+}
+
+void MM_AppPipe_Test_MemRangeRefreshSuccess(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = MM_MEM_RANGE_REFRESH_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+
+    UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_MemRangeRefresh), true);
+
+    /* Execute the function being tested */
+    MM_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 1);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+
+    UtAssert_STUB_COUNT(MM_MemRangeRefresh, 1);
+}
+
+void MM_AppPipe_Test_MemRangeRefreshFail(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = MM_MEM_RANGE_REFRESH_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+
+    UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, false);
+
+    /* Execute the function being tested */
+    MM_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 1);
+
+    UtAssert_STUB_COUNT(MM_MemRangeRefresh, 0);
+}
+
+void MM_AppPipe_Test_LookupAddrSuccess(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = MM_LOOKUP_ADDR_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+
+    UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), true);
+    UT_SetHookFunction(UT_KEY(MM_SymIndexLookup), MM_APP_TEST_MM_SymIndexLookupHook, NULL);
+
+    /* Execute the function being tested */
+    MM_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 1);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+
+    UtAssert_STUB_COUNT(MM_SymIndexLookup, 1);
+}
+
+void MM_AppPipe_Test_LookupAddrFail(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = MM_LOOKUP_ADDR_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+
+    UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, false);
+
+    /* Execute the function being tested */
+    MM_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 1);
+
+    UtAssert_STUB_COUNT(MM_SymIndexLookup, 0);
+}
+
+void MM_AppPipe_Test_LookupSymFileSuccess(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = MM_LOOKUP_SYM_FILE_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+
+    UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ChildDispatchCmd), true);
+
+    /* Execute the function being tested */
+    MM_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 1);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+
+    UtAssert_STUB_COUNT(MM_ChildDispatchCmd, 1);
+}
+
+void MM_AppPipe_Test_LookupSymFileFail(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = MM_LOOKUP_SYM_FILE_CC;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+
+    UT_SetDeferredRetcode(UT_KEY(MM_VerifyCmdLength), 1, false);
+
+    /* Execute the function being tested */
+    MM_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 1);
+
+    UtAssert_STUB_COUNT(MM_ChildDispatchCmd, 0);
+}
+
+void MM_AppPipe_Test_LookupSymbolSuccess(void)
+{
+    CFE_SB_MsgId_t    TestMsgId    = CFE_SB_ValueToMsgId(MM_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode      = MM_LOOKUP_SYM_CC;
+    size_t            MsgSize      = sizeof(UT_CmdBuf.LookupSymCmd);
+    cpuaddr           ResolvedAddr = 0;
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    strncpy(UT_CmdBuf.LookupSymCmd.Payload.SymName, "name", sizeof(UT_CmdBuf.LookupSymCmd.Payload.SymName) - 1);
+    UT_SetDataBuffer(UT_KEY(OS_SymbolLookup), &ResolvedAddr, sizeof(ResolvedAddr), false);
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyCmdLength), true);
+
+    /* Execute the function being tested */
+    MM_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 1);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+
+    /* Generates 1 event message in subfunction MM_LookupSymbolCmd.Payload.  Event message count = 1 verifies that the
+     * subfunction has been reached. */
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MM_AppPipe_Test_LookupSymbolFail(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = MM_LOOKUP_SYM_CC;
+    size_t            MsgSize   = sizeof(UT_CmdBuf.LookupSymCmd);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyCmdLength), false);
+
+    /* Execute the function being tested */
+    MM_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 1);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MM_AppPipe_Test_SymTblToFileSuccess(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = MM_SYMTBL_TO_FILE_CC;
+    size_t            MsgSize   = sizeof(UT_CmdBuf.SymTblToFileCmd);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    strncpy(UT_CmdBuf.SymTblToFileCmd.Payload.FileName, "name", sizeof(UT_CmdBuf.SymTblToFileCmd.Payload.FileName) - 1);
+
+    /* Set to satisfy condition "OS_Status == OS_SUCCESS" */
+    UT_SetDeferredRetcode(UT_KEY(OS_SymbolTableDump), 1, CFE_SUCCESS);
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyCmdLength), true);
+
+    /* Execute the function being tested */
+    MM_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 1);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+
+    /* Generates 1 event message in subfunction MM_SymTblToFileCmd.Payload.  Event message count = 1 verifies that the
+     * subfunction has been reached. */
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MM_AppPipe_Test_SymTblToFileFail(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = MM_SYMTBL_TO_FILE_CC;
+    size_t            MsgSize   = sizeof(UT_CmdBuf.SymTblToFileCmd);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyCmdLength), false);
+
+    /* Execute the function being tested */
+    MM_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 1);
+
+    /* Generates 1 event message in subfunction MM_SymTblToFileCmd.Payload.  Event message count = 1 verifies that the
+     * subfunction has been reached. */
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MM_AppPipe_Test_EnableEepromWriteSuccess(void)
+{
+    CFE_SB_MsgId_t    TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
+    CFE_MSG_FcnCode_t FcnCode   = MM_ENABLE_EEPROM_WRITE_CC;
+    size_t            MsgSize   = sizeof(UT_CmdBuf.EepromWriteEnaCmd);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyCmdLength), true);
 
     /* Execute the function being tested */
     MM_AppPipe(&UT_CmdBuf.Buf);
@@ -1126,31 +1653,119 @@ void MM_AppPipe_Test_InvalidCommandPipeMessageID(void)
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Invalid command pipe message ID: 0x%%08lX");
 
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
-    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetFcnCode), &FcnCode, sizeof(FcnCode), false);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    /* ignore dummy message length check */
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyCmdLength), true);
+
+    /* Execute the function being tested */
+    MM_AppPipe(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_MID_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MM_WakeupCmd_Test_NoSemaphore(void)
+{
+    MM_AppData.WakeupSemaphore = OS_OBJECT_ID_UNDEFINED;
+
+    /* Execute the function being tested */
+    MM_WakeupCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MM_AppData.WakeupCount, 1);
+    UtAssert_STUB_COUNT(OS_BinSemGive, 0);
+}
+
+void MM_DeferCmd_Test_Nominal(void)
+{
+    size_t MsgSize = sizeof(UT_CmdBuf.FillMemCmd);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    UT_CmdBuf.FillMemCmd.Payload.FillPattern = 0x12345678;
+
+    /* The queue wraps to the first slot */
+    MM_AppData.DeferredHead  = MM_DEFERRED_CMD_DEPTH - 1;
+    MM_AppData.DeferredCount = 1;
+
+    /* Execute the function being tested */
+    MM_DeferCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MM_AppData.DeferredCount, 2);
+    UtAssert_UINT32_EQ(MM_AppData.DeferredCmds[0].FillMemCmd.Payload.FillPattern, 0x12345678);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_DeferCmd_Test_QueueFull(void)
+{
+    size_t MsgSize = sizeof(UT_CmdBuf.FillMemCmd);
+
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
+
+    MM_AppData.DeferredCount = MM_DEFERRED_CMD_DEPTH;
+
+    /* Execute the function being tested */
+    MM_DeferCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MM_AppData.DeferredCount, MM_DEFERRED_CMD_DEPTH);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_DEFER_CMD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_DeferCmd_Test_TooLarge(void)
+{
+    size_t MsgSize = sizeof(MM_DeferredCmdBuf_t) + 1;
+
     UT_SetDataBuffer(UT_KEY(CFE_MSG_GetSize), &MsgSize, sizeof(MsgSize), false);
 
-    /* ignore dummy message length check */
-    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyCmdLength), true);
-
     /* Execute the function being tested */
-    MM_AppPipe(&UT_CmdBuf.Buf);
+    MM_DeferCmd(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_UINT32_EQ(MM_AppData.DeferredCount, 0);
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_DEFER_CMD_ERR_EID);
+}
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_MID_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+void MM_ProcessDeferredCmds_Test(void)
+{
+    CFE_SB_MsgId_t TestMsgId = CFE_SB_ValueToMsgId(MM_SEND_HK_MID);
 
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &TestMsgId, sizeof(TestMsgId), false);
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    /* Two held commands, the second one in the first slot */
+    MM_AppData.DeferredHead  = MM_DEFERRED_CMD_DEPTH - 1;
+    MM_AppData.DeferredCount = 2;
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    /* Execute the function being tested */
+    MM_ProcessDeferredCmds();
 
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
-                  call_count_CFE_EVS_SendEvent);
+    /* Verify results, each held command is processed once */
+    UtAssert_STUB_COUNT(CFE_MSG_GetMsgId, 2);
+    UtAssert_UINT32_EQ(MM_AppData.DeferredCount, 0);
+    UtAssert_UINT32_EQ(MM_AppData.DeferredHead, 1);
 }
 
 void MM_HousekeepingCmd_Test(void)
@@ -1171,12 +1786,28 @@ void MM_HousekeepingCmd_Test(void)
     MM_AppData.HkPacket.Payload.DataValue      = 6;
     MM_AppData.HkPacket.Payload.BytesProcessed = 7;
 
+    MM_AppData.SegmentSize[MM_SEG_LOAD] = 8;
+    MM_AppData.SegmentSize[MM_SEG_DUMP] = 12;
+    MM_AppData.SegmentSize[MM_SEG_FILL] = 16;
+    MM_AppData.Throughput               = 20;
+    MM_AppData.DeferredCount            = 3;
+
     strncpy(MM_AppData.HkPacket.Payload.FileName, "name", sizeof(MM_AppData.HkPacket.Payload.FileName) - 1);
 
     /* Execute the function being tested */
     MM_HousekeepingCmd(&UT_CmdBuf.Buf);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(MM_TableManage, 1);
+
+    /* Housekeeping and statistics packets */
+    UtAssert_STUB_COUNT(CFE_SB_TransmitMsg, 2);
+
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.LoadSegSize, 8);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.DumpSegSize, 12);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.FillSegSize, 16);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.Throughput, 20);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.DeferredCmds, 3);
     UtAssert_True(MM_AppData.HkPacket.Payload.CmdCounter == 1, "MM_AppData.HkPacket.Payload.CmdCounter == 1");
     UtAssert_True(MM_AppData.HkPacket.Payload.ErrCounter == 2, "MM_AppData.HkPacket.Payload.ErrCounter == 2");
     UtAssert_True(MM_AppData.HkPacket.Payload.LastAction == 3, "MM_AppData.HkPacket.Payload.LastAction == 3");
@@ -1351,6 +1982,7 @@ void MM_SymTblToFileCmd_Test_Nominal(void)
     /* Verify results */
     UtAssert_True(MM_AppData.HkPacket.Payload.LastAction == MM_SYMTBL_SAVE,
                   "MM_AppData.HkPacket.Payload.LastAction == MM_SYMTBL_SAVE");
+    UtAssert_STUB_COUNT(MM_SymIndexBuild, 1);
     UtAssert_True(
         strncmp(MM_AppData.HkPacket.Payload.FileName, UT_CmdBuf.SymTblToFileCmd.Payload.FileName, OS_MAX_PATH_LEN) == 0,
         "strncmp(MM_AppData.HkPacket.Payload.FileName, UT_CmdBuf.SymTblToFileCmd.Payload.FileName, OS_MAX_PATH_LEN) == "
@@ -1438,6 +2070,7 @@ void MM_SymTblToFileCmd_Test_SymbolTableDumpError(void)
     MM_SymTblToFileCmd(&UT_CmdBuf.Buf);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(MM_SymIndexBuild, 0);
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 
@@ -1632,6 +2265,441 @@ void MM_EepromWriteDisCmd_Test_Error(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
+void MM_SymCacheFlushCmd_Test_Nominal(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH, "Symbol cache flushed: Hits = %%u Misses = %%u");
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_SymCacheFlushCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MM_SymCacheFlush, 1);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.LastAction, MM_SYM_CACHE_FLUSH);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_SYM_CACHE_FLUSH_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+void MM_MemRangeRefreshCmd_Test_Nominal(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Memory range map refreshed: RAM ranges = %%u EEPROM ranges = %%u");
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_MemRangeRefresh), true);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_MemRangeRefreshCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MM_MemRangeRefresh, 1);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.LastAction, MM_RANGE_REFRESH);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_MEM_RANGE_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+void MM_MemRangeRefreshCmd_Test_Error(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(MM_MemRangeRefresh), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_MemRangeRefreshCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results, the error event comes from MM_MemRangeRefresh */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.LastAction, MM_NOACTION);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_LookupAddrCmd_Test_Nominal(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Address Lookup Command: Addr = %%p Symbol = '%%s' Offset = 0x%%lX");
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), true);
+    UT_SetHookFunction(UT_KEY(MM_SymIndexLookup), MM_APP_TEST_MM_SymIndexLookupHook, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_LookupAddrCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.LastAction, MM_ADDR_LOOKUP);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.DataValue, 0x10);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_ADDR_LOOKUP_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+void MM_LookupAddrCmd_Test_SymNameError(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Symbolic address can't be resolved: Name = '%%s'");
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_LookupAddrCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MM_SymIndexLookup, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.LastAction, MM_NOACTION);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_SYMNAME_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+void MM_LookupAddrCmd_Test_NotIndexed(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Address not in the reverse symbol index: Addr = %%p Symbols = %%u");
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_SymIndexLookup), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_LookupAddrCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MM_SymIndexLookup, 1);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.LastAction, MM_NOACTION);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_ADDR_LOOKUP_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+/* Request file image read back through OS_read: secondary header then records */
+typedef struct
+{
+    MM_SymLookupFileHeader_t Header;
+    MM_SymLookupRecord_t     Records[3];
+} UT_MM_APP_TEST_SymLookupFile_t;
+
+void MM_LookupSymFileCmd_Test_Nominal(void)
+{
+    UT_MM_APP_TEST_SymLookupFile_t InFile;
+    int32                          strCmpResult;
+    char                           ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Symbol Lookup File Command: %%u of %%u symbols resolved, results in '%%s'");
+
+    memset(&InFile, 0, sizeof(InFile));
+    InFile.Header.NumOfSymbols = 3;
+    strncpy(InFile.Records[0].SymName, "symbol1", sizeof(InFile.Records[0].SymName));
+    strncpy(InFile.Records[1].SymName, "symbol2", sizeof(InFile.Records[1].SymName));
+
+    strncpy(UT_CmdBuf.LookupSymFileCmd.Payload.InFileName, "in.dat", OS_MAX_PATH_LEN);
+    strncpy(UT_CmdBuf.LookupSymFileCmd.Payload.OutFileName, "out.dat", OS_MAX_PATH_LEN);
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ReadHeader), 1, sizeof(CFE_FS_Header_t));
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+    UT_SetDataBuffer(UT_KEY(OS_read), &InFile, sizeof(InFile), false);
+
+    /* First symbol resolves, second does not, third is empty and never looked up */
+    UT_SetDeferredRetcode(UT_KEY(MM_ResolveSymAddr), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MM_ResolveSymAddr), 1, false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_LookupSymFileCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MM_ResolveSymAddr, 2);
+    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 2);
+    UtAssert_STUB_COUNT(OS_close, 2);
+
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.LastAction, MM_SYM_LOOKUP);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.DataValue, 1);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.BytesProcessed, 3);
+    UtAssert_STRINGBUF_EQ(MM_AppData.HkPacket.Payload.FileName, sizeof(MM_AppData.HkPacket.Payload.FileName),
+                          "out.dat", sizeof("out.dat"));
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_SYM_LOOKUP_FILE_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+void MM_LookupSymFileCmd_Test_OpenError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 1, OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_LookupSymFileCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_FS_ReadHeader, 0);
+    UtAssert_STUB_COUNT(OS_close, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.LastAction, MM_NOACTION);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_OPEN_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_LookupSymFileCmd_Test_ReadHeaderError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ReadHeader), 1, 0);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_LookupSymFileCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CFE_FS_READHDR_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_LookupSymFileCmd_Test_SecondaryHeaderError(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ReadHeader), 1, sizeof(CFE_FS_Header_t));
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_LookupSymFileCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_READ_EXP_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_LookupSymFileCmd_Test_CountError(void)
+{
+    MM_SymLookupFileHeader_t FileHeader;
+    int32                    strCmpResult;
+    char                     ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Symbol lookup file count error: Symbols = %%u Max = %%u File = '%%s'");
+
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.NumOfSymbols = MM_MAX_SYM_LOOKUP_RECORDS + 1;
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ReadHeader), 1, sizeof(CFE_FS_Header_t));
+    UT_SetDataBuffer(UT_KEY(OS_read), &FileHeader, sizeof(FileHeader), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_LookupSymFileCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results, the result file is never created */
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(MM_ResolveSymAddr, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_SYM_LOOKUP_FILE_COUNT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+void MM_LookupSymFileCmd_Test_CreateError(void)
+{
+    MM_SymLookupFileHeader_t FileHeader;
+
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.NumOfSymbols = 1;
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ReadHeader), 1, sizeof(CFE_FS_Header_t));
+    UT_SetDataBuffer(UT_KEY(OS_read), &FileHeader, sizeof(FileHeader), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 2, OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_LookupSymFileCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results, only the request file is closed */
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(MM_ResolveSymAddr, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_CREAT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_LookupSymFileCmd_Test_CloseError(void)
+{
+    UT_MM_APP_TEST_SymLookupFile_t InFile;
+
+    memset(&InFile, 0, sizeof(InFile));
+    InFile.Header.NumOfSymbols = 1;
+    strncpy(InFile.Records[0].SymName, "symbol1", sizeof(InFile.Records[0].SymName));
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ReadHeader), 1, sizeof(CFE_FS_Header_t));
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+    UT_SetDataBuffer(UT_KEY(OS_read), &InFile, sizeof(InFile), false);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), true);
+    UT_SetDeferredRetcode(UT_KEY(OS_close), 1, OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_LookupSymFileCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.LastAction, MM_NOACTION);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_CLOSE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_LookupSymFile_Test_MultipleBuffers(void)
+{
+    MM_SymLookupFileHeader_t FileHeader;
+    uint32                   RecordsPerBuffer = MM_IO_BUFFER_SIZE / sizeof(MM_SymLookupRecord_t);
+
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.NumOfSymbols = RecordsPerBuffer + 1;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+    UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), true);
+
+    /* Execute the function being tested, OS_read fills every name with zeros */
+    UtAssert_BOOL_TRUE(MM_LookupSymFile(MM_UT_OBJID_1, "in.dat", MM_UT_OBJID_1, "out.dat", &FileHeader));
+
+    /* Verify results, empty names are reported unresolved without a lookup */
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(OS_write, 4);
+    UtAssert_STUB_COUNT(MM_ResolveSymAddr, 0);
+    UtAssert_UINT32_EQ(FileHeader.NumResolved, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_LookupSymFile_Test_ReadError(void)
+{
+    MM_SymLookupFileHeader_t FileHeader;
+
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.NumOfSymbols = 2;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_LookupSymFile(MM_UT_OBJID_1, "in.dat", MM_UT_OBJID_1, "out.dat", &FileHeader));
+
+    /* Verify results, the headers are not rewritten */
+    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_READ_EXP_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_LookupSymFile_Test_WriteError(void)
+{
+    MM_SymLookupFileHeader_t FileHeader;
+
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.NumOfSymbols = 2;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, 0);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_LookupSymFile(MM_UT_OBJID_1, "in.dat", MM_UT_OBJID_1, "out.dat", &FileHeader));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 1);
+    UtAssert_STUB_COUNT(OS_write, 2);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_WRITE_EXP_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_WriteSymLookupHeaders_Test_Nominal(void)
+{
+    CFE_FS_Header_t          CFEHeader;
+    MM_SymLookupFileHeader_t FileHeader;
+
+    memset(&CFEHeader, 0, sizeof(CFEHeader));
+    memset(&FileHeader, 0, sizeof(FileHeader));
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_WriteSymLookupHeaders("out.dat", MM_UT_OBJID_1, &CFEHeader, &FileHeader));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_WriteSymLookupHeaders_Test_CFEHeaderError(void)
+{
+    CFE_FS_Header_t          CFEHeader;
+    MM_SymLookupFileHeader_t FileHeader;
+
+    memset(&CFEHeader, 0, sizeof(CFEHeader));
+    memset(&FileHeader, 0, sizeof(FileHeader));
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), 0);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_WriteSymLookupHeaders("out.dat", MM_UT_OBJID_1, &CFEHeader, &FileHeader));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_write, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CFE_FS_WRITEHDR_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_WriteSymLookupHeaders_Test_WriteError(void)
+{
+    CFE_FS_Header_t          CFEHeader;
+    MM_SymLookupFileHeader_t FileHeader;
+
+    memset(&CFEHeader, 0, sizeof(CFEHeader));
+    memset(&FileHeader, 0, sizeof(FileHeader));
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, 0);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_WriteSymLookupHeaders("out.dat", MM_UT_OBJID_1, &CFEHeader, &FileHeader));
+
+    /* Verify results */
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_WRITE_EXP_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
 /*
  * Register the test cases to execute with the unit test tool
  */
@@ -1642,20 +2710,29 @@ void UtTest_Setup(void)
     UtTest_Add(MM_AppMain_Test_SBError, MM_Test_Setup, MM_Test_TearDown, "MM_AppMain_Test_SBError");
     UtTest_Add(MM_AppMain_Test_SBTimeout, MM_Test_Setup, MM_Test_TearDown, "MM_AppMain_Test_SBTimeout");
     UtTest_Add(MM_AppInit_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_AppInit_Test_Nominal");
+    UtTest_Add(MM_AppInit_Test_ChildInitError, MM_Test_Setup, MM_Test_TearDown, "MM_AppInit_Test_ChildInitError");
+    UtTest_Add(MM_AppInit_Test_StagingPoolError, MM_Test_Setup, MM_Test_TearDown, "MM_AppInit_Test_StagingPoolError");
     UtTest_Add(MM_AppInit_Test_EVSRegisterError, MM_Test_Setup, MM_Test_TearDown, "MM_AppInit_Test_EVSRegisterError");
     UtTest_Add(MM_AppInit_Test_SBCreatePipeError, MM_Test_Setup, MM_Test_TearDown, "MM_AppInit_Test_SBCreatePipeError");
     UtTest_Add(MM_AppInit_Test_SBSubscribeHKError, MM_Test_Setup, MM_Test_TearDown,
                "MM_AppInit_Test_SBSubscribeHKError");
     UtTest_Add(MM_AppInit_Test_SBSubscribeMMError, MM_Test_Setup, MM_Test_TearDown,
                "MM_AppInit_Test_SBSubscribeMMError");
+    UtTest_Add(MM_AppInit_Test_SBSubscribeWakeupError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_AppInit_Test_SBSubscribeWakeupError");
+    UtTest_Add(MM_AppInit_Test_TableInitError, MM_Test_Setup, MM_Test_TearDown, "MM_AppInit_Test_TableInitError");
     UtTest_Add(MM_AppPipe_Test_SendHKSuccess, MM_Test_Setup, MM_Test_TearDown, "MM_AppPipe_Test_SendHkSuccess");
     UtTest_Add(MM_AppPipe_Test_SendHKFail, MM_Test_Setup, MM_Test_TearDown, "MM_AppPipe_Test_SendHkFail");
+    UtTest_Add(MM_AppPipe_Test_WakeupSuccess, MM_Test_Setup, MM_Test_TearDown, "MM_AppPipe_Test_WakeupSuccess");
+    UtTest_Add(MM_AppPipe_Test_WakeupFail, MM_Test_Setup, MM_Test_TearDown, "MM_AppPipe_Test_WakeupFail");
     UtTest_Add(MM_AppPipe_Test_NoopSuccess, MM_Test_Setup, MM_Test_TearDown, "MM_AppPipe_Test_NoopSuccess");
     UtTest_Add(MM_AppPipe_Test_NoopFail, MM_Test_Setup, MM_Test_TearDown, "MM_AppPipe_Test_NoopFail");
+    UtTest_Add(MM_AppPipe_Test_NoopChildBusy, MM_Test_Setup, MM_Test_TearDown, "MM_AppPipe_Test_NoopChildBusy");
     UtTest_Add(MM_AppPipe_Test_ResetSuccess, MM_Test_Setup, MM_Test_TearDown, "MM_AppPipe_Test_ResetSuccess");
     UtTest_Add(MM_AppPipe_Test_ResetFail, MM_Test_Setup, MM_Test_TearDown, "MM_AppPipe_Test_ResetFail");
     UtTest_Add(MM_AppPipe_Test_PeekSuccess, MM_Test_Setup, MM_Test_TearDown, "MM_AppPipe_Test_PeekSuccess");
     UtTest_Add(MM_AppPipe_Test_PeekFail, MM_Test_Setup, MM_Test_TearDown, "MM_AppPipe_Test_PeekFail");
+    UtTest_Add(MM_AppPipe_Test_PeekChildBusy, MM_Test_Setup, MM_Test_TearDown, "MM_AppPipe_Test_PeekChildBusy");
     UtTest_Add(MM_AppPipe_Test_PokeSuccess, MM_Test_Setup, MM_Test_TearDown, "MM_AppPipe_Test_PokeSuccess");
     UtTest_Add(MM_AppPipe_Test_PokeFail, MM_Test_Setup, MM_Test_TearDown, "MM_AppPipe_Test_PokeFail");
     UtTest_Add(MM_AppPipe_Test_LoadMemWIDSuccess, MM_Test_Setup, MM_Test_TearDown, "MM_AppPipe_Test_LoadMemWIDSuccess");
@@ -1665,11 +2742,38 @@ void UtTest_Setup(void)
     UtTest_Add(MM_AppPipe_Test_DumpMemToFileSuccess, MM_Test_Setup, MM_Test_TearDown,
                "MM_AppPipe_Test_DumpMemToFileSuccess");
     UtTest_Add(MM_AppPipe_Test_DumpMemToFileFail, MM_Test_Setup, MM_Test_TearDown, "MM_AppPipe_Test_DumpMemToFileFail");
+    UtTest_Add(MM_AppPipe_Test_DumpMemToFileEncSuccess, MM_Test_Setup, MM_Test_TearDown,
+               "MM_AppPipe_Test_DumpMemToFileEncSuccess");
+    UtTest_Add(MM_AppPipe_Test_DumpMemToDeltaFileSuccess, MM_Test_Setup, MM_Test_TearDown,
+               "MM_AppPipe_Test_DumpMemToDeltaFileSuccess");
+    UtTest_Add(MM_AppPipe_Test_LoadMemFromPatchFileSuccess, MM_Test_Setup, MM_Test_TearDown,
+               "MM_AppPipe_Test_LoadMemFromPatchFileSuccess");
+    UtTest_Add(MM_AppPipe_Test_LoadMemFromMultiFileSuccess, MM_Test_Setup, MM_Test_TearDown,
+               "MM_AppPipe_Test_LoadMemFromMultiFileSuccess");
+    UtTest_Add(MM_AppPipe_Test_DumpMemToMultiFileSuccess, MM_Test_Setup, MM_Test_TearDown,
+               "MM_AppPipe_Test_DumpMemToMultiFileSuccess");
     UtTest_Add(MM_AppPipe_Test_DumpInEventSuccess, MM_Test_Setup, MM_Test_TearDown,
                "MM_AppPipe_Test_DumpInEventSuccess");
     UtTest_Add(MM_AppPipe_Test_DumpInEventFail, MM_Test_Setup, MM_Test_TearDown, "MM_AppPipe_Test_DumpInEventFail");
     UtTest_Add(MM_AppPipe_Test_FillMemSuccess, MM_Test_Setup, MM_Test_TearDown, "MM_AppPipe_Test_FillMemSuccess");
     UtTest_Add(MM_AppPipe_Test_FillMemFail, MM_Test_Setup, MM_Test_TearDown, "MM_AppPipe_Test_FillMemFail");
+    UtTest_Add(MM_AppPipe_Test_CopyMemSuccess, MM_Test_Setup, MM_Test_TearDown, "MM_AppPipe_Test_CopyMemSuccess");
+    UtTest_Add(MM_AppPipe_Test_CrcMemSuccess, MM_Test_Setup, MM_Test_TearDown, "MM_AppPipe_Test_CrcMemSuccess");
+    UtTest_Add(MM_AppPipe_Test_SymCacheFlushSuccess, MM_Test_Setup, MM_Test_TearDown,
+               "MM_AppPipe_Test_SymCacheFlushSuccess");
+    UtTest_Add(MM_AppPipe_Test_SymCacheFlushFail, MM_Test_Setup, MM_Test_TearDown,
+               "MM_AppPipe_Test_SymCacheFlushFail");
+    UtTest_Add(MM_AppPipe_Test_MemRangeRefreshSuccess, MM_Test_Setup, MM_Test_TearDown,
+               "MM_AppPipe_Test_MemRangeRefreshSuccess");
+    UtTest_Add(MM_AppPipe_Test_MemRangeRefreshFail, MM_Test_Setup, MM_Test_TearDown,
+               "MM_AppPipe_Test_MemRangeRefreshFail");
+    UtTest_Add(MM_AppPipe_Test_LookupAddrSuccess, MM_Test_Setup, MM_Test_TearDown,
+               "MM_AppPipe_Test_LookupAddrSuccess");
+    UtTest_Add(MM_AppPipe_Test_LookupAddrFail, MM_Test_Setup, MM_Test_TearDown, "MM_AppPipe_Test_LookupAddrFail");
+    UtTest_Add(MM_AppPipe_Test_LookupSymFileSuccess, MM_Test_Setup, MM_Test_TearDown,
+               "MM_AppPipe_Test_LookupSymFileSuccess");
+    UtTest_Add(MM_AppPipe_Test_LookupSymFileFail, MM_Test_Setup, MM_Test_TearDown,
+               "MM_AppPipe_Test_LookupSymFileFail");
     UtTest_Add(MM_AppPipe_Test_LookupSymbolSuccess, MM_Test_Setup, MM_Test_TearDown,
                "MM_AppPipe_Test_LookupSymbolSuccess");
     UtTest_Add(MM_AppPipe_Test_LookupSymbolFail, MM_Test_Setup, MM_Test_TearDown, "MM_AppPipe_Test_LookupSymbolFail");
@@ -1691,6 +2795,13 @@ void UtTest_Setup(void)
 
     UtTest_Add(MM_HousekeepingCmd_Test, MM_Test_Setup, MM_Test_TearDown, "MM_HousekeepingCmd_Test");
 
+    UtTest_Add(MM_WakeupCmd_Test_NoSemaphore, MM_Test_Setup, MM_Test_TearDown, "MM_WakeupCmd_Test_NoSemaphore");
+
+    UtTest_Add(MM_DeferCmd_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_DeferCmd_Test_Nominal");
+    UtTest_Add(MM_DeferCmd_Test_QueueFull, MM_Test_Setup, MM_Test_TearDown, "MM_DeferCmd_Test_QueueFull");
+    UtTest_Add(MM_DeferCmd_Test_TooLarge, MM_Test_Setup, MM_Test_TearDown, "MM_DeferCmd_Test_TooLarge");
+    UtTest_Add(MM_ProcessDeferredCmds_Test, MM_Test_Setup, MM_Test_TearDown, "MM_ProcessDeferredCmds_Test");
+
     UtTest_Add(MM_LookupSymbolCmd_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_LookupSymbolCmd_Test_Nominal");
     UtTest_Add(MM_LookupSymbolCmd_Test_SymbolNameNull, MM_Test_Setup, MM_Test_TearDown,
                "MM_LookupSymbolCmd_Test_SymbolNameNull");
@@ -1708,4 +2819,35 @@ void UtTest_Setup(void)
 
     UtTest_Add(MM_EepromWriteDisCmd_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_EepromWriteDisCmd_Test_Nominal");
     UtTest_Add(MM_EepromWriteDisCmd_Test_Error, MM_Test_Setup, MM_Test_TearDown, "MM_EepromWriteDisCmd_Test_Error");
+    UtTest_Add(MM_SymCacheFlushCmd_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_SymCacheFlushCmd_Test_Nominal");
+    UtTest_Add(MM_MemRangeRefreshCmd_Test_Nominal, MM_Test_Setup, MM_Test_TearDown,
+               "MM_MemRangeRefreshCmd_Test_Nominal");
+    UtTest_Add(MM_MemRangeRefreshCmd_Test_Error, MM_Test_Setup, MM_Test_TearDown, "MM_MemRangeRefreshCmd_Test_Error");
+    UtTest_Add(MM_LookupAddrCmd_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_LookupAddrCmd_Test_Nominal");
+    UtTest_Add(MM_LookupAddrCmd_Test_SymNameError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LookupAddrCmd_Test_SymNameError");
+    UtTest_Add(MM_LookupAddrCmd_Test_NotIndexed, MM_Test_Setup, MM_Test_TearDown, "MM_LookupAddrCmd_Test_NotIndexed");
+    UtTest_Add(MM_LookupSymFileCmd_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_LookupSymFileCmd_Test_Nominal");
+    UtTest_Add(MM_LookupSymFileCmd_Test_OpenError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LookupSymFileCmd_Test_OpenError");
+    UtTest_Add(MM_LookupSymFileCmd_Test_ReadHeaderError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LookupSymFileCmd_Test_ReadHeaderError");
+    UtTest_Add(MM_LookupSymFileCmd_Test_SecondaryHeaderError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LookupSymFileCmd_Test_SecondaryHeaderError");
+    UtTest_Add(MM_LookupSymFileCmd_Test_CountError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LookupSymFileCmd_Test_CountError");
+    UtTest_Add(MM_LookupSymFileCmd_Test_CreateError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LookupSymFileCmd_Test_CreateError");
+    UtTest_Add(MM_LookupSymFileCmd_Test_CloseError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LookupSymFileCmd_Test_CloseError");
+    UtTest_Add(MM_LookupSymFile_Test_MultipleBuffers, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LookupSymFile_Test_MultipleBuffers");
+    UtTest_Add(MM_LookupSymFile_Test_ReadError, MM_Test_Setup, MM_Test_TearDown, "MM_LookupSymFile_Test_ReadError");
+    UtTest_Add(MM_LookupSymFile_Test_WriteError, MM_Test_Setup, MM_Test_TearDown, "MM_LookupSymFile_Test_WriteError");
+    UtTest_Add(MM_WriteSymLookupHeaders_Test_Nominal, MM_Test_Setup, MM_Test_TearDown,
+               "MM_WriteSymLookupHeaders_Test_Nominal");
+    UtTest_Add(MM_WriteSymLookupHeaders_Test_CFEHeaderError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_WriteSymLookupHeaders_Test_CFEHeaderError");
+    UtTest_Add(MM_WriteSymLookupHeaders_Test_WriteError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_WriteSymLookupHeaders_Test_WriteError");
 }
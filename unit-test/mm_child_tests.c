@@ -0,0 +1,586 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Unit tests for mm_child.c
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_child.h"
+#include "mm_app.h"
+#include "mm_load.h"
+#include "mm_dump.h"
+#include "mm_msg.h"
+#include "mm_msgdefs.h"
+#include "mm_events.h"
+#include "mm_test_utils.h"
+
+/************************************************************************
+** UT Includes
+*************************************************************************/
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include <unistd.h>
+#include <stdlib.h>
+#include "cfe.h"
+
+/* mm_child_tests globals */
+uint8 call_count_CFE_EVS_SendEvent;
+
+/*
+ * Function Definitions
+ */
+
+void MM_ChildInit_Test_Nominal(void)
+{
+    CFE_Status_t Result;
+
+    /* Execute the function being tested */
+    Result = MM_ChildInit();
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, CFE_SUCCESS);
+    UtAssert_True(OS_ObjectIdDefined(MM_AppData.ChildSemaphore), "ChildSemaphore is defined");
+    UtAssert_True(OS_ObjectIdDefined(MM_AppData.ChildMutex), "ChildMutex is defined");
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ChildState, MM_CHILD_IDLE);
+
+    UtAssert_True(OS_ObjectIdDefined(MM_AppData.WakeupSemaphore), "WakeupSemaphore is defined");
+
+    UtAssert_STUB_COUNT(OS_MutSemCreate, 1);
+    UtAssert_STUB_COUNT(OS_CountSemCreate, 1);
+    UtAssert_STUB_COUNT(OS_BinSemCreate, 1);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 1);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MM_ChildInit_Test_MutexCreateError(void)
+{
+    CFE_Status_t Result;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_MutSemCreate), OS_ERROR);
+
+    /* Execute the function being tested */
+    Result = MM_ChildInit();
+
+    /* Verify results, every command is processed by the main task */
+    UtAssert_INT32_EQ(Result, OS_ERROR);
+    UtAssert_True(!OS_ObjectIdDefined(MM_AppData.ChildMutex), "ChildMutex is undefined");
+    UtAssert_True(!OS_ObjectIdDefined(MM_AppData.ChildSemaphore), "ChildSemaphore is undefined");
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ChildState, MM_CHILD_DISABLED);
+
+    UtAssert_STUB_COUNT(OS_CountSemCreate, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CHILD_INIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_ChildInit_Test_SemCreateError(void)
+{
+    CFE_Status_t Result;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemCreate), OS_ERROR);
+
+    /* Execute the function being tested */
+    Result = MM_ChildInit();
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, OS_ERROR);
+    UtAssert_True(!OS_ObjectIdDefined(MM_AppData.ChildSemaphore), "ChildSemaphore is undefined");
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ChildState, MM_CHILD_DISABLED);
+
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CHILD_INIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_ChildInit_Test_WakeupSemCreateError(void)
+{
+    CFE_Status_t Result;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_BinSemCreate), OS_ERROR);
+
+    /* Execute the function being tested */
+    Result = MM_ChildInit();
+
+    /* Verify results, the child task still runs without scheduler pacing */
+    UtAssert_INT32_EQ(Result, CFE_SUCCESS);
+    UtAssert_True(OS_ObjectIdDefined(MM_AppData.ChildSemaphore), "ChildSemaphore is defined");
+    UtAssert_True(!OS_ObjectIdDefined(MM_AppData.WakeupSemaphore), "WakeupSemaphore is undefined");
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ChildState, MM_CHILD_IDLE);
+
+    UtAssert_STUB_COUNT(CFE_ES_CreateChildTask, 1);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CHILD_INIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_ChildInit_Test_CreateTaskError(void)
+{
+    CFE_Status_t Result;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CreateChildTask), CFE_ES_ERR_CHILD_TASK_CREATE);
+
+    /* Execute the function being tested */
+    Result = MM_ChildInit();
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, CFE_ES_ERR_CHILD_TASK_CREATE);
+    UtAssert_True(!OS_ObjectIdDefined(MM_AppData.ChildSemaphore), "ChildSemaphore is undefined");
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ChildState, MM_CHILD_DISABLED);
+
+    UtAssert_True(!OS_ObjectIdDefined(MM_AppData.WakeupSemaphore), "WakeupSemaphore is undefined");
+
+    UtAssert_STUB_COUNT(OS_CountSemDelete, 1);
+    UtAssert_STUB_COUNT(OS_BinSemDelete, 1);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CHILD_INIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_ChildState_Test_Mutex(void)
+{
+    MM_AppData.ChildMutex = MM_UT_OBJID_1;
+
+    /* Execute the functions being tested */
+    MM_ChildSetState(MM_CHILD_BUSY);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MM_ChildGetState(), MM_CHILD_BUSY);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ChildState, MM_CHILD_BUSY);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 2);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 2);
+}
+
+void MM_ChildState_Test_NoMutex(void)
+{
+    MM_AppData.ChildMutex = OS_OBJECT_ID_UNDEFINED;
+
+    /* Execute the functions being tested */
+    MM_ChildSetState(MM_CHILD_IDLE);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MM_ChildGetState(), MM_CHILD_IDLE);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 0);
+}
+
+void MM_ChildLock_Test_Mutex(void)
+{
+    MM_AppData.ChildMutex = MM_UT_OBJID_1;
+
+    /* Execute the functions being tested */
+    MM_ChildLock();
+    MM_ChildUnlock();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_MutSemTake, 1);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 1);
+}
+
+void MM_ChildLock_Test_NoMutex(void)
+{
+    MM_AppData.ChildMutex = OS_OBJECT_ID_UNDEFINED;
+
+    /* Execute the functions being tested */
+    MM_ChildLock();
+    MM_ChildUnlock();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 0);
+}
+
+void MM_ChildVerifyIdle_Test_Idle(void)
+{
+    MM_AppData.HkPacket.Payload.ChildState = MM_CHILD_IDLE;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_ChildVerifyIdle(MM_PEEK_CC));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_ChildVerifyIdle_Test_Busy(void)
+{
+    MM_AppData.ChildCmdCode                = MM_LOAD_MEM_FROM_FILE_CC;
+    MM_AppData.HkPacket.Payload.ChildState = MM_CHILD_BUSY;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_ChildVerifyIdle(MM_PEEK_CC));
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ChildState, MM_CHILD_BUSY);
+    UtAssert_INT32_EQ(MM_AppData.ChildCmdCode, MM_LOAD_MEM_FROM_FILE_CC);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CHILD_BUSY_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_ChildTask_Test_SemTakeError(void)
+{
+    MM_AppData.ChildSemaphore              = MM_UT_OBJID_1;
+    MM_AppData.HkPacket.Payload.ChildState = MM_CHILD_IDLE;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemTake), OS_ERROR);
+
+    /* Execute the function being tested */
+    MM_ChildTask();
+
+    /* Verify results */
+    UtAssert_True(!OS_ObjectIdDefined(MM_AppData.ChildSemaphore), "ChildSemaphore is undefined");
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ChildState, MM_CHILD_DISABLED);
+
+    UtAssert_STUB_COUNT(OS_CountSemTake, 1);
+    UtAssert_STUB_COUNT(CFE_ES_ExitChildTask, 1);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CHILD_TERM_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_ChildLoop_Test_ProcessCmd(void)
+{
+    MM_AppData.ChildSemaphore              = MM_UT_OBJID_1;
+    MM_AppData.ChildCmdCode                = MM_FILL_MEM_CC;
+    MM_AppData.HkPacket.Payload.ChildState = MM_CHILD_BUSY;
+
+    /* Process one command, then fail the semaphore take to end the loop */
+    UT_SetDeferredRetcode(UT_KEY(OS_CountSemTake), 2, OS_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(MM_FillMemCmd), true);
+
+    /* Execute the function being tested */
+    MM_ChildLoop();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_CountSemTake, 2);
+    UtAssert_STUB_COUNT(MM_FillMemCmd, 1);
+
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ChildCmdCounter, 1);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ChildErrCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ChildLastCC, MM_FILL_MEM_CC);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ChildState, MM_CHILD_IDLE);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CHILD_TERM_ERR_EID);
+}
+
+void MM_ChildProcess_Test_CmdError(void)
+{
+    MM_AppData.ChildCmdCode                = MM_DUMP_MEM_TO_FILE_CC;
+    MM_AppData.HkPacket.Payload.ChildState = MM_CHILD_BUSY;
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_DumpMemToFileCmd), false);
+
+    /* Execute the function being tested */
+    MM_ChildProcess();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MM_DumpMemToFileCmd, 1);
+
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ChildCmdCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ChildErrCounter, 1);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ChildLastCC, MM_DUMP_MEM_TO_FILE_CC);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ChildState, MM_CHILD_IDLE);
+
+    /* No command-handling function should be updating the cmd or err counter itself */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+}
+
+void MM_ChildDispatchCmd_Test_Queued(void)
+{
+    bool Result;
+
+    MM_AppData.ChildSemaphore              = MM_UT_OBJID_1;
+    MM_AppData.HkPacket.Payload.ChildState = MM_CHILD_IDLE;
+
+    UT_CmdBuf.FillMemCmd.Payload.NumOfBytes  = 100;
+    UT_CmdBuf.FillMemCmd.Payload.FillPattern = 0xA5A5A5A5;
+
+    /* Execute the function being tested */
+    Result = MM_ChildDispatchCmd(&UT_CmdBuf.Buf, MM_FILL_MEM_CC, sizeof(MM_FillMemCmd_t));
+
+    /* Verify results */
+    UtAssert_True(Result == true, "Result == true");
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ChildState, MM_CHILD_BUSY);
+    UtAssert_INT32_EQ(MM_AppData.ChildCmdCode, MM_FILL_MEM_CC);
+    UtAssert_MemCmp(&MM_AppData.ChildCmdBuf, &UT_CmdBuf.FillMemCmd, sizeof(MM_FillMemCmd_t),
+                    "Command copied to child task buffer");
+
+    UtAssert_STUB_COUNT(OS_CountSemGive, 1);
+    UtAssert_STUB_COUNT(MM_FillMemCmd, 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MM_ChildDispatchCmd_Test_Busy(void)
+{
+    bool Result;
+
+    MM_AppData.ChildSemaphore              = MM_UT_OBJID_1;
+    MM_AppData.ChildCmdCode                = MM_DUMP_MEM_TO_FILE_CC;
+    MM_AppData.HkPacket.Payload.ChildState = MM_CHILD_BUSY;
+
+    /* Execute the function being tested */
+    Result = MM_ChildDispatchCmd(&UT_CmdBuf.Buf, MM_FILL_MEM_CC, sizeof(MM_FillMemCmd_t));
+
+    /* Verify results */
+    UtAssert_True(Result == false, "Result == false");
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ChildState, MM_CHILD_BUSY);
+
+    /* The active command must be left untouched */
+    UtAssert_INT32_EQ(MM_AppData.ChildCmdCode, MM_DUMP_MEM_TO_FILE_CC);
+
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+    UtAssert_STUB_COUNT(MM_FillMemCmd, 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CHILD_BUSY_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_ChildDispatchCmd_Test_CmdTooLarge(void)
+{
+    bool Result;
+
+    MM_AppData.ChildSemaphore              = MM_UT_OBJID_1;
+    MM_AppData.HkPacket.Payload.ChildState = MM_CHILD_IDLE;
+
+    /* Execute the function being tested */
+    Result = MM_ChildDispatchCmd(&UT_CmdBuf.Buf, MM_FILL_MEM_CC, sizeof(MM_AppData.ChildCmdBuf) + 1);
+
+    /* Verify results */
+    UtAssert_True(Result == false, "Result == false");
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ChildState, MM_CHILD_IDLE);
+
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CHILD_QUEUE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_ChildDispatchCmd_Test_SemGiveError(void)
+{
+    bool Result;
+
+    MM_AppData.ChildSemaphore              = MM_UT_OBJID_1;
+    MM_AppData.HkPacket.Payload.ChildState = MM_CHILD_IDLE;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_CountSemGive), OS_ERROR);
+
+    /* Execute the function being tested */
+    Result = MM_ChildDispatchCmd(&UT_CmdBuf.Buf, MM_LOAD_MEM_FROM_FILE_CC, sizeof(MM_LoadMemFromFileCmd_t));
+
+    /* Verify results */
+    UtAssert_True(Result == false, "Result == false");
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ChildState, MM_CHILD_IDLE);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CHILD_QUEUE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_ChildDispatchCmd_Test_NoChildTask(void)
+{
+    bool Result;
+
+    MM_AppData.ChildSemaphore              = OS_OBJECT_ID_UNDEFINED;
+    MM_AppData.HkPacket.Payload.ChildState = MM_CHILD_DISABLED;
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_LoadMemFromFileCmd), true);
+
+    /* Execute the function being tested */
+    Result = MM_ChildDispatchCmd(&UT_CmdBuf.Buf, MM_LOAD_MEM_FROM_FILE_CC, sizeof(MM_LoadMemFromFileCmd_t));
+
+    /* Verify results */
+    UtAssert_True(Result == true, "Result == true");
+
+    /* The command is processed on the calling task */
+    UtAssert_STUB_COUNT(MM_LoadMemFromFileCmd, 1);
+    UtAssert_STUB_COUNT(OS_CountSemGive, 0);
+
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ChildState, MM_CHILD_DISABLED);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ChildCmdCounter, 0);
+}
+
+void MM_ChildExecuteCmd_Test_Nominal(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(MM_LoadMemFromFileCmd), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_DumpMemToFileCmd), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_DumpMemToFileEncCmd), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_DumpMemToDeltaFileCmd), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_LoadMemFromPatchFileCmd), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_LoadMemFromMultiFileCmd), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_DumpMemToMultiFileCmd), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_FillMemCmd), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_CopyMemCmd), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_CrcMemCmd), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_LookupSymFileCmd), true);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_ChildExecuteCmd(&UT_CmdBuf.Buf, MM_LOAD_MEM_FROM_FILE_CC));
+    UtAssert_BOOL_TRUE(MM_ChildExecuteCmd(&UT_CmdBuf.Buf, MM_DUMP_MEM_TO_FILE_CC));
+    UtAssert_BOOL_TRUE(MM_ChildExecuteCmd(&UT_CmdBuf.Buf, MM_DUMP_MEM_TO_FILE_ENC_CC));
+    UtAssert_BOOL_TRUE(MM_ChildExecuteCmd(&UT_CmdBuf.Buf, MM_DUMP_MEM_TO_DELTA_FILE_CC));
+    UtAssert_BOOL_TRUE(MM_ChildExecuteCmd(&UT_CmdBuf.Buf, MM_LOAD_MEM_FROM_PATCH_FILE_CC));
+    UtAssert_BOOL_TRUE(MM_ChildExecuteCmd(&UT_CmdBuf.Buf, MM_LOAD_MEM_FROM_MULTI_FILE_CC));
+    UtAssert_BOOL_TRUE(MM_ChildExecuteCmd(&UT_CmdBuf.Buf, MM_DUMP_MEM_TO_MULTI_FILE_CC));
+    UtAssert_BOOL_TRUE(MM_ChildExecuteCmd(&UT_CmdBuf.Buf, MM_FILL_MEM_CC));
+    UtAssert_BOOL_TRUE(MM_ChildExecuteCmd(&UT_CmdBuf.Buf, MM_COPY_MEM_CC));
+    UtAssert_BOOL_TRUE(MM_ChildExecuteCmd(&UT_CmdBuf.Buf, MM_CRC_MEM_CC));
+    UtAssert_BOOL_TRUE(MM_ChildExecuteCmd(&UT_CmdBuf.Buf, MM_LOOKUP_SYM_FILE_CC));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MM_LoadMemFromFileCmd, 1);
+    UtAssert_STUB_COUNT(MM_DumpMemToFileCmd, 1);
+    UtAssert_STUB_COUNT(MM_DumpMemToFileEncCmd, 1);
+    UtAssert_STUB_COUNT(MM_DumpMemToDeltaFileCmd, 1);
+    UtAssert_STUB_COUNT(MM_LoadMemFromPatchFileCmd, 1);
+    UtAssert_STUB_COUNT(MM_LoadMemFromMultiFileCmd, 1);
+    UtAssert_STUB_COUNT(MM_DumpMemToMultiFileCmd, 1);
+    UtAssert_STUB_COUNT(MM_FillMemCmd, 1);
+    UtAssert_STUB_COUNT(MM_CopyMemCmd, 1);
+    UtAssert_STUB_COUNT(MM_CrcMemCmd, 1);
+    UtAssert_STUB_COUNT(MM_LookupSymFileCmd, 1);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+int32 UT_MM_CHILD_TEST_ActiveActionHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                        const UT_StubContext_t *Context)
+{
+    *((uint8 *)UserObj) = MM_AppData.HkPacket.Payload.ActiveAction;
+
+    return true;
+}
+
+void MM_ChildExecuteCmd_Test_ActiveAction(void)
+{
+    uint8 ActiveAction = MM_NOACTION;
+
+    UT_SetHookFunction(UT_KEY(MM_FillMemCmd), UT_MM_CHILD_TEST_ActiveActionHook, &ActiveAction);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_ChildExecuteCmd(&UT_CmdBuf.Buf, MM_FILL_MEM_CC));
+
+    /* Verify results, housekeeping shows the fill only while it runs */
+    UtAssert_INT32_EQ(ActiveAction, MM_FILL);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ActiveAction, MM_NOACTION);
+}
+
+void MM_ChildExecuteCmd_Test_InvalidCC(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_ChildExecuteCmd(&UT_CmdBuf.Buf, MM_PEEK_CC));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MM_LoadMemFromFileCmd, 0);
+    UtAssert_STUB_COUNT(MM_DumpMemToFileCmd, 0);
+    UtAssert_STUB_COUNT(MM_FillMemCmd, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CHILD_QUEUE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(MM_ChildInit_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_ChildInit_Test_Nominal");
+    UtTest_Add(MM_ChildInit_Test_MutexCreateError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_ChildInit_Test_MutexCreateError");
+    UtTest_Add(MM_ChildInit_Test_SemCreateError, MM_Test_Setup, MM_Test_TearDown, "MM_ChildInit_Test_SemCreateError");
+    UtTest_Add(MM_ChildInit_Test_WakeupSemCreateError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_ChildInit_Test_WakeupSemCreateError");
+    UtTest_Add(MM_ChildInit_Test_CreateTaskError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_ChildInit_Test_CreateTaskError");
+    UtTest_Add(MM_ChildState_Test_Mutex, MM_Test_Setup, MM_Test_TearDown, "MM_ChildState_Test_Mutex");
+    UtTest_Add(MM_ChildState_Test_NoMutex, MM_Test_Setup, MM_Test_TearDown, "MM_ChildState_Test_NoMutex");
+    UtTest_Add(MM_ChildLock_Test_Mutex, MM_Test_Setup, MM_Test_TearDown, "MM_ChildLock_Test_Mutex");
+    UtTest_Add(MM_ChildLock_Test_NoMutex, MM_Test_Setup, MM_Test_TearDown, "MM_ChildLock_Test_NoMutex");
+    UtTest_Add(MM_ChildVerifyIdle_Test_Idle, MM_Test_Setup, MM_Test_TearDown, "MM_ChildVerifyIdle_Test_Idle");
+    UtTest_Add(MM_ChildVerifyIdle_Test_Busy, MM_Test_Setup, MM_Test_TearDown, "MM_ChildVerifyIdle_Test_Busy");
+    UtTest_Add(MM_ChildTask_Test_SemTakeError, MM_Test_Setup, MM_Test_TearDown, "MM_ChildTask_Test_SemTakeError");
+    UtTest_Add(MM_ChildLoop_Test_ProcessCmd, MM_Test_Setup, MM_Test_TearDown, "MM_ChildLoop_Test_ProcessCmd");
+    UtTest_Add(MM_ChildProcess_Test_CmdError, MM_Test_Setup, MM_Test_TearDown, "MM_ChildProcess_Test_CmdError");
+    UtTest_Add(MM_ChildDispatchCmd_Test_Queued, MM_Test_Setup, MM_Test_TearDown, "MM_ChildDispatchCmd_Test_Queued");
+    UtTest_Add(MM_ChildDispatchCmd_Test_Busy, MM_Test_Setup, MM_Test_TearDown, "MM_ChildDispatchCmd_Test_Busy");
+    UtTest_Add(MM_ChildDispatchCmd_Test_CmdTooLarge, MM_Test_Setup, MM_Test_TearDown,
+               "MM_ChildDispatchCmd_Test_CmdTooLarge");
+    UtTest_Add(MM_ChildDispatchCmd_Test_SemGiveError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_ChildDispatchCmd_Test_SemGiveError");
+    UtTest_Add(MM_ChildDispatchCmd_Test_NoChildTask, MM_Test_Setup, MM_Test_TearDown,
+               "MM_ChildDispatchCmd_Test_NoChildTask");
+    UtTest_Add(MM_ChildExecuteCmd_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_ChildExecuteCmd_Test_Nominal");
+    UtTest_Add(MM_ChildExecuteCmd_Test_ActiveAction, MM_Test_Setup, MM_Test_TearDown,
+               "MM_ChildExecuteCmd_Test_ActiveAction");
+    UtTest_Add(MM_ChildExecuteCmd_Test_InvalidCC, MM_Test_Setup, MM_Test_TearDown,
+               "MM_ChildExecuteCmd_Test_InvalidCC");
+}
@@ -0,0 +1,678 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Unit tests for mm_codec.c
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_codec.h"
+#include "mm_test_utils.h"
+
+/************************************************************************
+** UT Includes
+*************************************************************************/
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include <string.h>
+#include "cfe.h"
+
+/* mm_codec_tests globals */
+#define UT_CODEC_DATA_SIZE 100000
+
+uint8 UT_CodecSrc[UT_CODEC_DATA_SIZE];
+uint8 UT_CodecEncoded[MM_RLE_MAX_ENCODED_SIZE(UT_CODEC_DATA_SIZE) + 4096];
+uint8 UT_CodecDecoded[UT_CODEC_DATA_SIZE];
+
+/*
+ * Function Definitions
+ */
+
+/* Encode UT_CodecSrc through an output buffer of OutSize bytes, InStep input bytes per call */
+size_t UT_CodecEncode(size_t SrcLen, size_t OutSize, size_t InStep)
+{
+    MM_RleEncoder_t Enc;
+    uint8           Out[MM_IO_BUFFER_SIZE];
+    size_t          EncodedLen = 0;
+    size_t          SrcPos     = 0;
+    size_t          Step;
+
+    MM_RleEncodeInit(&Enc, Out, OutSize);
+
+    while (SrcPos < SrcLen)
+    {
+        Step = SrcLen - SrcPos;
+        if (Step > InStep)
+        {
+            Step = InStep;
+        }
+
+        SrcPos += MM_RleEncode(&Enc, &UT_CodecSrc[SrcPos], Step);
+
+        if ((Enc.OutSize - Enc.OutLen) < MM_RLE_MAX_EMIT)
+        {
+            memcpy(&UT_CodecEncoded[EncodedLen], Out, Enc.OutLen);
+            EncodedLen += Enc.OutLen;
+            MM_RleEncodeRewind(&Enc);
+        }
+    }
+
+    MM_RleEncodeFinish(&Enc);
+    memcpy(&UT_CodecEncoded[EncodedLen], Out, Enc.OutLen);
+    EncodedLen += Enc.OutLen;
+
+    return EncodedLen;
+}
+
+/* Decode UT_CodecEncoded InStep bytes and OutStep bytes at a time, returns the decoded length */
+size_t UT_CodecDecode(size_t EncodedLen, size_t InStep, size_t OutStep, MM_RleDecoder_t *Dec)
+{
+    size_t SrcPos = 0;
+    size_t DstPos = 0;
+    size_t SrcLen;
+    size_t SrcUsed;
+    size_t Decoded;
+
+    MM_RleDecodeInit(Dec);
+
+    do
+    {
+        SrcLen = EncodedLen - SrcPos;
+        if (SrcLen > InStep)
+        {
+            SrcLen = InStep;
+        }
+
+        Decoded = MM_RleDecode(Dec, &UT_CodecEncoded[SrcPos], SrcLen, &SrcUsed, &UT_CodecDecoded[DstPos],
+                               OutStep < (sizeof(UT_CodecDecoded) - DstPos) ? OutStep
+                                                                           : (sizeof(UT_CodecDecoded) - DstPos));
+        SrcPos += SrcUsed;
+        DstPos += Decoded;
+    } while ((Decoded != 0) || (SrcUsed != 0));
+
+    return DstPos;
+}
+
+/* Fill UT_CodecSrc with bytes that rarely repeat */
+void UT_CodecFillRandom(size_t Length)
+{
+    uint32 Seed = 12345;
+    size_t i;
+
+    for (i = 0; i < Length; i++)
+    {
+        Seed           = (Seed * 1103515245) + 12345;
+        UT_CodecSrc[i] = (uint8)(Seed >> 16);
+    }
+}
+
+/* Fill UT_CodecSrc with runs of every length from 1 to 40 and some literal bytes */
+size_t UT_CodecFillMixed(void)
+{
+    size_t Length = 0;
+    size_t Run;
+    size_t i;
+
+    for (Run = 1; Run <= 40; Run++)
+    {
+        for (i = 0; i < Run; i++)
+        {
+            UT_CodecSrc[Length++] = (uint8)Run;
+        }
+
+        UT_CodecSrc[Length++] = 0xA5;
+        UT_CodecSrc[Length++] = 0x5A;
+    }
+
+    return Length;
+}
+
+/* Encode UT_CodecSrc with a file data encoder through an output buffer of OutSize bytes */
+size_t UT_CodecFileEncode(uint8 Encoding, uint8 FillValue, size_t SrcLen, size_t OutSize, size_t InStep)
+{
+    MM_FileEncoder_t Enc;
+    uint8            Out[MM_IO_BUFFER_SIZE];
+    const uint8 *    OutPtr;
+    size_t           OutLen;
+    size_t           EncodedLen = 0;
+    size_t           SrcPos     = 0;
+    size_t           Step;
+
+    MM_FileEncodeInit(&Enc, Encoding, FillValue, Out, OutSize);
+
+    while (SrcPos < SrcLen)
+    {
+        Step = SrcLen - SrcPos;
+        if (Step > InStep)
+        {
+            Step = InStep;
+        }
+
+        SrcPos += MM_FileEncode(&Enc, &UT_CodecSrc[SrcPos], Step);
+
+        if (MM_FileEncodeFull(&Enc))
+        {
+            OutLen = MM_FileEncodeOutput(&Enc, &OutPtr);
+            memcpy(&UT_CodecEncoded[EncodedLen], OutPtr, OutLen);
+            EncodedLen += OutLen;
+            MM_FileEncodeRewind(&Enc);
+        }
+    }
+
+    MM_FileEncodeFinish(&Enc);
+    OutLen = MM_FileEncodeOutput(&Enc, &OutPtr);
+    memcpy(&UT_CodecEncoded[EncodedLen], OutPtr, OutLen);
+    EncodedLen += OutLen;
+
+    return EncodedLen;
+}
+
+/* Decode UT_CodecEncoded with a file data decoder the way a load reads it, returns the decoded length */
+size_t UT_CodecFileDecode(uint8 Encoding, uint8 FillValue, size_t Size, size_t EncodedLen, size_t InStep,
+                          size_t OutStep, MM_FileDecoder_t *Dec)
+{
+    size_t SrcPos = 0;
+    size_t DstPos = 0;
+    size_t SrcLen;
+    size_t SrcUsed;
+    size_t DstLen;
+
+    MM_FileDecodeInit(Dec, Encoding, FillValue, Size);
+
+    while (DstPos < Size)
+    {
+        SrcLen = EncodedLen - SrcPos;
+        if (SrcLen > InStep)
+        {
+            SrcLen = InStep;
+        }
+
+        if ((SrcLen == 0) && !MM_FileDecodePending(Dec))
+        {
+            MM_FileDecodeEnd(Dec);
+        }
+
+        DstLen = Size - DstPos;
+        if (DstLen > OutStep)
+        {
+            DstLen = OutStep;
+        }
+
+        DstLen = MM_FileDecode(Dec, &UT_CodecEncoded[SrcPos], SrcLen, &SrcUsed, &UT_CodecDecoded[DstPos], DstLen);
+        if ((DstLen == 0) && (SrcUsed == 0))
+        {
+            break;
+        }
+
+        SrcPos += SrcUsed;
+        DstPos += DstLen;
+    }
+
+    return DstPos;
+}
+
+/* Fill UT_CodecSrc with data blocks between fill runs of every length from 1 to 40 */
+void UT_CodecFillSparse(size_t Length, uint8 FillValue)
+{
+    size_t Gap = 1;
+    size_t i   = 0;
+    size_t j;
+
+    UT_CodecFillRandom(Length);
+
+    while (i < Length)
+    {
+        /* Keep the random data clear of the fill value so the gaps are exact */
+        for (j = 0; (j < 64) && (i < Length); j++, i++)
+        {
+            if (UT_CodecSrc[i] == FillValue)
+            {
+                UT_CodecSrc[i] ^= 0x01;
+            }
+        }
+
+        for (j = 0; (j < Gap) && (i < Length); j++, i++)
+        {
+            UT_CodecSrc[i] = FillValue;
+        }
+
+        Gap = (Gap % 40) + 1;
+    }
+}
+
+void MM_RleEncode_Test_Run(void)
+{
+    const uint8 Expected[] = {0x80, 0x00, 0x00};
+    size_t      EncodedLen;
+
+    memset(UT_CodecSrc, 0, 4);
+
+    /* Execute the function being tested */
+    EncodedLen = UT_CodecEncode(4, MM_IO_BUFFER_SIZE, 4);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(EncodedLen, sizeof(Expected));
+    UtAssert_MemCmp(UT_CodecEncoded, Expected, sizeof(Expected), "Four zeros are one run record");
+}
+
+void MM_RleEncode_Test_Literal(void)
+{
+    const uint8 Expected[] = {0x05, 'A', 'B', 'B', 'B', 'C', 'C'};
+    size_t      EncodedLen;
+
+    memcpy(UT_CodecSrc, "ABBBCC", 6);
+
+    /* Execute the function being tested */
+    EncodedLen = UT_CodecEncode(6, MM_IO_BUFFER_SIZE, 6);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(EncodedLen, sizeof(Expected));
+    UtAssert_MemCmp(UT_CodecEncoded, Expected, sizeof(Expected), "Short runs are kept in one literal record");
+}
+
+void MM_RleEncode_Test_MaxRun(void)
+{
+    const uint8 Expected[] = {0xFF, 0xFF, 0x00, 0x00, 0x00};
+    size_t      EncodedLen;
+
+    memset(UT_CodecSrc, 0, MM_RLE_MAX_RUN + 1);
+
+    /* Execute the function being tested */
+    EncodedLen = UT_CodecEncode(MM_RLE_MAX_RUN + 1, MM_IO_BUFFER_SIZE, MM_RLE_MAX_RUN + 1);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(EncodedLen, sizeof(Expected));
+    UtAssert_MemCmp(UT_CodecEncoded, Expected, sizeof(Expected), "A run one over the maximum ends in a literal");
+}
+
+void MM_RleEncode_Test_LiteralLimit(void)
+{
+    size_t EncodedLen;
+
+    UT_CodecFillRandom(MM_RLE_MAX_LITERAL + 1);
+
+    /* Execute the function being tested */
+    EncodedLen = UT_CodecEncode(MM_RLE_MAX_LITERAL + 1, MM_IO_BUFFER_SIZE, MM_RLE_MAX_LITERAL + 1);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(EncodedLen, MM_RLE_MAX_LITERAL + 3);
+    UtAssert_UINT32_EQ(UT_CodecEncoded[0], MM_RLE_MAX_LITERAL - 1);
+    UtAssert_UINT32_EQ(UT_CodecEncoded[MM_RLE_MAX_LITERAL + 1], 0);
+}
+
+void MM_RleEncode_Test_OutputFull(void)
+{
+    MM_RleEncoder_t Enc;
+    uint8           Out[16];
+
+    UT_CodecFillRandom(100);
+    MM_RleEncodeInit(&Enc, Out, sizeof(Out));
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(MM_RleEncode(&Enc, UT_CodecSrc, 100), 9);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Enc.OutLen, 9);
+    UtAssert_UINT32_EQ(Enc.RunLength, 1);
+
+    MM_RleEncodeRewind(&Enc);
+    UtAssert_UINT32_EQ(Enc.OutLen, 0);
+    UtAssert_UINT32_EQ(Enc.LiteralCount, 0);
+}
+
+void MM_RleRoundTrip_Test_Zeros(void)
+{
+    MM_RleDecoder_t Dec;
+    size_t          EncodedLen;
+
+    memset(UT_CodecSrc, 0, UT_CODEC_DATA_SIZE);
+
+    /* Execute the function being tested */
+    EncodedLen = UT_CodecEncode(UT_CODEC_DATA_SIZE, MM_IO_BUFFER_SIZE, 1000);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(EncodedLen, 12);
+    UtAssert_UINT32_EQ(UT_CodecDecode(EncodedLen, EncodedLen, UT_CODEC_DATA_SIZE, &Dec), UT_CODEC_DATA_SIZE);
+    UtAssert_UINT32_EQ(Dec.State, MM_RLE_STATE_CTRL);
+    UtAssert_MemCmp(UT_CodecDecoded, UT_CodecSrc, UT_CODEC_DATA_SIZE, "Zeros decode");
+}
+
+void MM_RleRoundTrip_Test_Random(void)
+{
+    MM_RleDecoder_t Dec;
+    size_t          EncodedLen;
+
+    UT_CodecFillRandom(UT_CODEC_DATA_SIZE);
+
+    /* Execute the function being tested */
+    EncodedLen = UT_CodecEncode(UT_CODEC_DATA_SIZE, MM_IO_BUFFER_SIZE, 333);
+
+    /* Verify results */
+    UtAssert_True(EncodedLen <= MM_RLE_MAX_ENCODED_SIZE(UT_CODEC_DATA_SIZE), "Encoded size %u within limit",
+                  (unsigned int)EncodedLen);
+    UtAssert_UINT32_EQ(UT_CodecDecode(EncodedLen, 200, 300, &Dec), UT_CODEC_DATA_SIZE);
+    UtAssert_UINT32_EQ(Dec.State, MM_RLE_STATE_CTRL);
+    UtAssert_MemCmp(UT_CodecDecoded, UT_CodecSrc, UT_CODEC_DATA_SIZE, "Random data decodes");
+}
+
+void MM_RleRoundTrip_Test_Mixed(void)
+{
+    MM_RleDecoder_t Dec;
+    size_t          EncodedLen;
+    size_t          Length = UT_CodecFillMixed();
+
+    /* Execute the function being tested, one byte at a time through a small output buffer */
+    EncodedLen = UT_CodecEncode(Length, 16, 1);
+
+    /* Verify results, one byte at a time in both directions */
+    UtAssert_True(EncodedLen < Length, "Encoded size %u less than %u", (unsigned int)EncodedLen,
+                  (unsigned int)Length);
+    UtAssert_UINT32_EQ(UT_CodecDecode(EncodedLen, 1, 1, &Dec), Length);
+    UtAssert_UINT32_EQ(Dec.State, MM_RLE_STATE_CTRL);
+    UtAssert_MemCmp(UT_CodecDecoded, UT_CodecSrc, Length, "Mixed data decodes");
+}
+
+void MM_RleDecode_Test_Truncated(void)
+{
+    MM_RleDecoder_t Dec;
+    size_t          EncodedLen;
+
+    memset(UT_CodecSrc, 0x55, 1000);
+    EncodedLen = UT_CodecEncode(1000, MM_IO_BUFFER_SIZE, 1000);
+
+    /* Execute the function being tested without the run value */
+    UtAssert_UINT32_EQ(UT_CodecDecode(EncodedLen - 1, EncodedLen, 1000, &Dec), 0);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Dec.State, MM_RLE_STATE_RUN_VAL);
+}
+
+void MM_RleDecode_Test_OutputFull(void)
+{
+    MM_RleDecoder_t Dec;
+    const uint8     Src[] = {0x80, 0x06, 0x77, 0x01, 'A', 'B'};
+    uint8           Dst[8];
+    size_t          SrcUsed;
+
+    MM_RleDecodeInit(&Dec);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(MM_RleDecode(&Dec, Src, sizeof(Src), &SrcUsed, Dst, 8), 8);
+
+    /* Verify results, the run is two bytes short of its end */
+    UtAssert_UINT32_EQ(SrcUsed, 3);
+    UtAssert_UINT32_EQ(Dec.State, MM_RLE_STATE_RUN);
+    UtAssert_UINT32_EQ(Dec.Count, 2);
+
+    /* The rest of the run needs no input */
+    UtAssert_UINT32_EQ(MM_RleDecode(&Dec, Src, 0, &SrcUsed, Dst, 8), 2);
+    UtAssert_UINT32_EQ(SrcUsed, 0);
+    UtAssert_UINT32_EQ(Dec.State, MM_RLE_STATE_CTRL);
+
+    UtAssert_UINT32_EQ(MM_RleDecode(&Dec, &Src[3], 3, &SrcUsed, Dst, 0), 0);
+    UtAssert_UINT32_EQ(SrcUsed, 0);
+}
+
+void MM_SparseScanFill_Test(void)
+{
+    uint32 Words[8];
+    uint8 *Src = (uint8 *)Words;
+
+    memset(Words, 0xFF, sizeof(Words));
+    Src[29] = 0x00;
+
+    /* Execute the function being tested, aligned and unaligned starts */
+    UtAssert_UINT32_EQ(MM_SparseScanFill(Src, sizeof(Words), 0xFF), 29);
+    UtAssert_UINT32_EQ(MM_SparseScanFill(&Src[3], sizeof(Words) - 3, 0xFF), 26);
+    UtAssert_UINT32_EQ(MM_SparseScanFill(&Src[3], 10, 0xFF), 10);
+
+    /* Verify results, no fill at the start */
+    UtAssert_UINT32_EQ(MM_SparseScanFill(&Src[29], 3, 0xFF), 0);
+    UtAssert_UINT32_EQ(MM_SparseScanFill(Src, 0, 0xFF), 0);
+}
+
+void MM_SparseScanData_Test(void)
+{
+    uint32 Words[16];
+    uint8 *Src = (uint8 *)Words;
+
+    memset(Words, 0x5A, sizeof(Words));
+
+    /* Execute the function being tested, data up to a long fill run */
+    memset(&Src[21], 0x00, MM_SPARSE_MIN_GAP);
+    UtAssert_UINT32_EQ(MM_SparseScanData(Src, sizeof(Words), 0x00), 21);
+    UtAssert_UINT32_EQ(MM_SparseScanData(&Src[1], sizeof(Words) - 1, 0x00), 20);
+
+    /* Verify results, a short fill run is kept in the data */
+    Src[21 + MM_SPARSE_MIN_GAP - 1] = 0x5A;
+    UtAssert_UINT32_EQ(MM_SparseScanData(Src, sizeof(Words), 0x00), sizeof(Words));
+
+    /* Fill at the end is left out however short */
+    UtAssert_UINT32_EQ(MM_SparseScanData(Src, 23, 0x00), 21);
+    UtAssert_UINT32_EQ(MM_SparseScanData(&Src[21], 2, 0x00), 0);
+}
+
+void MM_SparseEncode_Test_Extents(void)
+{
+    MM_SparseExtent_t Extent;
+    size_t            EncodedLen;
+
+    memset(UT_CodecSrc, 0x00, 100);
+    memset(&UT_CodecSrc[40], 0x11, 4);
+    UT_CodecSrc[99] = 0x22;
+
+    /* Execute the function being tested */
+    EncodedLen = UT_CodecFileEncode(MM_ENCODING_SPARSE, 0x00, 100, MM_IO_BUFFER_SIZE, 100);
+
+    /* Verify results, one extent for each data block and nothing for the fill */
+    UtAssert_UINT32_EQ(EncodedLen, (2 * sizeof(Extent)) + 5);
+    memcpy(&Extent, UT_CodecEncoded, sizeof(Extent));
+    UtAssert_UINT32_EQ(Extent.Offset, 40);
+    UtAssert_UINT32_EQ(Extent.Length, 4);
+    memcpy(&Extent, &UT_CodecEncoded[sizeof(Extent) + 4], sizeof(Extent));
+    UtAssert_UINT32_EQ(Extent.Offset, 99);
+    UtAssert_UINT32_EQ(Extent.Length, 1);
+}
+
+void MM_SparseEncode_Test_OutputFull(void)
+{
+    MM_SparseEncoder_t Enc;
+    uint8              Out[sizeof(MM_SparseExtent_t) + MM_SPARSE_MIN_GAP + 4];
+
+    memset(UT_CodecSrc, 0x33, 100);
+    MM_SparseEncodeInit(&Enc, 0x00, Out, sizeof(Out));
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(MM_SparseEncode(&Enc, UT_CodecSrc, 100), MM_SPARSE_MIN_GAP + 4);
+
+    /* Verify results, the rest of the data is encoded after the output is written */
+    UtAssert_UINT32_EQ(Enc.OutLen, sizeof(Out));
+    UtAssert_UINT32_EQ(MM_SparseEncode(&Enc, UT_CodecSrc, 100), 0);
+}
+
+void MM_SparseRoundTrip_Test_Zeros(void)
+{
+    MM_FileDecoder_t Dec;
+    size_t           EncodedLen;
+
+    memset(UT_CodecSrc, 0x00, UT_CODEC_DATA_SIZE);
+
+    /* Execute the function being tested */
+    EncodedLen = UT_CodecFileEncode(MM_ENCODING_SPARSE, 0x00, UT_CODEC_DATA_SIZE, MM_IO_BUFFER_SIZE, 1000);
+
+    /* Verify results, all fill is no data at all */
+    UtAssert_UINT32_EQ(EncodedLen, 0);
+    memset(UT_CodecDecoded, 0x5A, sizeof(UT_CodecDecoded));
+    UtAssert_UINT32_EQ(
+        UT_CodecFileDecode(MM_ENCODING_SPARSE, 0x00, UT_CODEC_DATA_SIZE, EncodedLen, 1000, 3000, &Dec),
+        UT_CODEC_DATA_SIZE);
+    UtAssert_BOOL_TRUE(MM_FileDecodeDone(&Dec));
+    UtAssert_MemCmp(UT_CodecDecoded, UT_CodecSrc, UT_CODEC_DATA_SIZE, "Zeros decode");
+}
+
+void MM_SparseRoundTrip_Test_Fill(void)
+{
+    MM_FileDecoder_t Dec;
+    size_t           EncodedLen;
+    uint8            FillValue[] = {0x00, 0xFF};
+    size_t           i;
+
+    for (i = 0; i < sizeof(FillValue); i++)
+    {
+        UT_CodecFillSparse(UT_CODEC_DATA_SIZE, FillValue[i]);
+
+        /* Execute the function being tested */
+        EncodedLen =
+            UT_CodecFileEncode(MM_ENCODING_SPARSE, FillValue[i], UT_CODEC_DATA_SIZE, MM_IO_BUFFER_SIZE, 777);
+
+        /* Verify results, through odd sized input and output steps */
+        UtAssert_True(EncodedLen < UT_CODEC_DATA_SIZE, "Encoded size %u less than %u", (unsigned int)EncodedLen,
+                      (unsigned int)UT_CODEC_DATA_SIZE);
+        UtAssert_UINT32_EQ(
+            UT_CodecFileDecode(MM_ENCODING_SPARSE, FillValue[i], UT_CODEC_DATA_SIZE, EncodedLen, 5, 301, &Dec),
+            UT_CODEC_DATA_SIZE);
+        UtAssert_BOOL_TRUE(MM_FileDecodeDone(&Dec));
+        UtAssert_MemCmp(UT_CodecDecoded, UT_CodecSrc, UT_CODEC_DATA_SIZE, "Sparse data decodes");
+    }
+}
+
+void MM_SparseRoundTrip_Test_SmallOutput(void)
+{
+    MM_FileDecoder_t Dec;
+    size_t           EncodedLen;
+
+    UT_CodecFillSparse(5000, 0xFF);
+
+    /* Execute the function being tested, one byte at a time through a small output buffer */
+    EncodedLen = UT_CodecFileEncode(MM_ENCODING_SPARSE, 0xFF, 5000, sizeof(MM_SparseExtent_t) + 20, 1);
+
+    /* Verify results, one byte at a time in both directions */
+    UtAssert_UINT32_EQ(UT_CodecFileDecode(MM_ENCODING_SPARSE, 0xFF, 5000, EncodedLen, 1, 1, &Dec), 5000);
+    UtAssert_BOOL_TRUE(MM_FileDecodeDone(&Dec));
+    UtAssert_MemCmp(UT_CodecDecoded, UT_CodecSrc, 5000, "Sparse data decodes");
+}
+
+void MM_SparseDecode_Test_Errors(void)
+{
+    MM_SparseDecoder_t Dec;
+    MM_SparseExtent_t  Extent[2];
+    uint8              Dst[32];
+    size_t             SrcUsed;
+
+    /* Execute the function being tested, an extent past the end */
+    Extent[0].Offset = 30;
+    Extent[0].Length = 3;
+    MM_SparseDecodeInit(&Dec, 0x00, 32);
+    UtAssert_UINT32_EQ(MM_SparseDecode(&Dec, (uint8 *)Extent, sizeof(Extent[0]), &SrcUsed, Dst, sizeof(Dst)), 0);
+    UtAssert_UINT32_EQ(Dec.State, MM_SPARSE_STATE_ERROR);
+
+    /* An empty extent */
+    Extent[0].Offset = 8;
+    Extent[0].Length = 0;
+    Extent[1]        = Extent[0];
+    MM_SparseDecodeInit(&Dec, 0x00, 32);
+    UtAssert_UINT32_EQ(MM_SparseDecode(&Dec, (uint8 *)Extent, sizeof(Extent), &SrcUsed, Dst, sizeof(Dst)), 0);
+    UtAssert_UINT32_EQ(SrcUsed, sizeof(Extent[0]));
+    UtAssert_UINT32_EQ(Dec.State, MM_SPARSE_STATE_ERROR);
+
+    /* Extents out of order, the data of the first is decoded */
+    Extent[0].Offset = 8;
+    Extent[0].Length = 4;
+    Extent[1].Offset = 4;
+    Extent[1].Length = 4;
+    memcpy(UT_CodecEncoded, &Extent[0], sizeof(Extent[0]));
+    memset(&UT_CodecEncoded[sizeof(Extent[0])], 0x66, 4);
+    memcpy(&UT_CodecEncoded[sizeof(Extent[0]) + 4], &Extent[1], sizeof(Extent[1]));
+    MM_SparseDecodeInit(&Dec, 0x00, 32);
+    UtAssert_UINT32_EQ(MM_SparseDecode(&Dec, UT_CodecEncoded, sizeof(Extent) + 4, &SrcUsed, Dst, sizeof(Dst)), 12);
+    UtAssert_UINT32_EQ(SrcUsed, sizeof(Extent) + 4);
+    UtAssert_UINT32_EQ(Dec.State, MM_SPARSE_STATE_ERROR);
+
+    /* Verify results, nothing more is decoded once in error */
+    UtAssert_UINT32_EQ(MM_SparseDecode(&Dec, (uint8 *)Extent, sizeof(Extent), &SrcUsed, Dst, sizeof(Dst)), 0);
+    UtAssert_UINT32_EQ(SrcUsed, 0);
+}
+
+void MM_SparseDecode_Test_Truncated(void)
+{
+    MM_FileDecoder_t Dec;
+    size_t           EncodedLen;
+
+    memset(UT_CodecSrc, 0xFF, 64);
+    memset(&UT_CodecSrc[32], 0x44, 8);
+    EncodedLen = UT_CodecFileEncode(MM_ENCODING_SPARSE, 0xFF, 64, MM_IO_BUFFER_SIZE, 64);
+
+    /* Execute the function being tested without the last data byte */
+    UtAssert_UINT32_EQ(UT_CodecFileDecode(MM_ENCODING_SPARSE, 0xFF, 64, EncodedLen - 1, 64, 64, &Dec), 39);
+
+    /* Verify results, the trailing fill isn't output inside an extent */
+    UtAssert_UINT32_EQ(Dec.Codec.Sparse.State, MM_SPARSE_STATE_DATA);
+    UtAssert_BOOL_FALSE(MM_FileDecodeDone(&Dec));
+    UtAssert_BOOL_FALSE(MM_FileDecodePending(&Dec));
+}
+
+void MM_FileCodec_Test_Rle(void)
+{
+    MM_FileDecoder_t Dec;
+    size_t           EncodedLen;
+    size_t           Length = UT_CodecFillMixed();
+
+    /* Execute the function being tested */
+    EncodedLen = UT_CodecFileEncode(MM_ENCODING_RLE, 0x00, Length, 16, 3);
+
+    /* Verify results, the run length encoding is the same through the file data functions */
+    UtAssert_UINT32_EQ(EncodedLen, UT_CodecEncode(Length, 16, 3));
+    UtAssert_UINT32_EQ(UT_CodecFileDecode(MM_ENCODING_RLE, 0x00, Length, EncodedLen, 7, 11, &Dec), Length);
+    UtAssert_BOOL_TRUE(MM_FileDecodeDone(&Dec));
+    UtAssert_BOOL_FALSE(MM_FileDecodePending(&Dec));
+    UtAssert_MemCmp(UT_CodecDecoded, UT_CodecSrc, Length, "Mixed data decodes");
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(MM_RleEncode_Test_Run, MM_Test_Setup, MM_Test_TearDown, "MM_RleEncode_Test_Run");
+    UtTest_Add(MM_RleEncode_Test_Literal, MM_Test_Setup, MM_Test_TearDown, "MM_RleEncode_Test_Literal");
+    UtTest_Add(MM_RleEncode_Test_MaxRun, MM_Test_Setup, MM_Test_TearDown, "MM_RleEncode_Test_MaxRun");
+    UtTest_Add(MM_RleEncode_Test_LiteralLimit, MM_Test_Setup, MM_Test_TearDown, "MM_RleEncode_Test_LiteralLimit");
+    UtTest_Add(MM_RleEncode_Test_OutputFull, MM_Test_Setup, MM_Test_TearDown, "MM_RleEncode_Test_OutputFull");
+    UtTest_Add(MM_RleRoundTrip_Test_Zeros, MM_Test_Setup, MM_Test_TearDown, "MM_RleRoundTrip_Test_Zeros");
+    UtTest_Add(MM_RleRoundTrip_Test_Random, MM_Test_Setup, MM_Test_TearDown, "MM_RleRoundTrip_Test_Random");
+    UtTest_Add(MM_RleRoundTrip_Test_Mixed, MM_Test_Setup, MM_Test_TearDown, "MM_RleRoundTrip_Test_Mixed");
+    UtTest_Add(MM_RleDecode_Test_Truncated, MM_Test_Setup, MM_Test_TearDown, "MM_RleDecode_Test_Truncated");
+    UtTest_Add(MM_RleDecode_Test_OutputFull, MM_Test_Setup, MM_Test_TearDown, "MM_RleDecode_Test_OutputFull");
+    UtTest_Add(MM_SparseScanFill_Test, MM_Test_Setup, MM_Test_TearDown, "MM_SparseScanFill_Test");
+    UtTest_Add(MM_SparseScanData_Test, MM_Test_Setup, MM_Test_TearDown, "MM_SparseScanData_Test");
+    UtTest_Add(MM_SparseEncode_Test_Extents, MM_Test_Setup, MM_Test_TearDown, "MM_SparseEncode_Test_Extents");
+    UtTest_Add(MM_SparseEncode_Test_OutputFull, MM_Test_Setup, MM_Test_TearDown, "MM_SparseEncode_Test_OutputFull");
+    UtTest_Add(MM_SparseRoundTrip_Test_Zeros, MM_Test_Setup, MM_Test_TearDown, "MM_SparseRoundTrip_Test_Zeros");
+    UtTest_Add(MM_SparseRoundTrip_Test_Fill, MM_Test_Setup, MM_Test_TearDown, "MM_SparseRoundTrip_Test_Fill");
+    UtTest_Add(MM_SparseRoundTrip_Test_SmallOutput, MM_Test_Setup, MM_Test_TearDown,
+               "MM_SparseRoundTrip_Test_SmallOutput");
+    UtTest_Add(MM_SparseDecode_Test_Errors, MM_Test_Setup, MM_Test_TearDown, "MM_SparseDecode_Test_Errors");
+    UtTest_Add(MM_SparseDecode_Test_Truncated, MM_Test_Setup, MM_Test_TearDown, "MM_SparseDecode_Test_Truncated");
+    UtTest_Add(MM_FileCodec_Test_Rle, MM_Test_Setup, MM_Test_TearDown, "MM_FileCodec_Test_Rle");
+}
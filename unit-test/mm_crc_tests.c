@@ -0,0 +1,162 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Unit tests for mm_crc.c
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_crc.h"
+#include "mm_test_utils.h"
+
+/************************************************************************
+** UT Includes
+*************************************************************************/
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include "cfe.h"
+
+/* mm_crc_tests globals */
+#define UT_CRC_DATA_SIZE 1024
+
+uint8 UT_CrcData[UT_CRC_DATA_SIZE + MM_CRC_SLICES];
+
+/*
+ * Function Definitions
+ */
+
+/* Byte at a time CRC-16/ARC, the way CFE_ES_CalculateCRC computes it */
+uint32 UT_CrcReference(const uint8 *DataPtr, size_t DataLength, uint32 InputCRC)
+{
+    uint16 Crc = (uint16)InputCRC;
+    uint32 Bit;
+
+    while (DataLength > 0)
+    {
+        Crc ^= *DataPtr;
+        for (Bit = 0; Bit < 8; Bit++)
+        {
+            if ((Crc & 1) != 0)
+            {
+                Crc = (Crc >> 1) ^ MM_CRC16_POLY;
+            }
+            else
+            {
+                Crc = Crc >> 1;
+            }
+        }
+
+        DataPtr++;
+        DataLength--;
+    }
+
+    return Crc;
+}
+
+void UT_CrcSetup(void)
+{
+    uint32 i;
+    uint32 Seed = 12345;
+
+    MM_Test_Setup();
+
+    for (i = 0; i < sizeof(UT_CrcData); i++)
+    {
+        Seed          = (Seed * 1103515245) + 12345;
+        UT_CrcData[i] = (uint8)(Seed >> 16);
+    }
+
+    MM_CrcInit();
+}
+
+void MM_CalculateCRC_Test_CheckValue(void)
+{
+    const char CheckString[] = "123456789";
+
+    /* Execute the function being tested, this is the published CRC-16/ARC check value */
+    UtAssert_UINT32_EQ(MM_CalculateCRC(CheckString, 9, 0, CFE_ES_CrcType_CRC_16), 0xBB3D);
+}
+
+void MM_CalculateCRC_Test_Lengths(void)
+{
+    size_t Length;
+    size_t Offset;
+    uint32 Mismatches = 0;
+
+    /* Every tail length and every alignment of the eight byte steps */
+    for (Offset = 0; Offset < MM_CRC_SLICES; Offset++)
+    {
+        for (Length = 0; Length <= 64; Length++)
+        {
+            if (MM_CalculateCRC(&UT_CrcData[Offset], Length, 0x5A5A, CFE_ES_CrcType_CRC_16) !=
+                UT_CrcReference(&UT_CrcData[Offset], Length, 0x5A5A))
+            {
+                Mismatches++;
+            }
+        }
+    }
+
+    UtAssert_UINT32_EQ(Mismatches, 0);
+    UtAssert_UINT32_EQ(MM_CalculateCRC(UT_CrcData, UT_CRC_DATA_SIZE, 0, CFE_ES_CrcType_CRC_16),
+                       UT_CrcReference(UT_CrcData, UT_CRC_DATA_SIZE, 0));
+}
+
+void MM_CalculateCRC_Test_Continued(void)
+{
+    uint32 Crc;
+
+    /* Execute the function being tested, a CRC taken in pieces matches one taken at once */
+    Crc = MM_CalculateCRC(UT_CrcData, 13, 0, CFE_ES_CrcType_CRC_16);
+    Crc = MM_CalculateCRC(&UT_CrcData[13], 200, Crc, CFE_ES_CrcType_CRC_16);
+    Crc = MM_CalculateCRC(&UT_CrcData[213], UT_CRC_DATA_SIZE - 213, Crc, CFE_ES_CrcType_CRC_16);
+
+    UtAssert_UINT32_EQ(Crc, UT_CrcReference(UT_CrcData, UT_CRC_DATA_SIZE, 0));
+}
+
+void MM_CalculateCRC_Test_ZeroLength(void)
+{
+    /* Execute the function being tested, the input CRC is returned as it is */
+    UtAssert_UINT32_EQ(MM_CalculateCRC(UT_CrcData, 0, 0x12345678, CFE_ES_CrcType_CRC_16), 0x12345678);
+}
+
+void MM_CalculateCRC_Test_OtherType(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 0x4321);
+
+    /* Execute the function being tested, other CRC types are computed by cFE */
+    UtAssert_UINT32_EQ(MM_CalculateCRC(UT_CrcData, 16, 0, CFE_ES_CrcType_NONE), 0x4321);
+    UtAssert_STUB_COUNT(CFE_ES_CalculateCRC, 1);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(MM_CalculateCRC_Test_CheckValue, UT_CrcSetup, MM_Test_TearDown, "MM_CalculateCRC_Test_CheckValue");
+    UtTest_Add(MM_CalculateCRC_Test_Lengths, UT_CrcSetup, MM_Test_TearDown, "MM_CalculateCRC_Test_Lengths");
+    UtTest_Add(MM_CalculateCRC_Test_Continued, UT_CrcSetup, MM_Test_TearDown, "MM_CalculateCRC_Test_Continued");
+    UtTest_Add(MM_CalculateCRC_Test_ZeroLength, UT_CrcSetup, MM_Test_TearDown, "MM_CalculateCRC_Test_ZeroLength");
+    UtTest_Add(MM_CalculateCRC_Test_OtherType, UT_CrcSetup, MM_Test_TearDown, "MM_CalculateCRC_Test_OtherType");
+}
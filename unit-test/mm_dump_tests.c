@@ -26,6 +26,7 @@
 ** Includes
 *************************************************************************/
 #include "mm_dump.h"
+#include "mm_load.h"
 #include "mm_msg.h"
 #include "mm_msgdefs.h"
 #include "mm_msgids.h"
@@ -33,6 +34,8 @@
 #include "mm_filedefs.h"
 #include "mm_version.h"
 #include "mm_utils.h"
+#include "mm_crc.h"
+#include "mm_symidx.h"
 #include "mm_test_utils.h"
 #include "mm_mem32.h"
 #include "mm_mem16.h"
@@ -53,7 +56,10 @@
 /* mm_dump_tests globals */
 uint8 call_count_CFE_EVS_SendEvent;
 
-uint8 Buffer[MM_MAX_FILL_DATA_SEG * 2];
+uint8 Buffer[MM_IO_BUFFER_SIZE * 2];
+
+/* Last event message text, with its arguments formatted */
+char UT_EventText[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
 /*
  * Function Definitions
@@ -80,6 +86,80 @@ int32 UT_MM_LOAD_TEST_OS_WriteHook1(void *UserObj, int32 StubRetcode, uint32 Cal
     return sizeof(MM_LoadDumpFileHeader_t);
 }
 
+int32 UT_MM_DUMP_TEST_MM_FileEncodeInitHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                            const UT_StubContext_t *Context)
+{
+    uint8 *Args = (uint8 *)UserObj;
+
+    /* Capture the encoding and fill value the dump was started with */
+    Args[0] = UT_Hook_GetArgValueByName(Context, "Encoding", uint8);
+    Args[1] = UT_Hook_GetArgValueByName(Context, "FillValue", uint8);
+
+    return StubRetcode;
+}
+
+/* Memory of an encoded dump and the first byte the CRC and the encoder saw */
+typedef struct
+{
+    uint8 *Memory;
+    uint8  CrcByte;
+    uint8  EncodedByte;
+} UT_MM_EncodeCopy_t;
+
+int32 UT_MM_DUMP_TEST_MM_CalculateCRCHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                          const UT_StubContext_t *Context)
+{
+    UT_MM_EncodeCopy_t *Copy    = (UT_MM_EncodeCopy_t *)UserObj;
+    const uint8 *       DataPtr = UT_Hook_GetArgValueByName(Context, "DataPtr", const uint8 *);
+
+    /* Memory changes once the CRC has read it */
+    Copy->CrcByte   = DataPtr[0];
+    Copy->Memory[0] = 0x55;
+
+    return StubRetcode;
+}
+
+int32 UT_MM_DUMP_TEST_MM_FileEncodeHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                        const UT_StubContext_t *Context)
+{
+    UT_MM_EncodeCopy_t *Copy = (UT_MM_EncodeCopy_t *)UserObj;
+    const uint8 *       Src  = UT_Hook_GetArgValueByName(Context, "Src", const uint8 *);
+
+    Copy->EncodedByte = Src[0];
+
+    return StubRetcode;
+}
+
+int32 UT_MM_DUMP_TEST_MM_ReadFileHeadersHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                             const UT_StubContext_t *Context)
+{
+    MM_LoadDumpFileHeader_t *MMHeader = UT_Hook_GetArgValueByName(Context, "MMHeader", MM_LoadDumpFileHeader_t *);
+
+    /* Return the baseline header handed to the hook */
+    memcpy(MMHeader, UserObj, sizeof(*MMHeader));
+
+    return StubRetcode;
+}
+
+int32 UT_MM_DUMP_TEST_MM_SymIndexFormatHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                            const UT_StubContext_t *Context)
+{
+    char * Buf        = UT_Hook_GetArgValueByName(Context, "Buffer", char *);
+    size_t BufferSize = UT_Hook_GetArgValueByName(Context, "BufferSize", size_t);
+
+    snprintf(Buf, BufferSize, "Alpha+0x10");
+
+    return true;
+}
+
+void UT_MM_DUMP_TEST_CFE_EVS_SendEventHandler(void *UserObj, UT_EntryKey_t FuncKey, const UT_StubContext_t *Context,
+                                              va_list va)
+{
+    const char *Spec = UT_Hook_GetArgValueByName(Context, "Spec", const char *);
+
+    vsnprintf(UT_EventText, sizeof(UT_EventText), Spec, va);
+}
+
 void MM_PeekCmd_Test_Nominal(void)
 {
     CFE_SB_MsgId_t    TestMsgId;
@@ -106,6 +186,8 @@ void MM_PeekCmd_Test_Nominal(void)
 
     UT_SetDeferredRetcode(UT_KEY(MM_VerifyPeekPokeParams), 1, true);
 
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadMemBlock), true);
+
     /* Execute the function being tested */
     Result = MM_PeekCmd(&UT_CmdBuf.Buf);
 
@@ -219,6 +301,7 @@ void MM_PeekMem_Test_Byte(void)
 {
     MM_PeekCmd_t CmdPacket;
     uint32       SrcAddress = 1;
+    uint8        ByteValue  = 1;
     int32        strCmpResult;
     char         ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
     bool         Result;
@@ -229,10 +312,15 @@ void MM_PeekMem_Test_Byte(void)
     CmdPacket.Payload.DataSize = MM_BYTE_BIT_WIDTH;
     CmdPacket.Payload.MemType  = MM_RAM;
 
+    /* Driver reads back the low byte of the address, as the PSP stub did */
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadMemBlock), true);
+    UT_SetDataBuffer(UT_KEY(MM_ReadMemBlock), &ByteValue, sizeof(ByteValue), false);
+
     /* Execute the function being tested */
     Result = MM_PeekMem(&CmdPacket, SrcAddress);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(MM_ReadMemBlock, 1);
     UtAssert_True(Result == true, "Result == true");
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_PEEK_BYTE_INF_EID);
@@ -261,39 +349,32 @@ void MM_PeekMem_Test_Byte(void)
 void MM_PeekMem_Test_ByteError(void)
 {
     MM_PeekCmd_t CmdPacket;
-    uint32       SrcAddress = 1;
-    int32        strCmpResult;
-    char         ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    uint32       SrcAddress = 0;
     bool         Result;
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "PSP read memory error: RC=%%d, Address=%%p, MemType=MEM%%u");
-
     CmdPacket.Payload.DataSize = MM_BYTE_BIT_WIDTH;
+    CmdPacket.Payload.MemType  = MM_RAM;
 
-    /* Set to generate error message MM_PSP_READ_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRead8), 1, -1);
+    /* Driver read fails, the driver sends its own error event */
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadMemBlock), false);
 
     /* Execute the function being tested */
     Result = MM_PeekMem(&CmdPacket, SrcAddress);
 
     /* Verify results */
     UtAssert_True(Result == false, "Result == false");
-
-    /* No command-handling function should be updating the cmd or err counter itself */
-    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
-    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
-
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    UtAssert_STUB_COUNT(MM_ReadMemBlock, 1);
+    UtAssert_True(MM_AppData.HkPacket.Payload.LastAction == MM_NOACTION,
+                  "MM_AppData.HkPacket.Payload.LastAction == MM_NOACTION");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
                   call_count_CFE_EVS_SendEvent);
+
+    /* No command-handling function should be updating the cmd or err counter itself */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 }
 
 void MM_PeekMem_Test_Word(void)
@@ -310,10 +391,13 @@ void MM_PeekMem_Test_Word(void)
     CmdPacket.Payload.DataSize = MM_WORD_BIT_WIDTH;
     CmdPacket.Payload.MemType  = MM_RAM;
 
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadMemBlock), true);
+
     /* Execute the function being tested */
     Result = MM_PeekMem(&CmdPacket, SrcAddress);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(MM_ReadMemBlock, 1);
     UtAssert_True(Result == true, "Result == true");
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_PEEK_WORD_INF_EID);
@@ -343,39 +427,31 @@ void MM_PeekMem_Test_WordError(void)
 {
     MM_PeekCmd_t CmdPacket;
     uint32       SrcAddress = 0;
-    int32        strCmpResult;
-    char         ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
     bool         Result;
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "PSP read memory error: RC=%%d, Address=%%p, MemType=MEM%%u");
-
     CmdPacket.Payload.DataSize = MM_WORD_BIT_WIDTH;
+    CmdPacket.Payload.MemType  = MM_RAM;
 
-    /* Set to generate error message MM_PSP_READ_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRead16), 1, -1);
+    /* Driver read fails, the driver sends its own error event */
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadMemBlock), false);
 
     /* Execute the function being tested */
     Result = MM_PeekMem(&CmdPacket, SrcAddress);
 
     /* Verify results */
     UtAssert_True(Result == false, "Result == false");
-
-    /* No command-handling function should be updating the cmd or err counter itself */
-    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
-    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
-
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_PSP_READ_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    UtAssert_STUB_COUNT(MM_ReadMemBlock, 1);
+    UtAssert_True(MM_AppData.HkPacket.Payload.LastAction == MM_NOACTION,
+                  "MM_AppData.HkPacket.Payload.LastAction == MM_NOACTION");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
                   call_count_CFE_EVS_SendEvent);
+
+    /* No command-handling function should be updating the cmd or err counter itself */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 }
 
 void MM_PeekMem_Test_DWord(void)
@@ -392,10 +468,13 @@ void MM_PeekMem_Test_DWord(void)
     CmdPacket.Payload.DataSize = MM_DWORD_BIT_WIDTH;
     CmdPacket.Payload.MemType  = MM_RAM;
 
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadMemBlock), true);
+
     /* Execute the function being tested */
     Result = MM_PeekMem(&CmdPacket, SrcAddress);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(MM_ReadMemBlock, 1);
     UtAssert_True(Result == true, "Result == true");
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_PEEK_DWORD_INF_EID);
@@ -421,30 +500,31 @@ void MM_PeekMem_Test_DWord(void)
                   call_count_CFE_EVS_SendEvent);
 }
 
-void MM_PeekMem_Test_DWordError(void)
+void MM_PeekMem_Test_SymIndex(void)
 {
     MM_PeekCmd_t CmdPacket;
-    uint32       SrcAddress = 0;
+    uint32       SrcAddress = 1;
     int32        strCmpResult;
     char         ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    bool         Result;
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "PSP read memory error: RC=%%d, Address=%%p, MemType=MEM%%u");
+             "Peek Command: Addr = %%p Size = %%u bits Data = 0x%%08X Sym = %%s");
 
     CmdPacket.Payload.DataSize = MM_DWORD_BIT_WIDTH;
+    CmdPacket.Payload.MemType  = MM_RAM;
 
-    /* Set to generate error message MM_PSP_READ_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRead32), 1, -1);
+    UT_SetHookFunction(UT_KEY(MM_SymIndexFormat), UT_MM_DUMP_TEST_MM_SymIndexFormatHook, NULL);
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadMemBlock), true);
 
     /* Execute the function being tested */
-    Result = MM_PeekMem(&CmdPacket, SrcAddress);
+    UtAssert_BOOL_TRUE(MM_PeekMem(&CmdPacket, SrcAddress));
 
     /* Verify results */
-    UtAssert_True(Result == false, "Result == false");
-
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_PSP_READ_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(MM_ReadMemBlock, 1);
+    UtAssert_STUB_COUNT(MM_SymIndexFormat, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_PEEK_DWORD_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
 
     strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
@@ -454,6 +534,33 @@ void MM_PeekMem_Test_DWordError(void)
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
                   call_count_CFE_EVS_SendEvent);
+}
+
+void MM_PeekMem_Test_DWordError(void)
+{
+    MM_PeekCmd_t CmdPacket;
+    uint32       SrcAddress = 0;
+    bool         Result;
+
+    CmdPacket.Payload.DataSize = MM_DWORD_BIT_WIDTH;
+    CmdPacket.Payload.MemType  = MM_RAM;
+
+    /* Driver read fails, the driver sends its own error event */
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadMemBlock), false);
+
+    /* Execute the function being tested */
+    Result = MM_PeekMem(&CmdPacket, SrcAddress);
+
+    /* Verify results */
+    UtAssert_True(Result == false, "Result == false");
+    UtAssert_STUB_COUNT(MM_ReadMemBlock, 1);
+    UtAssert_True(MM_AppData.HkPacket.Payload.LastAction == MM_NOACTION,
+                  "MM_AppData.HkPacket.Payload.LastAction == MM_NOACTION");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
 
     /* No command-handling function should be updating the cmd or err counter itself */
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
@@ -473,10 +580,11 @@ void MM_PeekMem_Test_DefaultSwitch(void)
 
     /* Verify results */
     UtAssert_True(Result == false, "Result == false");
+    UtAssert_STUB_COUNT(MM_ReadMemBlock, 0);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
                   call_count_CFE_EVS_SendEvent);
 
     /* No command-handling function should be updating the cmd or err counter itself */
@@ -904,16 +1012,16 @@ void MM_DumpMemToFileCmd_Test_MEM8(void)
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 }
 
-void MM_DumpMemToFileCmd_Test_ComputeCRCError(void)
+void MM_DumpMemToFileCmd_Test_RewriteHeadersError(void)
 {
     CFE_SB_MsgId_t    TestMsgId;
     CFE_MSG_FcnCode_t FcnCode;
     int32             strCmpResult;
-    char              ExpectedEventString[2][CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    char              ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
     bool              Result;
 
-    snprintf(ExpectedEventString[0], CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "MM_ComputeCRCFromFile error received: RC = 0x%%08X File = '%%s'");
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "CFE_FS_WriteHeader error received: RC = %%d Expected = %%d File = '%%s'");
 
     TestMsgId = CFE_SB_ValueToMsgId(MM_CMD_MID);
     FcnCode   = MM_DUMP_MEM_TO_FILE_CC;
@@ -929,11 +1037,10 @@ void MM_DumpMemToFileCmd_Test_ComputeCRCError(void)
 
     strncpy(UT_CmdBuf.DumpMemToFileCmd.Payload.FileName, "filename", sizeof(UT_CmdBuf.DumpMemToFileCmd.Payload.FileName) - 1);
 
-    /* Set to satisfy 2 instances of condition "Valid == true": after comment "Write the file headers" and comment "end
-     * Valid == true if" */
+    /* Initial header write succeeds, rewrite of the headers with the final CRC fails */
     UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_WriteHeader), 2, -1);
 
-    /* Set to satisfy condition "Valid == true" before comment "Compute CRC of dumped data" */
     UT_SetDeferredRetcode(UT_KEY(OS_write), 1, sizeof(MM_LoadDumpFileHeader_t));
 
     /* ignore dummy message length check */
@@ -944,25 +1051,23 @@ void MM_DumpMemToFileCmd_Test_ComputeCRCError(void)
     UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_MemValidateRange), OS_SUCCESS);
     UT_SetDefaultReturnValue(UT_KEY(MM_DumpMem8ToFile), true);
 
-    /* Set to generate error message MM_COMPUTECRCFROMFILE_ERR_EID */
-    UT_SetDefaultReturnValue(UT_KEY(MM_ComputeCRCFromFile), -1);
-
     /* Execute the function being tested */
     Result = MM_DumpMemToFileCmd(&UT_CmdBuf.Buf);
 
     /* Verify results */
     UtAssert_True(Result == false, "Result == false");
 
+    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 2);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
                   call_count_CFE_EVS_SendEvent);
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_COMPUTECRCFROMFILE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CFE_FS_WRITEHDR_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 
-    strCmpResult =
-        strncmp(ExpectedEventString[0], context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
 
     UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
 
@@ -1176,7 +1281,7 @@ void MM_DumpMemToFileCmd_Test_InvalidDumpResult(void)
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 }
 
-void MM_DumpMemToFileCmd_Test_lseekError(void)
+void MM_DumpMemToFileCmd_Test_NoReadBack(void)
 {
     CFE_SB_MsgId_t    TestMsgId;
     CFE_MSG_FcnCode_t FcnCode;
@@ -1196,12 +1301,8 @@ void MM_DumpMemToFileCmd_Test_lseekError(void)
 
     strncpy(UT_CmdBuf.DumpMemToFileCmd.Payload.FileName, "filename", sizeof(UT_CmdBuf.DumpMemToFileCmd.Payload.FileName) - 1);
 
-    /* Set to satisfy 2 instances of condition "Valid == true": after comment "Write the file headers" and comment "end
-     * Valid == true if" */
     UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
-
-    /* Set to satisfy condition "Valid == false" before comment "Compute CRC of dumped data" */
-    UT_SetDeferredRetcode(UT_KEY(OS_lseek), 1, -1);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, sizeof(MM_LoadDumpFileHeader_t));
 
     /* ignore dummy message length check */
     UT_SetDefaultReturnValue(UT_KEY(MM_VerifyCmdLength), true);
@@ -1215,13 +1316,21 @@ void MM_DumpMemToFileCmd_Test_lseekError(void)
     Result = MM_DumpMemToFileCmd(&UT_CmdBuf.Buf);
 
     /* Verify results */
-    UtAssert_True(Result == false, "Result == false");
+    UtAssert_True(Result == true, "Result == true");
+
+    /* The CRC is accumulated during the dump, the file must not be read back */
+    UtAssert_STUB_COUNT(OS_lseek, 0);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(MM_ComputeCRCFromFile, 0);
+    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 2);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
                   call_count_CFE_EVS_SendEvent);
 
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_DMP_MEM_FILE_INF_EID);
+
     /* no command-handling function should be updating the cmd or err counter itself */
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
@@ -1420,8 +1529,11 @@ void MM_DumpMemToFile_Test_Nominal(void)
 
     FileHeader.NumOfBytes = 1;
     /* a valid source address is required input to memcpy */
-    FileHeader.SymAddress.Offset = (cpuaddr)&MM_AppData.LoadBuffer[0];
+    FileHeader.SymAddress.Offset = (cpuaddr)&Buffer[0];
     FileHeader.MemType           = MM_RAM;
+    FileHeader.Crc               = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), 0x1234);
 
     /* Execute the function being tested */
     Result = MM_DumpMemToFile(FileHandle, FileName, &FileHeader);
@@ -1435,6 +1547,8 @@ void MM_DumpMemToFile_Test_Nominal(void)
     UtAssert_True(MM_AppData.HkPacket.Payload.Address == (cpuaddr)FileHeader.SymAddress.Offset,
                   "MM_AppData.HkPacket.Payload.Address == FileHeader.SymAddress.Offset");
     UtAssert_True(MM_AppData.HkPacket.Payload.BytesProcessed == 1, "MM_AppData.HkPacket.Payload.BytesProcessed == 1");
+    UtAssert_STUB_COUNT(MM_CalculateCRC, 1);
+    UtAssert_UINT32_EQ(FileHeader.Crc, 0x1234);
     UtAssert_STRINGBUF_EQ(MM_AppData.HkPacket.Payload.FileName, sizeof(MM_AppData.HkPacket.Payload.FileName), FileName,
                           sizeof(FileName));
 
@@ -1477,6 +1591,7 @@ void MM_DumpMemToFile_Test_CPUHogging(void)
                   "MM_AppData.HkPacket.Payload.Address == FileHeader.SymAddress.Offset");
     UtAssert_True(MM_AppData.HkPacket.Payload.BytesProcessed == 2 * MM_MAX_DUMP_DATA_SEG,
                   "MM_AppData.HkPacket.Payload.BytesProcessed == 2 * MM_MAX_DUMP_DATA_SEG");
+    UtAssert_STUB_COUNT(OS_write, 1);
     UtAssert_STRINGBUF_EQ(MM_AppData.HkPacket.Payload.FileName, sizeof(MM_AppData.HkPacket.Payload.FileName), FileName,
                           sizeof(FileName));
 
@@ -1490,6 +1605,39 @@ void MM_DumpMemToFile_Test_CPUHogging(void)
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 }
 
+void MM_DumpMemToFile_Test_MultipleBlocks(void)
+{
+    osal_id_t               FileHandle = MM_UT_OBJID_1;
+    MM_LoadDumpFileHeader_t FileHeader;
+    bool                    Result;
+
+    FileHeader.NumOfBytes        = MM_IO_BUFFER_SIZE + 8;
+    FileHeader.SymAddress.Offset = (cpuaddr)&Buffer[0];
+    FileHeader.MemType           = MM_RAM;
+    FileHeader.Crc               = 0;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, MM_IO_BUFFER_SIZE);
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, 8);
+
+    /* Execute the function being tested */
+    Result = MM_DumpMemToFile(FileHandle, (char *)"filename", &FileHeader);
+
+    /* Verify results, the file is written one full i/o block at a time */
+    UtAssert_True(Result == true, "Result == true");
+    UtAssert_True(MM_AppData.HkPacket.Payload.BytesProcessed == MM_IO_BUFFER_SIZE + 8,
+                  "MM_AppData.HkPacket.Payload.BytesProcessed == MM_IO_BUFFER_SIZE + 8");
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_STUB_COUNT(MM_CalculateCRC, 2);
+    UtAssert_STUB_COUNT(MM_SegmentIoStart, 2);
+    UtAssert_STUB_COUNT(MM_SegmentIoEnd, 2);
+    UtAssert_STUB_COUNT(MM_SegmentEnd, 1);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
 void MM_DumpMemToFile_Test_WriteError(void)
 {
     osal_id_t               FileHandle = MM_UT_OBJID_1;
@@ -1507,7 +1655,7 @@ void MM_DumpMemToFile_Test_WriteError(void)
 
     FileHeader.NumOfBytes = 1;
     /* a valid source address is required input to memcpy */
-    FileHeader.SymAddress.Offset = (cpuaddr)&MM_AppData.LoadBuffer[0];
+    FileHeader.SymAddress.Offset = (cpuaddr)&Buffer[0];
     FileHeader.MemType           = MM_RAM;
 
     /* Set to generate error message MM_OS_WRITE_EXP_ERR_EID */
@@ -1536,90 +1684,947 @@ void MM_DumpMemToFile_Test_WriteError(void)
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 }
 
-void MM_WriteFileHeaders_Test_Nominal(void)
+void MM_DumpMemToFileEncCmd_Test_RLE(void)
 {
-    char                    FileName[OS_MAX_PATH_LEN];
-    osal_id_t               FileHandle = MM_UT_OBJID_1;
-    CFE_FS_Header_t         CFEHeader;
-    MM_LoadDumpFileHeader_t MMHeader;
-    bool                    Result;
-
-    strncpy(FileName, "filename", sizeof(FileName) - 1);
-    FileName[sizeof(FileName) - 1] = '\0';
+    bool Result;
 
-    MMHeader.NumOfBytes        = 1;
-    MMHeader.SymAddress.Offset = 0;
-    MMHeader.MemType           = MM_RAM;
+    strncpy(UT_CmdBuf.DumpMemToFileEncCmd.Payload.Dump.FileName, "filename",
+            sizeof(UT_CmdBuf.DumpMemToFileEncCmd.Payload.Dump.FileName) - 1);
+    UT_CmdBuf.DumpMemToFileEncCmd.Payload.Dump.SrcSymAddress.Offset = (cpuaddr)&Buffer[0];
+    UT_CmdBuf.DumpMemToFileEncCmd.Payload.Dump.MemType              = MM_RAM;
+    UT_CmdBuf.DumpMemToFileEncCmd.Payload.Dump.NumOfBytes           = 16;
+    UT_CmdBuf.DumpMemToFileEncCmd.Payload.Encoding                  = MM_ENCODING_RLE;
 
+    UT_SetHookFunction(UT_KEY(MM_ResolveSymAddr), UT_MM_LOAD_TEST_CFE_SymbolLookupHook1, 0);
     UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+    UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
 
     /* Execute the function being tested */
-    Result = MM_WriteFileHeaders(FileName, FileHandle, &CFEHeader, &MMHeader);
+    Result = MM_DumpMemToFileEncCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results, the encoded data is written by the run length encoded dump */
+    UtAssert_BOOL_TRUE(Result);
+    UtAssert_STUB_COUNT(MM_VerifyFileEncoding, 1);
+    UtAssert_STUB_COUNT(MM_FileEncodeInit, 1);
+    UtAssert_STUB_COUNT(MM_FileEncodeFinish, 1);
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.LastAction, MM_DUMP_TO_FILE);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.BytesProcessed, 16);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_DMP_MEM_FILE_INF_EID);
+}
 
-    /* Verify results */
-    UtAssert_True(Result == true, "Result == true");
+void MM_DumpMemToFileEncCmd_Test_Sparse(void)
+{
+    bool  Result;
+    uint8 EncodeArgs[2] = {0};
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    strncpy(UT_CmdBuf.DumpMemToFileEncCmd.Payload.Dump.FileName, "filename",
+            sizeof(UT_CmdBuf.DumpMemToFileEncCmd.Payload.Dump.FileName) - 1);
+    UT_CmdBuf.DumpMemToFileEncCmd.Payload.Dump.SrcSymAddress.Offset = (cpuaddr)&Buffer[0];
+    UT_CmdBuf.DumpMemToFileEncCmd.Payload.Dump.MemType              = MM_EEPROM;
+    UT_CmdBuf.DumpMemToFileEncCmd.Payload.Dump.NumOfBytes           = 16;
+    UT_CmdBuf.DumpMemToFileEncCmd.Payload.Encoding                  = MM_ENCODING_SPARSE;
+    UT_CmdBuf.DumpMemToFileEncCmd.Payload.FillValue                 = 0xFF;
 
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
-                  call_count_CFE_EVS_SendEvent);
+    UT_SetHookFunction(UT_KEY(MM_ResolveSymAddr), UT_MM_LOAD_TEST_CFE_SymbolLookupHook1, 0);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+    UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+    UT_SetHookFunction(UT_KEY(MM_FileEncodeInit), UT_MM_DUMP_TEST_MM_FileEncodeInitHook, EncodeArgs);
 
-    /* no command-handling function should be updating the cmd or err counter itself */
-    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
-    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+    /* Execute the function being tested */
+    Result = MM_DumpMemToFileEncCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results, the commanded fill value is handed to the encoder */
+    UtAssert_BOOL_TRUE(Result);
+    UtAssert_STUB_COUNT(MM_FileEncodeInit, 1);
+    UtAssert_UINT32_EQ(EncodeArgs[0], MM_ENCODING_SPARSE);
+    UtAssert_UINT32_EQ(EncodeArgs[1], 0xFF);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.BytesProcessed, 16);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_DMP_MEM_FILE_INF_EID);
 }
 
-void MM_WriteFileHeaders_Test_WriteHeaderError(void)
+void MM_DumpMemToFileEncCmd_Test_EncodingError(void)
 {
-    char                    FileName[OS_MAX_PATH_LEN];
-    osal_id_t               FileHandle = MM_UT_OBJID_1;
-    CFE_FS_Header_t         CFEHeader;
-    MM_LoadDumpFileHeader_t MMHeader;
-    int32                   strCmpResult;
-    char                    ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
-    bool                    Result;
+    bool Result;
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "CFE_FS_WriteHeader error received: RC = %%d Expected = %%d File = '%%s'");
+    UT_CmdBuf.DumpMemToFileEncCmd.Payload.Dump.MemType    = MM_MEM32;
+    UT_CmdBuf.DumpMemToFileEncCmd.Payload.Dump.NumOfBytes = 16;
+    UT_CmdBuf.DumpMemToFileEncCmd.Payload.Encoding        = MM_ENCODING_RLE;
 
-    strncpy(FileName, "filename", sizeof(FileName) - 1);
-    FileName[sizeof(FileName) - 1] = '\0';
+    UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyFileEncoding), false);
 
-    MMHeader.NumOfBytes        = 1;
-    MMHeader.SymAddress.Offset = 0;
-    MMHeader.MemType           = MM_RAM;
+    /* Execute the function being tested */
+    Result = MM_DumpMemToFileEncCmd(&UT_CmdBuf.Buf);
 
-    /* Set to generate error message MM_CFE_FS_WRITEHDR_ERR_EID */
-    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), -1);
+    /* Verify results, nothing is written for an unsupported encoding */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+    UtAssert_STUB_COUNT(MM_FileEncodeInit, 0);
+}
 
-    /* Execute the function being tested */
-    Result = MM_WriteFileHeaders(FileName, FileHandle, &CFEHeader, &MMHeader);
+void MM_DumpMemToEncodedFile_Test_Nominal(void)
+{
+    osal_id_t               FileHandle = MM_UT_OBJID_1;
+    MM_LoadDumpFileHeader_t FileHeader;
+    bool                    Result;
+    uint8                   Data[2 * MM_MAX_DUMP_DATA_SEG] = {0};
 
-    /* Verify results */
-    UtAssert_True(Result == false, "Result == false");
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.NumOfBytes        = sizeof(Data);
+    FileHeader.SymAddress.Offset = (cpuaddr)Data;
+    FileHeader.MemType           = MM_RAM;
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CFE_FS_WRITEHDR_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), 0x1234);
+    UT_SetDefaultReturnValue(UT_KEY(MM_FileEncodeFull), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_FileEncodeOutput), MM_IO_BUFFER_SIZE - 1);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), MM_IO_BUFFER_SIZE - 1);
 
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    /* Execute the function being tested */
+    Result = MM_DumpMemToEncodedFile(FileHandle, "filename", &FileHeader);
+
+    /* Verify results, the CRC is of each memory segment and each full output buffer is written */
+    UtAssert_BOOL_TRUE(Result);
+    UtAssert_STUB_COUNT(MM_CalculateCRC, 2);
+    UtAssert_UINT32_EQ(FileHeader.Crc, 0x1234);
+    UtAssert_STUB_COUNT(MM_FileEncode, 2);
+    UtAssert_STUB_COUNT(OS_write, 3);
+    UtAssert_STUB_COUNT(MM_SegmentIoStart, 3);
+    UtAssert_STUB_COUNT(MM_SegmentBreak, 1);
+    UtAssert_STUB_COUNT(MM_FileEncodeFinish, 1);
+    UtAssert_STUB_COUNT(MM_SegmentEnd, 1);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.LastAction, MM_DUMP_TO_FILE);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.BytesProcessed, sizeof(Data));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+void MM_DumpMemToEncodedFile_Test_MemoryChanges(void)
+{
+    osal_id_t               FileHandle = MM_UT_OBJID_1;
+    MM_LoadDumpFileHeader_t FileHeader;
+    UT_MM_EncodeCopy_t      Copy;
+    uint8                   Data[16];
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    memset(Data, 0xAA, sizeof(Data));
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.NumOfBytes        = sizeof(Data);
+    FileHeader.SymAddress.Offset = (cpuaddr)Data;
+    FileHeader.MemType           = MM_RAM;
 
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
-                  call_count_CFE_EVS_SendEvent);
+    Copy.Memory      = Data;
+    Copy.CrcByte     = 0;
+    Copy.EncodedByte = 0;
 
-    /* no command-handling function should be updating the cmd or err counter itself */
-    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
-    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+    UT_SetHookFunction(UT_KEY(MM_CalculateCRC), UT_MM_DUMP_TEST_MM_CalculateCRCHook, &Copy);
+    UT_SetHookFunction(UT_KEY(MM_FileEncode), UT_MM_DUMP_TEST_MM_FileEncodeHook, &Copy);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_DumpMemToEncodedFile(FileHandle, "filename", &FileHeader));
+
+    /* Verify results, the bytes encoded are the bytes in the CRC even though memory changed between */
+    UtAssert_UINT32_EQ(Data[0], 0x55);
+    UtAssert_UINT32_EQ(Copy.CrcByte, 0xAA);
+    UtAssert_UINT32_EQ(Copy.EncodedByte, 0xAA);
+    UtAssert_STUB_COUNT(MM_CalculateCRC, 1);
+    UtAssert_STUB_COUNT(MM_FileEncode, 1);
 }
 
-void MM_WriteFileHeaders_Test_WriteError(void)
+void MM_DumpMemToEncodedFile_Test_WriteError(void)
 {
-    char                    FileName[OS_MAX_PATH_LEN];
     osal_id_t               FileHandle = MM_UT_OBJID_1;
-    CFE_FS_Header_t         CFEHeader;
+    MM_LoadDumpFileHeader_t FileHeader;
+    bool                    Result;
+    uint8                   Data[2 * MM_MAX_DUMP_DATA_SEG] = {0};
+
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.NumOfBytes        = sizeof(Data);
+    FileHeader.SymAddress.Offset = (cpuaddr)Data;
+    FileHeader.MemType           = MM_RAM;
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_FileEncodeFull), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_FileEncodeOutput), MM_IO_BUFFER_SIZE - 1);
+    UT_SetDefaultReturnValue(UT_KEY(OS_write), -1);
+
+    /* Execute the function being tested */
+    Result = MM_DumpMemToEncodedFile(FileHandle, "filename", &FileHeader);
+
+    /* Verify results, the dump stops at the failed write */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(MM_FileEncode, 1);
+    UtAssert_STUB_COUNT(MM_SegmentBreak, 0);
+    UtAssert_STUB_COUNT(MM_FileEncodeFinish, 0);
+    UtAssert_STUB_COUNT(MM_SegmentEnd, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_WRITE_EXP_ERR_EID);
+}
+
+void MM_WriteEncodedBlock_Test_Empty(void)
+{
+    MM_FileEncoder_t Encoder;
+
+    memset(&Encoder, 0, sizeof(Encoder));
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_WriteEncodedBlock(MM_UT_OBJID_1, "filename", &Encoder));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(MM_FileEncodeRewind, 1);
+}
+
+void MM_DumpMemToDeltaFileCmd_Test_Nominal(void)
+{
+    bool                    Result;
+    uint8                   Baseline[16];
+    MM_LoadDumpFileHeader_t BaselineHeader;
+
+    memset(Buffer, 0x5A, 16);
+    memcpy(Baseline, Buffer, sizeof(Baseline));
+    Baseline[7] = 0;
+
+    memset(&BaselineHeader, 0, sizeof(BaselineHeader));
+    BaselineHeader.MemType    = MM_RAM;
+    BaselineHeader.NumOfBytes = 16;
+    BaselineHeader.Encoding   = MM_ENCODING_RAW;
+
+    strncpy(UT_CmdBuf.DumpMemToDeltaFileCmd.Payload.Dump.FileName, "filename",
+            sizeof(UT_CmdBuf.DumpMemToDeltaFileCmd.Payload.Dump.FileName) - 1);
+    strncpy(UT_CmdBuf.DumpMemToDeltaFileCmd.Payload.BaselineFileName, "baseline",
+            sizeof(UT_CmdBuf.DumpMemToDeltaFileCmd.Payload.BaselineFileName) - 1);
+    UT_CmdBuf.DumpMemToDeltaFileCmd.Payload.Dump.MemType    = MM_RAM;
+    UT_CmdBuf.DumpMemToDeltaFileCmd.Payload.Dump.NumOfBytes = 16;
+
+    UT_SetHookFunction(UT_KEY(MM_ResolveSymAddr), UT_MM_LOAD_TEST_CFE_SymbolLookupHook1, 0);
+    UT_SetHookFunction(UT_KEY(MM_ReadFileHeaders), UT_MM_DUMP_TEST_MM_ReadFileHeadersHook, &BaselineHeader);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadFileHeaders), true);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+    UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+    UT_SetDataBuffer(UT_KEY(OS_read), Baseline, sizeof(Baseline), false);
+
+    /* Execute the function being tested */
+    Result = MM_DumpMemToDeltaFileCmd(&UT_CmdBuf.Buf);
+
+    /*
+    ** Verify results, the headers and block map are written twice around
+    ** the one changed block, both the delta and baseline files are closed
+    */
+    UtAssert_BOOL_TRUE(Result);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 2);
+    UtAssert_STUB_COUNT(OS_write, 7);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_UINT32_EQ(MM_AppData.DeltaBlockMap[0], 0x01);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.LastAction, MM_DUMP_TO_FILE);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.BytesProcessed, 16);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_DMP_DELTA_FILE_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void MM_DumpMemToDeltaFileCmd_Test_BaselineMismatch(void)
+{
+    bool                    Result;
+    MM_LoadDumpFileHeader_t BaselineHeader;
+
+    memset(&BaselineHeader, 0, sizeof(BaselineHeader));
+    BaselineHeader.MemType    = MM_RAM;
+    BaselineHeader.NumOfBytes = 16;
+    BaselineHeader.Encoding   = MM_ENCODING_RLE;
+
+    UT_CmdBuf.DumpMemToDeltaFileCmd.Payload.Dump.MemType    = MM_RAM;
+    UT_CmdBuf.DumpMemToDeltaFileCmd.Payload.Dump.NumOfBytes = 16;
+
+    UT_SetHookFunction(UT_KEY(MM_ReadFileHeaders), UT_MM_DUMP_TEST_MM_ReadFileHeadersHook, &BaselineHeader);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadFileHeaders), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+
+    /* Execute the function being tested */
+    Result = MM_DumpMemToDeltaFileCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results, an encoded baseline is closed without creating the delta file */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(OS_write, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_DELTA_BASELINE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_DumpMemToDeltaFileCmd_Test_BaselineOpenError(void)
+{
+    bool Result;
+
+    UT_CmdBuf.DumpMemToDeltaFileCmd.Payload.Dump.MemType    = MM_EEPROM;
+    UT_CmdBuf.DumpMemToDeltaFileCmd.Payload.Dump.NumOfBytes = 16;
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 1, OS_ERROR);
+
+    /* Execute the function being tested */
+    Result = MM_DumpMemToDeltaFileCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(MM_ReadFileHeaders, 0);
+    UtAssert_STUB_COUNT(OS_close, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_OPEN_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_DumpMemToDeltaFileCmd_Test_MemTypeError(void)
+{
+    bool Result;
+
+    UT_CmdBuf.DumpMemToDeltaFileCmd.Payload.Dump.MemType    = MM_MEM32;
+    UT_CmdBuf.DumpMemToDeltaFileCmd.Payload.Dump.NumOfBytes = 16;
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+
+    /* Execute the function being tested */
+    Result = MM_DumpMemToDeltaFileCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results, blocks of non byte addressable memory can't be compared */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_FILE_ENCODING_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_DumpMemToDeltaFileCmd_Test_SymNameError(void)
+{
+    bool Result;
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), false);
+
+    /* Execute the function being tested */
+    Result = MM_DumpMemToDeltaFileCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(MM_VerifyLoadDumpParams, 0);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_SYMNAME_ERR_EID);
+}
+
+void MM_DumpMemToDeltaFile_Test_Nominal(void)
+{
+    osal_id_t               FileHandle = MM_UT_OBJID_1;
+    MM_LoadDumpFileHeader_t FileHeader;
+    MM_DeltaFileHeader_t    DeltaHeader;
+    bool                    Result;
+    uint8                   Baseline[4 * MM_DELTA_BLOCK_SIZE + 44];
+
+    memset(Buffer, 0xA5, sizeof(Baseline));
+    memcpy(Baseline, Buffer, sizeof(Baseline));
+
+    /* Change every block but the fourth, the last one is a partial block */
+    Baseline[0]                          = 0;
+    Baseline[2 * MM_DELTA_BLOCK_SIZE - 1] = 0;
+    Baseline[2 * MM_DELTA_BLOCK_SIZE]     = 0;
+    Baseline[sizeof(Baseline) - 1]        = 0;
+
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.NumOfBytes        = sizeof(Baseline);
+    FileHeader.SymAddress.Offset = (cpuaddr)Buffer;
+    FileHeader.MemType           = MM_RAM;
+
+    memset(&DeltaHeader, 0, sizeof(DeltaHeader));
+    memset(MM_AppData.DeltaBlockMap, 0, sizeof(MM_AppData.DeltaBlockMap));
+    DeltaHeader.BlockSize   = MM_DELTA_BLOCK_SIZE;
+    DeltaHeader.NumOfBlocks = 5;
+
+    UT_SetDataBuffer(UT_KEY(OS_read), Baseline, sizeof(Baseline), false);
+    UT_SetDefaultReturnValue(UT_KEY(MM_SegmentStart), 2 * MM_DELTA_BLOCK_SIZE);
+    UT_SetDefaultReturnValue(UT_KEY(MM_SegmentBreak), 2 * MM_DELTA_BLOCK_SIZE);
+
+    /* Execute the function being tested */
+    Result = MM_DumpMemToDeltaFile(FileHandle, "filename", MM_UT_OBJID_2, "baseline", &FileHeader, &DeltaHeader);
+
+    /*
+    ** Verify results, the changed blocks are written once the output area
+    ** is full and at the end of the dump, with a break every two blocks
+    */
+    UtAssert_BOOL_TRUE(Result);
+    UtAssert_STUB_COUNT(OS_read, 5);
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_UINT32_EQ(DeltaHeader.ChangedBlocks, 4);
+    UtAssert_UINT32_EQ(MM_AppData.DeltaBlockMap[0], 0x17);
+    UtAssert_STUB_COUNT(MM_SegmentBreak, 2);
+    UtAssert_STUB_COUNT(MM_SegmentEnd, 1);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.LastAction, MM_DUMP_TO_FILE);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.BytesProcessed, sizeof(Baseline));
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_DumpMemToDeltaFile_Test_BaselineCrcError(void)
+{
+    MM_LoadDumpFileHeader_t FileHeader;
+    MM_DeltaFileHeader_t    DeltaHeader;
+    bool                    Result;
+    uint8                   Baseline[MM_DELTA_BLOCK_SIZE] = {0};
+
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.NumOfBytes        = sizeof(Baseline);
+    FileHeader.SymAddress.Offset = (cpuaddr)Buffer;
+    FileHeader.MemType           = MM_RAM;
+
+    memset(&DeltaHeader, 0, sizeof(DeltaHeader));
+    DeltaHeader.BaselineCrc = 0x1234;
+
+    UT_SetDataBuffer(UT_KEY(OS_read), Baseline, sizeof(Baseline), false);
+    UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), 0x4321);
+
+    /* Execute the function being tested */
+    Result = MM_DumpMemToDeltaFile(MM_UT_OBJID_1, "filename", MM_UT_OBJID_2, "baseline", &FileHeader, &DeltaHeader);
+
+    /* Verify results, a corrupted baseline fails the dump */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(MM_CalculateCRC, 2);
+    UtAssert_STUB_COUNT(MM_SegmentEnd, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_DELTA_BASELINE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_DumpMemToDeltaFile_Test_ReadError(void)
+{
+    MM_LoadDumpFileHeader_t FileHeader;
+    MM_DeltaFileHeader_t    DeltaHeader;
+    bool                    Result;
+
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.NumOfBytes        = 2 * MM_DELTA_BLOCK_SIZE;
+    FileHeader.SymAddress.Offset = (cpuaddr)Buffer;
+    FileHeader.MemType           = MM_RAM;
+
+    memset(&DeltaHeader, 0, sizeof(DeltaHeader));
+
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 10);
+
+    /* Execute the function being tested */
+    Result = MM_DumpMemToDeltaFile(MM_UT_OBJID_1, "filename", MM_UT_OBJID_2, "baseline", &FileHeader, &DeltaHeader);
+
+    /* Verify results, the dump stops at the short baseline read */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(MM_SegmentEnd, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_READ_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_WriteDeltaHeader_Test_Nominal(void)
+{
+    MM_DeltaFileHeader_t DeltaHeader;
+
+    memset(&DeltaHeader, 0, sizeof(DeltaHeader));
+    DeltaHeader.NumOfBlocks = 9;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_WriteDeltaHeader("filename", MM_UT_OBJID_1, &DeltaHeader));
+
+    /* Verify results, the header is followed by two bytes of block map */
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_WriteDeltaHeader_Test_MapWriteError(void)
+{
+    MM_DeltaFileHeader_t DeltaHeader;
+
+    memset(&DeltaHeader, 0, sizeof(DeltaHeader));
+    DeltaHeader.NumOfBlocks = 9;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 2, 1);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_WriteDeltaHeader("filename", MM_UT_OBJID_1, &DeltaHeader));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_WRITE_EXP_ERR_EID);
+}
+
+/* Region table handed to the multi-region table read hook */
+typedef struct
+{
+    MM_MultiFileHeader_t    MultiHeader;
+    MM_LoadDumpFileHeader_t Regions[2];
+} UT_MM_RegionTable_t;
+
+void UT_MM_DUMP_TEST_InitRegionTable(UT_MM_RegionTable_t *Table)
+{
+    memset(Table, 0, sizeof(*Table));
+    Table->MultiHeader.NumOfRegions = 2;
+
+    strncpy(Table->Regions[0].SymAddress.SymName, "first", sizeof(Table->Regions[0].SymAddress.SymName) - 1);
+    Table->Regions[0].MemType           = MM_RAM;
+    Table->Regions[0].NumOfBytes        = 4;
+    Table->Regions[0].Crc               = 0x1234;
+    Table->Regions[1].SymAddress.Offset = 16;
+    Table->Regions[1].MemType           = MM_EEPROM;
+    Table->Regions[1].NumOfBytes        = 8;
+}
+
+int32 UT_MM_DUMP_TEST_MM_ReadMultiFileTableHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                                const UT_StubContext_t *Context)
+{
+    UT_MM_RegionTable_t * Table       = UserObj;
+    MM_MultiFileHeader_t *MultiHeader = UT_Hook_GetArgValueByName(Context, "MultiHeader", MM_MultiFileHeader_t *);
+
+    /* Return the region table handed to the hook */
+    *MultiHeader = Table->MultiHeader;
+    memcpy(MM_AppData.FileRegions, Table->Regions, sizeof(Table->Regions));
+
+    return StubRetcode;
+}
+
+/* Resolves each region to the test buffer plus the region symbol offset */
+int32 UT_MM_DUMP_TEST_RegionAddrHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                     const UT_StubContext_t *Context)
+{
+    MM_SymAddr_t *SymAddr         = UT_Hook_GetArgValueByName(Context, "SymAddr", MM_SymAddr_t *);
+    cpuaddr *     ResolvedAddress = UT_Hook_GetArgValueByName(Context, "ResolvedAddr", cpuaddr *);
+
+    *ResolvedAddress = (cpuaddr)&Buffer[SymAddr->Offset];
+
+    return true;
+}
+
+void MM_DumpMemToMultiFileCmd_Test_Nominal(void)
+{
+    bool                    Result;
+    UT_MM_RegionTable_t     Table;
+    MM_LoadDumpFileHeader_t RegionFileHeader;
+
+    UT_MM_DUMP_TEST_InitRegionTable(&Table);
+
+    memset(&RegionFileHeader, 0, sizeof(RegionFileHeader));
+    RegionFileHeader.Encoding = MM_ENCODING_MULTI;
+
+    strncpy(UT_CmdBuf.DumpMemToMultiFileCmd.Payload.FileName, "filename",
+            sizeof(UT_CmdBuf.DumpMemToMultiFileCmd.Payload.FileName) - 1);
+    strncpy(UT_CmdBuf.DumpMemToMultiFileCmd.Payload.RegionFileName, "regions",
+            sizeof(UT_CmdBuf.DumpMemToMultiFileCmd.Payload.RegionFileName) - 1);
+
+    UT_SetHookFunction(UT_KEY(MM_ReadFileHeaders), UT_MM_DUMP_TEST_MM_ReadFileHeadersHook, &RegionFileHeader);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadFileHeaders), true);
+    UT_SetHookFunction(UT_KEY(MM_ReadMultiFileTable), UT_MM_DUMP_TEST_MM_ReadMultiFileTableHook, &Table);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadMultiFileTable), true);
+    UT_SetHookFunction(UT_KEY(MM_ResolveSymAddr), UT_MM_DUMP_TEST_RegionAddrHook, 0);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+
+    /* Execute the function being tested */
+    Result = MM_DumpMemToMultiFileCmd(&UT_CmdBuf.Buf);
+
+    /*
+    ** Verify results, the headers and region table are written twice
+    ** around the data of both regions and both files are closed
+    */
+    UtAssert_BOOL_TRUE(Result);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 2);
+    UtAssert_STUB_COUNT(OS_write, 8);
+    UtAssert_STUB_COUNT(OS_close, 2);
+    UtAssert_UINT32_EQ(MM_AppData.FileRegions[0].SymAddress.Offset, (cpuaddr)&Buffer[0]);
+    UtAssert_UINT32_EQ(MM_AppData.FileRegions[0].SymAddress.SymName[0], MM_CLEAR_SYMNAME);
+    UtAssert_UINT32_EQ(MM_AppData.FileRegions[1].SymAddress.Offset, (cpuaddr)&Buffer[16]);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.LastAction, MM_DUMP_TO_FILE);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.MemType, MM_RAM);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.Address, (cpuaddr)&Buffer[0]);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.BytesProcessed, 12);
+
+    /* Both regions are accounted as one dump */
+    UtAssert_STUB_COUNT(MM_SegmentMultiStart, 1);
+    UtAssert_STUB_COUNT(MM_SegmentMultiEnd, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_DMP_MULTI_FILE_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void MM_DumpMemToMultiFileCmd_Test_RegionFileError(void)
+{
+    bool Result;
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadFileHeaders), false);
+
+    /* Execute the function being tested */
+    Result = MM_DumpMemToMultiFileCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results, no dump file is created */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_STUB_COUNT(OS_write, 0);
+}
+
+void MM_DumpMemToMultiFileCmd_Test_CreateError(void)
+{
+    bool                    Result;
+    UT_MM_RegionTable_t     Table;
+    MM_LoadDumpFileHeader_t RegionFileHeader;
+
+    UT_MM_DUMP_TEST_InitRegionTable(&Table);
+
+    memset(&RegionFileHeader, 0, sizeof(RegionFileHeader));
+    RegionFileHeader.Encoding = MM_ENCODING_MULTI;
+
+    UT_SetHookFunction(UT_KEY(MM_ReadFileHeaders), UT_MM_DUMP_TEST_MM_ReadFileHeadersHook, &RegionFileHeader);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadFileHeaders), true);
+    UT_SetHookFunction(UT_KEY(MM_ReadMultiFileTable), UT_MM_DUMP_TEST_MM_ReadMultiFileTableHook, &Table);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadMultiFileTable), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+    UT_SetDeferredRetcode(UT_KEY(OS_OpenCreate), 2, OS_ERROR);
+
+    /* Execute the function being tested */
+    Result = MM_DumpMemToMultiFileCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 2);
+    UtAssert_STUB_COUNT(OS_close, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_CREAT_ERR_EID);
+}
+
+void MM_DumpMemToMultiFileCmd_Test_RegionWriteError(void)
+{
+    bool                    Result;
+    UT_MM_RegionTable_t     Table;
+    MM_LoadDumpFileHeader_t RegionFileHeader;
+
+    UT_MM_DUMP_TEST_InitRegionTable(&Table);
+
+    memset(&RegionFileHeader, 0, sizeof(RegionFileHeader));
+    RegionFileHeader.Encoding = MM_ENCODING_MULTI;
+
+    UT_SetHookFunction(UT_KEY(MM_ReadFileHeaders), UT_MM_DUMP_TEST_MM_ReadFileHeadersHook, &RegionFileHeader);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadFileHeaders), true);
+    UT_SetHookFunction(UT_KEY(MM_ReadMultiFileTable), UT_MM_DUMP_TEST_MM_ReadMultiFileTableHook, &Table);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadMultiFileTable), true);
+    UT_SetHookFunction(UT_KEY(MM_ResolveSymAddr), UT_MM_DUMP_TEST_RegionAddrHook, 0);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+
+    /* The MM header and the region table are written, then the first region fails */
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 4, OS_ERROR);
+
+    /* Execute the function being tested */
+    Result = MM_DumpMemToMultiFileCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results, the headers aren't rewritten and the second region isn't dumped */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(CFE_FS_WriteHeader, 1);
+    UtAssert_STUB_COUNT(OS_write, 4);
+    UtAssert_STUB_COUNT(OS_close, 2);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_WRITE_EXP_ERR_EID);
+}
+
+void MM_ReadDumpRegionFile_Test_EncodingError(void)
+{
+    MM_MultiFileHeader_t    MultiHeader;
+    MM_LoadDumpFileHeader_t RegionFileHeader;
+    uint32                  TotalBytes = 1;
+
+    memset(&MultiHeader, 0, sizeof(MultiHeader));
+    memset(&RegionFileHeader, 0, sizeof(RegionFileHeader));
+    RegionFileHeader.Encoding = MM_ENCODING_RAW;
+
+    UT_SetHookFunction(UT_KEY(MM_ReadFileHeaders), UT_MM_DUMP_TEST_MM_ReadFileHeadersHook, &RegionFileHeader);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadFileHeaders), true);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_ReadDumpRegionFile("regions", &MultiHeader, &TotalBytes));
+
+    /* Verify results, a plain dump file doesn't list regions */
+    UtAssert_STUB_COUNT(MM_ReadMultiFileTable, 0);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_UINT32_EQ(TotalBytes, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_FILE_ENCODING_ERR_EID);
+}
+
+void MM_ReadDumpRegionFile_Test_OpenError(void)
+{
+    MM_MultiFileHeader_t MultiHeader;
+    uint32               TotalBytes;
+
+    memset(&MultiHeader, 0, sizeof(MultiHeader));
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_ReadDumpRegionFile("regions", &MultiHeader, &TotalBytes));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MM_ReadFileHeaders, 0);
+    UtAssert_STUB_COUNT(OS_close, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_OPEN_ERR_EID);
+}
+
+void MM_ReadDumpRegionFile_Test_RegionError(void)
+{
+    MM_MultiFileHeader_t    MultiHeader;
+    UT_MM_RegionTable_t     Table;
+    MM_LoadDumpFileHeader_t RegionFileHeader;
+    uint32                  TotalBytes;
+
+    UT_MM_DUMP_TEST_InitRegionTable(&Table);
+
+    memset(&RegionFileHeader, 0, sizeof(RegionFileHeader));
+    RegionFileHeader.Encoding = MM_ENCODING_MULTI;
+
+    UT_SetHookFunction(UT_KEY(MM_ReadFileHeaders), UT_MM_DUMP_TEST_MM_ReadFileHeadersHook, &RegionFileHeader);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadFileHeaders), true);
+    UT_SetHookFunction(UT_KEY(MM_ReadMultiFileTable), UT_MM_DUMP_TEST_MM_ReadMultiFileTableHook, &Table);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadMultiFileTable), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), true);
+    UT_SetDeferredRetcode(UT_KEY(MM_VerifyLoadDumpParams), 2, false);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_ReadDumpRegionFile("regions", &MultiHeader, &TotalBytes));
+
+    /* Verify results, the second region is out of range */
+    UtAssert_STUB_COUNT(MM_VerifyLoadDumpParams, 2);
+    UtAssert_STUB_COUNT(OS_close, 1);
+}
+
+void MM_VerifyDumpRegion_Test_Nominal(void)
+{
+    MM_LoadDumpFileHeader_t Region;
+
+    memset(&Region, 0, sizeof(Region));
+    strncpy(Region.SymAddress.SymName, "symbol", sizeof(Region.SymAddress.SymName) - 1);
+    Region.SymAddress.Offset = 8;
+    Region.MemType           = MM_RAM;
+    Region.NumOfBytes        = 4;
+    Region.Crc               = 0x1234;
+
+    UT_SetHookFunction(UT_KEY(MM_ResolveSymAddr), UT_MM_DUMP_TEST_RegionAddrHook, 0);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_VerifyDumpRegion("regions", &Region, 0));
+
+    /* Verify results, the entry is ready for the dump file */
+    UtAssert_UINT32_EQ(Region.SymAddress.Offset, (cpuaddr)&Buffer[8]);
+    UtAssert_UINT32_EQ(Region.SymAddress.SymName[0], MM_CLEAR_SYMNAME);
+    UtAssert_UINT32_EQ(Region.SymAddress.SymName[1], 0);
+    UtAssert_UINT32_EQ(Region.Crc, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_VerifyDumpRegion_Test_Errors(void)
+{
+    MM_LoadDumpFileHeader_t Region;
+
+    memset(&Region, 0, sizeof(Region));
+    Region.MemType    = MM_RAM;
+    Region.NumOfBytes = 4;
+
+    Region.Encoding = MM_ENCODING_SPARSE;
+    UtAssert_BOOL_FALSE(MM_VerifyDumpRegion("regions", &Region, 0));
+
+    Region.Encoding = MM_ENCODING_RAW;
+    UT_SetDeferredRetcode(UT_KEY(MM_ResolveSymAddr), 1, false);
+    UtAssert_BOOL_FALSE(MM_VerifyDumpRegion("regions", &Region, 1));
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), false);
+    UtAssert_BOOL_FALSE(MM_VerifyDumpRegion("regions", &Region, 2));
+
+    /* Verify results, the parameter check sends its own event */
+    UtAssert_STUB_COUNT(MM_ResolveSymAddr, 2);
+    UtAssert_STUB_COUNT(MM_VerifyLoadDumpParams, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_MULTI_FILE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, MM_SYMNAME_ERR_EID);
+}
+
+void MM_DumpFileRegion_Test_MemTypes(void)
+{
+    MM_LoadDumpFileHeader_t Region;
+
+    memset(&Region, 0, sizeof(Region));
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_DumpMem32ToFile), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_DumpMem16ToFile), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_DumpMem8ToFile), true);
+
+    /* Execute the function being tested */
+    Region.MemType = MM_MEM32;
+    UtAssert_BOOL_TRUE(MM_DumpFileRegion(MM_UT_OBJID_1, "filename", &Region));
+    Region.MemType = MM_MEM16;
+    UtAssert_BOOL_TRUE(MM_DumpFileRegion(MM_UT_OBJID_1, "filename", &Region));
+    Region.MemType = MM_MEM8;
+    UtAssert_BOOL_TRUE(MM_DumpFileRegion(MM_UT_OBJID_1, "filename", &Region));
+    Region.MemType = MM_NOMEMTYPE;
+    UtAssert_BOOL_FALSE(MM_DumpFileRegion(MM_UT_OBJID_1, "filename", &Region));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MM_DumpMem32ToFile, 1);
+    UtAssert_STUB_COUNT(MM_DumpMem16ToFile, 1);
+    UtAssert_STUB_COUNT(MM_DumpMem8ToFile, 1);
+    UtAssert_STUB_COUNT(OS_write, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_WriteMultiFileTable_Test_Nominal(void)
+{
+    MM_MultiFileHeader_t MultiHeader;
+
+    memset(&MultiHeader, 0, sizeof(MultiHeader));
+    MultiHeader.NumOfRegions = 3;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_WriteMultiFileTable("filename", MM_UT_OBJID_1, &MultiHeader));
+
+    /* Verify results, the header is followed by the whole table in one write */
+    UtAssert_STUB_COUNT(OS_write, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_WriteMultiFileTable_Test_WriteError(void)
+{
+    MM_MultiFileHeader_t MultiHeader;
+
+    memset(&MultiHeader, 0, sizeof(MultiHeader));
+    MultiHeader.NumOfRegions = 3;
+
+    UT_SetDeferredRetcode(UT_KEY(OS_write), 1, OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_WriteMultiFileTable("filename", MM_UT_OBJID_1, &MultiHeader));
+
+    /* Verify results, the table isn't written after a header error */
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_WRITE_EXP_ERR_EID);
+}
+
+void MM_WriteFileHeaders_Test_Nominal(void)
+{
+    char                    FileName[OS_MAX_PATH_LEN];
+    osal_id_t               FileHandle = MM_UT_OBJID_1;
+    CFE_FS_Header_t         CFEHeader;
+    MM_LoadDumpFileHeader_t MMHeader;
+    bool                    Result;
+
+    strncpy(FileName, "filename", sizeof(FileName) - 1);
+    FileName[sizeof(FileName) - 1] = '\0';
+
+    MMHeader.NumOfBytes        = 1;
+    MMHeader.SymAddress.Offset = 0;
+    MMHeader.MemType           = MM_RAM;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), sizeof(CFE_FS_Header_t));
+
+    /* Execute the function being tested */
+    Result = MM_WriteFileHeaders(FileName, FileHandle, &CFEHeader, &MMHeader);
+
+    /* Verify results */
+    UtAssert_True(Result == true, "Result == true");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+
+    /* no command-handling function should be updating the cmd or err counter itself */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+}
+
+void MM_WriteFileHeaders_Test_WriteHeaderError(void)
+{
+    char                    FileName[OS_MAX_PATH_LEN];
+    osal_id_t               FileHandle = MM_UT_OBJID_1;
+    CFE_FS_Header_t         CFEHeader;
+    MM_LoadDumpFileHeader_t MMHeader;
+    int32                   strCmpResult;
+    char                    ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    bool                    Result;
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "CFE_FS_WriteHeader error received: RC = %%d Expected = %%d File = '%%s'");
+
+    strncpy(FileName, "filename", sizeof(FileName) - 1);
+    FileName[sizeof(FileName) - 1] = '\0';
+
+    MMHeader.NumOfBytes        = 1;
+    MMHeader.SymAddress.Offset = 0;
+    MMHeader.MemType           = MM_RAM;
+
+    /* Set to generate error message MM_CFE_FS_WRITEHDR_ERR_EID */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_FS_WriteHeader), -1);
+
+    /* Execute the function being tested */
+    Result = MM_WriteFileHeaders(FileName, FileHandle, &CFEHeader, &MMHeader);
+
+    /* Verify results */
+    UtAssert_True(Result == false, "Result == false");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CFE_FS_WRITEHDR_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+    /* no command-handling function should be updating the cmd or err counter itself */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+}
+
+void MM_WriteFileHeaders_Test_WriteError(void)
+{
+    char                    FileName[OS_MAX_PATH_LEN];
+    osal_id_t               FileHandle = MM_UT_OBJID_1;
+    CFE_FS_Header_t         CFEHeader;
     MM_LoadDumpFileHeader_t MMHeader;
     int32                   strCmpResult;
     char                    ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
@@ -1731,6 +2736,54 @@ void MM_DumpInEventCmd_Test_Nominal(void)
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 }
 
+void MM_DumpInEventCmd_Test_SymIndex(void)
+{
+    const char *Annotation;
+
+    UT_CmdBuf.DumpInEventCmd.Payload.MemType              = MM_RAM;
+    UT_CmdBuf.DumpInEventCmd.Payload.NumOfBytes           = 1;
+    UT_CmdBuf.DumpInEventCmd.Payload.SrcSymAddress.Offset = (cpuaddr)&Buffer[0];
+
+    UT_SetHookFunction(UT_KEY(MM_ResolveSymAddr), UT_MM_LOAD_TEST_CFE_SymbolLookupHook1, 0);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+    UT_SetHookFunction(UT_KEY(MM_SymIndexFormat), UT_MM_DUMP_TEST_MM_SymIndexFormatHook, NULL);
+    UT_SetVaHandlerFunction(UT_KEY(CFE_EVS_SendEvent), UT_MM_DUMP_TEST_CFE_EVS_SendEventHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_DumpInEventCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results, the symbol follows the address */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_STUB_COUNT(MM_SymIndexFormat, 1);
+
+    Annotation = strstr(UT_EventText, " (Alpha+0x10)");
+    UtAssert_NOT_NULL(Annotation);
+    UtAssert_True((Annotation != NULL) && (Annotation[strlen(" (Alpha+0x10)")] == '\0'), "Symbol ends the event, '%s'",
+                  UT_EventText);
+    UtAssert_True(strncmp(UT_EventText, "Memory Dump: ", 13) == 0, "Dump data unchanged, '%s'", UT_EventText);
+    UtAssert_NOT_NULL(strstr(UT_EventText, " from address: "));
+}
+
+void MM_DumpInEventCmd_Test_SymIndexNoRoom(void)
+{
+    UT_CmdBuf.DumpInEventCmd.Payload.MemType              = MM_RAM;
+    UT_CmdBuf.DumpInEventCmd.Payload.NumOfBytes           = MM_MAX_DUMP_INEVENT_BYTES;
+    UT_CmdBuf.DumpInEventCmd.Payload.SrcSymAddress.Offset = (cpuaddr)&Buffer[0];
+
+    UT_SetHookFunction(UT_KEY(MM_ResolveSymAddr), UT_MM_LOAD_TEST_CFE_SymbolLookupHook1, 0);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+    UT_SetHookFunction(UT_KEY(MM_SymIndexFormat), UT_MM_DUMP_TEST_MM_SymIndexFormatHook, NULL);
+    UT_SetVaHandlerFunction(UT_KEY(CFE_EVS_SendEvent), UT_MM_DUMP_TEST_CFE_EVS_SendEventHandler, NULL);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_DumpInEventCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results, a symbol that doesn't fit is left out rather than cut short */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_NULL(strstr(UT_EventText, "Alpha"));
+    UtAssert_NOT_NULL(strstr(UT_EventText, "from address: "));
+}
+
 void MM_DumpInEventCmd_Test_SymNameError(void)
 {
     CFE_SB_MsgId_t    TestMsgId;
@@ -1877,7 +2930,7 @@ void MM_FillDumpInEventBuffer_Test_RAM(void)
 {
     MM_DumpInEventCmd_t CmdPacket;
     /* a valid source address is required input to memcpy */
-    cpuaddr SrcAddress = (cpuaddr)&MM_AppData.LoadBuffer[0];
+    cpuaddr SrcAddress = (cpuaddr)&Buffer[0];
     bool    Result;
 
     CmdPacket.Payload.MemType              = MM_RAM;
@@ -1885,7 +2938,7 @@ void MM_FillDumpInEventBuffer_Test_RAM(void)
     CmdPacket.Payload.SrcSymAddress.Offset = 0;
 
     /* Execute the function being tested */
-    Result = MM_FillDumpInEventBuffer(SrcAddress, &CmdPacket, (uint8 *)(&MM_AppData.DumpBuffer[0]));
+    Result = MM_FillDumpInEventBuffer(SrcAddress, &CmdPacket, (uint8 *)(&MM_AppData.IoBuffer[0]));
 
     /* Verify results */
     UtAssert_True(Result == true, "Result == true");
@@ -1904,7 +2957,7 @@ void MM_FillDumpInEventBuffer_Test_BadType(void)
 {
     MM_DumpInEventCmd_t CmdPacket;
     /* a valid source address is required input to memcpy */
-    cpuaddr SrcAddress = (cpuaddr)&MM_AppData.LoadBuffer[0];
+    cpuaddr SrcAddress = (cpuaddr)&Buffer[0];
     bool    Result;
 
     CmdPacket.Payload.MemType              = 99;
@@ -1912,7 +2965,7 @@ void MM_FillDumpInEventBuffer_Test_BadType(void)
     CmdPacket.Payload.SrcSymAddress.Offset = 0;
 
     /* Execute the function being tested */
-    Result = MM_FillDumpInEventBuffer(SrcAddress, &CmdPacket, (uint8 *)(&MM_AppData.DumpBuffer[0]));
+    Result = MM_FillDumpInEventBuffer(SrcAddress, &CmdPacket, (uint8 *)(&MM_AppData.IoBuffer[0]));
 
     /* Verify results */
     UtAssert_True(Result == false, "Result == false");
@@ -1931,7 +2984,7 @@ void MM_FillDumpInEventBuffer_Test_EEPROM(void)
 {
     MM_DumpInEventCmd_t CmdPacket;
     /* a valid source address is required input to memcpy */
-    cpuaddr SrcAddress = (cpuaddr)&MM_AppData.LoadBuffer[0];
+    cpuaddr SrcAddress = (cpuaddr)&Buffer[0];
     bool    Result;
 
     CmdPacket.Payload.MemType              = MM_EEPROM;
@@ -1939,7 +2992,7 @@ void MM_FillDumpInEventBuffer_Test_EEPROM(void)
     CmdPacket.Payload.SrcSymAddress.Offset = 0;
 
     /* Execute the function being tested */
-    Result = MM_FillDumpInEventBuffer(SrcAddress, &CmdPacket, (uint8 *)(&MM_AppData.DumpBuffer[0]));
+    Result = MM_FillDumpInEventBuffer(SrcAddress, &CmdPacket, (uint8 *)(&MM_AppData.IoBuffer[0]));
 
     /* Verify results */
     UtAssert_True(Result == true, "Result == true");
@@ -1957,24 +3010,24 @@ void MM_FillDumpInEventBuffer_Test_EEPROM(void)
 void MM_FillDumpInEventBuffer_Test_MEM32(void)
 {
     MM_DumpInEventCmd_t CmdPacket;
-    /* CFE_PSP_MemRead32 stub returns success with non-zero address */
-    cpuaddr SrcAddress = 1;
-    bool    Result;
+    cpuaddr             SrcAddress = 0;
+    bool                Result;
 
     CmdPacket.Payload.MemType              = MM_MEM32;
     CmdPacket.Payload.NumOfBytes           = 4;
     CmdPacket.Payload.SrcSymAddress.Offset = 0;
 
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadMem32), true);
+
     /* Execute the function being tested */
-    Result = MM_FillDumpInEventBuffer(SrcAddress, &CmdPacket, (uint8 *)(&MM_AppData.DumpBuffer[0]));
+    Result = MM_FillDumpInEventBuffer(SrcAddress, &CmdPacket, (uint8 *)(&MM_AppData.IoBuffer[0]));
 
     /* Verify results */
     UtAssert_True(Result == true, "Result == true");
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
-                  call_count_CFE_EVS_SendEvent);
+    /* The whole buffer is read with one call to the driver */
+    UtAssert_STUB_COUNT(MM_ReadMem32, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 
     /* no command-handling function should be updating the cmd or err counter itself */
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
@@ -1984,24 +3037,24 @@ void MM_FillDumpInEventBuffer_Test_MEM32(void)
 void MM_FillDumpInEventBuffer_Test_MEM16(void)
 {
     MM_DumpInEventCmd_t CmdPacket;
-    /* CFE_PSP_MemRead16 stub returns success with non-zero address */
-    cpuaddr SrcAddress = 1;
-    bool    Result;
+    cpuaddr             SrcAddress = 0;
+    bool                Result;
 
     CmdPacket.Payload.MemType              = MM_MEM16;
     CmdPacket.Payload.NumOfBytes           = 2;
     CmdPacket.Payload.SrcSymAddress.Offset = 0;
 
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadMem16), true);
+
     /* Execute the function being tested */
-    Result = MM_FillDumpInEventBuffer(SrcAddress, &CmdPacket, (uint8 *)(&MM_AppData.DumpBuffer[0]));
+    Result = MM_FillDumpInEventBuffer(SrcAddress, &CmdPacket, (uint8 *)(&MM_AppData.IoBuffer[0]));
 
     /* Verify results */
     UtAssert_True(Result == true, "Result == true");
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
-                  call_count_CFE_EVS_SendEvent);
+    /* The whole buffer is read with one call to the driver */
+    UtAssert_STUB_COUNT(MM_ReadMem16, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 
     /* no command-handling function should be updating the cmd or err counter itself */
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
@@ -2018,16 +3071,17 @@ void MM_FillDumpInEventBuffer_Test_MEM8(void)
     CmdPacket.Payload.NumOfBytes           = 1;
     CmdPacket.Payload.SrcSymAddress.Offset = 0;
 
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadMem8), true);
+
     /* Execute the function being tested */
-    Result = MM_FillDumpInEventBuffer(SrcAddress, &CmdPacket, (uint8 *)(&MM_AppData.DumpBuffer[0]));
+    Result = MM_FillDumpInEventBuffer(SrcAddress, &CmdPacket, (uint8 *)(&MM_AppData.IoBuffer[0]));
 
     /* Verify results */
     UtAssert_True(Result == true, "Result == true");
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
-                  call_count_CFE_EVS_SendEvent);
+    /* The whole buffer is read with one call to the driver */
+    UtAssert_STUB_COUNT(MM_ReadMem8, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 
     /* no command-handling function should be updating the cmd or err counter itself */
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
@@ -2038,37 +3092,23 @@ void MM_FillDumpInEventBuffer_Test_MEM32ReadError(void)
 {
     MM_DumpInEventCmd_t CmdPacket;
     cpuaddr             SrcAddress = 0;
-    int32               strCmpResult;
-    char                ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
     bool                Result;
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "PSP read memory error: RC=%%d, Src=%%p, Tgt=%%p, Type=MEM32");
-
     CmdPacket.Payload.MemType              = MM_MEM32;
     CmdPacket.Payload.NumOfBytes           = 4;
     CmdPacket.Payload.SrcSymAddress.Offset = 0;
 
-    /* Set to generate error message MM_PSP_READ_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRead32), 1, -1);
+    /* The read routine reports the PSP error itself */
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadMem32), false);
 
     /* Execute the function being tested */
-    Result = MM_FillDumpInEventBuffer(SrcAddress, &CmdPacket, (uint8 *)(&MM_AppData.DumpBuffer[0]));
+    Result = MM_FillDumpInEventBuffer(SrcAddress, &CmdPacket, (uint8 *)(&MM_AppData.IoBuffer[0]));
 
     /* Verify results */
     UtAssert_True(Result == false, "Result == false");
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_PSP_READ_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
-                  call_count_CFE_EVS_SendEvent);
+    UtAssert_STUB_COUNT(MM_ReadMem32, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 
     /* no command-handling function should be updating the cmd or err counter itself */
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
@@ -2079,37 +3119,23 @@ void MM_FillDumpInEventBuffer_Test_MEM16ReadError(void)
 {
     MM_DumpInEventCmd_t CmdPacket;
     cpuaddr             SrcAddress = 0;
-    int32               strCmpResult;
-    char                ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
     bool                Result;
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "PSP read memory error: RC=%%d, Src=%%p, Tgt=%%p, Type=MEM16");
-
     CmdPacket.Payload.MemType              = MM_MEM16;
     CmdPacket.Payload.NumOfBytes           = 4;
     CmdPacket.Payload.SrcSymAddress.Offset = 0;
 
-    /* Set to generate error message MM_PSP_READ_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRead16), 1, -1);
+    /* The read routine reports the PSP error itself */
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadMem16), false);
 
     /* Execute the function being tested */
-    Result = MM_FillDumpInEventBuffer(SrcAddress, &CmdPacket, (uint8 *)(&MM_AppData.DumpBuffer[0]));
+    Result = MM_FillDumpInEventBuffer(SrcAddress, &CmdPacket, (uint8 *)(&MM_AppData.IoBuffer[0]));
 
     /* Verify results */
     UtAssert_True(Result == false, "Result == false");
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_PSP_READ_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
-                  call_count_CFE_EVS_SendEvent);
+    UtAssert_STUB_COUNT(MM_ReadMem16, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 
     /* no command-handling function should be updating the cmd or err counter itself */
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
@@ -2120,37 +3146,23 @@ void MM_FillDumpInEventBuffer_Test_MEM8ReadError(void)
 {
     MM_DumpInEventCmd_t CmdPacket;
     cpuaddr             SrcAddress = 0;
-    int32               strCmpResult;
-    char                ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
     bool                Result;
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "PSP read memory error: RC=%%d, Src=%%p, Tgt=%%p, Type=MEM8");
-
     CmdPacket.Payload.MemType              = MM_MEM8;
     CmdPacket.Payload.NumOfBytes           = 4;
     CmdPacket.Payload.SrcSymAddress.Offset = 0;
 
-    /* Set to generate error message MM_PSP_READ_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRead8), 1, -1);
+    /* The read routine reports the PSP error itself */
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadMem8), false);
 
     /* Execute the function being tested */
-    Result = MM_FillDumpInEventBuffer(SrcAddress, &CmdPacket, (uint8 *)(&MM_AppData.DumpBuffer[0]));
+    Result = MM_FillDumpInEventBuffer(SrcAddress, &CmdPacket, (uint8 *)(&MM_AppData.IoBuffer[0]));
 
     /* Verify results */
     UtAssert_True(Result == false, "Result == false");
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_PSP_READ_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
-
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
-                  call_count_CFE_EVS_SendEvent);
+    UtAssert_STUB_COUNT(MM_ReadMem8, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 
     /* no command-handling function should be updating the cmd or err counter itself */
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
@@ -2160,6 +3172,104 @@ void MM_FillDumpInEventBuffer_Test_MEM8ReadError(void)
 /*
  * Register the test cases to execute with the unit test tool
  */
+/* Returns the CRC handed to the hook when the stub succeeds */
+int32 UT_MM_DUMP_TEST_MM_ComputeMemCRCHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                           const UT_StubContext_t *Context)
+{
+    uint32 *CrcPtr = UT_Hook_GetArgValueByName(Context, "CrcPtr", uint32 *);
+
+    if (StubRetcode == true)
+    {
+        *CrcPtr = *(uint32 *)UserObj;
+    }
+
+    return StubRetcode;
+}
+
+void MM_CrcMemCmd_Test_Nominal(void)
+{
+    bool   Result;
+    uint32 Crc = 0x89ABCDEF;
+
+    UT_CmdBuf.CrcMemCmd.Payload.MemType              = MM_MEM16;
+    UT_CmdBuf.CrcMemCmd.Payload.NumOfBytes           = 64;
+    UT_CmdBuf.CrcMemCmd.Payload.SrcSymAddress.Offset = 8;
+
+    UT_SetHookFunction(UT_KEY(MM_ResolveSymAddr), UT_MM_DUMP_TEST_RegionAddrHook, 0);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ComputeMemCRC), true);
+    UT_SetHookFunction(UT_KEY(MM_ComputeMemCRC), UT_MM_DUMP_TEST_MM_ComputeMemCRCHook, &Crc);
+
+    /* Execute the function being tested */
+    Result = MM_CrcMemCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(Result);
+    UtAssert_STUB_COUNT(MM_SegmentStart, 1);
+    UtAssert_STUB_COUNT(MM_ComputeMemCRC, 1);
+    UtAssert_STUB_COUNT(MM_SegmentEnd, 1);
+
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.LastAction, MM_CRC);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.MemType, MM_MEM16);
+    UtAssert_True(MM_AppData.HkPacket.Payload.Address == (cpuaddr)&Buffer[8],
+                  "MM_AppData.HkPacket.Payload.Address == (cpuaddr)&Buffer[8]");
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.DataValue, 0x89ABCDEF);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.BytesProcessed, 64);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CRC_MEM_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    /* No command-handling function should be updating the cmd or err counter itself */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+}
+
+void MM_CrcMemCmd_Test_SymNameError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_CrcMemCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MM_VerifyLoadDumpParams, 0);
+    UtAssert_STUB_COUNT(MM_ComputeMemCRC, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_SYMNAME_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_CrcMemCmd_Test_VerifyError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_CrcMemCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MM_SegmentStart, 0);
+    UtAssert_STUB_COUNT(MM_ComputeMemCRC, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_CrcMemCmd_Test_ReadError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ComputeMemCRC), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_CrcMemCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results, the read error event comes from the PSP read */
+    UtAssert_STUB_COUNT(MM_SegmentEnd, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.LastAction, MM_NOACTION);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
 void UtTest_Setup(void)
 {
     UtTest_Add(MM_PeekCmd_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_PeekCmd_Test_Nominal");
@@ -2172,6 +3282,7 @@ void UtTest_Setup(void)
     UtTest_Add(MM_PeekMem_Test_WordError, MM_Test_Setup, MM_Test_TearDown, "MM_PeekMem_Test_WordError");
     UtTest_Add(MM_PeekMem_Test_DWord, MM_Test_Setup, MM_Test_TearDown, "MM_PeekMem_Test_DWord");
     UtTest_Add(MM_PeekMem_Test_DWordError, MM_Test_Setup, MM_Test_TearDown, "MM_PeekMem_Test_DWordError");
+    UtTest_Add(MM_PeekMem_Test_SymIndex, MM_Test_Setup, MM_Test_TearDown, "MM_PeekMem_Test_SymIndex");
     UtTest_Add(MM_PeekMem_Test_DefaultSwitch, MM_Test_Setup, MM_Test_TearDown, "MM_PeekMem_Test_DefaultSwitch");
 
     UtTest_Add(MM_DumpMemToFileCmd_Test_RAM, MM_Test_Setup, MM_Test_TearDown, "MM_DumpMemToFileCmd_Test_RAM");
@@ -2181,16 +3292,16 @@ void UtTest_Setup(void)
     UtTest_Add(MM_DumpMemToFileCmd_Test_MEM32, MM_Test_Setup, MM_Test_TearDown, "MM_DumpMemToFileCmd_Test_MEM32");
     UtTest_Add(MM_DumpMemToFileCmd_Test_MEM16, MM_Test_Setup, MM_Test_TearDown, "MM_DumpMemToFileCmd_Test_MEM16");
     UtTest_Add(MM_DumpMemToFileCmd_Test_MEM8, MM_Test_Setup, MM_Test_TearDown, "MM_DumpMemToFileCmd_Test_MEM8");
-    UtTest_Add(MM_DumpMemToFileCmd_Test_ComputeCRCError, MM_Test_Setup, MM_Test_TearDown,
-               "MM_DumpMemToFileCmd_Test_ComputeCRCError");
+    UtTest_Add(MM_DumpMemToFileCmd_Test_RewriteHeadersError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_DumpMemToFileCmd_Test_RewriteHeadersError");
     UtTest_Add(MM_DumpMemToFileCmd_Test_CloseError, MM_Test_Setup, MM_Test_TearDown,
                "MM_DumpMemToFileCmd_Test_CloseError");
     UtTest_Add(MM_DumpMemToFileCmd_Test_CreatError, MM_Test_Setup, MM_Test_TearDown,
                "MM_DumpMemToFileCmd_Test_CreatError");
     UtTest_Add(MM_DumpMemToFileCmd_Test_InvalidDumpResult, MM_Test_Setup, MM_Test_TearDown,
                "MM_DumpMemToFileCmd_Test_InvalidDumpResult");
-    UtTest_Add(MM_DumpMemToFileCmd_Test_lseekError, MM_Test_Setup, MM_Test_TearDown,
-               "MM_DumpMemToFileCmd_Test_lseekError");
+    UtTest_Add(MM_DumpMemToFileCmd_Test_NoReadBack, MM_Test_Setup, MM_Test_TearDown,
+               "MM_DumpMemToFileCmd_Test_NoReadBack");
     UtTest_Add(MM_DumpMemToFileCmd_Test_SymNameError, MM_Test_Setup, MM_Test_TearDown,
                "MM_DumpMemToFileCmd_Test_SymNameError");
     UtTest_Add(MM_DumpMemToFileCmd_Test_NoVerifyDumpParams, MM_Test_Setup, MM_Test_TearDown,
@@ -2200,8 +3311,64 @@ void UtTest_Setup(void)
 
     UtTest_Add(MM_DumpMemToFile_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_DumpMemToFile_Test_Nominal");
     UtTest_Add(MM_DumpMemToFile_Test_CPUHogging, MM_Test_Setup, MM_Test_TearDown, "MM_DumpMemToFile_Test_CPUHogging");
+    UtTest_Add(MM_DumpMemToFile_Test_MultipleBlocks, MM_Test_Setup, MM_Test_TearDown,
+               "MM_DumpMemToFile_Test_MultipleBlocks");
     UtTest_Add(MM_DumpMemToFile_Test_WriteError, MM_Test_Setup, MM_Test_TearDown, "MM_DumpMemToFile_Test_WriteError");
 
+    UtTest_Add(MM_DumpMemToFileEncCmd_Test_RLE, MM_Test_Setup, MM_Test_TearDown, "MM_DumpMemToFileEncCmd_Test_RLE");
+    UtTest_Add(MM_DumpMemToFileEncCmd_Test_Sparse, MM_Test_Setup, MM_Test_TearDown,
+               "MM_DumpMemToFileEncCmd_Test_Sparse");
+    UtTest_Add(MM_DumpMemToFileEncCmd_Test_EncodingError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_DumpMemToFileEncCmd_Test_EncodingError");
+    UtTest_Add(MM_DumpMemToEncodedFile_Test_Nominal, MM_Test_Setup, MM_Test_TearDown,
+               "MM_DumpMemToEncodedFile_Test_Nominal");
+    UtTest_Add(MM_DumpMemToEncodedFile_Test_MemoryChanges, MM_Test_Setup, MM_Test_TearDown,
+               "MM_DumpMemToEncodedFile_Test_MemoryChanges");
+    UtTest_Add(MM_DumpMemToEncodedFile_Test_WriteError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_DumpMemToEncodedFile_Test_WriteError");
+    UtTest_Add(MM_WriteEncodedBlock_Test_Empty, MM_Test_Setup, MM_Test_TearDown, "MM_WriteEncodedBlock_Test_Empty");
+
+    UtTest_Add(MM_DumpMemToDeltaFileCmd_Test_Nominal, MM_Test_Setup, MM_Test_TearDown,
+               "MM_DumpMemToDeltaFileCmd_Test_Nominal");
+    UtTest_Add(MM_DumpMemToDeltaFileCmd_Test_BaselineMismatch, MM_Test_Setup, MM_Test_TearDown,
+               "MM_DumpMemToDeltaFileCmd_Test_BaselineMismatch");
+    UtTest_Add(MM_DumpMemToDeltaFileCmd_Test_BaselineOpenError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_DumpMemToDeltaFileCmd_Test_BaselineOpenError");
+    UtTest_Add(MM_DumpMemToDeltaFileCmd_Test_MemTypeError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_DumpMemToDeltaFileCmd_Test_MemTypeError");
+    UtTest_Add(MM_DumpMemToDeltaFileCmd_Test_SymNameError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_DumpMemToDeltaFileCmd_Test_SymNameError");
+    UtTest_Add(MM_DumpMemToDeltaFile_Test_Nominal, MM_Test_Setup, MM_Test_TearDown,
+               "MM_DumpMemToDeltaFile_Test_Nominal");
+    UtTest_Add(MM_DumpMemToDeltaFile_Test_BaselineCrcError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_DumpMemToDeltaFile_Test_BaselineCrcError");
+    UtTest_Add(MM_DumpMemToDeltaFile_Test_ReadError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_DumpMemToDeltaFile_Test_ReadError");
+    UtTest_Add(MM_WriteDeltaHeader_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_WriteDeltaHeader_Test_Nominal");
+    UtTest_Add(MM_WriteDeltaHeader_Test_MapWriteError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_WriteDeltaHeader_Test_MapWriteError");
+
+    UtTest_Add(MM_DumpMemToMultiFileCmd_Test_Nominal, MM_Test_Setup, MM_Test_TearDown,
+               "MM_DumpMemToMultiFileCmd_Test_Nominal");
+    UtTest_Add(MM_DumpMemToMultiFileCmd_Test_RegionFileError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_DumpMemToMultiFileCmd_Test_RegionFileError");
+    UtTest_Add(MM_DumpMemToMultiFileCmd_Test_CreateError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_DumpMemToMultiFileCmd_Test_CreateError");
+    UtTest_Add(MM_DumpMemToMultiFileCmd_Test_RegionWriteError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_DumpMemToMultiFileCmd_Test_RegionWriteError");
+    UtTest_Add(MM_ReadDumpRegionFile_Test_EncodingError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_ReadDumpRegionFile_Test_EncodingError");
+    UtTest_Add(MM_ReadDumpRegionFile_Test_OpenError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_ReadDumpRegionFile_Test_OpenError");
+    UtTest_Add(MM_ReadDumpRegionFile_Test_RegionError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_ReadDumpRegionFile_Test_RegionError");
+    UtTest_Add(MM_VerifyDumpRegion_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_VerifyDumpRegion_Test_Nominal");
+    UtTest_Add(MM_VerifyDumpRegion_Test_Errors, MM_Test_Setup, MM_Test_TearDown, "MM_VerifyDumpRegion_Test_Errors");
+    UtTest_Add(MM_DumpFileRegion_Test_MemTypes, MM_Test_Setup, MM_Test_TearDown, "MM_DumpFileRegion_Test_MemTypes");
+    UtTest_Add(MM_WriteMultiFileTable_Test_Nominal, MM_Test_Setup, MM_Test_TearDown,
+               "MM_WriteMultiFileTable_Test_Nominal");
+    UtTest_Add(MM_WriteMultiFileTable_Test_WriteError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_WriteMultiFileTable_Test_WriteError");
     UtTest_Add(MM_WriteFileHeaders_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_WriteFileHeaders_Test_Nominal");
     UtTest_Add(MM_WriteFileHeaders_Test_WriteHeaderError, MM_Test_Setup, MM_Test_TearDown,
                "MM_WriteFileHeaders_Test_WriteHeaderError");
@@ -2209,6 +3376,9 @@ void UtTest_Setup(void)
                "MM_WriteFileHeaders_Test_WriteError");
 
     UtTest_Add(MM_DumpInEventCmd_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_DumpInEventCmd_Test_Nominal");
+    UtTest_Add(MM_DumpInEventCmd_Test_SymIndex, MM_Test_Setup, MM_Test_TearDown, "MM_DumpInEventCmd_Test_SymIndex");
+    UtTest_Add(MM_DumpInEventCmd_Test_SymIndexNoRoom, MM_Test_Setup, MM_Test_TearDown,
+               "MM_DumpInEventCmd_Test_SymIndexNoRoom");
     UtTest_Add(MM_DumpInEventCmd_Test_SymNameError, MM_Test_Setup, MM_Test_TearDown,
                "MM_DumpInEventCmd_Test_SymNameError");
     UtTest_Add(MM_DumpInEventCmd_Test_NoVerifyDumpParams, MM_Test_Setup, MM_Test_TearDown,
@@ -2233,4 +3403,9 @@ void UtTest_Setup(void)
                "MM_FillDumpInEventBuffer_Test_MEM16ReadError");
     UtTest_Add(MM_FillDumpInEventBuffer_Test_MEM8ReadError, MM_Test_Setup, MM_Test_TearDown,
                "MM_FillDumpInEventBuffer_Test_MEM8ReadError");
+
+    UtTest_Add(MM_CrcMemCmd_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_CrcMemCmd_Test_Nominal");
+    UtTest_Add(MM_CrcMemCmd_Test_SymNameError, MM_Test_Setup, MM_Test_TearDown, "MM_CrcMemCmd_Test_SymNameError");
+    UtTest_Add(MM_CrcMemCmd_Test_VerifyError, MM_Test_Setup, MM_Test_TearDown, "MM_CrcMemCmd_Test_VerifyError");
+    UtTest_Add(MM_CrcMemCmd_Test_ReadError, MM_Test_Setup, MM_Test_TearDown, "MM_CrcMemCmd_Test_ReadError");
 }
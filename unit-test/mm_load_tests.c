@@ -26,6 +26,7 @@
 ** Includes
 *************************************************************************/
 #include "mm_load.h"
+#include "mm_codec.h"
 #include "mm_msg.h"
 #include "mm_msgdefs.h"
 #include "mm_msgids.h"
@@ -33,6 +34,7 @@
 #include "mm_filedefs.h"
 #include "mm_version.h"
 #include "mm_utils.h"
+#include "mm_crc.h"
 #include "mm_test_utils.h"
 #include "mm_mem32.h"
 #include "mm_mem16.h"
@@ -57,7 +59,7 @@ MM_LoadDumpFileHeader_t MMHeaderSave;
 
 MM_LoadDumpFileHeader_t *MMHeaderRestore;
 
-uint8 Buffer[MM_MAX_FILL_DATA_SEG * 2];
+uint8 Buffer[MM_IO_BUFFER_SIZE * 2];
 
 /*
  * Function Definitions
@@ -199,6 +201,17 @@ int32 UT_MM_LOAD_TEST_CFE_OS_StatHook1(void *UserObj, int32 StubRetcode, uint32
     return OS_SUCCESS;
 }
 
+int32 UT_MM_LOAD_TEST_CFE_OS_StatHook2(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                       const UT_StubContext_t *Context)
+{
+    os_fstat_t filestats = {.FileSize = sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t) + 20};
+
+    /* Load buffer */
+    UT_SetDataBuffer(UT_KEY(OS_stat), &filestats, sizeof(filestats), true);
+
+    return OS_SUCCESS;
+}
+
 void MM_PokeCmd_Test_EEPROM(void)
 {
     CFE_SB_MsgId_t    TestMsgId;
@@ -271,10 +284,13 @@ void MM_PokeCmd_Test_NonEEPROM(void)
 
     UT_SetDeferredRetcode(UT_KEY(MM_VerifyPeekPokeParams), 1, true);
 
+    UT_SetDefaultReturnValue(UT_KEY(MM_WriteMemBlock), true);
+
     /* Execute the function being tested */
     Result = MM_PokeCmd(&UT_CmdBuf.Buf);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(MM_WriteMemBlock, 1);
     UtAssert_True(Result == true, "Result == true");
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_POKE_DWORD_INF_EID);
@@ -388,10 +404,11 @@ void MM_PokeMem_Test_NoDataSize(void)
 
     /* Verify results */
     UtAssert_True(Result == false, "Result == false");
+    UtAssert_STUB_COUNT(MM_WriteMemBlock, 0);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
                   call_count_CFE_EVS_SendEvent);
 
     /* No command-handling function should be updating the cmd or err counter itself */
@@ -416,10 +433,13 @@ void MM_PokeMem_Test_8bit(void)
 
     DestAddress = 1;
 
+    UT_SetDefaultReturnValue(UT_KEY(MM_WriteMemBlock), true);
+
     /* Execute the function being tested */
     Result = MM_PokeMem(&CmdPacket, DestAddress);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(MM_WriteMemBlock, 1);
     UtAssert_True(Result == true, "Result == true");
 
     UtAssert_True(MM_AppData.HkPacket.Payload.LastAction == MM_POKE, "MM_AppData.HkPacket.Payload.LastAction == MM_POKE");
@@ -449,39 +469,29 @@ void MM_PokeMem_Test_8bitError(void)
 {
     MM_PokeCmd_t CmdPacket;
     uint32       DestAddress;
-    int32        strCmpResult;
-    char         ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
     bool         Result;
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "PSP write memory error: RC=0x%%08X, Address=%%p, MemType=MEM%%u");
-
     CmdPacket.Payload.MemType  = MM_RAM;
     CmdPacket.Payload.DataSize = MM_BYTE_BIT_WIDTH;
     CmdPacket.Payload.Data     = (uint8)(5);
 
-    /* CFE_PSP_MemWrite8 stub returns success with non-zero address */
     DestAddress = 0;
 
-    /* Set to generate error message MM_PSP_WRITE_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemWrite8), 1, -1);
+    /* Driver write fails, the driver sends its own error event */
+    UT_SetDefaultReturnValue(UT_KEY(MM_WriteMemBlock), false);
 
     /* Execute the function being tested */
     Result = MM_PokeMem(&CmdPacket, DestAddress);
 
     /* Verify results */
     UtAssert_True(Result == false, "Result == false");
-
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_PSP_WRITE_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    UtAssert_STUB_COUNT(MM_WriteMemBlock, 1);
+    UtAssert_True(MM_AppData.HkPacket.Payload.LastAction == MM_NOACTION,
+                  "MM_AppData.HkPacket.Payload.LastAction == MM_NOACTION");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
                   call_count_CFE_EVS_SendEvent);
 
     /* No command-handling function should be updating the cmd or err counter itself */
@@ -506,10 +516,13 @@ void MM_PokeMem_Test_16bit(void)
 
     DestAddress = 1;
 
+    UT_SetDefaultReturnValue(UT_KEY(MM_WriteMemBlock), true);
+
     /* Execute the function being tested */
     Result = MM_PokeMem(&CmdPacket, DestAddress);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(MM_WriteMemBlock, 1);
     UtAssert_True(Result == true, "Result == true");
 
     UtAssert_True(MM_AppData.HkPacket.Payload.LastAction == MM_POKE, "MM_AppData.HkPacket.Payload.LastAction == MM_POKE");
@@ -539,39 +552,29 @@ void MM_PokeMem_Test_16bitError(void)
 {
     MM_PokeCmd_t CmdPacket;
     uint32       DestAddress;
-    int32        strCmpResult;
-    char         ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
     bool         Result;
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "PSP write memory error: RC=0x%%08X, Address=%%p, MemType=MEM%%u");
-
     CmdPacket.Payload.MemType  = MM_RAM;
     CmdPacket.Payload.DataSize = MM_WORD_BIT_WIDTH;
     CmdPacket.Payload.Data     = (uint16)(5);
 
-    /* CFE_PSP_MemWrite16 stub returns success with non-zero address */
     DestAddress = 0;
 
-    /* Set to generate error message MM_PSP_WRITE_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemWrite16), 1, -1);
+    /* Driver write fails, the driver sends its own error event */
+    UT_SetDefaultReturnValue(UT_KEY(MM_WriteMemBlock), false);
 
     /* Execute the function being tested */
     Result = MM_PokeMem(&CmdPacket, DestAddress);
 
     /* Verify results */
     UtAssert_True(Result == false, "Result == false");
-
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_PSP_WRITE_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    UtAssert_STUB_COUNT(MM_WriteMemBlock, 1);
+    UtAssert_True(MM_AppData.HkPacket.Payload.LastAction == MM_NOACTION,
+                  "MM_AppData.HkPacket.Payload.LastAction == MM_NOACTION");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
                   call_count_CFE_EVS_SendEvent);
 
     /* No command-handling function should be updating the cmd or err counter itself */
@@ -596,10 +599,13 @@ void MM_PokeMem_Test_32bit(void)
 
     DestAddress = 1;
 
+    UT_SetDefaultReturnValue(UT_KEY(MM_WriteMemBlock), true);
+
     /* Execute the function being tested */
     Result = MM_PokeMem(&CmdPacket, DestAddress);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(MM_WriteMemBlock, 1);
     UtAssert_True(Result == true, "Result == true");
 
     UtAssert_True(MM_AppData.HkPacket.Payload.LastAction == MM_POKE, "MM_AppData.HkPacket.Payload.LastAction == MM_POKE");
@@ -629,39 +635,29 @@ void MM_PokeMem_Test_32bitError(void)
 {
     MM_PokeCmd_t CmdPacket;
     uint32       DestAddress;
-    int32        strCmpResult;
-    char         ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
     bool         Result;
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "PSP write memory error: RC=0x%%08X, Address=%%p, MemType=MEM%%u");
-
     CmdPacket.Payload.MemType  = MM_RAM;
     CmdPacket.Payload.DataSize = MM_DWORD_BIT_WIDTH;
     CmdPacket.Payload.Data     = (uint32)(5);
 
-    /* CFE_PSP_MemWrite32 stub returns success with non-zero address */
     DestAddress = 0;
 
-    /* Set to generate error message MM_PSP_WRITE_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemWrite32), 1, -1);
+    /* Driver write fails, the driver sends its own error event */
+    UT_SetDefaultReturnValue(UT_KEY(MM_WriteMemBlock), false);
 
     /* Execute the function being tested */
     Result = MM_PokeMem(&CmdPacket, DestAddress);
 
     /* Verify results */
     UtAssert_True(Result == false, "Result == false");
-
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_PSP_WRITE_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
-
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
-
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    UtAssert_STUB_COUNT(MM_WriteMemBlock, 1);
+    UtAssert_True(MM_AppData.HkPacket.Payload.LastAction == MM_NOACTION,
+                  "MM_AppData.HkPacket.Payload.LastAction == MM_NOACTION");
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
                   call_count_CFE_EVS_SendEvent);
 
     /* No command-handling function should be updating the cmd or err counter itself */
@@ -2027,6 +2023,177 @@ void MM_LoadMemFromFileCmd_Test_OpenError(void)
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 }
 
+void MM_LoadMemFromFileCmd_Test_RLE(void)
+{
+    bool                    Result;
+    MM_LoadDumpFileHeader_t FileHeader;
+
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.MemType    = MM_RAM;
+    FileHeader.NumOfBytes = 64;
+    FileHeader.Encoding   = MM_ENCODING_RLE;
+
+    strncpy(UT_CmdBuf.LoadMemFromFileCmd.Payload.FileName, "name", sizeof(UT_CmdBuf.LoadMemFromFileCmd.Payload.FileName) - 1);
+
+    /* The encoded data is smaller than the load bytes */
+    UT_SetHookFunction(UT_KEY(OS_stat), UT_MM_LOAD_TEST_CFE_OS_StatHook2, 0);
+    UT_SetDeferredRetcode(UT_KEY(MM_ResolveSymAddr), 1, true);
+
+    /* File header, encoded data for the CRC, end of file, then the encoded data again for the load */
+    UT_SetDataBuffer(UT_KEY(OS_read), &FileHeader, sizeof(FileHeader), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, 10);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ReadHeader), 1, sizeof(CFE_FS_Header_t));
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+
+    /* Execute the function being tested */
+    Result = MM_LoadMemFromFileCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results, the encoded data is decoded once for the CRC and once for the load */
+    UtAssert_BOOL_TRUE(Result);
+    UtAssert_STUB_COUNT(MM_VerifyFileEncoding, 1);
+    UtAssert_STUB_COUNT(MM_ComputeCRCFromFile, 0);
+    UtAssert_STUB_COUNT(OS_read, 4);
+    UtAssert_STUB_COUNT(MM_FileDecode, 2);
+    UtAssert_STUB_COUNT(MM_SegmentEnd, 1);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.BytesProcessed, 64);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_LD_MEM_FILE_INF_EID);
+}
+
+void MM_LoadMemFromFileCmd_Test_EncodingError(void)
+{
+    bool                    Result;
+    MM_LoadDumpFileHeader_t FileHeader;
+
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.MemType    = MM_MEM32;
+    FileHeader.NumOfBytes = 64;
+    FileHeader.Encoding   = MM_ENCODING_RLE;
+
+    strncpy(UT_CmdBuf.LoadMemFromFileCmd.Payload.FileName, "name", sizeof(UT_CmdBuf.LoadMemFromFileCmd.Payload.FileName) - 1);
+
+    UT_SetDataBuffer(UT_KEY(OS_read), &FileHeader, sizeof(FileHeader), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ReadHeader), 1, sizeof(CFE_FS_Header_t));
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyFileEncoding), false);
+
+    /* Execute the function being tested */
+    Result = MM_LoadMemFromFileCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results, the file is rejected before its size or data are checked */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(OS_stat, 0);
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(MM_FileDecode, 0);
+}
+
+void MM_LoadMemFromFileCmd_Test_Staged(void)
+{
+    bool                Result;
+    uint32              StagingData[4];
+    CFE_ES_MemPoolBuf_t PoolBuf   = StagingData;
+    os_fstat_t          FileStats = {.FileSize = sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t) + 4};
+    struct
+    {
+        MM_LoadDumpFileHeader_t Header;
+        uint8                   Data[4];
+    } LoadFile;
+
+    memset(&LoadFile, 0, sizeof(LoadFile));
+    LoadFile.Header.MemType    = MM_RAM;
+    LoadFile.Header.NumOfBytes = 4;
+    memcpy(LoadFile.Data, "\x01\x02\x03\x04", 4);
+    memset(Buffer, 0, sizeof(Buffer));
+
+    strncpy(UT_CmdBuf.LoadMemFromFileCmd.Payload.FileName, "name", sizeof(UT_CmdBuf.LoadMemFromFileCmd.Payload.FileName) - 1);
+
+    /* The file is read in two pieces, the header and then the staged load data */
+    UT_SetDataBuffer(UT_KEY(OS_read), &LoadFile, sizeof(LoadFile), false);
+    UT_SetDataBuffer(UT_KEY(OS_stat), &FileStats, sizeof(FileStats), false);
+
+    UT_SetHookFunction(UT_KEY(MM_ResolveSymAddr), UT_MM_LOAD_TEST_CFE_SymbolLookupHook3, 0);
+
+    /* Provide a staging buffer large enough for the load */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetPoolBuf), 4);
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetPoolBuf), &PoolBuf, sizeof(PoolBuf), false);
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ReadHeader), 1, sizeof(CFE_FS_Header_t));
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+
+    /* Execute the function being tested */
+    Result = MM_LoadMemFromFileCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(Result == true, "Result == true");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_LD_MEM_FILE_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    /* The load data was read once and never re-read from the file */
+    UtAssert_MemCmp(Buffer, LoadFile.Data, sizeof(LoadFile.Data), "Staged data loaded");
+    UtAssert_STUB_COUNT(MM_ComputeCRCFromFile, 0);
+    UtAssert_STUB_COUNT(MM_LoadMemFromFile, 0);
+    UtAssert_STUB_COUNT(OS_lseek, 0);
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 1);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+    /* No command-handling function should be updating the cmd or err counter itself */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+}
+
+void MM_LoadMemFromFileCmd_Test_StagedReadError(void)
+{
+    bool                    Result;
+    uint32                  StagingData[4];
+    CFE_ES_MemPoolBuf_t     PoolBuf   = StagingData;
+    os_fstat_t              FileStats = {.FileSize = sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t) + 4};
+    MM_LoadDumpFileHeader_t Header;
+
+    memset(&Header, 0, sizeof(Header));
+    Header.MemType    = MM_EEPROM;
+    Header.NumOfBytes = 4;
+
+    strncpy(UT_CmdBuf.LoadMemFromFileCmd.Payload.FileName, "name", sizeof(UT_CmdBuf.LoadMemFromFileCmd.Payload.FileName) - 1);
+
+    /* Only the header read succeeds, the staging read comes up short */
+    UT_SetDataBuffer(UT_KEY(OS_read), &Header, sizeof(Header), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, 2);
+    UT_SetDataBuffer(UT_KEY(OS_stat), &FileStats, sizeof(FileStats), false);
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetPoolBuf), 4);
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetPoolBuf), &PoolBuf, sizeof(PoolBuf), false);
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ReadHeader), 1, sizeof(CFE_FS_Header_t));
+
+    /* Execute the function being tested */
+    Result = MM_LoadMemFromFileCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_True(Result == false, "Result == false");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_COMPUTECRCFROMFILE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    /* The staging buffer is returned on the error path too */
+    UtAssert_STUB_COUNT(CFE_ES_PutPoolBuf, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+    /* No command-handling function should be updating the cmd or err counter itself */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+}
+
 void MM_LoadMemFromFile_Test_PreventCPUHogging(void)
 {
     bool                    Result;
@@ -2034,10 +2201,10 @@ void MM_LoadMemFromFile_Test_PreventCPUHogging(void)
     char                    FileName[] = "filename";
 
     FileHeader.MemType    = MM_EEPROM;
-    FileHeader.NumOfBytes = 2 * MM_MAX_LOAD_DATA_SEG;
+    FileHeader.NumOfBytes = 2 * MM_IO_BUFFER_SIZE;
 
-    /* Set to satisfy condition "(ReadLength = OS_read(FileHandle, ioBuffer, SegmentSize)) == SegmentSize" */
-    UT_SetDefaultReturnValue(UT_KEY(OS_read), MM_MAX_LOAD_DATA_SEG);
+    /* Set to satisfy condition "ReadLength == BlockSize" */
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), MM_IO_BUFFER_SIZE);
 
     /* Execute the function being tested */
     Result = MM_LoadMemFromFile(MM_UT_OBJID_1, FileName, &FileHeader, (cpuaddr)&Buffer[0]);
@@ -2048,8 +2215,12 @@ void MM_LoadMemFromFile_Test_PreventCPUHogging(void)
                   "MM_AppData.HkPacket.Payload.LastAction == MM_LOAD_FROM_FILE");
     UtAssert_True(MM_AppData.HkPacket.Payload.MemType == MM_EEPROM, "MM_AppData.HkPacket.Payload.MemType == MM_EEPROM");
     UtAssert_True(MM_AppData.HkPacket.Payload.Address == (cpuaddr)(&Buffer[0]), "MM_AppData.HkPacket.Payload.Address == 0");
-    UtAssert_True(MM_AppData.HkPacket.Payload.BytesProcessed == 2 * MM_MAX_LOAD_DATA_SEG,
-                  "MM_AppData.HkPacket.Payload.BytesProcessed == 2*MM_MAX_LOAD_DATA_SEG");
+    UtAssert_True(MM_AppData.HkPacket.Payload.BytesProcessed == 2 * MM_IO_BUFFER_SIZE,
+                  "MM_AppData.HkPacket.Payload.BytesProcessed == 2*MM_IO_BUFFER_SIZE");
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(MM_SegmentIoStart, 2);
+    UtAssert_STUB_COUNT(MM_SegmentIoEnd, 2);
+    UtAssert_STUB_COUNT(MM_SegmentEnd, 1);
     UtAssert_STRINGBUF_EQ(MM_AppData.HkPacket.Payload.FileName, sizeof(MM_AppData.HkPacket.Payload.FileName), FileName,
                           sizeof(FileName));
 
@@ -2082,6 +2253,7 @@ void MM_LoadMemFromFile_Test_ReadError(void)
 
     /* Verify results */
     UtAssert_True(Result == false, "Result == false");
+    UtAssert_STUB_COUNT(MM_SegmentEnd, 0);
 
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_READ_ERR_EID);
     UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
@@ -2108,8 +2280,8 @@ void MM_LoadMemFromFile_Test_NotEepromMemType(void)
     FileHeader.MemType    = MM_MEM8;
     FileHeader.NumOfBytes = 2 * MM_MAX_LOAD_DATA_SEG;
 
-    /* Set to satisfy condition "(ReadLength = OS_read(FileHandle, ioBuffer, SegmentSize)) == SegmentSize" */
-    UT_SetDefaultReturnValue(UT_KEY(OS_read), MM_MAX_LOAD_DATA_SEG);
+    /* Set to satisfy condition "ReadLength == BlockSize", the whole file fits in one block */
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 2 * MM_MAX_LOAD_DATA_SEG);
 
     /* Execute the function being tested */
     Result = MM_LoadMemFromFile(MM_UT_OBJID_1, FileName, &FileHeader, (cpuaddr)&Buffer[0]);
@@ -2122,6 +2294,7 @@ void MM_LoadMemFromFile_Test_NotEepromMemType(void)
     UtAssert_True(MM_AppData.HkPacket.Payload.Address == (cpuaddr)(&Buffer[0]), "MM_AppData.HkPacket.Payload.Address == 0");
     UtAssert_True(MM_AppData.HkPacket.Payload.BytesProcessed == 2 * MM_MAX_LOAD_DATA_SEG,
                   "MM_AppData.HkPacket.Payload.BytesProcessed == 2*MM_MAX_LOAD_DATA_SEG");
+    UtAssert_STUB_COUNT(OS_read, 1);
     UtAssert_STRINGBUF_EQ(MM_AppData.HkPacket.Payload.FileName, sizeof(MM_AppData.HkPacket.Payload.FileName), FileName,
                           sizeof(FileName));
 
@@ -2134,132 +2307,1251 @@ void MM_LoadMemFromFile_Test_NotEepromMemType(void)
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 }
 
-void MM_ReadFileHeaders_Test_ReadHeaderError(void)
+void MM_ComputeDecodedCRCFromFile_Test_Nominal(void)
 {
-    bool                    Result;
-    osal_id_t               FileHandle = MM_UT_OBJID_1;
-    CFE_FS_Header_t         CFEHeader;
-    MM_LoadDumpFileHeader_t MMHeader;
-    int32                   strCmpResult;
-    char                    ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    MM_LoadDumpFileHeader_t FileHeader;
+    uint32                  Crc = 0;
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "CFE_FS_ReadHeader error received: RC = 0x%%08X Expected = %%u File = '%%s'");
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.NumOfBytes = 2 * MM_CODEC_CHECK_CHUNK;
 
-    /* Set to satisfy condition "OS_Status != sizeof(CFE_FS_Header_t)" */
-    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ReadHeader), 1, 0);
+    /* Two blocks of encoded data then the end of the file */
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 10);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 3, 0);
+    UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), 0x1234);
 
     /* Execute the function being tested */
-    Result = MM_ReadFileHeaders((char *)"filename", FileHandle, &CFEHeader, &MMHeader);
-
-    /* Verify results */
-    UtAssert_True(Result == false, "Result == false");
+    UtAssert_INT32_EQ(MM_ComputeDecodedCRCFromFile(MM_UT_OBJID_1, "filename", &FileHeader, &Crc), OS_SUCCESS);
+
+    /* Verify results, the CRC is of the decoded data */
+    UtAssert_UINT32_EQ(Crc, 0x1234);
+    UtAssert_STUB_COUNT(OS_read, 3);
+    UtAssert_STUB_COUNT(MM_FileDecode, 2);
+    UtAssert_STUB_COUNT(MM_CalculateCRC, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CFE_FS_READHDR_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+void MM_ComputeDecodedCRCFromFile_Test_Truncated(void)
+{
+    MM_LoadDumpFileHeader_t FileHeader;
+    uint32                  Crc = 0;
 
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.NumOfBytes = 16;
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    /* The encoded data ends before all load bytes are decoded */
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 10);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
+    UT_SetDeferredRetcode(UT_KEY(MM_FileDecode), 1, 8);
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
-                  call_count_CFE_EVS_SendEvent);
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MM_ComputeDecodedCRCFromFile(MM_UT_OBJID_1, "filename", &FileHeader, &Crc), OS_ERROR);
 
-    /* No command-handling function should be updating the cmd or err counter itself */
-    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
-    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+    /* Verify results */
+    UtAssert_UINT32_EQ(Crc, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_LOAD_DECODE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
 }
 
-void MM_ReadFileHeaders_Test_ReadError(void)
+void MM_ComputeDecodedCRCFromFile_Test_NotDone(void)
 {
-    bool                    Result;
-    osal_id_t               FileHandle = MM_UT_OBJID_1;
-    CFE_FS_Header_t         CFEHeader;
-    MM_LoadDumpFileHeader_t MMHeader;
-    int32                   strCmpResult;
-    char                    ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    MM_LoadDumpFileHeader_t FileHeader;
+    uint32                  Crc = 0;
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "OS_read error received: RC = 0x%%08X Expected = %%u File = '%%s'");
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.NumOfBytes = 16;
+    FileHeader.Encoding   = MM_ENCODING_SPARSE;
 
-    /* Set to generate error message MM_OS_READ_ERR_EID */
+    /* All load bytes are decoded but the data doesn't end there */
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 10);
     UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
+    UT_SetDefaultReturnValue(UT_KEY(MM_FileDecodeDone), false);
 
     /* Execute the function being tested */
-    Result = MM_ReadFileHeaders((char *)"filename", FileHandle, &CFEHeader, &MMHeader);
+    UtAssert_INT32_EQ(MM_ComputeDecodedCRCFromFile(MM_UT_OBJID_1, "filename", &FileHeader, &Crc), OS_ERROR);
 
     /* Verify results */
-    UtAssert_True(Result == false, "Result == false");
+    UtAssert_UINT32_EQ(Crc, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_LOAD_DECODE_ERR_EID);
+}
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_READ_EXP_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+void MM_ComputeDecodedCRCFromFile_Test_ReadError(void)
+{
+    MM_LoadDumpFileHeader_t FileHeader;
+    uint32                  Crc = 0;
 
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.NumOfBytes = 16;
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, OS_ERROR_TIMEOUT);
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
-                  call_count_CFE_EVS_SendEvent);
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MM_ComputeDecodedCRCFromFile(MM_UT_OBJID_1, "filename", &FileHeader, &Crc), OS_ERROR_TIMEOUT);
 
-    /* No command-handling function should be updating the cmd or err counter itself */
-    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
-    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+    /* Verify results, the caller reports read errors */
+    UtAssert_STUB_COUNT(MM_FileDecode, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void MM_VerifyLoadFileSize_Test_StatError(void)
+void MM_LoadMemFromEncodedFile_Test_Nominal(void)
 {
     bool                    Result;
     MM_LoadDumpFileHeader_t FileHeader;
-    int32                   strCmpResult;
-    char                    ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+    char                    FileName[] = "filename";
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "OS_stat error received: RC = 0x%%08X File = '%%s'");
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.MemType    = MM_EEPROM;
+    FileHeader.NumOfBytes = 2 * MM_MAX_LOAD_DATA_SEG;
+    FileHeader.Encoding   = MM_ENCODING_RLE;
 
-    /* Set to generate error message MM_OS_MEMVALIDATE_ERR_EID */
-    UT_SetDeferredRetcode(UT_KEY(OS_stat), 1, -1);
+    /* Each file block decodes to a full load segment */
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), 10);
 
     /* Execute the function being tested */
-    Result = MM_VerifyLoadFileSize((char *)"filename", &FileHeader);
+    Result = MM_LoadMemFromEncodedFile(MM_UT_OBJID_1, FileName, &FileHeader, (cpuaddr)&Buffer[0]);
 
     /* Verify results */
-    UtAssert_True(Result == false, "Result == false");
+    UtAssert_BOOL_TRUE(Result);
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(MM_FileDecode, 2);
+    UtAssert_STUB_COUNT(MM_SegmentIoStart, 2);
+    UtAssert_STUB_COUNT(MM_SegmentBreak, 1);
+    UtAssert_STUB_COUNT(MM_SegmentEnd, 1);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.LastAction, MM_LOAD_FROM_FILE);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.MemType, MM_EEPROM);
+    UtAssert_ADDRESS_EQ(MM_AppData.HkPacket.Payload.Address, &Buffer[0]);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.BytesProcessed, 2 * MM_MAX_LOAD_DATA_SEG);
+    UtAssert_STRINGBUF_EQ(MM_AppData.HkPacket.Payload.FileName, sizeof(MM_AppData.HkPacket.Payload.FileName), FileName,
+                          sizeof(FileName));
 
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_STAT_ERR_EID);
-    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
 
-    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+void MM_LoadMemFromEncodedFile_Test_Pending(void)
+{
+    bool                    Result;
+    MM_LoadDumpFileHeader_t FileHeader;
 
-    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.MemType    = MM_RAM;
+    FileHeader.NumOfBytes = 16;
+    FileHeader.Encoding   = MM_ENCODING_SPARSE;
 
-    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
-    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
-                  call_count_CFE_EVS_SendEvent);
+    /* Trailing fill is output without reading more of the file */
+    UT_SetDefaultReturnValue(UT_KEY(MM_FileDecodePending), true);
 
-    /* No command-handling function should be updating the cmd or err counter itself */
-    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
-    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+    /* Execute the function being tested */
+    Result = MM_LoadMemFromEncodedFile(MM_UT_OBJID_1, "filename", &FileHeader, (cpuaddr)&Buffer[0]);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(Result);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(MM_FileDecode, 1);
+    UtAssert_STUB_COUNT(MM_SegmentEnd, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
 }
 
-void MM_VerifyLoadFileSize_Test_SizeError(void)
+void MM_LoadMemFromEncodedFile_Test_ReadError(void)
 {
     bool                    Result;
     MM_LoadDumpFileHeader_t FileHeader;
-    int32                   strCmpResult;
-    char                    ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
-    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "Load file size error: Reported by OS = %%d Expected = %%u File = '%%s'");
-
-    FileHeader.NumOfBytes = 99;
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.MemType    = MM_RAM;
+    FileHeader.NumOfBytes = 16;
+    FileHeader.Encoding   = MM_ENCODING_RLE;
 
-    /* Generates error message MM_LD_FILE_SIZE_ERR_EID */
-    UT_SetHookFunction(UT_KEY(OS_stat), UT_MM_LOAD_TEST_CFE_OS_StatHook1, 0);
+    /* The file ended after its data was checked */
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
 
     /* Execute the function being tested */
-    Result = MM_VerifyLoadFileSize((char *)"filename", &FileHeader);
+    Result = MM_LoadMemFromEncodedFile(MM_UT_OBJID_1, "filename", &FileHeader, (cpuaddr)&Buffer[0]);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(MM_FileDecode, 0);
+    UtAssert_STUB_COUNT(MM_SegmentEnd, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_READ_ERR_EID);
+}
+
+/* Patch file records, held twice in the test file as it is read once to verify and once to load */
+typedef struct
+{
+    MM_PatchRecord_t Record0;
+    uint8            Data0[4];
+    MM_PatchRecord_t Record1;
+    uint8            Data1[4];
+} UT_MM_PatchRecords_t;
+
+typedef struct
+{
+    MM_LoadDumpFileHeader_t MMHeader;
+    MM_PatchFileHeader_t    PatchHeader;
+    UT_MM_PatchRecords_t    Verify;
+    UT_MM_PatchRecords_t    Load;
+} UT_MM_PatchFile_t;
+
+void UT_MM_LOAD_TEST_InitPatchFile(UT_MM_PatchFile_t *PatchFile)
+{
+    memset(PatchFile, 0, sizeof(*PatchFile));
+    PatchFile->MMHeader.MemType         = MM_RAM;
+    PatchFile->MMHeader.NumOfBytes      = 64;
+    PatchFile->MMHeader.Encoding        = MM_ENCODING_PATCH;
+    PatchFile->PatchHeader.NumOfRecords = 2;
+
+    PatchFile->Verify.Record0.Offset = 4;
+    PatchFile->Verify.Record0.Length = sizeof(PatchFile->Verify.Data0);
+    memset(PatchFile->Verify.Data0, 0xAA, sizeof(PatchFile->Verify.Data0));
+    PatchFile->Verify.Record1.Offset = 60;
+    PatchFile->Verify.Record1.Length = sizeof(PatchFile->Verify.Data1);
+    memset(PatchFile->Verify.Data1, 0xBB, sizeof(PatchFile->Verify.Data1));
+
+    PatchFile->Load = PatchFile->Verify;
+}
+
+void MM_LoadMemFromPatchFileCmd_Test_Nominal(void)
+{
+    bool              Result;
+    UT_MM_PatchFile_t PatchFile;
+
+    UT_MM_LOAD_TEST_InitPatchFile(&PatchFile);
+    memset(Buffer, 0, 64);
+
+    strncpy(UT_CmdBuf.LoadMemFromFileCmd.Payload.FileName, "name",
+            sizeof(UT_CmdBuf.LoadMemFromFileCmd.Payload.FileName) - 1);
+
+    /* MM header, patch header, two records and the end of file, then the records again */
+    UT_SetDataBuffer(UT_KEY(OS_read), &PatchFile, sizeof(PatchFile), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 7, 0);
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ReadHeader), 1, sizeof(CFE_FS_Header_t));
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t) +
+                                                   sizeof(MM_PatchFileHeader_t));
+    UT_SetHookFunction(UT_KEY(MM_ResolveSymAddr), UT_MM_LOAD_TEST_CFE_SymbolLookupHook3, 0);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+
+    /* Execute the function being tested */
+    Result = MM_LoadMemFromPatchFileCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results, only the patched bytes change */
+    UtAssert_BOOL_TRUE(Result);
+    UtAssert_STUB_COUNT(OS_read, 11);
+    UtAssert_UINT32_EQ(Buffer[3], 0);
+    UtAssert_UINT32_EQ(Buffer[4], 0xAA);
+    UtAssert_UINT32_EQ(Buffer[7], 0xAA);
+    UtAssert_UINT32_EQ(Buffer[8], 0);
+    UtAssert_UINT32_EQ(Buffer[59], 0);
+    UtAssert_UINT32_EQ(Buffer[60], 0xBB);
+    UtAssert_UINT32_EQ(Buffer[63], 0xBB);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.LastAction, MM_LOAD_FROM_FILE);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.BytesProcessed, 8);
+    UtAssert_STUB_COUNT(OS_close, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_LD_PATCH_FILE_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void MM_LoadMemFromPatchFileCmd_Test_PreImageError(void)
+{
+    bool              Result;
+    UT_MM_PatchFile_t PatchFile;
+
+    UT_MM_LOAD_TEST_InitPatchFile(&PatchFile);
+    PatchFile.PatchHeader.PreImageCrc = 0x1234;
+    memset(Buffer, 0, 64);
+
+    UT_SetDataBuffer(UT_KEY(OS_read), &PatchFile, sizeof(PatchFile), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 7, 0);
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ReadHeader), 1, sizeof(CFE_FS_Header_t));
+    UT_SetHookFunction(UT_KEY(MM_ResolveSymAddr), UT_MM_LOAD_TEST_CFE_SymbolLookupHook3, 0);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+
+    /* Execute the function being tested */
+    Result = MM_LoadMemFromPatchFileCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results, a patch made for other memory contents writes nothing */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(OS_lseek, 0);
+    UtAssert_UINT32_EQ(Buffer[4], 0);
+    UtAssert_UINT32_EQ(Buffer[60], 0);
+    UtAssert_STUB_COUNT(OS_close, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_PATCH_PREIMAGE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_LoadMemFromPatchFileCmd_Test_EncodingError(void)
+{
+    bool              Result;
+    UT_MM_PatchFile_t PatchFile;
+
+    UT_MM_LOAD_TEST_InitPatchFile(&PatchFile);
+    PatchFile.MMHeader.Encoding = MM_ENCODING_RAW;
+
+    UT_SetDataBuffer(UT_KEY(OS_read), &PatchFile, sizeof(PatchFile), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ReadHeader), 1, sizeof(CFE_FS_Header_t));
+
+    /* Execute the function being tested */
+    Result = MM_LoadMemFromPatchFileCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results, a load file image is not a patch */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(MM_ResolveSymAddr, 0);
+    UtAssert_STUB_COUNT(OS_close, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_FILE_ENCODING_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_LoadMemFromPatchFileCmd_Test_SymNameError(void)
+{
+    bool              Result;
+    UT_MM_PatchFile_t PatchFile;
+
+    UT_MM_LOAD_TEST_InitPatchFile(&PatchFile);
+
+    UT_SetDataBuffer(UT_KEY(OS_read), &PatchFile, sizeof(PatchFile), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ReadHeader), 1, sizeof(CFE_FS_Header_t));
+    UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), false);
+
+    /* Execute the function being tested */
+    Result = MM_LoadMemFromPatchFileCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(MM_VerifyLoadDumpParams, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_SYMNAME_ERR_EID);
+}
+
+void MM_LoadMemFromPatchFileCmd_Test_ParamsError(void)
+{
+    bool              Result;
+    UT_MM_PatchFile_t PatchFile;
+
+    UT_MM_LOAD_TEST_InitPatchFile(&PatchFile);
+
+    UT_SetDataBuffer(UT_KEY(OS_read), &PatchFile, sizeof(PatchFile), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ReadHeader), 1, sizeof(CFE_FS_Header_t));
+    UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), false);
+
+    /* Execute the function being tested */
+    Result = MM_LoadMemFromPatchFileCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results, only the MM header is read */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(OS_read, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_FILE_LOAD_PARAMS_ERR_EID);
+}
+
+void MM_LoadMemFromPatchFileCmd_Test_OpenError(void)
+{
+    bool Result;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
+
+    /* Execute the function being tested */
+    Result = MM_LoadMemFromPatchFileCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(OS_close, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_OPEN_ERR_EID);
+}
+
+void MM_VerifyPatchFile_Test_OutOfOrder(void)
+{
+    bool                 Result;
+    UT_MM_PatchFile_t    PatchFile;
+    MM_PatchFileHeader_t PatchHeader;
+
+    UT_MM_LOAD_TEST_InitPatchFile(&PatchFile);
+    PatchFile.Verify.Record1.Offset = 6;
+
+    UT_SetDataBuffer(UT_KEY(OS_read), &PatchFile.PatchHeader,
+                     sizeof(PatchFile.PatchHeader) + sizeof(PatchFile.Verify), false);
+
+    /* Execute the function being tested */
+    Result = MM_VerifyPatchFile(MM_UT_OBJID_1, "filename", &PatchFile.MMHeader, (cpuaddr)Buffer, &PatchHeader);
+
+    /* Verify results, the second record overlaps the first */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(OS_read, 4);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_PATCH_FILE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_VerifyPatchFile_Test_RecordCountError(void)
+{
+    bool                 Result;
+    UT_MM_PatchFile_t    PatchFile;
+    MM_PatchFileHeader_t PatchHeader;
+
+    UT_MM_LOAD_TEST_InitPatchFile(&PatchFile);
+    PatchFile.PatchHeader.NumOfRecords = 3;
+
+    UT_SetDataBuffer(UT_KEY(OS_read), &PatchFile.PatchHeader,
+                     sizeof(PatchFile.PatchHeader) + sizeof(PatchFile.Verify), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 6, 0);
+
+    /* Execute the function being tested */
+    Result = MM_VerifyPatchFile(MM_UT_OBJID_1, "filename", &PatchFile.MMHeader, (cpuaddr)Buffer, &PatchHeader);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_UINT32_EQ(PatchHeader.NumOfRecords, 3);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_PATCH_FILE_ERR_EID);
+}
+
+void MM_VerifyPatchFile_Test_CrcError(void)
+{
+    bool                 Result;
+    UT_MM_PatchFile_t    PatchFile;
+    MM_PatchFileHeader_t PatchHeader;
+
+    UT_MM_LOAD_TEST_InitPatchFile(&PatchFile);
+    PatchFile.MMHeader.Crc = 0x1234;
+
+    UT_SetDataBuffer(UT_KEY(OS_read), &PatchFile.PatchHeader,
+                     sizeof(PatchFile.PatchHeader) + sizeof(PatchFile.Verify), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 6, 0);
+
+    /* Execute the function being tested */
+    Result = MM_VerifyPatchFile(MM_UT_OBJID_1, "filename", &PatchFile.MMHeader, (cpuaddr)Buffer, &PatchHeader);
+
+    /* Verify results, the file CRC is checked before the pre-image */
+    UtAssert_BOOL_FALSE(Result);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_LOAD_FILE_CRC_ERR_EID);
+}
+
+void MM_VerifyPatchFile_Test_CutShort(void)
+{
+    bool                 Result;
+    UT_MM_PatchFile_t    PatchFile;
+    MM_PatchFileHeader_t PatchHeader;
+
+    UT_MM_LOAD_TEST_InitPatchFile(&PatchFile);
+
+    UT_SetDataBuffer(UT_KEY(OS_read), &PatchFile.PatchHeader,
+                     sizeof(PatchFile.PatchHeader) + sizeof(PatchFile.Verify), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 3, 2);
+
+    /* Execute the function being tested */
+    Result = MM_VerifyPatchFile(MM_UT_OBJID_1, "filename", &PatchFile.MMHeader, (cpuaddr)Buffer, &PatchHeader);
+
+    /* Verify results, the first record's data ends early */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(OS_read, 3);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_PATCH_FILE_ERR_EID);
+}
+
+void MM_VerifyPatchFile_Test_PreImageSegments(void)
+{
+    bool                 Result;
+    UT_MM_PatchFile_t    PatchFile;
+    MM_PatchFileHeader_t PatchHeader;
+
+    UT_MM_LOAD_TEST_InitPatchFile(&PatchFile);
+
+    UT_SetDataBuffer(UT_KEY(OS_read), &PatchFile.PatchHeader,
+                     sizeof(PatchFile.PatchHeader) + sizeof(PatchFile.Verify), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 6, 0);
+    UT_SetDefaultReturnValue(UT_KEY(MM_SegmentStart), 2);
+
+    /* Execute the function being tested */
+    Result = MM_VerifyPatchFile(MM_UT_OBJID_1, "filename", &PatchFile.MMHeader, (cpuaddr)Buffer, &PatchHeader);
+
+    /* Verify results, the two 4 byte pre-images take 4 CRC segments with a break between each */
+    UtAssert_BOOL_TRUE(Result);
+    UtAssert_STUB_COUNT(MM_SegmentStart, 1);
+    UtAssert_STUB_COUNT(MM_SegmentBreak, 3);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_VerifyPatchFile_Test_HeaderReadError(void)
+{
+    bool                 Result;
+    UT_MM_PatchFile_t    PatchFile;
+    MM_PatchFileHeader_t PatchHeader;
+
+    UT_MM_LOAD_TEST_InitPatchFile(&PatchFile);
+
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, OS_ERROR);
+
+    /* Execute the function being tested */
+    Result = MM_VerifyPatchFile(MM_UT_OBJID_1, "filename", &PatchFile.MMHeader, (cpuaddr)Buffer, &PatchHeader);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(OS_read, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_READ_ERR_EID);
+}
+
+void MM_VerifyPatchRecord_Test_Range(void)
+{
+    MM_PatchRecord_t Record;
+
+    /* In range, up to the end of the patched range */
+    Record.Offset = 8;
+    Record.Length = 8;
+    UtAssert_BOOL_TRUE(MM_VerifyPatchRecord("filename", &Record, 0, 8, 16));
+
+    /* Overlaps the record before it */
+    UtAssert_BOOL_FALSE(MM_VerifyPatchRecord("filename", &Record, 1, 9, 16));
+
+    /* Ends past the patched range */
+    Record.Length = 9;
+    UtAssert_BOOL_FALSE(MM_VerifyPatchRecord("filename", &Record, 1, 0, 16));
+
+    /* Starts past the patched range, the length must not wrap */
+    Record.Offset = 17;
+    Record.Length = 0xFFFFFFFF;
+    UtAssert_BOOL_FALSE(MM_VerifyPatchRecord("filename", &Record, 1, 0, 16));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_PATCH_FILE_ERR_EID);
+}
+
+void MM_LoadMemFromPatchFile_Test_SegmentBreak(void)
+{
+    bool              Result;
+    UT_MM_PatchFile_t PatchFile;
+
+    UT_MM_LOAD_TEST_InitPatchFile(&PatchFile);
+    PatchFile.MMHeader.MemType = MM_EEPROM;
+    memset(Buffer, 0, 64);
+
+    UT_SetDataBuffer(UT_KEY(OS_read), &PatchFile.Load, sizeof(PatchFile.Load), false);
+    UT_SetDefaultReturnValue(UT_KEY(MM_SegmentStart), 3);
+    UT_SetDefaultReturnValue(UT_KEY(MM_SegmentBreak), 3);
+
+    /* Execute the function being tested */
+    Result = MM_LoadMemFromPatchFile(MM_UT_OBJID_1, "filename", &PatchFile.MMHeader, (cpuaddr)Buffer,
+                                     &PatchFile.PatchHeader);
+
+    /* Verify results, segments span records and no segment break follows the last one */
+    UtAssert_BOOL_TRUE(Result);
+    UtAssert_STUB_COUNT(OS_read, 6);
+    UtAssert_STUB_COUNT(MM_SegmentBreak, 2);
+    UtAssert_STUB_COUNT(MM_SegmentEnd, 1);
+    UtAssert_UINT32_EQ(Buffer[4], 0xAA);
+    UtAssert_UINT32_EQ(Buffer[7], 0xAA);
+    UtAssert_UINT32_EQ(Buffer[60], 0xBB);
+    UtAssert_UINT32_EQ(Buffer[63], 0xBB);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.MemType, MM_EEPROM);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.BytesProcessed, 8);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_LoadMemFromPatchFile_Test_ReadError(void)
+{
+    bool              Result;
+    UT_MM_PatchFile_t PatchFile;
+
+    UT_MM_LOAD_TEST_InitPatchFile(&PatchFile);
+
+    UT_SetDataBuffer(UT_KEY(OS_read), &PatchFile.Load, sizeof(PatchFile.Load), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 3, OS_ERROR);
+
+    /* Execute the function being tested */
+    Result = MM_LoadMemFromPatchFile(MM_UT_OBJID_1, "filename", &PatchFile.MMHeader, (cpuaddr)Buffer,
+                                     &PatchFile.PatchHeader);
+
+    /* Verify results, the file changed after it was verified */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(OS_read, 3);
+    UtAssert_STUB_COUNT(MM_SegmentEnd, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_READ_ERR_EID);
+}
+
+/* Multi-region file, the region data is held twice as it is read once to verify and once to load */
+typedef struct
+{
+    MM_LoadDumpFileHeader_t MMHeader;
+    MM_MultiFileHeader_t    MultiHeader;
+    MM_LoadDumpFileHeader_t Regions[2];
+    uint8                   VerifyData0[4];
+    uint8                   VerifyData1[8];
+    uint8                   LoadData0[4];
+    uint8                   LoadData1[8];
+} UT_MM_MultiFile_t;
+
+void UT_MM_LOAD_TEST_InitMultiFile(UT_MM_MultiFile_t *MultiFile)
+{
+    memset(MultiFile, 0, sizeof(*MultiFile));
+    MultiFile->MMHeader.NumOfBytes      = 12;
+    MultiFile->MMHeader.Encoding        = MM_ENCODING_MULTI;
+    MultiFile->MultiHeader.NumOfRegions = 2;
+
+    MultiFile->Regions[0].MemType           = MM_RAM;
+    MultiFile->Regions[0].NumOfBytes        = sizeof(MultiFile->VerifyData0);
+    MultiFile->Regions[1].SymAddress.Offset = 16;
+    MultiFile->Regions[1].MemType           = MM_RAM;
+    MultiFile->Regions[1].NumOfBytes        = sizeof(MultiFile->VerifyData1);
+
+    memset(MultiFile->VerifyData0, 0xAA, sizeof(MultiFile->VerifyData0));
+    memset(MultiFile->VerifyData1, 0xBB, sizeof(MultiFile->VerifyData1));
+    memcpy(MultiFile->LoadData0, MultiFile->VerifyData0, sizeof(MultiFile->LoadData0));
+    memcpy(MultiFile->LoadData1, MultiFile->VerifyData1, sizeof(MultiFile->LoadData1));
+}
+
+/* Resolves each region to the test buffer plus the region symbol offset */
+int32 UT_MM_LOAD_TEST_RegionAddrHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                     const UT_StubContext_t *Context)
+{
+    MM_SymAddr_t *SymAddr         = UT_Hook_GetArgValueByName(Context, "SymAddr", MM_SymAddr_t *);
+    cpuaddr *     ResolvedAddress = UT_Hook_GetArgValueByName(Context, "ResolvedAddr", cpuaddr *);
+
+    *ResolvedAddress = (cpuaddr)&Buffer[SymAddr->Offset];
+
+    return true;
+}
+
+void MM_LoadMemFromMultiFileCmd_Test_Nominal(void)
+{
+    bool              Result;
+    UT_MM_MultiFile_t MultiFile;
+
+    UT_MM_LOAD_TEST_InitMultiFile(&MultiFile);
+    memset(Buffer, 0, 32);
+
+    strncpy(UT_CmdBuf.LoadMemFromFileCmd.Payload.FileName, "name",
+            sizeof(UT_CmdBuf.LoadMemFromFileCmd.Payload.FileName) - 1);
+
+    UT_SetDataBuffer(UT_KEY(OS_read), &MultiFile, sizeof(MultiFile), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ReadHeader), 1, sizeof(CFE_FS_Header_t));
+    UT_SetDefaultReturnValue(UT_KEY(OS_lseek), sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t) +
+                                                   sizeof(MM_MultiFileHeader_t) + sizeof(MultiFile.Regions));
+    UT_SetHookFunction(UT_KEY(MM_ResolveSymAddr), UT_MM_LOAD_TEST_RegionAddrHook, 0);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+
+    /* Execute the function being tested */
+    Result = MM_LoadMemFromMultiFileCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results, both regions are loaded from one file */
+    UtAssert_BOOL_TRUE(Result);
+    UtAssert_STUB_COUNT(OS_OpenCreate, 1);
+    UtAssert_STUB_COUNT(OS_read, 7);
+    UtAssert_STUB_COUNT(MM_VerifyLoadDumpParams, 2);
+    UtAssert_UINT32_EQ(Buffer[0], 0xAA);
+    UtAssert_UINT32_EQ(Buffer[3], 0xAA);
+    UtAssert_UINT32_EQ(Buffer[4], 0);
+    UtAssert_UINT32_EQ(Buffer[15], 0);
+    UtAssert_UINT32_EQ(Buffer[16], 0xBB);
+    UtAssert_UINT32_EQ(Buffer[23], 0xBB);
+    UtAssert_UINT32_EQ(Buffer[24], 0);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.LastAction, MM_LOAD_FROM_FILE);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.Address, (cpuaddr)Buffer);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.BytesProcessed, 12);
+    UtAssert_STUB_COUNT(OS_close, 1);
+
+    /* Both regions are accounted as one load */
+    UtAssert_STUB_COUNT(MM_SegmentMultiStart, 1);
+    UtAssert_STUB_COUNT(MM_SegmentMultiEnd, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_LD_MULTI_FILE_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void MM_LoadMemFromMultiFileCmd_Test_RegionCrcError(void)
+{
+    bool              Result;
+    UT_MM_MultiFile_t MultiFile;
+
+    UT_MM_LOAD_TEST_InitMultiFile(&MultiFile);
+    MultiFile.Regions[1].Crc = 0x1234;
+    memset(Buffer, 0, 32);
+
+    UT_SetDataBuffer(UT_KEY(OS_read), &MultiFile, sizeof(MultiFile), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ReadHeader), 1, sizeof(CFE_FS_Header_t));
+    UT_SetHookFunction(UT_KEY(MM_ResolveSymAddr), UT_MM_LOAD_TEST_RegionAddrHook, 0);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+
+    /* Execute the function being tested */
+    Result = MM_LoadMemFromMultiFileCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results, a bad last region keeps the first one from being loaded */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(OS_lseek, 0);
+    UtAssert_UINT32_EQ(Buffer[0], 0);
+    UtAssert_UINT32_EQ(Buffer[16], 0);
+    UtAssert_STUB_COUNT(OS_close, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_LOAD_FILE_CRC_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_LoadMemFromMultiFileCmd_Test_EncodingError(void)
+{
+    bool              Result;
+    UT_MM_MultiFile_t MultiFile;
+
+    UT_MM_LOAD_TEST_InitMultiFile(&MultiFile);
+    MultiFile.MMHeader.Encoding = MM_ENCODING_RAW;
+
+    UT_SetDataBuffer(UT_KEY(OS_read), &MultiFile, sizeof(MultiFile), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ReadHeader), 1, sizeof(CFE_FS_Header_t));
+
+    /* Execute the function being tested */
+    Result = MM_LoadMemFromMultiFileCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results, a plain load file is not a multi-region file */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_FILE_ENCODING_ERR_EID);
+}
+
+void MM_LoadMemFromMultiFileCmd_Test_OpenError(void)
+{
+    bool Result;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
+
+    /* Execute the function being tested */
+    Result = MM_LoadMemFromMultiFileCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(Result);
+    UtAssert_STUB_COUNT(OS_close, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_OPEN_ERR_EID);
+}
+
+void MM_VerifyMultiFile_Test_RegionCountError(void)
+{
+    UT_MM_MultiFile_t    MultiFile;
+    MM_MultiFileHeader_t MultiHeader;
+
+    UT_MM_LOAD_TEST_InitMultiFile(&MultiFile);
+
+    /* An empty table */
+    MultiFile.MultiHeader.NumOfRegions = 0;
+    UT_SetDataBuffer(UT_KEY(OS_read), &MultiFile.MultiHeader, sizeof(MultiFile.MultiHeader), false);
+    UtAssert_BOOL_FALSE(MM_VerifyMultiFile(MM_UT_OBJID_1, "filename", &MultiFile.MMHeader, &MultiHeader));
+
+    /* A table larger than the region table storage */
+    UT_ResetState(UT_KEY(OS_read));
+    MultiFile.MultiHeader.NumOfRegions = MM_MAX_FILE_REGIONS + 1;
+    UT_SetDataBuffer(UT_KEY(OS_read), &MultiFile.MultiHeader, sizeof(MultiFile.MultiHeader), false);
+    UtAssert_BOOL_FALSE(MM_VerifyMultiFile(MM_UT_OBJID_1, "filename", &MultiFile.MMHeader, &MultiHeader));
+
+    /* Verify results, the table itself is never read */
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(MM_ResolveSymAddr, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_MULTI_FILE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, MM_MULTI_FILE_ERR_EID);
+}
+
+void MM_VerifyMultiFile_Test_TableCrcError(void)
+{
+    UT_MM_MultiFile_t    MultiFile;
+    MM_MultiFileHeader_t MultiHeader;
+
+    UT_MM_LOAD_TEST_InitMultiFile(&MultiFile);
+    MultiFile.MMHeader.Crc = 0x1234;
+
+    UT_SetDataBuffer(UT_KEY(OS_read), &MultiFile.MultiHeader,
+                     sizeof(MultiFile) - sizeof(MultiFile.MMHeader), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_VerifyMultiFile(MM_UT_OBJID_1, "filename", &MultiFile.MMHeader, &MultiHeader));
+
+    /* Verify results, a corrupt table is not used to resolve anything */
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(MM_ResolveSymAddr, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_LOAD_FILE_CRC_ERR_EID);
+}
+
+void MM_VerifyMultiFile_Test_SizeError(void)
+{
+    UT_MM_MultiFile_t    MultiFile;
+    MM_MultiFileHeader_t MultiHeader;
+
+    UT_MM_LOAD_TEST_InitMultiFile(&MultiFile);
+    MultiFile.MMHeader.NumOfBytes = 13;
+
+    UT_SetDataBuffer(UT_KEY(OS_read), &MultiFile.MultiHeader,
+                     sizeof(MultiFile) - sizeof(MultiFile.MMHeader), false);
+    UT_SetHookFunction(UT_KEY(MM_ResolveSymAddr), UT_MM_LOAD_TEST_RegionAddrHook, 0);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_VerifyMultiFile(MM_UT_OBJID_1, "filename", &MultiFile.MMHeader, &MultiHeader));
+
+    /* Verify results, the regions are resolved but their data isn't read */
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_UINT32_EQ(MM_AppData.FileRegionAddress[1], (cpuaddr)&Buffer[16]);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_MULTI_FILE_ERR_EID);
+}
+
+void MM_VerifyMultiFile_Test_ReadError(void)
+{
+    UT_MM_MultiFile_t    MultiFile;
+    MM_MultiFileHeader_t MultiHeader;
+
+    UT_MM_LOAD_TEST_InitMultiFile(&MultiFile);
+
+    UT_SetDataBuffer(UT_KEY(OS_read), &MultiFile.MultiHeader,
+                     sizeof(MultiFile) - sizeof(MultiFile.MMHeader), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 4, 3);
+    UT_SetHookFunction(UT_KEY(MM_ResolveSymAddr), UT_MM_LOAD_TEST_RegionAddrHook, 0);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_VerifyMultiFile(MM_UT_OBJID_1, "filename", &MultiFile.MMHeader, &MultiHeader));
+
+    /* Verify results, the second region data is cut short */
+    UtAssert_STUB_COUNT(OS_read, 4);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_READ_ERR_EID);
+}
+
+void MM_VerifyMultiFile_Test_TableReadError(void)
+{
+    UT_MM_MultiFile_t    MultiFile;
+    MM_MultiFileHeader_t MultiHeader;
+
+    UT_MM_LOAD_TEST_InitMultiFile(&MultiFile);
+
+    UT_SetDataBuffer(UT_KEY(OS_read), &MultiFile.MultiHeader,
+                     sizeof(MultiFile) - sizeof(MultiFile.MMHeader), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_VerifyMultiFile(MM_UT_OBJID_1, "filename", &MultiFile.MMHeader, &MultiHeader));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(MM_ResolveSymAddr, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_READ_ERR_EID);
+}
+
+void MM_VerifyFileRegion_Test_Nominal(void)
+{
+    MM_LoadDumpFileHeader_t Region;
+    cpuaddr                 DestAddress = 0;
+
+    memset(&Region, 0, sizeof(Region));
+    Region.SymAddress.Offset = 8;
+    Region.MemType           = MM_EEPROM;
+    Region.NumOfBytes        = 4;
+
+    UT_SetHookFunction(UT_KEY(MM_ResolveSymAddr), UT_MM_LOAD_TEST_RegionAddrHook, 0);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_VerifyFileRegion("filename", &Region, 0, &DestAddress));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(DestAddress, (cpuaddr)&Buffer[8]);
+    UtAssert_STUB_COUNT(MM_VerifyLoadDumpParams, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_VerifyFileRegion_Test_Errors(void)
+{
+    MM_LoadDumpFileHeader_t Region;
+    cpuaddr                 DestAddress = 0;
+
+    memset(&Region, 0, sizeof(Region));
+    Region.MemType    = MM_RAM;
+    Region.NumOfBytes = 4;
+
+    /* Regions are raw, encoded regions would need the whole file decoded twice */
+    Region.Encoding = MM_ENCODING_RLE;
+    UtAssert_BOOL_FALSE(MM_VerifyFileRegion("filename", &Region, 0, &DestAddress));
+
+    Region.Encoding = MM_ENCODING_RAW;
+    UT_SetDeferredRetcode(UT_KEY(MM_ResolveSymAddr), 1, false);
+    UtAssert_BOOL_FALSE(MM_VerifyFileRegion("filename", &Region, 1, &DestAddress));
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), false);
+    UtAssert_BOOL_FALSE(MM_VerifyFileRegion("filename", &Region, 2, &DestAddress));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MM_ResolveSymAddr, 2);
+    UtAssert_STUB_COUNT(MM_VerifyLoadDumpParams, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_MULTI_FILE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, MM_SYMNAME_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, MM_FILE_LOAD_PARAMS_ERR_EID);
+}
+
+void MM_LoadMemFromMultiFile_Test_RegionError(void)
+{
+    UT_MM_MultiFile_t MultiFile;
+
+    UT_MM_LOAD_TEST_InitMultiFile(&MultiFile);
+    memset(Buffer, 0, 32);
+
+    memcpy(MM_AppData.FileRegions, MultiFile.Regions, sizeof(MultiFile.Regions));
+    MM_AppData.FileRegionAddress[0] = (cpuaddr)&Buffer[0];
+    MM_AppData.FileRegionAddress[1] = (cpuaddr)&Buffer[16];
+
+    UT_SetDataBuffer(UT_KEY(OS_read), MultiFile.LoadData0, sizeof(MultiFile.LoadData0) + sizeof(MultiFile.LoadData1),
+                     false);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_LoadMemFromMultiFile(MM_UT_OBJID_1, "filename", &MultiFile.MultiHeader));
+
+    /* Verify results, the regions before the failure stay loaded */
+    UtAssert_UINT32_EQ(Buffer[0], 0xAA);
+    UtAssert_UINT32_EQ(Buffer[16], 0);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.BytesProcessed, 4);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_READ_ERR_EID);
+}
+
+void MM_LoadFileRegion_Test_MemTypes(void)
+{
+    MM_LoadDumpFileHeader_t Region;
+
+    memset(&Region, 0, sizeof(Region));
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_LoadMem32FromFile), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_LoadMem16FromFile), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_LoadMem8FromFile), true);
+
+    /* Execute the function being tested */
+    Region.MemType = MM_MEM32;
+    UtAssert_BOOL_TRUE(MM_LoadFileRegion(MM_UT_OBJID_1, "filename", &Region, (cpuaddr)Buffer));
+    Region.MemType = MM_MEM16;
+    UtAssert_BOOL_TRUE(MM_LoadFileRegion(MM_UT_OBJID_1, "filename", &Region, (cpuaddr)Buffer));
+    Region.MemType = MM_MEM8;
+    UtAssert_BOOL_TRUE(MM_LoadFileRegion(MM_UT_OBJID_1, "filename", &Region, (cpuaddr)Buffer));
+    Region.MemType = MM_NOMEMTYPE;
+    UtAssert_BOOL_FALSE(MM_LoadFileRegion(MM_UT_OBJID_1, "filename", &Region, (cpuaddr)Buffer));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MM_LoadMem32FromFile, 1);
+    UtAssert_STUB_COUNT(MM_LoadMem16FromFile, 1);
+    UtAssert_STUB_COUNT(MM_LoadMem8FromFile, 1);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_GetLoadStagingBuf_Test_Nominal(void)
+{
+    uint8 *                 Result;
+    MM_LoadDumpFileHeader_t FileHeader;
+    CFE_ES_MemPoolBuf_t     PoolBuf = Buffer;
+
+    FileHeader.MemType    = MM_EEPROM;
+    FileHeader.NumOfBytes = MM_MAX_STAGED_LOAD;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetPoolBuf), MM_MAX_STAGED_LOAD);
+    UT_SetDataBuffer(UT_KEY(CFE_ES_GetPoolBuf), &PoolBuf, sizeof(PoolBuf), false);
+
+    /* Execute the function being tested */
+    Result = MM_GetLoadStagingBuf(&FileHeader);
+
+    /* Verify results */
+    UtAssert_ADDRESS_EQ(Result, Buffer);
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_GetLoadStagingBuf_Test_NotStaged(void)
+{
+    MM_LoadDumpFileHeader_t FileHeader;
+
+    memset(&FileHeader, 0, sizeof(FileHeader));
+
+    /* Larger than the configured limit */
+    FileHeader.MemType    = MM_RAM;
+    FileHeader.NumOfBytes = MM_MAX_STAGED_LOAD + 1;
+    UtAssert_NULL(MM_GetLoadStagingBuf(&FileHeader));
+
+    /* Staging disabled by the table */
+    FileHeader.NumOfBytes           = 4;
+    MM_AppData.Config.MaxStagedLoad = 0;
+    UtAssert_NULL(MM_GetLoadStagingBuf(&FileHeader));
+
+    /* Optional memory types are always loaded from the file */
+    MM_AppData.Config.MaxStagedLoad = MM_MAX_STAGED_LOAD;
+    FileHeader.MemType              = MM_MEM8;
+    UtAssert_NULL(MM_GetLoadStagingBuf(&FileHeader));
+
+    /* Encoded files are decoded as they are read */
+    FileHeader.MemType  = MM_RAM;
+    FileHeader.Encoding = MM_ENCODING_RLE;
+    UtAssert_NULL(MM_GetLoadStagingBuf(&FileHeader));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 0);
+}
+
+void MM_GetLoadStagingBuf_Test_PoolError(void)
+{
+    MM_LoadDumpFileHeader_t FileHeader;
+
+    FileHeader.MemType    = MM_RAM;
+    FileHeader.NumOfBytes = 4;
+
+    /* Pool exhausted, the load falls back to reading the file twice */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetPoolBuf), CFE_ES_ERR_MEM_BLOCK_SIZE);
+
+    /* Execute the function being tested */
+    UtAssert_NULL(MM_GetLoadStagingBuf(&FileHeader));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_StageLoadFile_Test_Nominal(void)
+{
+    MM_LoadDumpFileHeader_t FileHeader;
+    uint32                  Crc = 0;
+
+    FileHeader.NumOfBytes = MM_IO_BUFFER_SIZE;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_read), MM_IO_BUFFER_SIZE);
+    UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), 0x1234);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MM_StageLoadFile(MM_UT_OBJID_1, &FileHeader, Buffer, &Crc), OS_SUCCESS);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Crc, 0x1234);
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(MM_CalculateCRC, 1);
+}
+
+void MM_StageLoadFile_Test_ReadError(void)
+{
+    MM_LoadDumpFileHeader_t FileHeader;
+    uint32                  Crc = 0;
+
+    FileHeader.NumOfBytes = MM_IO_BUFFER_SIZE;
+
+    /* Read error is passed back */
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, OS_INVALID_POINTER);
+    UtAssert_INT32_EQ(MM_StageLoadFile(MM_UT_OBJID_1, &FileHeader, Buffer, &Crc), OS_INVALID_POINTER);
+
+    /* Short read */
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, MM_IO_BUFFER_SIZE - 1);
+    UtAssert_INT32_EQ(MM_StageLoadFile(MM_UT_OBJID_1, &FileHeader, Buffer, &Crc), OS_ERROR);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MM_CalculateCRC, 0);
+}
+
+void MM_LoadMemFromStaging_Test_Nominal(void)
+{
+    bool                    Result;
+    MM_LoadDumpFileHeader_t FileHeader;
+    char                    FileName[] = "filename";
+    uint8                   StagingData[2 * MM_MAX_LOAD_DATA_SEG + 1];
+    uint32                  i;
+
+    for (i = 0; i < sizeof(StagingData); i++)
+    {
+        StagingData[i] = (uint8)i;
+    }
+    memset(Buffer, 0, sizeof(Buffer));
+
+    FileHeader.MemType    = MM_EEPROM;
+    FileHeader.NumOfBytes = sizeof(StagingData);
+
+    /* Execute the function being tested */
+    Result = MM_LoadMemFromStaging(StagingData, FileName, &FileHeader, (cpuaddr)&Buffer[0]);
+
+    /* Verify results */
+    UtAssert_True(Result == true, "Result == true");
+    UtAssert_MemCmp(Buffer, StagingData, sizeof(StagingData), "Staged data loaded");
+    UtAssert_True(MM_AppData.HkPacket.Payload.LastAction == MM_LOAD_FROM_FILE,
+                  "MM_AppData.HkPacket.Payload.LastAction == MM_LOAD_FROM_FILE");
+    UtAssert_True(MM_AppData.HkPacket.Payload.MemType == MM_EEPROM, "MM_AppData.HkPacket.Payload.MemType == MM_EEPROM");
+    UtAssert_True(MM_AppData.HkPacket.Payload.Address == (cpuaddr)(&Buffer[0]), "MM_AppData.HkPacket.Payload.Address == 0");
+    UtAssert_True(MM_AppData.HkPacket.Payload.BytesProcessed == sizeof(StagingData),
+                  "MM_AppData.HkPacket.Payload.BytesProcessed == sizeof(StagingData)");
+    UtAssert_STRINGBUF_EQ(MM_AppData.HkPacket.Payload.FileName, sizeof(MM_AppData.HkPacket.Payload.FileName), FileName,
+                          sizeof(FileName));
+
+    /* The copy still yields between segments */
+    UtAssert_STUB_COUNT(MM_SegmentBreak, 2);
+    UtAssert_STUB_COUNT(MM_SegmentEnd, 1);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    /* No command-handling function should be updating the cmd or err counter itself */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+}
+
+void MM_ReadFileHeaders_Test_ReadHeaderError(void)
+{
+    bool                    Result;
+    osal_id_t               FileHandle = MM_UT_OBJID_1;
+    CFE_FS_Header_t         CFEHeader;
+    MM_LoadDumpFileHeader_t MMHeader;
+    int32                   strCmpResult;
+    char                    ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "CFE_FS_ReadHeader error received: RC = 0x%%08X Expected = %%u File = '%%s'");
+
+    /* Set to satisfy condition "OS_Status != sizeof(CFE_FS_Header_t)" */
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ReadHeader), 1, 0);
+
+    /* Execute the function being tested */
+    Result = MM_ReadFileHeaders((char *)"filename", FileHandle, &CFEHeader, &MMHeader);
+
+    /* Verify results */
+    UtAssert_True(Result == false, "Result == false");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CFE_FS_READHDR_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+    /* No command-handling function should be updating the cmd or err counter itself */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+}
+
+void MM_ReadFileHeaders_Test_ReadError(void)
+{
+    bool                    Result;
+    osal_id_t               FileHandle = MM_UT_OBJID_1;
+    CFE_FS_Header_t         CFEHeader;
+    MM_LoadDumpFileHeader_t MMHeader;
+    int32                   strCmpResult;
+    char                    ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "OS_read error received: RC = 0x%%08X Expected = %%u File = '%%s'");
+
+    /* Set to generate error message MM_OS_READ_ERR_EID */
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
+
+    /* Execute the function being tested */
+    Result = MM_ReadFileHeaders((char *)"filename", FileHandle, &CFEHeader, &MMHeader);
+
+    /* Verify results */
+    UtAssert_True(Result == false, "Result == false");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_READ_EXP_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+    /* No command-handling function should be updating the cmd or err counter itself */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+}
+
+void MM_VerifyLoadFileSize_Test_StatError(void)
+{
+    bool                    Result;
+    MM_LoadDumpFileHeader_t FileHeader;
+    int32                   strCmpResult;
+    char                    ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "OS_stat error received: RC = 0x%%08X File = '%%s'");
+
+    /* Set to generate error message MM_OS_MEMVALIDATE_ERR_EID */
+    UT_SetDeferredRetcode(UT_KEY(OS_stat), 1, -1);
+
+    /* Execute the function being tested */
+    Result = MM_VerifyLoadFileSize((char *)"filename", &FileHeader);
+
+    /* Verify results */
+    UtAssert_True(Result == false, "Result == false");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_STAT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+
+    /* No command-handling function should be updating the cmd or err counter itself */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+}
+
+void MM_VerifyLoadFileSize_Test_SizeError(void)
+{
+    bool                    Result;
+    MM_LoadDumpFileHeader_t FileHeader;
+    int32                   strCmpResult;
+    char                    ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Load file size error: Reported by OS = %%d Expected = %%u File = '%%s'");
+
+    FileHeader.NumOfBytes = 99;
+
+    /* Generates error message MM_LD_FILE_SIZE_ERR_EID */
+    UT_SetHookFunction(UT_KEY(OS_stat), UT_MM_LOAD_TEST_CFE_OS_StatHook1, 0);
+
+    /* Execute the function being tested */
+    Result = MM_VerifyLoadFileSize((char *)"filename", &FileHeader);
 
     /* Verify results */
     UtAssert_True(Result == false, "Result == false");
@@ -2280,6 +3572,58 @@ void MM_VerifyLoadFileSize_Test_SizeError(void)
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 }
 
+void MM_VerifyLoadFileSize_Test_RLE(void)
+{
+    MM_LoadDumpFileHeader_t FileHeader;
+
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.Encoding = MM_ENCODING_RLE;
+
+    /* The stat hook reports a file of headers only, too small for any encoded data */
+    UT_SetHookFunction(UT_KEY(OS_stat), UT_MM_LOAD_TEST_CFE_OS_StatHook1, 0);
+    FileHeader.NumOfBytes = 99;
+    UtAssert_BOOL_FALSE(MM_VerifyLoadFileSize("filename", &FileHeader));
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_LD_FILE_SIZE_ERR_EID);
+
+    /* Encoded data smaller than the load bytes is accepted */
+    UT_ResetState(UT_KEY(OS_stat));
+    UT_SetHookFunction(UT_KEY(OS_stat), UT_MM_LOAD_TEST_CFE_OS_StatHook2, 0);
+    UtAssert_BOOL_TRUE(MM_VerifyLoadFileSize("filename", &FileHeader));
+
+    /* Encoded data larger than the encoding can produce is not */
+    FileHeader.NumOfBytes = 4;
+    UtAssert_BOOL_FALSE(MM_VerifyLoadFileSize("filename", &FileHeader));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+}
+
+void MM_VerifyLoadFileSize_Test_Sparse(void)
+{
+    MM_LoadDumpFileHeader_t FileHeader;
+
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.Encoding   = MM_ENCODING_SPARSE;
+    FileHeader.NumOfBytes = 64;
+
+    /* A file of headers only is an image of all fill bytes */
+    UT_SetHookFunction(UT_KEY(OS_stat), UT_MM_LOAD_TEST_CFE_OS_StatHook1, 0);
+    UtAssert_BOOL_TRUE(MM_VerifyLoadFileSize("filename", &FileHeader));
+
+    /* Extents smaller than the load bytes are accepted */
+    UT_ResetState(UT_KEY(OS_stat));
+    UT_SetHookFunction(UT_KEY(OS_stat), UT_MM_LOAD_TEST_CFE_OS_StatHook2, 0);
+    UtAssert_BOOL_TRUE(MM_VerifyLoadFileSize("filename", &FileHeader));
+
+    /* Extents larger than the encoding can produce are not */
+    FileHeader.NumOfBytes = 1;
+    UtAssert_BOOL_FALSE(MM_VerifyLoadFileSize("filename", &FileHeader));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_LD_FILE_SIZE_ERR_EID);
+}
+
 void MM_FillMemCmd_Test_RAM(void)
 {
     int32 strCmpResult;
@@ -2533,6 +3877,9 @@ void MM_FillMemCmd_Test_SymNameError(void)
     UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
                   call_count_CFE_EVS_SendEvent);
 
+    /* Failed commands still close the command performance log marker */
+    UtAssert_STUB_COUNT(CFE_ES_PerfLogAdd, 2);
+
     /* No command-handling function should be updating the cmd or err counter itself */
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
@@ -2654,6 +4001,29 @@ void MM_FillMem_Test_Nominal(void)
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 }
 
+void MM_FillMem_Test_Pattern(void)
+{
+    MM_FillMemCmd_t CmdPacket;
+    bool            Result;
+    uint32          Expected[2] = {0x12345678, 0x12345678};
+
+    memset(&CmdPacket, 0, sizeof(CmdPacket));
+    memset(Buffer, 0, sizeof(Buffer));
+
+    CmdPacket.Payload.MemType     = MM_RAM;
+    CmdPacket.Payload.NumOfBytes  = sizeof(Expected);
+    CmdPacket.Payload.FillPattern = 0x12345678;
+
+    /* Execute the function being tested */
+    Result = MM_FillMem((cpuaddr)Buffer, &CmdPacket);
+
+    /* Verify results, every byte of the 32 bit pattern is used */
+    UtAssert_True(Result == true, "Result == true");
+    UtAssert_MemCmp(Buffer, Expected, sizeof(Expected), "Memory filled with the fill pattern");
+    UtAssert_True(MM_AppData.HkPacket.Payload.BytesProcessed == sizeof(Expected),
+                  "MM_AppData.HkPacket.Payload.BytesProcessed == sizeof(Expected)");
+}
+
 void MM_FillMem_Test_MaxFillDataSegment(void)
 {
     MM_FillMemCmd_t CmdPacket;
@@ -2688,6 +4058,543 @@ void MM_FillMem_Test_MaxFillDataSegment(void)
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 }
 
+void MM_FillMem_Test_AdaptiveSegments(void)
+{
+    MM_FillMemCmd_t CmdPacket;
+    bool            Result;
+
+    memset(&CmdPacket, 0, sizeof(CmdPacket));
+
+    CmdPacket.Payload.MemType    = MM_RAM;
+    CmdPacket.Payload.NumOfBytes = 40;
+
+    /* First segment of 8 bytes, then the size adapts to 16 bytes */
+    UT_SetDefaultReturnValue(UT_KEY(MM_SegmentStart), 8);
+    UT_SetDefaultReturnValue(UT_KEY(MM_SegmentBreak), 16);
+
+    memset(Buffer, 1, (MM_MAX_FILL_DATA_SEG * 2));
+
+    /* Execute the function being tested */
+    Result = MM_FillMem((cpuaddr)Buffer, &CmdPacket);
+
+    /* Verify results, segments of 8, 16 and 16 bytes */
+    UtAssert_True(Result == true, "Result == true");
+    UtAssert_STUB_COUNT(MM_SegmentBreak, 2);
+    UtAssert_True(MM_AppData.HkPacket.Payload.BytesProcessed == 40, "MM_AppData.HkPacket.Payload.BytesProcessed == 40");
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+/* Reads a memory block straight from the address */
+int32 UT_MM_LOAD_TEST_ReadMemBlockHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                       const UT_StubContext_t *Context)
+{
+    cpuaddr SrcAddress = UT_Hook_GetArgValueByName(Context, "SrcAddress", cpuaddr);
+    void *  Buffer     = UT_Hook_GetArgValueByName(Context, "Buffer", void *);
+    size_t  NumOfBytes = UT_Hook_GetArgValueByName(Context, "NumOfBytes", size_t);
+
+    memcpy(Buffer, (void *)SrcAddress, NumOfBytes);
+
+    return StubRetcode;
+}
+
+/* Writes a memory block straight to the address */
+int32 UT_MM_LOAD_TEST_WriteMemBlockHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                        const UT_StubContext_t *Context)
+{
+    cpuaddr     DestAddress = UT_Hook_GetArgValueByName(Context, "DestAddress", cpuaddr);
+    const void *Buffer      = UT_Hook_GetArgValueByName(Context, "Buffer", const void *);
+    size_t      NumOfBytes  = UT_Hook_GetArgValueByName(Context, "NumOfBytes", size_t);
+
+    memcpy((void *)DestAddress, Buffer, NumOfBytes);
+
+    return StubRetcode;
+}
+
+void UT_MM_LOAD_TEST_InitCopy(uint32 NumOfBytes)
+{
+    uint32 i;
+
+    for (i = 0; i < sizeof(Buffer); i++)
+    {
+        Buffer[i] = (uint8)i;
+    }
+
+    UT_CmdBuf.CopyMemCmd.Payload.SrcMemType  = MM_RAM;
+    UT_CmdBuf.CopyMemCmd.Payload.DestMemType = MM_RAM;
+    UT_CmdBuf.CopyMemCmd.Payload.NumOfBytes  = NumOfBytes;
+
+    UT_SetHookFunction(UT_KEY(MM_ReadMemBlock), UT_MM_LOAD_TEST_ReadMemBlockHook, 0);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadMemBlock), true);
+    UT_SetHookFunction(UT_KEY(MM_WriteMemBlock), UT_MM_LOAD_TEST_WriteMemBlockHook, 0);
+    UT_SetDefaultReturnValue(UT_KEY(MM_WriteMemBlock), true);
+}
+
+void MM_CopyMemCmd_Test_Nominal(void)
+{
+    bool  Result;
+    uint8 Expected[40];
+
+    UT_MM_LOAD_TEST_InitCopy(sizeof(Expected));
+    memcpy(Expected, Buffer, sizeof(Expected));
+
+    UT_CmdBuf.CopyMemCmd.Payload.SrcSymAddress.Offset  = 0;
+    UT_CmdBuf.CopyMemCmd.Payload.DestSymAddress.Offset = 64;
+    UT_CmdBuf.CopyMemCmd.Payload.DestMemType           = MM_EEPROM;
+
+    UT_SetHookFunction(UT_KEY(MM_ResolveSymAddr), UT_MM_LOAD_TEST_RegionAddrHook, 0);
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), 0x1234);
+
+    /* Execute the function being tested */
+    Result = MM_CopyMemCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(Result);
+    UtAssert_MemCmp(&Buffer[64], Expected, sizeof(Expected), "Destination holds the source data");
+    UtAssert_STUB_COUNT(MM_VerifyLoadDumpParams, 2);
+    UtAssert_STUB_COUNT(MM_ComputeMemCRC, 0);
+
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.LastAction, MM_COPY);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.MemType, MM_EEPROM);
+    UtAssert_True(MM_AppData.HkPacket.Payload.Address == (cpuaddr)&Buffer[64],
+                  "MM_AppData.HkPacket.Payload.Address == (cpuaddr)&Buffer[64]");
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.DataValue, 0x1234);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.BytesProcessed, sizeof(Expected));
+    UtAssert_STUB_COUNT(MM_SegmentEnd, 1);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_COPY_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    /* No command-handling function should be updating the cmd or err counter itself */
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.CmdCounter, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
+}
+
+void MM_CopyMemCmd_Test_SymNameError(void)
+{
+    UT_MM_LOAD_TEST_InitCopy(4);
+
+    /* Source, then destination symbol fails */
+    UT_SetDeferredRetcode(UT_KEY(MM_ResolveSymAddr), 1, false);
+    UtAssert_BOOL_FALSE(MM_CopyMemCmd(&UT_CmdBuf.Buf));
+
+    UT_SetDeferredRetcode(UT_KEY(MM_ResolveSymAddr), 2, false);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), true);
+    UtAssert_BOOL_FALSE(MM_CopyMemCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MM_ResolveSymAddr, 3);
+    UtAssert_STUB_COUNT(MM_VerifyLoadDumpParams, 0);
+    UtAssert_STUB_COUNT(MM_ReadMemBlock, 0);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_SYMNAME_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, MM_SYMNAME_ERR_EID);
+}
+
+void MM_CopyMemCmd_Test_VerifyError(void)
+{
+    UT_MM_LOAD_TEST_InitCopy(4);
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_ResolveSymAddr), true);
+
+    /* The source passes the dump checks, the destination fails the load checks */
+    UT_SetDeferredRetcode(UT_KEY(MM_VerifyLoadDumpParams), 1, true);
+    UT_SetDeferredRetcode(UT_KEY(MM_VerifyLoadDumpParams), 1, false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_CopyMemCmd(&UT_CmdBuf.Buf));
+
+    /* Verify results, the check sends its own event */
+    UtAssert_STUB_COUNT(MM_VerifyLoadDumpParams, 2);
+    UtAssert_STUB_COUNT(MM_ReadMemBlock, 0);
+    UtAssert_STUB_COUNT(MM_SegmentStart, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_CopyMem_Test_OverlapForward(void)
+{
+    uint8  Expected[40];
+    uint32 Crc = 0;
+
+    UT_MM_LOAD_TEST_InitCopy(sizeof(Expected));
+    memcpy(Expected, &Buffer[12], sizeof(Expected));
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_SegmentStart), 8);
+    UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), 0x5678);
+
+    /* Execute the function being tested, the destination is below the source */
+    UtAssert_BOOL_TRUE(MM_CopyMem((cpuaddr)&Buffer[12], (cpuaddr)&Buffer[4], &UT_CmdBuf.CopyMemCmd, &Crc));
+
+    /* Verify results, the CRC is taken as each of the 5 segments goes by */
+    UtAssert_MemCmp(&Buffer[4], Expected, sizeof(Expected), "Destination holds the source data");
+    UtAssert_STUB_COUNT(MM_SegmentBreak, 4);
+    UtAssert_STUB_COUNT(MM_CalculateCRC, 5);
+    UtAssert_STUB_COUNT(MM_ComputeMemCRC, 0);
+    UtAssert_UINT32_EQ(Crc, 0x5678);
+}
+
+void MM_CopyMem_Test_OverlapBackward(void)
+{
+    uint8  Expected[40];
+    uint32 Crc = 0;
+
+    UT_MM_LOAD_TEST_InitCopy(sizeof(Expected));
+    memcpy(Expected, &Buffer[4], sizeof(Expected));
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_SegmentStart), 8);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ComputeMemCRC), true);
+
+    /* Execute the function being tested, the destination starts inside the source */
+    UtAssert_BOOL_TRUE(MM_CopyMem((cpuaddr)&Buffer[4], (cpuaddr)&Buffer[12], &UT_CmdBuf.CopyMemCmd, &Crc));
+
+    /* Verify results, the CRC comes from the destination after the copy */
+    UtAssert_MemCmp(&Buffer[12], Expected, sizeof(Expected), "Destination holds the source data");
+    UtAssert_STUB_COUNT(MM_ReadMemBlock, 5);
+    UtAssert_STUB_COUNT(MM_SegmentBreak, 5);
+    UtAssert_STUB_COUNT(MM_CalculateCRC, 0);
+    UtAssert_STUB_COUNT(MM_ComputeMemCRC, 1);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.BytesProcessed, sizeof(Expected));
+}
+
+void MM_CopyMem_Test_WriteError(void)
+{
+    uint32 Crc = 0xFFFFFFFF;
+
+    UT_MM_LOAD_TEST_InitCopy(40);
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_SegmentStart), 8);
+    UT_SetDeferredRetcode(UT_KEY(MM_WriteMemBlock), 2, false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_CopyMem((cpuaddr)&Buffer[0], (cpuaddr)&Buffer[64], &UT_CmdBuf.CopyMemCmd, &Crc));
+
+    /* Verify results, the copy stops at the failed segment */
+    UtAssert_STUB_COUNT(MM_ReadMemBlock, 2);
+    UtAssert_STUB_COUNT(MM_WriteMemBlock, 2);
+    UtAssert_STUB_COUNT(MM_SegmentEnd, 0);
+    UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.LastAction, MM_NOACTION);
+    UtAssert_UINT32_EQ(Crc, 0xFFFFFFFF);
+}
+
+void MM_LoadMemFromFileCmd_Test_CacheHit(void)
+{
+    bool                    Result;
+    MM_LoadDumpFileHeader_t FileHeader;
+
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.MemType    = MM_RAM;
+    FileHeader.NumOfBytes = 20;
+    FileHeader.Crc        = 0x1234;
+
+    strncpy(UT_CmdBuf.LoadMemFromFileCmd.Payload.FileName, "name", sizeof(UT_CmdBuf.LoadMemFromFileCmd.Payload.FileName) - 1);
+
+    /* The same file was verified before and hasn't changed since */
+    MM_AppData.LoadCache.Entries[0].InUse    = true;
+    MM_AppData.LoadCache.Entries[0].FileSize = sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t) + 20;
+    MM_AppData.LoadCache.Entries[0].Header   = FileHeader;
+    strncpy(MM_AppData.LoadCache.Entries[0].FileName, "name", OS_MAX_PATH_LEN - 1);
+
+    UT_SetDataBuffer(UT_KEY(OS_read), &FileHeader, sizeof(FileHeader), false);
+    UT_SetHookFunction(UT_KEY(OS_stat), UT_MM_LOAD_TEST_CFE_OS_StatHook2, 0);
+
+    UT_SetHookFunction(UT_KEY(MM_ResolveSymAddr), UT_MM_LOAD_TEST_CFE_SymbolLookupHook3, 0);
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ReadHeader), 1, sizeof(CFE_FS_Header_t));
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+
+    /* Execute the function being tested */
+    Result = MM_LoadMemFromFileCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results, the load goes ahead without a CRC pass over the file */
+    UtAssert_True(Result == true, "Result == true");
+    UtAssert_STUB_COUNT(MM_ComputeCRCFromFile, 0);
+    UtAssert_STUB_COUNT(CFE_ES_GetPoolBuf, 0);
+    UtAssert_STUB_COUNT(OS_read, 2);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_LOAD_CACHE_HIT_DBG_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_DEBUG);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, MM_LD_MEM_FILE_INF_EID);
+}
+
+void MM_LoadMemFromFileCmd_Test_CacheUpdate(void)
+{
+    bool                    Result;
+    MM_LoadDumpFileHeader_t FileHeader;
+
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.MemType    = MM_RAM;
+    FileHeader.NumOfBytes = 20;
+
+    strncpy(UT_CmdBuf.LoadMemFromFileCmd.Payload.FileName, "name", sizeof(UT_CmdBuf.LoadMemFromFileCmd.Payload.FileName) - 1);
+
+    UT_SetDataBuffer(UT_KEY(OS_read), &FileHeader, sizeof(FileHeader), false);
+    UT_SetHookFunction(UT_KEY(OS_stat), UT_MM_LOAD_TEST_CFE_OS_StatHook2, 0);
+
+    UT_SetHookFunction(UT_KEY(MM_ResolveSymAddr), UT_MM_LOAD_TEST_CFE_SymbolLookupHook3, 0);
+
+    /* Causes call to MM_ComputeCRCFromFile to return 0 for ComputedCRC */
+    UT_SetHookFunction(UT_KEY(MM_ComputeCRCFromFile), UT_MM_LOAD_TEST_MM_ComputeCrcHook1, 0);
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_FS_ReadHeader), 1, sizeof(CFE_FS_Header_t));
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyLoadDumpParams), true);
+
+    /* Execute the function being tested */
+    Result = MM_LoadMemFromFileCmd(&UT_CmdBuf.Buf);
+
+    /* Verify results, the verified file is remembered for the next load */
+    UtAssert_True(Result == true, "Result == true");
+    UtAssert_STUB_COUNT(MM_ComputeCRCFromFile, 1);
+    UtAssert_BOOL_TRUE(MM_AppData.LoadCache.Entries[0].InUse);
+    UtAssert_STRINGBUF_EQ(MM_AppData.LoadCache.Entries[0].FileName, OS_MAX_PATH_LEN, "name", 5);
+    UtAssert_UINT32_EQ(MM_AppData.LoadCache.Entries[0].FileSize,
+                       sizeof(CFE_FS_Header_t) + sizeof(MM_LoadDumpFileHeader_t) + 20);
+    UtAssert_UINT32_EQ(MM_AppData.LoadCache.Entries[0].Header.NumOfBytes, 20);
+    UtAssert_UINT32_EQ(MM_AppData.LoadCache.NextEntry, 1);
+}
+
+void MM_LoadCacheInit_Test_New(void)
+{
+    MM_AppData.LoadCache.Entries[0].InUse = true;
+
+    /* Execute the function being tested */
+    MM_LoadCacheInit();
+
+    /* Verify results, a new CDS block starts with an empty cache */
+    UtAssert_STUB_COUNT(CFE_ES_RegisterCDS, 1);
+    UtAssert_STUB_COUNT(CFE_ES_RestoreFromCDS, 0);
+    UtAssert_BOOL_FALSE(MM_AppData.LoadCache.Entries[0].InUse);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_LoadCacheInit_Test_Restore(void)
+{
+    MM_LoadCache_t SavedCache;
+
+    /* A cache saved before the reset, with damaged bookkeeping */
+    memset(&SavedCache, 'a', sizeof(SavedCache));
+    SavedCache.Entries[0].InUse = true;
+    SavedCache.NextEntry        = MM_LOAD_CACHE_ENTRIES;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RegisterCDS), CFE_ES_CDS_ALREADY_EXISTS);
+    UT_SetDataBuffer(UT_KEY(CFE_ES_RestoreFromCDS), &SavedCache, sizeof(SavedCache), false);
+
+    /* Execute the function being tested */
+    MM_LoadCacheInit();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_ES_RestoreFromCDS, 1);
+    UtAssert_BOOL_TRUE(MM_AppData.LoadCache.Entries[0].InUse);
+    UtAssert_UINT32_EQ(MM_AppData.LoadCache.NextEntry, 0);
+    UtAssert_UINT32_EQ(strlen(MM_AppData.LoadCache.Entries[0].FileName), OS_MAX_PATH_LEN - 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_LoadCacheInit_Test_RestoreError(void)
+{
+    MM_LoadCache_t SavedCache;
+
+    memset(&SavedCache, 0, sizeof(SavedCache));
+    SavedCache.Entries[0].InUse = true;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RegisterCDS), CFE_ES_CDS_ALREADY_EXISTS);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RestoreFromCDS), -1);
+    UT_SetDataBuffer(UT_KEY(CFE_ES_RestoreFromCDS), &SavedCache, sizeof(SavedCache), false);
+
+    /* Execute the function being tested */
+    MM_LoadCacheInit();
+
+    /* Verify results, an unreadable cache is discarded */
+    UtAssert_STUB_COUNT(CFE_ES_RestoreFromCDS, 1);
+    UtAssert_BOOL_FALSE(MM_AppData.LoadCache.Entries[0].InUse);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_LoadCacheInit_Test_RegisterError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_RegisterCDS), -1);
+
+    /* Execute the function being tested */
+    MM_LoadCacheInit();
+
+    /* Verify results, the cache still works but won't survive a reset */
+    UtAssert_STUB_COUNT(CFE_ES_RestoreFromCDS, 0);
+    UtAssert_BOOL_FALSE(CFE_RESOURCEID_TEST_DEFINED(MM_AppData.LoadCacheCDSHandle));
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_LOAD_CACHE_CDS_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_LoadCacheLookup_Test_Hit(void)
+{
+    MM_LoadDumpFileHeader_t FileHeader;
+    MM_LoadCacheEntry_t     CacheKey;
+    os_fstat_t              FileStats = {.FileSize = 100};
+
+    memset(&FileHeader, 0, sizeof(FileHeader));
+    FileHeader.Crc = 0x1234;
+
+    MM_AppData.LoadCache.Entries[1].InUse    = true;
+    MM_AppData.LoadCache.Entries[1].FileSize = 100;
+    MM_AppData.LoadCache.Entries[1].Header   = FileHeader;
+    strncpy(MM_AppData.LoadCache.Entries[1].FileName, "name", OS_MAX_PATH_LEN - 1);
+
+    UT_SetDataBuffer(UT_KEY(OS_stat), &FileStats, sizeof(FileStats), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_LoadCacheLookup("name", &FileHeader, &CacheKey));
+
+    /* Verify results */
+    UtAssert_BOOL_TRUE(CacheKey.InUse);
+    UtAssert_UINT32_EQ(CacheKey.FileSize, 100);
+    UtAssert_UINT32_EQ(CacheKey.Header.Crc, 0x1234);
+    UtAssert_BOOL_TRUE(MM_AppData.LoadCache.Entries[1].InUse);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+}
+
+void MM_LoadCacheLookup_Test_Miss(void)
+{
+    MM_LoadDumpFileHeader_t FileHeader;
+    MM_LoadCacheEntry_t     CacheKey;
+    os_fstat_t              FileStats = {.FileSize = 100};
+
+    memset(&FileHeader, 0, sizeof(FileHeader));
+
+    MM_AppData.LoadCache.Entries[0].InUse    = true;
+    MM_AppData.LoadCache.Entries[0].FileSize = 100;
+    strncpy(MM_AppData.LoadCache.Entries[0].FileName, "other", OS_MAX_PATH_LEN - 1);
+
+    UT_SetDataBuffer(UT_KEY(OS_stat), &FileStats, sizeof(FileStats), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_LoadCacheLookup("name", &FileHeader, &CacheKey));
+
+    /* Verify results, the key is ready for the update and other files are untouched */
+    UtAssert_BOOL_TRUE(CacheKey.InUse);
+    UtAssert_STRINGBUF_EQ(CacheKey.FileName, OS_MAX_PATH_LEN, "name", 5);
+    UtAssert_BOOL_TRUE(MM_AppData.LoadCache.Entries[0].InUse);
+}
+
+void MM_LoadCacheLookup_Test_Changed(void)
+{
+    MM_LoadDumpFileHeader_t FileHeader;
+    MM_LoadCacheEntry_t     CacheKey;
+    os_fstat_t              FileStats = {.FileSize = 100};
+
+    memset(&FileHeader, 0, sizeof(FileHeader));
+
+    MM_AppData.LoadCacheCDSHandle = MM_UT_CDSHANDLE_1;
+
+    /* Same size, but the header written into the file is different */
+    MM_AppData.LoadCache.Entries[0].InUse      = true;
+    MM_AppData.LoadCache.Entries[0].FileSize   = 100;
+    MM_AppData.LoadCache.Entries[0].Header.Crc = 0x1234;
+    strncpy(MM_AppData.LoadCache.Entries[0].FileName, "name", OS_MAX_PATH_LEN - 1);
+
+    UT_SetDataBuffer(UT_KEY(OS_stat), &FileStats, sizeof(FileStats), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_LoadCacheLookup("name", &FileHeader, &CacheKey));
+
+    /* Verify results, the stale entry is dropped */
+    UtAssert_BOOL_FALSE(MM_AppData.LoadCache.Entries[0].InUse);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 1);
+}
+
+void MM_LoadCacheLookup_Test_StatError(void)
+{
+    MM_LoadDumpFileHeader_t FileHeader;
+    MM_LoadCacheEntry_t     CacheKey;
+
+    memset(&FileHeader, 0, sizeof(FileHeader));
+
+    MM_AppData.LoadCache.Entries[0].InUse = true;
+    strncpy(MM_AppData.LoadCache.Entries[0].FileName, "name", OS_MAX_PATH_LEN - 1);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_stat), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_LoadCacheLookup("name", &FileHeader, &CacheKey));
+
+    /* Verify results, there is no key to update the cache with */
+    UtAssert_BOOL_FALSE(CacheKey.InUse);
+    UtAssert_BOOL_TRUE(MM_AppData.LoadCache.Entries[0].InUse);
+}
+
+void MM_LoadCacheUpdate_Test_RoundRobin(void)
+{
+    MM_LoadCacheEntry_t CacheKey;
+    uint32              i;
+
+    memset(&CacheKey, 0, sizeof(CacheKey));
+    CacheKey.InUse = true;
+
+    MM_AppData.LoadCacheCDSHandle = MM_UT_CDSHANDLE_1;
+
+    /* One more file than the cache holds, the oldest entry is replaced */
+    for (i = 0; i <= MM_LOAD_CACHE_ENTRIES; i++)
+    {
+        snprintf(CacheKey.FileName, sizeof(CacheKey.FileName), "file%u", (unsigned int)i);
+        CacheKey.FileSize = i;
+
+        /* Execute the function being tested */
+        MM_LoadCacheUpdate(&CacheKey);
+    }
+
+    /* Verify results */
+    UtAssert_STRINGBUF_EQ(MM_AppData.LoadCache.Entries[0].FileName, OS_MAX_PATH_LEN, CacheKey.FileName,
+                          OS_MAX_PATH_LEN);
+    UtAssert_UINT32_EQ(MM_AppData.LoadCache.Entries[0].FileSize, MM_LOAD_CACHE_ENTRIES);
+    UtAssert_UINT32_EQ(MM_AppData.LoadCache.NextEntry, 1 % MM_LOAD_CACHE_ENTRIES);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, MM_LOAD_CACHE_ENTRIES + 1);
+}
+
+void MM_LoadCacheUpdate_Test_SameName(void)
+{
+    MM_LoadCacheEntry_t CacheKey;
+
+    memset(&CacheKey, 0, sizeof(CacheKey));
+    CacheKey.InUse    = true;
+    CacheKey.FileSize = 200;
+    strncpy(CacheKey.FileName, "name", sizeof(CacheKey.FileName) - 1);
+
+    MM_AppData.LoadCache.Entries[0].InUse    = true;
+    MM_AppData.LoadCache.Entries[0].FileSize = 100;
+    strncpy(MM_AppData.LoadCache.Entries[0].FileName, "name", OS_MAX_PATH_LEN - 1);
+    MM_AppData.LoadCache.NextEntry = 1;
+
+    /* Execute the function being tested */
+    MM_LoadCacheUpdate(&CacheKey);
+
+    /* Verify results, a file is never cached twice */
+    UtAssert_UINT32_EQ(MM_AppData.LoadCache.Entries[0].FileSize, 200);
+    UtAssert_BOOL_FALSE(MM_AppData.LoadCache.Entries[1].InUse);
+    UtAssert_UINT32_EQ(MM_AppData.LoadCache.NextEntry, 1);
+}
+
+void MM_LoadCacheUpdate_Test_NoKey(void)
+{
+    MM_LoadCacheEntry_t CacheKey;
+
+    memset(&CacheKey, 0, sizeof(CacheKey));
+
+    MM_AppData.LoadCacheCDSHandle = MM_UT_CDSHANDLE_1;
+
+    /* Execute the function being tested */
+    MM_LoadCacheUpdate(&CacheKey);
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(MM_AppData.LoadCache.Entries[0].InUse);
+    UtAssert_UINT32_EQ(MM_AppData.LoadCache.NextEntry, 0);
+    UtAssert_STUB_COUNT(CFE_ES_CopyToCDS, 0);
+}
+
 /*
  * Register the test cases to execute with the unit test tool
  */
@@ -2747,16 +4654,97 @@ void UtTest_Setup(void)
                "MM_LoadMemFromFileCmd_Test_CloseError");
     UtTest_Add(MM_LoadMemFromFileCmd_Test_OpenError, MM_Test_Setup, MM_Test_TearDown,
                "MM_LoadMemFromFileCmd_Test_OpenError");
+    UtTest_Add(MM_LoadMemFromFileCmd_Test_RLE, MM_Test_Setup, MM_Test_TearDown, "MM_LoadMemFromFileCmd_Test_RLE");
+    UtTest_Add(MM_LoadMemFromFileCmd_Test_EncodingError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LoadMemFromFileCmd_Test_EncodingError");
+
+    UtTest_Add(MM_LoadMemFromFileCmd_Test_Staged, MM_Test_Setup, MM_Test_TearDown, "MM_LoadMemFromFileCmd_Test_Staged");
+    UtTest_Add(MM_LoadMemFromFileCmd_Test_StagedReadError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LoadMemFromFileCmd_Test_StagedReadError");
 
     UtTest_Add(MM_LoadMemFromFile_Test_PreventCPUHogging, MM_Test_Setup, MM_Test_TearDown,
                "MM_LoadMemFromFile_Test_PreventCPUHogging");
     UtTest_Add(MM_LoadMemFromFile_Test_ReadError, MM_Test_Setup, MM_Test_TearDown, "MM_LoadMemFromFile_Test_ReadError");
     UtTest_Add(MM_LoadMemFromFile_Test_NotEepromMemType, MM_Test_Setup, MM_Test_TearDown,
                "MM_LoadMemFromFile_Test_NotEepromMemType");
+    UtTest_Add(MM_ComputeDecodedCRCFromFile_Test_Nominal, MM_Test_Setup, MM_Test_TearDown,
+               "MM_ComputeDecodedCRCFromFile_Test_Nominal");
+    UtTest_Add(MM_ComputeDecodedCRCFromFile_Test_Truncated, MM_Test_Setup, MM_Test_TearDown,
+               "MM_ComputeDecodedCRCFromFile_Test_Truncated");
+    UtTest_Add(MM_ComputeDecodedCRCFromFile_Test_NotDone, MM_Test_Setup, MM_Test_TearDown,
+               "MM_ComputeDecodedCRCFromFile_Test_NotDone");
+    UtTest_Add(MM_ComputeDecodedCRCFromFile_Test_ReadError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_ComputeDecodedCRCFromFile_Test_ReadError");
+    UtTest_Add(MM_LoadMemFromEncodedFile_Test_Nominal, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LoadMemFromEncodedFile_Test_Nominal");
+    UtTest_Add(MM_LoadMemFromEncodedFile_Test_Pending, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LoadMemFromEncodedFile_Test_Pending");
+    UtTest_Add(MM_LoadMemFromEncodedFile_Test_ReadError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LoadMemFromEncodedFile_Test_ReadError");
+    UtTest_Add(MM_LoadMemFromPatchFileCmd_Test_Nominal, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LoadMemFromPatchFileCmd_Test_Nominal");
+    UtTest_Add(MM_LoadMemFromPatchFileCmd_Test_PreImageError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LoadMemFromPatchFileCmd_Test_PreImageError");
+    UtTest_Add(MM_LoadMemFromPatchFileCmd_Test_EncodingError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LoadMemFromPatchFileCmd_Test_EncodingError");
+    UtTest_Add(MM_LoadMemFromPatchFileCmd_Test_SymNameError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LoadMemFromPatchFileCmd_Test_SymNameError");
+    UtTest_Add(MM_LoadMemFromPatchFileCmd_Test_ParamsError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LoadMemFromPatchFileCmd_Test_ParamsError");
+    UtTest_Add(MM_LoadMemFromPatchFileCmd_Test_OpenError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LoadMemFromPatchFileCmd_Test_OpenError");
+    UtTest_Add(MM_VerifyPatchFile_Test_OutOfOrder, MM_Test_Setup, MM_Test_TearDown,
+               "MM_VerifyPatchFile_Test_OutOfOrder");
+    UtTest_Add(MM_VerifyPatchFile_Test_RecordCountError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_VerifyPatchFile_Test_RecordCountError");
+    UtTest_Add(MM_VerifyPatchFile_Test_CrcError, MM_Test_Setup, MM_Test_TearDown, "MM_VerifyPatchFile_Test_CrcError");
+    UtTest_Add(MM_VerifyPatchFile_Test_CutShort, MM_Test_Setup, MM_Test_TearDown, "MM_VerifyPatchFile_Test_CutShort");
+    UtTest_Add(MM_VerifyPatchFile_Test_PreImageSegments, MM_Test_Setup, MM_Test_TearDown,
+               "MM_VerifyPatchFile_Test_PreImageSegments");
+    UtTest_Add(MM_VerifyPatchFile_Test_HeaderReadError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_VerifyPatchFile_Test_HeaderReadError");
+    UtTest_Add(MM_VerifyPatchRecord_Test_Range, MM_Test_Setup, MM_Test_TearDown, "MM_VerifyPatchRecord_Test_Range");
+    UtTest_Add(MM_LoadMemFromPatchFile_Test_SegmentBreak, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LoadMemFromPatchFile_Test_SegmentBreak");
+    UtTest_Add(MM_LoadMemFromPatchFile_Test_ReadError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LoadMemFromPatchFile_Test_ReadError");
+    UtTest_Add(MM_LoadMemFromMultiFileCmd_Test_Nominal, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LoadMemFromMultiFileCmd_Test_Nominal");
+    UtTest_Add(MM_LoadMemFromMultiFileCmd_Test_RegionCrcError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LoadMemFromMultiFileCmd_Test_RegionCrcError");
+    UtTest_Add(MM_LoadMemFromMultiFileCmd_Test_EncodingError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LoadMemFromMultiFileCmd_Test_EncodingError");
+    UtTest_Add(MM_LoadMemFromMultiFileCmd_Test_OpenError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LoadMemFromMultiFileCmd_Test_OpenError");
+    UtTest_Add(MM_VerifyMultiFile_Test_RegionCountError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_VerifyMultiFile_Test_RegionCountError");
+    UtTest_Add(MM_VerifyMultiFile_Test_TableCrcError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_VerifyMultiFile_Test_TableCrcError");
+    UtTest_Add(MM_VerifyMultiFile_Test_SizeError, MM_Test_Setup, MM_Test_TearDown, "MM_VerifyMultiFile_Test_SizeError");
+    UtTest_Add(MM_VerifyMultiFile_Test_ReadError, MM_Test_Setup, MM_Test_TearDown, "MM_VerifyMultiFile_Test_ReadError");
+    UtTest_Add(MM_VerifyMultiFile_Test_TableReadError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_VerifyMultiFile_Test_TableReadError");
+    UtTest_Add(MM_VerifyFileRegion_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_VerifyFileRegion_Test_Nominal");
+    UtTest_Add(MM_VerifyFileRegion_Test_Errors, MM_Test_Setup, MM_Test_TearDown, "MM_VerifyFileRegion_Test_Errors");
+    UtTest_Add(MM_LoadMemFromMultiFile_Test_RegionError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LoadMemFromMultiFile_Test_RegionError");
+    UtTest_Add(MM_LoadFileRegion_Test_MemTypes, MM_Test_Setup, MM_Test_TearDown, "MM_LoadFileRegion_Test_MemTypes");
+    UtTest_Add(MM_GetLoadStagingBuf_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_GetLoadStagingBuf_Test_Nominal");
+    UtTest_Add(MM_GetLoadStagingBuf_Test_NotStaged, MM_Test_Setup, MM_Test_TearDown,
+               "MM_GetLoadStagingBuf_Test_NotStaged");
+    UtTest_Add(MM_GetLoadStagingBuf_Test_PoolError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_GetLoadStagingBuf_Test_PoolError");
+    UtTest_Add(MM_StageLoadFile_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_StageLoadFile_Test_Nominal");
+    UtTest_Add(MM_StageLoadFile_Test_ReadError, MM_Test_Setup, MM_Test_TearDown, "MM_StageLoadFile_Test_ReadError");
+    UtTest_Add(MM_LoadMemFromStaging_Test_Nominal, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LoadMemFromStaging_Test_Nominal");
+
     UtTest_Add(MM_VerifyLoadFileSize_Test_StatError, MM_Test_Setup, MM_Test_TearDown,
                "MM_VerifyLoadFileSize_Test_StatError");
     UtTest_Add(MM_VerifyLoadFileSize_Test_SizeError, MM_Test_Setup, MM_Test_TearDown,
                "MM_VerifyLoadFileSize_Test_SizeError");
+    UtTest_Add(MM_VerifyLoadFileSize_Test_RLE, MM_Test_Setup, MM_Test_TearDown, "MM_VerifyLoadFileSize_Test_RLE");
+    UtTest_Add(MM_VerifyLoadFileSize_Test_Sparse, MM_Test_Setup, MM_Test_TearDown, "MM_VerifyLoadFileSize_Test_Sparse");
 
     UtTest_Add(MM_ReadFileHeaders_Test_ReadHeaderError, MM_Test_Setup, MM_Test_TearDown,
                "MM_ReadFileHeaders_Test_ReadHeaderError");
@@ -2774,6 +4762,32 @@ void UtTest_Setup(void)
                "MM_FillMemCmd_Test_NoVerifyLoadDump");
     UtTest_Add(MM_FillMemCmd_Test_BadType, MM_Test_Setup, MM_Test_TearDown, "MM_FillMemCmd_Test_BadType");
     UtTest_Add(MM_FillMem_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_FillMem_Test_Nominal");
+    UtTest_Add(MM_FillMem_Test_Pattern, MM_Test_Setup, MM_Test_TearDown, "MM_FillMem_Test_Pattern");
     UtTest_Add(MM_FillMem_Test_MaxFillDataSegment, MM_Test_Setup, MM_Test_TearDown,
                "MM_FillMem_Test_MaxFillDataSegment");
+    UtTest_Add(MM_FillMem_Test_AdaptiveSegments, MM_Test_Setup, MM_Test_TearDown, "MM_FillMem_Test_AdaptiveSegments");
+    UtTest_Add(MM_CopyMemCmd_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_CopyMemCmd_Test_Nominal");
+    UtTest_Add(MM_CopyMemCmd_Test_SymNameError, MM_Test_Setup, MM_Test_TearDown, "MM_CopyMemCmd_Test_SymNameError");
+    UtTest_Add(MM_CopyMemCmd_Test_VerifyError, MM_Test_Setup, MM_Test_TearDown, "MM_CopyMemCmd_Test_VerifyError");
+    UtTest_Add(MM_CopyMem_Test_OverlapForward, MM_Test_Setup, MM_Test_TearDown, "MM_CopyMem_Test_OverlapForward");
+    UtTest_Add(MM_CopyMem_Test_OverlapBackward, MM_Test_Setup, MM_Test_TearDown, "MM_CopyMem_Test_OverlapBackward");
+    UtTest_Add(MM_CopyMem_Test_WriteError, MM_Test_Setup, MM_Test_TearDown, "MM_CopyMem_Test_WriteError");
+    UtTest_Add(MM_LoadMemFromFileCmd_Test_CacheHit, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LoadMemFromFileCmd_Test_CacheHit");
+    UtTest_Add(MM_LoadMemFromFileCmd_Test_CacheUpdate, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LoadMemFromFileCmd_Test_CacheUpdate");
+    UtTest_Add(MM_LoadCacheInit_Test_New, MM_Test_Setup, MM_Test_TearDown, "MM_LoadCacheInit_Test_New");
+    UtTest_Add(MM_LoadCacheInit_Test_Restore, MM_Test_Setup, MM_Test_TearDown, "MM_LoadCacheInit_Test_Restore");
+    UtTest_Add(MM_LoadCacheInit_Test_RestoreError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LoadCacheInit_Test_RestoreError");
+    UtTest_Add(MM_LoadCacheInit_Test_RegisterError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LoadCacheInit_Test_RegisterError");
+    UtTest_Add(MM_LoadCacheLookup_Test_Hit, MM_Test_Setup, MM_Test_TearDown, "MM_LoadCacheLookup_Test_Hit");
+    UtTest_Add(MM_LoadCacheLookup_Test_Miss, MM_Test_Setup, MM_Test_TearDown, "MM_LoadCacheLookup_Test_Miss");
+    UtTest_Add(MM_LoadCacheLookup_Test_Changed, MM_Test_Setup, MM_Test_TearDown, "MM_LoadCacheLookup_Test_Changed");
+    UtTest_Add(MM_LoadCacheLookup_Test_StatError, MM_Test_Setup, MM_Test_TearDown, "MM_LoadCacheLookup_Test_StatError");
+    UtTest_Add(MM_LoadCacheUpdate_Test_RoundRobin, MM_Test_Setup, MM_Test_TearDown,
+               "MM_LoadCacheUpdate_Test_RoundRobin");
+    UtTest_Add(MM_LoadCacheUpdate_Test_SameName, MM_Test_Setup, MM_Test_TearDown, "MM_LoadCacheUpdate_Test_SameName");
+    UtTest_Add(MM_LoadCacheUpdate_Test_NoKey, MM_Test_Setup, MM_Test_TearDown, "MM_LoadCacheUpdate_Test_NoKey");
 }
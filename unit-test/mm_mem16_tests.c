@@ -32,6 +32,8 @@
 #include "mm_events.h"
 #include "mm_filedefs.h"
 #include "mm_version.h"
+#include "mm_utils.h"
+#include "mm_crc.h"
 #include "mm_test_utils.h"
 
 /************************************************************************
@@ -117,6 +119,10 @@ void MM_LoadMem16FromFile_Test_CPUHogging(void)
     UtAssert_True(strncmp(MM_AppData.HkPacket.Payload.FileName, "filename", OS_MAX_PATH_LEN) == 0,
                   "MM_AppData.HkPacket.Payload.FileName, 'filename', OS_MAX_PATH_LEN) == 0");
 
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(MM_SegmentIoEnd, 1);
+    UtAssert_STUB_COUNT(MM_SegmentEnd, 1);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -223,6 +229,8 @@ void MM_DumpMem16ToFile_Test_Nominal(void)
     /* CFE_PSP_MemRead16 stub returns success with non-zero address */
     FileHeader.SymAddress.Offset = 1;
 
+    UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), 0x1234);
+
     /* Execute the function being tested */
     Result = MM_DumpMem16ToFile(FileHandle, (char *)"filename", &FileHeader);
 
@@ -238,6 +246,8 @@ void MM_DumpMem16ToFile_Test_Nominal(void)
     UtAssert_True(strncmp(MM_AppData.HkPacket.Payload.FileName, "filename", OS_MAX_PATH_LEN) == 0,
                   "MM_AppData.HkPacket.Payload.FileName, 'filename', OS_MAX_PATH_LEN) == 0");
 
+    UtAssert_UINT32_EQ(FileHeader.Crc, 0x1234);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -273,6 +283,10 @@ void MM_DumpMem16ToFile_Test_CPUHogging(void)
     UtAssert_True(strncmp(MM_AppData.HkPacket.Payload.FileName, "filename", OS_MAX_PATH_LEN) == 0,
                   "MM_AppData.HkPacket.Payload.FileName, 'filename', OS_MAX_PATH_LEN) == 0");
 
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(MM_SegmentIoEnd, 1);
+    UtAssert_STUB_COUNT(MM_SegmentEnd, 1);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -500,6 +514,66 @@ void MM_FillMem16_Test_Align(void)
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 }
 
+void MM_ReadMem16_Test_Nominal(void)
+{
+    uint16 Source[4] = {0};
+    uint16 Target[4] = {0};
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_ReadMem16((cpuaddr)Source, Target, sizeof(Source)));
+
+    /* Verify results, one 16 bit read per word */
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead16, 4);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_ReadMem16_Test_ReadError(void)
+{
+    uint16 Source[4] = {0};
+    uint16 Target[4] = {0};
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRead16), 2, -1);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_ReadMem16((cpuaddr)Source, Target, sizeof(Source)));
+
+    /* Verify results, the read stops at the error */
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead16, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_PSP_READ_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_WriteMem16_Test_Nominal(void)
+{
+    uint16 Source[4] = {0};
+    uint16 Target[4] = {0};
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_WriteMem16((cpuaddr)Target, Source, sizeof(Source)));
+
+    /* Verify results, one 16 bit write per word */
+    UtAssert_STUB_COUNT(CFE_PSP_MemWrite16, 4);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_WriteMem16_Test_WriteError(void)
+{
+    uint16 Source[4] = {0};
+    uint16 Target[4] = {0};
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemWrite16), 1, -1);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_WriteMem16((cpuaddr)Target, Source, sizeof(Source)));
+
+    /* Verify results, the write stops at the error */
+    UtAssert_STUB_COUNT(CFE_PSP_MemWrite16, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_PSP_WRITE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
 /*
  * Register the test cases to execute with the unit test tool
  */
@@ -522,4 +596,8 @@ void UtTest_Setup(void)
     UtTest_Add(MM_FillMem16_Test_CPUHogging, MM_Test_Setup, MM_Test_TearDown, "MM_FillMem16_Test_CPUHogging");
     UtTest_Add(MM_FillMem16_Test_WriteError, MM_Test_Setup, MM_Test_TearDown, "MM_FillMem16_Test_WriteError");
     UtTest_Add(MM_FillMem16_Test_Align, MM_Test_Setup, MM_Test_TearDown, "MM_FillMem16_Test_Align");
+    UtTest_Add(MM_ReadMem16_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_ReadMem16_Test_Nominal");
+    UtTest_Add(MM_ReadMem16_Test_ReadError, MM_Test_Setup, MM_Test_TearDown, "MM_ReadMem16_Test_ReadError");
+    UtTest_Add(MM_WriteMem16_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_WriteMem16_Test_Nominal");
+    UtTest_Add(MM_WriteMem16_Test_WriteError, MM_Test_Setup, MM_Test_TearDown, "MM_WriteMem16_Test_WriteError");
 }
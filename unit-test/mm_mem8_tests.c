@@ -32,6 +32,8 @@
 #include "mm_events.h"
 #include "mm_filedefs.h"
 #include "mm_version.h"
+#include "mm_utils.h"
+#include "mm_crc.h"
 #include "mm_test_utils.h"
 
 /************************************************************************
@@ -115,6 +117,10 @@ void MM_LoadMem8FromFile_Test_CPUHogging(void)
     UtAssert_True(strncmp(MM_AppData.HkPacket.Payload.FileName, "filename", OS_MAX_PATH_LEN) == 0,
                   "MM_AppData.HkPacket.Payload.FileName, 'filename', OS_MAX_PATH_LEN) == 0");
 
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(MM_SegmentIoEnd, 1);
+    UtAssert_STUB_COUNT(MM_SegmentEnd, 1);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -223,6 +229,8 @@ void MM_DumpMem8ToFile_Test_Nominal(void)
     /* CFE_PSP_MemRead8 stub returns success with non-zero address */
     FileHeader.SymAddress.Offset = 1;
 
+    UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), 0x1234);
+
     /* Execute the function being tested */
     Result = MM_DumpMem8ToFile(FileHandle, (char *)"filename", &FileHeader);
 
@@ -238,6 +246,8 @@ void MM_DumpMem8ToFile_Test_Nominal(void)
     UtAssert_True(strncmp(MM_AppData.HkPacket.Payload.FileName, "filename", OS_MAX_PATH_LEN) == 0,
                   "MM_AppData.HkPacket.Payload.FileName, 'filename', OS_MAX_PATH_LEN) == 0");
 
+    UtAssert_UINT32_EQ(FileHeader.Crc, 0x1234);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -273,6 +283,10 @@ void MM_DumpMem8ToFile_Test_CPUHogging(void)
     UtAssert_True(strncmp(MM_AppData.HkPacket.Payload.FileName, "filename", OS_MAX_PATH_LEN) == 0,
                   "MM_AppData.HkPacket.Payload.FileName, 'filename', OS_MAX_PATH_LEN) == 0");
 
+    UtAssert_STUB_COUNT(OS_write, 1);
+    UtAssert_STUB_COUNT(MM_SegmentIoEnd, 1);
+    UtAssert_STUB_COUNT(MM_SegmentEnd, 1);
+
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
     UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
@@ -469,6 +483,66 @@ void MM_FillMem8_Test_WriteError(void)
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 }
 
+void MM_ReadMem8_Test_Nominal(void)
+{
+    uint8 Source[8] = {0};
+    uint8 Target[8] = {0};
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_ReadMem8((cpuaddr)Source, Target, sizeof(Source)));
+
+    /* Verify results, one 8 bit read per word */
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead8, 8);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_ReadMem8_Test_ReadError(void)
+{
+    uint8 Source[8] = {0};
+    uint8 Target[8] = {0};
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRead8), 2, -1);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_ReadMem8((cpuaddr)Source, Target, sizeof(Source)));
+
+    /* Verify results, the read stops at the error */
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead8, 2);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_PSP_READ_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_WriteMem8_Test_Nominal(void)
+{
+    uint8 Source[8] = {0};
+    uint8 Target[8] = {0};
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_WriteMem8((cpuaddr)Target, Source, sizeof(Source)));
+
+    /* Verify results, one 8 bit write per word */
+    UtAssert_STUB_COUNT(CFE_PSP_MemWrite8, 8);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_WriteMem8_Test_WriteError(void)
+{
+    uint8 Source[8] = {0};
+    uint8 Target[8] = {0};
+
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemWrite8), 1, -1);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_WriteMem8((cpuaddr)Target, Source, sizeof(Source)));
+
+    /* Verify results, the write stops at the error */
+    UtAssert_STUB_COUNT(CFE_PSP_MemWrite8, 1);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_PSP_WRITE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
 /*
  * Register the test cases to execute with the unit test tool
  */
@@ -488,4 +562,8 @@ void UtTest_Setup(void)
     UtTest_Add(MM_FillMem8_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_FillMem8_Test_Nominal");
     UtTest_Add(MM_FillMem8_Test_CPUHogging, MM_Test_Setup, MM_Test_TearDown, "MM_FillMem8_Test_CPUHogging");
     UtTest_Add(MM_FillMem8_Test_WriteError, MM_Test_Setup, MM_Test_TearDown, "MM_FillMem8_Test_WriteError");
+    UtTest_Add(MM_ReadMem8_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_ReadMem8_Test_Nominal");
+    UtTest_Add(MM_ReadMem8_Test_ReadError, MM_Test_Setup, MM_Test_TearDown, "MM_ReadMem8_Test_ReadError");
+    UtTest_Add(MM_WriteMem8_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_WriteMem8_Test_Nominal");
+    UtTest_Add(MM_WriteMem8_Test_WriteError, MM_Test_Setup, MM_Test_TearDown, "MM_WriteMem8_Test_WriteError");
 }
@@ -0,0 +1,285 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Unit tests for mm_memtype.c
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_memtype.h"
+#include "mm_app.h"
+#include "mm_events.h"
+#include "mm_load.h"
+#include "mm_mem32.h"
+#include "mm_test_utils.h"
+
+/************************************************************************
+** UT Includes
+*************************************************************************/
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include "cfe.h"
+
+/* A mission memory type, such as a bank of FPGA registers */
+#define UT_MM_FPGA_MEMTYPE ((MM_MemType_t)(MM_MEM32 + 1))
+
+MM_MemTypeLimits_t UT_FpgaLimits = {64, 64, 64};
+
+MM_MemTypeDriver_t UT_FpgaDriver;
+
+/*
+ * Function Definitions
+ */
+
+void MM_MemTypeInit_Test(void)
+{
+    /* Execute the function being tested */
+    MM_MemTypeInit();
+
+    /* Verify results */
+    UtAssert_NULL(MM_MemTypeGet(MM_NOMEMTYPE));
+    UtAssert_NOT_NULL(MM_MemTypeGet(MM_RAM));
+    UtAssert_NOT_NULL(MM_MemTypeGet(MM_EEPROM));
+    UtAssert_NOT_NULL(MM_MemTypeGet(MM_MEM32));
+    UtAssert_NOT_NULL(MM_MemTypeGet(MM_MEM16));
+    UtAssert_NOT_NULL(MM_MemTypeGet(MM_MEM8));
+    UtAssert_NULL(MM_MemTypeGet(UT_MM_FPGA_MEMTYPE));
+
+    UtAssert_STRINGBUF_EQ(MM_MemTypeGet(MM_EEPROM)->Name, sizeof("MEM_EEPROM"), "MEM_EEPROM", sizeof("MEM_EEPROM"));
+    UtAssert_UINT32_EQ(MM_MemTypeGet(MM_EEPROM)->PSP_MemType, CFE_PSP_MEM_EEPROM);
+    UtAssert_ADDRESS_EQ(MM_MemTypeGet(MM_RAM)->Limits, &MM_AppData.Config.Ram);
+    UtAssert_ADDRESS_EQ(MM_MemTypeGet(MM_RAM)->Read, MM_ReadMemRam);
+    UtAssert_UINT32_EQ(MM_MemTypeGet(MM_RAM)->AccessWidth, 0);
+    UtAssert_ADDRESS_EQ(MM_MemTypeGet(MM_MEM32)->Limits, &MM_AppData.Config.Mem32);
+    UtAssert_ADDRESS_EQ(MM_MemTypeGet(MM_MEM32)->LoadFromFile, MM_LoadMem32FromFile);
+    UtAssert_UINT32_EQ(MM_MemTypeGet(MM_MEM32)->AccessWidth, 4);
+    UtAssert_UINT32_EQ(MM_MemTypeGet(MM_MEM16)->AccessWidth, 2);
+    UtAssert_UINT32_EQ(MM_MemTypeGet(MM_MEM8)->AccessWidth, 1);
+}
+
+void MM_MemTypeRegister_Test_Nominal(void)
+{
+    MM_MemTypeInit();
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_MemTypeRegister(UT_MM_FPGA_MEMTYPE, &UT_FpgaDriver));
+
+    /* Verify results */
+    UtAssert_ADDRESS_EQ(MM_MemTypeGet(UT_MM_FPGA_MEMTYPE), &UT_FpgaDriver);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_MemTypeRegister_Test_Reserved(void)
+{
+    MM_MemTypeInit();
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_MemTypeRegister(MM_NOMEMTYPE, &UT_FpgaDriver));
+    UtAssert_BOOL_FALSE(MM_MemTypeRegister(MM_RAM, &UT_FpgaDriver));
+    UtAssert_BOOL_FALSE(MM_MemTypeRegister(MM_MEM32, &UT_FpgaDriver));
+    UtAssert_BOOL_FALSE(MM_MemTypeRegister((MM_MemType_t)MM_MAX_MEM_TYPES, &UT_FpgaDriver));
+
+    /* Verify results */
+    UtAssert_ADDRESS_EQ(MM_MemTypeGet(MM_RAM)->Read, MM_ReadMemRam);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 4);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_MEMTYPE_REG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_MemTypeRegister_Test_Duplicate(void)
+{
+    MM_MemTypeDriver_t OtherDriver = UT_FpgaDriver;
+
+    MM_MemTypeInit();
+    UtAssert_BOOL_TRUE(MM_MemTypeRegister(UT_MM_FPGA_MEMTYPE, &UT_FpgaDriver));
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_MemTypeRegister(UT_MM_FPGA_MEMTYPE, &OtherDriver));
+
+    /* Verify results */
+    UtAssert_ADDRESS_EQ(MM_MemTypeGet(UT_MM_FPGA_MEMTYPE), &UT_FpgaDriver);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_MEMTYPE_REG_ERR_EID);
+}
+
+void MM_MemTypeRegister_Test_BadDriver(void)
+{
+    MM_MemTypeInit();
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_MemTypeRegister(UT_MM_FPGA_MEMTYPE, NULL));
+
+    UT_FpgaDriver.Limits = NULL;
+    UtAssert_BOOL_FALSE(MM_MemTypeRegister(UT_MM_FPGA_MEMTYPE, &UT_FpgaDriver));
+    UT_FpgaDriver.Limits = &UT_FpgaLimits;
+
+    UT_FpgaDriver.Write = NULL;
+    UtAssert_BOOL_FALSE(MM_MemTypeRegister(UT_MM_FPGA_MEMTYPE, &UT_FpgaDriver));
+    UT_FpgaDriver.Write = MM_WriteMem32;
+
+    UT_FpgaDriver.AccessWidth = 3;
+    UtAssert_BOOL_FALSE(MM_MemTypeRegister(UT_MM_FPGA_MEMTYPE, &UT_FpgaDriver));
+
+    /* Verify results */
+    UtAssert_NULL(MM_MemTypeGet(UT_MM_FPGA_MEMTYPE));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 4);
+}
+
+void MM_MemTypeGet_Test_OutOfRange(void)
+{
+    MM_MemTypeInit();
+
+    /* Execute the function being tested */
+    UtAssert_NULL(MM_MemTypeGet((MM_MemType_t)MM_MAX_MEM_TYPES));
+    UtAssert_NULL(MM_MemTypeGet((MM_MemType_t)-1));
+}
+
+void MM_ReadWriteMemRam_Test(void)
+{
+    uint8 Source[5] = {1, 2, 3, 4, 5};
+    uint8 Target[5] = {0};
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_ReadMemRam((cpuaddr)Source, Target, sizeof(Target)));
+    UtAssert_MemCmp(Target, Source, sizeof(Source), "Read copied memory");
+
+    memset(Target, 0, sizeof(Target));
+    UtAssert_BOOL_TRUE(MM_WriteMemRam((cpuaddr)Target, Source, sizeof(Source)));
+    UtAssert_MemCmp(Target, Source, sizeof(Source), "Write copied memory");
+}
+
+void MM_ReadMemRam_Test_SingleItem(void)
+{
+    uint32 Source   = 0;
+    uint32 PspValue = 0x12345678;
+    uint16 PspWord  = 0x1234;
+    uint8  PspByte  = 0x12;
+    uint32 Target32 = 0;
+    uint16 Target16 = 0;
+    uint8  Target8  = 0;
+
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_MemRead32), &PspValue, sizeof(PspValue), false);
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_MemRead16), &PspWord, sizeof(PspWord), false);
+    UT_SetDataBuffer(UT_KEY(CFE_PSP_MemRead8), &PspByte, sizeof(PspByte), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_ReadMemRam((cpuaddr)&Source, &Target32, sizeof(Target32)));
+    UtAssert_BOOL_TRUE(MM_ReadMemRam((cpuaddr)&Source, &Target16, sizeof(Target16)));
+    UtAssert_BOOL_TRUE(MM_ReadMemRam((cpuaddr)&Source, &Target8, sizeof(Target8)));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead32, 1);
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead16, 1);
+    UtAssert_STUB_COUNT(CFE_PSP_MemRead8, 1);
+    UtAssert_UINT32_EQ(Target32, PspValue);
+    UtAssert_UINT32_EQ(Target16, PspWord);
+    UtAssert_UINT32_EQ(Target8, PspByte);
+}
+
+void MM_ReadMemRam_Test_PSPError(void)
+{
+    uint32 Source = 0;
+    uint16 Target = 0;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_MemRead16), -1);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_ReadMemRam((cpuaddr)&Source, &Target, sizeof(Target)));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_PSP_READ_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_WriteMemRam_Test_SingleItem(void)
+{
+    uint32 Target = 0;
+    uint32 Value  = 5;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_WriteMemRam((cpuaddr)&Target, &Value, sizeof(uint32)));
+    UtAssert_BOOL_TRUE(MM_WriteMemRam((cpuaddr)&Target, &Value, sizeof(uint16)));
+    UtAssert_BOOL_TRUE(MM_WriteMemRam((cpuaddr)&Target, &Value, sizeof(uint8)));
+
+    /* Verify results, the PSP stubs don't touch the target */
+    UtAssert_STUB_COUNT(CFE_PSP_MemWrite32, 1);
+    UtAssert_STUB_COUNT(CFE_PSP_MemWrite16, 1);
+    UtAssert_STUB_COUNT(CFE_PSP_MemWrite8, 1);
+    UtAssert_UINT32_EQ(Target, 0);
+}
+
+void MM_WriteMemRam_Test_PSPError(void)
+{
+    uint32 Target = 0;
+    uint32 Value  = 5;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_MemWrite32), -1);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_WriteMemRam((cpuaddr)&Target, &Value, sizeof(Value)));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_PSP_WRITE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void UT_MemTypeSetup(void)
+{
+    MM_Test_Setup();
+
+    memset(&UT_FpgaDriver, 0, sizeof(UT_FpgaDriver));
+    UT_FpgaDriver.Name         = "FPGA";
+    UT_FpgaDriver.PSP_MemType  = CFE_PSP_MEM_RAM;
+    UT_FpgaDriver.AccessWidth  = 4;
+    UT_FpgaDriver.Limits       = &UT_FpgaLimits;
+    UT_FpgaDriver.LoadFromFile = MM_LoadMem32FromFile;
+    UT_FpgaDriver.DumpToFile   = MM_DumpMem32ToFile;
+    UT_FpgaDriver.Fill         = MM_FillMem32;
+    UT_FpgaDriver.Read         = MM_ReadMem32;
+    UT_FpgaDriver.Write        = MM_WriteMem32;
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(MM_MemTypeInit_Test, UT_MemTypeSetup, MM_Test_TearDown, "MM_MemTypeInit_Test");
+    UtTest_Add(MM_MemTypeRegister_Test_Nominal, UT_MemTypeSetup, MM_Test_TearDown,
+               "MM_MemTypeRegister_Test_Nominal");
+    UtTest_Add(MM_MemTypeRegister_Test_Reserved, UT_MemTypeSetup, MM_Test_TearDown,
+               "MM_MemTypeRegister_Test_Reserved");
+    UtTest_Add(MM_MemTypeRegister_Test_Duplicate, UT_MemTypeSetup, MM_Test_TearDown,
+               "MM_MemTypeRegister_Test_Duplicate");
+    UtTest_Add(MM_MemTypeRegister_Test_BadDriver, UT_MemTypeSetup, MM_Test_TearDown,
+               "MM_MemTypeRegister_Test_BadDriver");
+    UtTest_Add(MM_MemTypeGet_Test_OutOfRange, UT_MemTypeSetup, MM_Test_TearDown, "MM_MemTypeGet_Test_OutOfRange");
+    UtTest_Add(MM_ReadWriteMemRam_Test, UT_MemTypeSetup, MM_Test_TearDown, "MM_ReadWriteMemRam_Test");
+    UtTest_Add(MM_ReadMemRam_Test_SingleItem, UT_MemTypeSetup, MM_Test_TearDown, "MM_ReadMemRam_Test_SingleItem");
+    UtTest_Add(MM_ReadMemRam_Test_PSPError, UT_MemTypeSetup, MM_Test_TearDown, "MM_ReadMemRam_Test_PSPError");
+    UtTest_Add(MM_WriteMemRam_Test_SingleItem, UT_MemTypeSetup, MM_Test_TearDown, "MM_WriteMemRam_Test_SingleItem");
+    UtTest_Add(MM_WriteMemRam_Test_PSPError, UT_MemTypeSetup, MM_Test_TearDown, "MM_WriteMemRam_Test_PSPError");
+}
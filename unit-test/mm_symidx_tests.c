@@ -0,0 +1,435 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Unit tests for mm_symidx.c
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_symidx.h"
+#include "mm_app.h"
+#include "mm_events.h"
+#include "mm_test_utils.h"
+
+/************************************************************************
+** UT Includes
+*************************************************************************/
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include "cfe.h"
+
+/* mm_symidx_tests globals */
+uint8 call_count_CFE_EVS_SendEvent;
+
+/* Large enough to overflow both the index and its name pool */
+OS_SymbolRecord_t UT_SymRecords[MM_SYM_INDEX_ENTRIES + 1];
+
+/*
+ * Function Definitions
+ */
+
+/* Adds a symbol to the index directly, without reading a dump file */
+void UT_SymIndexAdd(const char *SymName, cpuaddr Address)
+{
+    size_t NameLength = strlen(SymName);
+
+    memcpy(&MM_AppData.SymIndexNames[MM_AppData.SymIndexNamesUsed], SymName, NameLength + 1);
+    MM_AppData.SymIndex[MM_AppData.SymIndexCount].Address    = Address;
+    MM_AppData.SymIndex[MM_AppData.SymIndexCount].NameOffset = MM_AppData.SymIndexNamesUsed;
+
+    MM_AppData.SymIndexNamesUsed += NameLength + 1;
+    MM_AppData.SymIndexCount++;
+}
+
+const char *UT_SymIndexName(uint32 Entry)
+{
+    return &MM_AppData.SymIndexNames[MM_AppData.SymIndex[Entry].NameOffset];
+}
+
+void MM_SymIndexReset_Test(void)
+{
+    UT_SymIndexAdd("Alpha", 0x1000);
+    MM_AppData.HkPacket.Payload.SymIndexEntries = 1;
+
+    /* Execute the function being tested */
+    MM_SymIndexReset();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MM_AppData.SymIndexCount, 0);
+    UtAssert_UINT32_EQ(MM_AppData.SymIndexNamesUsed, 0);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.SymIndexEntries, 0);
+}
+
+void MM_SymIndexBuild_Test_Nominal(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Reverse symbol index built: Symbols = %%u File = '%%s'");
+
+    /* Unsorted, with an unnamed record and a name that fills its record */
+    snprintf(UT_SymRecords[0].SymbolName, sizeof(UT_SymRecords[0].SymbolName), "Beta");
+    UT_SymRecords[0].SymbolAddress = 0x2000;
+    UT_SymRecords[1].SymbolAddress = 0x5000;
+    snprintf(UT_SymRecords[2].SymbolName, sizeof(UT_SymRecords[2].SymbolName), "Alpha");
+    UT_SymRecords[2].SymbolAddress = 0x1000;
+    memset(UT_SymRecords[3].SymbolName, 'G', sizeof(UT_SymRecords[3].SymbolName));
+    UT_SymRecords[3].SymbolAddress = 0x3000;
+
+    UT_SetDataBuffer(UT_KEY(OS_read), UT_SymRecords, 4 * sizeof(UT_SymRecords[0]), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 5, 0);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_SymIndexBuild("symtbl.dat"));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MM_AppData.SymIndexCount, 3);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.SymIndexEntries, 3);
+    UtAssert_UINT32_EQ(MM_AppData.SymIndexNamesUsed, 5 + 1 + 4 + 1 + OS_MAX_SYM_LEN + 1);
+    UtAssert_STRINGBUF_EQ(UT_SymIndexName(0), sizeof("Alpha"), "Alpha", sizeof("Alpha"));
+    UtAssert_STRINGBUF_EQ(UT_SymIndexName(1), sizeof("Beta"), "Beta", sizeof("Beta"));
+    UtAssert_UINT32_EQ(strlen(UT_SymIndexName(2)), OS_MAX_SYM_LEN);
+    UtAssert_UINT32_EQ(MM_AppData.SymIndex[0].Address, 0x1000);
+    UtAssert_UINT32_EQ(MM_AppData.SymIndex[1].Address, 0x2000);
+    UtAssert_UINT32_EQ(MM_AppData.SymIndex[2].Address, 0x3000);
+    UtAssert_STUB_COUNT(OS_read, 5);
+    UtAssert_STUB_COUNT(OS_close, 1);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_SYM_INDEX_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+void MM_SymIndexBuild_Test_IndexFull(void)
+{
+    uint32 i;
+    int32  strCmpResult;
+    char   ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Reverse symbol index full: Symbols = %%u Name pool bytes = %%u File = '%%s'");
+
+    /* One more symbol than fits, in descending address order */
+    for (i = 0; i < MM_SYM_INDEX_ENTRIES + 1; i++)
+    {
+        snprintf(UT_SymRecords[i].SymbolName, sizeof(UT_SymRecords[i].SymbolName), "S%u", (unsigned int)i);
+        UT_SymRecords[i].SymbolAddress = (MM_SYM_INDEX_ENTRIES - i) * 16;
+    }
+
+    UT_SetDataBuffer(UT_KEY(OS_read), UT_SymRecords, sizeof(UT_SymRecords), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_SymIndexBuild("symtbl.dat"));
+
+    /* Verify results, reading stops at the symbol that doesn't fit */
+    UtAssert_UINT32_EQ(MM_AppData.SymIndexCount, MM_SYM_INDEX_ENTRIES);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.SymIndexEntries, MM_SYM_INDEX_ENTRIES);
+    UtAssert_STUB_COUNT(OS_read, MM_SYM_INDEX_ENTRIES + 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+
+    UtAssert_UINT32_EQ(MM_AppData.SymIndex[0].Address, 16);
+    UtAssert_STRINGBUF_EQ(UT_SymIndexName(MM_SYM_INDEX_ENTRIES - 1), sizeof("S0"), "S0", sizeof("S0"));
+    for (i = 1; i < MM_SYM_INDEX_ENTRIES; i++)
+    {
+        UtAssert_True(MM_AppData.SymIndex[i].Address == (MM_AppData.SymIndex[i - 1].Address + 16),
+                      "Entry %u in address order", (unsigned int)i);
+    }
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_SYM_INDEX_FULL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+void MM_SymIndexBuild_Test_NamePoolFull(void)
+{
+    uint32 i;
+
+    /* Names that each take OS_MAX_SYM_LEN bytes of the pool */
+    for (i = 0; i < MM_SYM_INDEX_ENTRIES + 1; i++)
+    {
+        memset(UT_SymRecords[i].SymbolName, 'N', OS_MAX_SYM_LEN - 1);
+        UT_SymRecords[i].SymbolAddress = i * 16;
+    }
+
+    UT_SetDataBuffer(UT_KEY(OS_read), UT_SymRecords, sizeof(UT_SymRecords), false);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_SymIndexBuild("symtbl.dat"));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MM_AppData.SymIndexCount, MM_SYM_INDEX_NAME_POOL_SIZE / OS_MAX_SYM_LEN);
+    UtAssert_True(MM_AppData.SymIndexNamesUsed <= MM_SYM_INDEX_NAME_POOL_SIZE, "Name pool not overrun");
+    UtAssert_UINT32_EQ(strlen(UT_SymIndexName(MM_AppData.SymIndexCount - 1)), OS_MAX_SYM_LEN - 1);
+    UtAssert_STUB_COUNT(OS_read, MM_AppData.SymIndexCount + 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_SYM_INDEX_FULL_INF_EID);
+}
+
+void MM_SymIndexBuild_Test_OpenError(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Reverse symbol index open error: RC = %%d File = '%%s'");
+
+    UT_SymIndexAdd("Alpha", 0x1000);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_OpenCreate), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_SymIndexBuild("symtbl.dat"));
+
+    /* Verify results, the old index is gone */
+    UtAssert_UINT32_EQ(MM_AppData.SymIndexCount, 0);
+    UtAssert_STUB_COUNT(OS_read, 0);
+    UtAssert_STUB_COUNT(OS_close, 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_SYM_INDEX_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+void MM_SymIndexBuild_Test_ReadError(void)
+{
+    int32 strCmpResult;
+    char  ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
+
+    snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
+             "Reverse symbol index read error: RC = %%d File = '%%s'");
+
+    strncpy(UT_SymRecords[0].SymbolName, "Alpha", sizeof(UT_SymRecords[0].SymbolName));
+    UT_SymRecords[0].SymbolAddress = 0x1000;
+
+    UT_SetDataBuffer(UT_KEY(OS_read), UT_SymRecords, sizeof(UT_SymRecords[0]), false);
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 2, OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_SymIndexBuild("symtbl.dat"));
+
+    /* Verify results, the symbols read before the error are discarded */
+    UtAssert_UINT32_EQ(MM_AppData.SymIndexCount, 0);
+    UtAssert_UINT32_EQ(MM_AppData.SymIndexNamesUsed, 0);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.SymIndexEntries, 0);
+    UtAssert_STUB_COUNT(OS_close, 1);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_INT32_EQ(call_count_CFE_EVS_SendEvent, 1);
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_SYM_INDEX_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    strCmpResult = strncmp(ExpectedEventString, context_CFE_EVS_SendEvent[0].Spec, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH);
+
+    UtAssert_True(strCmpResult == 0, "Event string matched expected result, '%s'", context_CFE_EVS_SendEvent[0].Spec);
+}
+
+void MM_SymIndexBuild_Test_PartialRecord(void)
+{
+    UT_SetDeferredRetcode(UT_KEY(OS_read), 1, sizeof(OS_SymbolRecord_t) / 2);
+
+    /* Execute the function being tested, a truncated file is a read error */
+    UtAssert_BOOL_FALSE(MM_SymIndexBuild("symtbl.dat"));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MM_AppData.SymIndexCount, 0);
+    UtAssert_STUB_COUNT(OS_read, 1);
+    UtAssert_STUB_COUNT(OS_close, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_SYM_INDEX_ERR_EID);
+}
+
+void MM_SymIndexSort_Test_Nominal(void)
+{
+    uint32  i;
+    uint32  Seed = 12345;
+    cpuaddr Sum  = 0;
+    cpuaddr SortedSum;
+
+    /* Pseudo random addresses, with duplicates */
+    for (i = 0; i < 1000; i++)
+    {
+        Seed = (Seed * 1103515245) + 12345;
+
+        MM_AppData.SymIndex[i].Address    = (Seed >> 16) % 500;
+        MM_AppData.SymIndex[i].NameOffset = i;
+        Sum += MM_AppData.SymIndex[i].Address;
+    }
+
+    MM_AppData.SymIndexCount = 1000;
+
+    /* Execute the function being tested */
+    MM_SymIndexSort();
+
+    /* Verify results */
+    SortedSum = MM_AppData.SymIndex[0].Address;
+    for (i = 1; i < 1000; i++)
+    {
+        UtAssert_True(MM_AppData.SymIndex[i - 1].Address <= MM_AppData.SymIndex[i].Address,
+                      "Entry %u in address order", (unsigned int)i);
+        SortedSum += MM_AppData.SymIndex[i].Address;
+    }
+
+    UtAssert_True(SortedSum == Sum, "No address lost or duplicated");
+}
+
+void MM_SymIndexSort_Test_Small(void)
+{
+    /* Execute the function being tested, empty and single entry indexes are already sorted */
+    MM_SymIndexSort();
+
+    UT_SymIndexAdd("Alpha", 0x1000);
+    MM_SymIndexSort();
+    UtAssert_UINT32_EQ(MM_AppData.SymIndex[0].Address, 0x1000);
+
+    UT_SymIndexAdd("Beta", 0x800);
+    MM_SymIndexSort();
+    UtAssert_UINT32_EQ(MM_AppData.SymIndex[0].Address, 0x800);
+    UtAssert_STRINGBUF_EQ(UT_SymIndexName(0), sizeof("Beta"), "Beta", sizeof("Beta"));
+    UtAssert_UINT32_EQ(MM_AppData.SymIndex[1].Address, 0x1000);
+}
+
+void MM_SymIndexLookup_Test_Nominal(void)
+{
+    const char *SymName = NULL;
+    cpuaddr     Offset  = 0;
+
+    UT_SymIndexAdd("Alpha", 0x1000);
+    UT_SymIndexAdd("Beta", 0x2000);
+    UT_SymIndexAdd("Gamma", 0x30000);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_SymIndexLookup(0x1000, &SymName, &Offset));
+    UtAssert_STRINGBUF_EQ(SymName, sizeof("Alpha"), "Alpha", sizeof("Alpha"));
+    UtAssert_UINT32_EQ(Offset, 0);
+
+    UtAssert_BOOL_TRUE(MM_SymIndexLookup(0x1FFF, &SymName, &Offset));
+    UtAssert_STRINGBUF_EQ(SymName, sizeof("Alpha"), "Alpha", sizeof("Alpha"));
+    UtAssert_UINT32_EQ(Offset, 0xFFF);
+
+    UtAssert_BOOL_TRUE(MM_SymIndexLookup(0x2004, &SymName, &Offset));
+    UtAssert_STRINGBUF_EQ(SymName, sizeof("Beta"), "Beta", sizeof("Beta"));
+    UtAssert_UINT32_EQ(Offset, 4);
+
+    UtAssert_BOOL_TRUE(MM_SymIndexLookup(0x30000 + MM_SYM_INDEX_MAX_OFFSET, &SymName, &Offset));
+    UtAssert_STRINGBUF_EQ(SymName, sizeof("Gamma"), "Gamma", sizeof("Gamma"));
+    UtAssert_UINT32_EQ(Offset, MM_SYM_INDEX_MAX_OFFSET);
+}
+
+void MM_SymIndexLookup_Test_NotFound(void)
+{
+    const char *SymName = NULL;
+    cpuaddr     Offset  = 0;
+
+    /* Execute the function being tested, nothing is found in an empty index */
+    UtAssert_BOOL_FALSE(MM_SymIndexLookup(0x1000, &SymName, &Offset));
+
+    UT_SymIndexAdd("Alpha", 0x1000);
+    UT_SymIndexAdd("Gamma", 0x30000);
+
+    /* Below the first symbol */
+    UtAssert_BOOL_FALSE(MM_SymIndexLookup(0xFFF, &SymName, &Offset));
+
+    /* Too far above the last symbol */
+    UtAssert_BOOL_FALSE(MM_SymIndexLookup(0x30000 + MM_SYM_INDEX_MAX_OFFSET + 1, &SymName, &Offset));
+
+    /* Verify results */
+    UtAssert_NULL(SymName);
+    UtAssert_UINT32_EQ(Offset, 0);
+}
+
+void MM_SymIndexFormat_Test_Nominal(void)
+{
+    char Buffer[MM_SYM_INDEX_STRING_LEN];
+
+    UT_SymIndexAdd("Alpha", 0x1000);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_SymIndexFormat(0x10AB, Buffer, sizeof(Buffer)));
+
+    /* Verify results */
+    UtAssert_STRINGBUF_EQ(Buffer, sizeof(Buffer), "Alpha+0xAB", sizeof("Alpha+0xAB"));
+}
+
+void MM_SymIndexFormat_Test_NotFound(void)
+{
+    char Buffer[MM_SYM_INDEX_STRING_LEN] = "unchanged";
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_SymIndexFormat(0x10AB, Buffer, sizeof(Buffer)));
+
+    /* Verify results */
+    UtAssert_STRINGBUF_EQ(Buffer, sizeof(Buffer), "unchanged", sizeof("unchanged"));
+}
+
+void UT_SymIndexSetup(void)
+{
+    MM_Test_Setup();
+
+    memset(UT_SymRecords, 0, sizeof(UT_SymRecords));
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(MM_SymIndexReset_Test, UT_SymIndexSetup, MM_Test_TearDown, "MM_SymIndexReset_Test");
+    UtTest_Add(MM_SymIndexBuild_Test_Nominal, UT_SymIndexSetup, MM_Test_TearDown, "MM_SymIndexBuild_Test_Nominal");
+    UtTest_Add(MM_SymIndexBuild_Test_IndexFull, UT_SymIndexSetup, MM_Test_TearDown,
+               "MM_SymIndexBuild_Test_IndexFull");
+    UtTest_Add(MM_SymIndexBuild_Test_NamePoolFull, UT_SymIndexSetup, MM_Test_TearDown,
+               "MM_SymIndexBuild_Test_NamePoolFull");
+    UtTest_Add(MM_SymIndexBuild_Test_OpenError, UT_SymIndexSetup, MM_Test_TearDown,
+               "MM_SymIndexBuild_Test_OpenError");
+    UtTest_Add(MM_SymIndexBuild_Test_ReadError, UT_SymIndexSetup, MM_Test_TearDown,
+               "MM_SymIndexBuild_Test_ReadError");
+    UtTest_Add(MM_SymIndexBuild_Test_PartialRecord, UT_SymIndexSetup, MM_Test_TearDown,
+               "MM_SymIndexBuild_Test_PartialRecord");
+    UtTest_Add(MM_SymIndexSort_Test_Nominal, UT_SymIndexSetup, MM_Test_TearDown, "MM_SymIndexSort_Test_Nominal");
+    UtTest_Add(MM_SymIndexSort_Test_Small, UT_SymIndexSetup, MM_Test_TearDown, "MM_SymIndexSort_Test_Small");
+    UtTest_Add(MM_SymIndexLookup_Test_Nominal, UT_SymIndexSetup, MM_Test_TearDown, "MM_SymIndexLookup_Test_Nominal");
+    UtTest_Add(MM_SymIndexLookup_Test_NotFound, UT_SymIndexSetup, MM_Test_TearDown,
+               "MM_SymIndexLookup_Test_NotFound");
+    UtTest_Add(MM_SymIndexFormat_Test_Nominal, UT_SymIndexSetup, MM_Test_TearDown, "MM_SymIndexFormat_Test_Nominal");
+    UtTest_Add(MM_SymIndexFormat_Test_NotFound, UT_SymIndexSetup, MM_Test_TearDown,
+               "MM_SymIndexFormat_Test_NotFound");
+}
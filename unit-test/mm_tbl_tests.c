@@ -0,0 +1,421 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Unit tests for mm_tbl.c
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_tbl.h"
+#include "mm_app.h"
+#include "mm_events.h"
+#include "mm_child.h"
+#include "mm_platform_cfg.h"
+#include "mm_test_utils.h"
+
+/************************************************************************
+** UT Includes
+*************************************************************************/
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+#include <string.h>
+#include "cfe.h"
+
+/* mm_tbl_tests globals */
+uint8 call_count_CFE_EVS_SendEvent;
+
+/*
+ * Function Definitions
+ */
+
+void MM_TableInit_Test_Nominal(void)
+{
+    CFE_Status_t   Result;
+    MM_ConfigTbl_t Defaults;
+
+    MM_TableSetDefaults(&Defaults);
+    memset(&MM_AppData.Config, 0, sizeof(MM_AppData.Config));
+
+    /* Execute the function being tested */
+    Result = MM_TableInit();
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, CFE_SUCCESS);
+    UtAssert_MemCmp(&MM_AppData.Config, &Defaults, sizeof(Defaults), "Config holds the compile time values");
+
+    UtAssert_STUB_COUNT(CFE_TBL_Register, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_Load, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_Manage, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_GetAddress, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 1);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 0, "CFE_EVS_SendEvent was called %u time(s), expected 0",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MM_TableInit_Test_RegisterError(void)
+{
+    CFE_Status_t Result;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Register), -1);
+
+    /* Execute the function being tested */
+    Result = MM_TableInit();
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, -1);
+    UtAssert_STUB_COUNT(CFE_TBL_Load, 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CONFIG_TBL_REG_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_TableInit_Test_LoadError(void)
+{
+    CFE_Status_t   Result;
+    MM_ConfigTbl_t Defaults;
+
+    MM_TableSetDefaults(&Defaults);
+    memset(&MM_AppData.Config, 0, sizeof(MM_AppData.Config));
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_Load), -1);
+
+    /* Execute the function being tested */
+    Result = MM_TableInit();
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, CFE_SUCCESS);
+    UtAssert_MemCmp(&MM_AppData.Config, &Defaults, sizeof(Defaults), "Config holds the compile time values");
+    UtAssert_STUB_COUNT(CFE_TBL_Manage, 0);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CONFIG_TBL_LOAD_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_TableSetDefaults_Test(void)
+{
+    MM_ConfigTbl_t Tbl;
+
+    memset(&Tbl, 0, sizeof(Tbl));
+
+    /* Execute the function being tested */
+    MM_TableSetDefaults(&Tbl);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Tbl.Ram.MaxLoadFileData, MM_MAX_LOAD_FILE_DATA_RAM);
+    UtAssert_UINT32_EQ(Tbl.Eeprom.MaxDumpFileData, MM_MAX_DUMP_FILE_DATA_EEPROM);
+    UtAssert_UINT32_EQ(Tbl.Mem8.MaxFillData, MM_MAX_FILL_DATA_MEM8);
+    UtAssert_UINT32_EQ(Tbl.LoadDataSeg, MM_MAX_LOAD_DATA_SEG);
+    UtAssert_UINT32_EQ(Tbl.DumpDataSeg, MM_MAX_DUMP_DATA_SEG);
+    UtAssert_UINT32_EQ(Tbl.FillDataSeg, MM_MAX_FILL_DATA_SEG);
+    UtAssert_UINT32_EQ(Tbl.ProcessorCycle, MM_PROCESSOR_CYCLE);
+    UtAssert_UINT32_EQ(Tbl.SegmentTimeBudget, MM_SEGMENT_TIME_BUDGET);
+    UtAssert_UINT32_EQ(Tbl.WakeupByteBudget, MM_WAKEUP_BYTE_BUDGET);
+    UtAssert_UINT32_EQ(Tbl.MaxStagedLoad, MM_MAX_STAGED_LOAD);
+}
+
+void MM_TableManage_Test_Updated(void)
+{
+    MM_ConfigTbl_t  Tbl;
+    MM_ConfigTbl_t *TblPtr = &Tbl;
+
+    MM_TableSetDefaults(&Tbl);
+    Tbl.DumpDataSeg    = 64;
+    Tbl.ProcessorCycle = 5;
+
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &TblPtr, sizeof(TblPtr), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_INFO_UPDATED);
+
+    /* Execute the function being tested */
+    MM_TableManage();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MM_AppData.Config.DumpDataSeg, 64);
+    UtAssert_UINT32_EQ(MM_AppData.Config.ProcessorCycle, 5);
+    UtAssert_STUB_COUNT(CFE_TBL_Manage, 1);
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 1);
+}
+
+void MM_TableManage_Test_NotUpdated(void)
+{
+    MM_ConfigTbl_t  Tbl;
+    MM_ConfigTbl_t *TblPtr = &Tbl;
+
+    MM_TableSetDefaults(&Tbl);
+    Tbl.DumpDataSeg = 64;
+
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &TblPtr, sizeof(TblPtr), false);
+
+    /* Execute the function being tested */
+    MM_TableManage();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MM_AppData.Config.DumpDataSeg, MM_MAX_DUMP_DATA_SEG);
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 1);
+}
+
+void MM_TableManage_Test_GetAddressError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_ERR_INVALID_HANDLE);
+
+    /* Execute the function being tested */
+    MM_TableManage();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MM_AppData.Config.DumpDataSeg, MM_MAX_DUMP_DATA_SEG);
+    UtAssert_STUB_COUNT(CFE_TBL_ReleaseAddress, 0);
+}
+
+void MM_TableManage_Test_ActiveAction(void)
+{
+    MM_ConfigTbl_t  Tbl;
+    MM_ConfigTbl_t *TblPtr = &Tbl;
+
+    MM_TableSetDefaults(&Tbl);
+    Tbl.DumpDataSeg = 64;
+
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &TblPtr, sizeof(TblPtr), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_INFO_UPDATED);
+
+    /* A dump on the main task is answering a housekeeping request */
+    MM_TableSetDefaults(&MM_AppData.Config);
+    MM_AppData.HkPacket.Payload.ActiveAction = MM_DUMP_TO_FILE;
+
+    /* Execute the function being tested */
+    MM_TableManage();
+
+    /* Verify results, the update waits for the dump to complete */
+    UtAssert_UINT32_EQ(MM_AppData.Config.DumpDataSeg, MM_MAX_DUMP_DATA_SEG);
+    UtAssert_STUB_COUNT(CFE_TBL_Manage, 0);
+    UtAssert_STUB_COUNT(CFE_TBL_GetAddress, 0);
+}
+
+void MM_TableManage_Test_ChildBusy(void)
+{
+    MM_ConfigTbl_t  Tbl;
+    MM_ConfigTbl_t *TblPtr = &Tbl;
+
+    MM_TableSetDefaults(&Tbl);
+    Tbl.DumpDataSeg = 64;
+
+    UT_SetDataBuffer(UT_KEY(CFE_TBL_GetAddress), &TblPtr, sizeof(TblPtr), false);
+    UT_SetDefaultReturnValue(UT_KEY(CFE_TBL_GetAddress), CFE_TBL_INFO_UPDATED);
+
+    MM_TableSetDefaults(&MM_AppData.Config);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ChildGetState), MM_CHILD_BUSY);
+
+    /* Execute the function being tested */
+    MM_TableManage();
+
+    /* Verify results, the update waits for the child task to complete */
+    UtAssert_UINT32_EQ(MM_AppData.Config.DumpDataSeg, MM_MAX_DUMP_DATA_SEG);
+    UtAssert_STUB_COUNT(CFE_TBL_Manage, 0);
+    UtAssert_STUB_COUNT(CFE_TBL_GetAddress, 0);
+}
+
+void MM_TableValidate_Test_Nominal(void)
+{
+    int32          Result;
+    MM_ConfigTbl_t Tbl;
+
+    MM_TableSetDefaults(&Tbl);
+
+    /* Execute the function being tested */
+    Result = MM_TableValidate(&Tbl);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, CFE_SUCCESS);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CONFIG_TBL_VAL_INF_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_INFORMATION);
+}
+
+void MM_TableValidate_Test_LimitError(void)
+{
+    int32          Result;
+    MM_ConfigTbl_t Tbl;
+
+    MM_TableSetDefaults(&Tbl);
+    Tbl.Eeprom.MaxFillData = MM_MAX_FILL_DATA_EEPROM + 1;
+
+    /* Execute the function being tested */
+    Result = MM_TableValidate(&Tbl);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, MM_CONFIG_TBL_VALIDATION_ERR);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CONFIG_TBL_VAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_TableValidate_Test_StagedLoadError(void)
+{
+    int32          Result;
+    MM_ConfigTbl_t Tbl;
+
+    /* Staging can be turned off but not raised past the pool sizing */
+    MM_TableSetDefaults(&Tbl);
+    Tbl.MaxStagedLoad = 0;
+    UtAssert_INT32_EQ(MM_TableValidate(&Tbl), CFE_SUCCESS);
+
+    Tbl.MaxStagedLoad = MM_MAX_STAGED_LOAD + 1;
+
+    /* Execute the function being tested */
+    Result = MM_TableValidate(&Tbl);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, MM_CONFIG_TBL_VALIDATION_ERR);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, MM_CONFIG_TBL_VAL_ERR_EID);
+}
+
+void MM_TableValidate_Test_SegmentError(void)
+{
+    int32          Result;
+    MM_ConfigTbl_t Tbl;
+
+    MM_TableSetDefaults(&Tbl);
+    Tbl.FillDataSeg = MM_MIN_DATA_SEG + 2;
+
+    /* Execute the function being tested */
+    Result = MM_TableValidate(&Tbl);
+
+    /* Verify results */
+    UtAssert_INT32_EQ(Result, MM_CONFIG_TBL_VALIDATION_ERR);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CONFIG_TBL_VAL_ERR_EID);
+}
+
+void MM_TableValidate_Test_PacingError(void)
+{
+    MM_ConfigTbl_t Tbl;
+
+    MM_TableSetDefaults(&Tbl);
+    Tbl.ProcessorCycle = MM_MAX_PROCESSOR_CYCLE + 1;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MM_TableValidate(&Tbl), MM_CONFIG_TBL_VALIDATION_ERR);
+
+    MM_TableSetDefaults(&Tbl);
+    Tbl.SegmentTimeBudget = MM_MAX_SEGMENT_TIME_BUDGET + 1;
+
+    UtAssert_INT32_EQ(MM_TableValidate(&Tbl), MM_CONFIG_TBL_VALIDATION_ERR);
+
+    /* A wakeup budget must hold the largest segment */
+    MM_TableSetDefaults(&Tbl);
+    Tbl.WakeupByteBudget = Tbl.DumpDataSeg - 1;
+
+    UtAssert_INT32_EQ(MM_TableValidate(&Tbl), MM_CONFIG_TBL_VALIDATION_ERR);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CONFIG_TBL_VAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, MM_CONFIG_TBL_VAL_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, MM_CONFIG_TBL_VAL_ERR_EID);
+}
+
+void MM_TableValidateLimit_Test(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_TableValidateLimit("Limit", 100, 100));
+    UtAssert_BOOL_FALSE(MM_TableValidateLimit("Limit", 101, 100));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CONFIG_TBL_VAL_ERR_EID);
+}
+
+void MM_TableValidateSegment_Test(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_TableValidateSegment("Seg", MM_MIN_DATA_SEG, 200));
+    UtAssert_BOOL_TRUE(MM_TableValidateSegment("Seg", 200, 200));
+    UtAssert_BOOL_FALSE(MM_TableValidateSegment("Seg", 0, 200));
+    UtAssert_BOOL_FALSE(MM_TableValidateSegment("Seg", 198, 200));
+    UtAssert_BOOL_FALSE(MM_TableValidateSegment("Seg", 204, 200));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
+}
+
+void MM_TableValidateBudget_Test(void)
+{
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_TableValidateBudget("Budget", 0, 200));
+    UtAssert_BOOL_TRUE(MM_TableValidateBudget("Budget", 200, 200));
+    UtAssert_BOOL_FALSE(MM_TableValidateBudget("Budget", 199, 200));
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 1);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_CONFIG_TBL_VAL_ERR_EID);
+}
+
+/*
+ * Register the test cases to execute with the unit test tool
+ */
+void UtTest_Setup(void)
+{
+    UtTest_Add(MM_TableInit_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_TableInit_Test_Nominal");
+    UtTest_Add(MM_TableInit_Test_RegisterError, MM_Test_Setup, MM_Test_TearDown, "MM_TableInit_Test_RegisterError");
+    UtTest_Add(MM_TableInit_Test_LoadError, MM_Test_Setup, MM_Test_TearDown, "MM_TableInit_Test_LoadError");
+    UtTest_Add(MM_TableSetDefaults_Test, MM_Test_Setup, MM_Test_TearDown, "MM_TableSetDefaults_Test");
+    UtTest_Add(MM_TableManage_Test_Updated, MM_Test_Setup, MM_Test_TearDown, "MM_TableManage_Test_Updated");
+    UtTest_Add(MM_TableManage_Test_NotUpdated, MM_Test_Setup, MM_Test_TearDown, "MM_TableManage_Test_NotUpdated");
+    UtTest_Add(MM_TableManage_Test_GetAddressError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_TableManage_Test_GetAddressError");
+    UtTest_Add(MM_TableManage_Test_ActiveAction, MM_Test_Setup, MM_Test_TearDown, "MM_TableManage_Test_ActiveAction");
+    UtTest_Add(MM_TableManage_Test_ChildBusy, MM_Test_Setup, MM_Test_TearDown, "MM_TableManage_Test_ChildBusy");
+    UtTest_Add(MM_TableValidate_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_TableValidate_Test_Nominal");
+    UtTest_Add(MM_TableValidate_Test_LimitError, MM_Test_Setup, MM_Test_TearDown, "MM_TableValidate_Test_LimitError");
+    UtTest_Add(MM_TableValidate_Test_StagedLoadError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_TableValidate_Test_StagedLoadError");
+    UtTest_Add(MM_TableValidate_Test_SegmentError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_TableValidate_Test_SegmentError");
+    UtTest_Add(MM_TableValidate_Test_PacingError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_TableValidate_Test_PacingError");
+    UtTest_Add(MM_TableValidateLimit_Test, MM_Test_Setup, MM_Test_TearDown, "MM_TableValidateLimit_Test");
+    UtTest_Add(MM_TableValidateSegment_Test, MM_Test_Setup, MM_Test_TearDown, "MM_TableValidateSegment_Test");
+    UtTest_Add(MM_TableValidateBudget_Test, MM_Test_Setup, MM_Test_TearDown, "MM_TableValidateBudget_Test");
+}
@@ -26,6 +26,7 @@
 ** Includes
 *************************************************************************/
 #include "mm_utils.h"
+#include "mm_crc.h"
 #include "mm_msg.h"
 #include "mm_msgdefs.h"
 #include "mm_msgids.h"
@@ -34,6 +35,10 @@
 #include "mm_version.h"
 #include "mm_test_utils.h"
 #include "mm_dump.h"
+#include "mm_mem32.h"
+#include "mm_mem16.h"
+#include "mm_mem8.h"
+#include "mm_child.h"
 
 /************************************************************************
 ** UT Includes
@@ -203,9 +208,11 @@ void MM_VerifyCmdLength_Test_LengthError(void)
 void MM_SegmentBreak_Test_Nominal(void)
 {
     /* Execute the function being tested */
-    MM_SegmentBreak();
+    MM_SegmentBreak(MM_MAX_DUMP_DATA_SEG);
 
     /* Verify results */
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+    UtAssert_STUB_COUNT(OS_BinSemTimedWait, 0);
 
     call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
 
@@ -217,6 +224,611 @@ void MM_SegmentBreak_Test_Nominal(void)
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 }
 
+/* Simulates the main task receiving a scheduler wakeup while the child task waits */
+int32 UT_MM_UTILS_TEST_WakeupHook(void *UserObj, int32 StubRetcode, uint32 CallCount, const UT_StubContext_t *Context)
+{
+    MM_AppData.WakeupCount++;
+
+    return StubRetcode;
+}
+
+void MM_SegmentBreak_Test_PacedWithinBudget(void)
+{
+    MM_AppData.WakeupSemaphore             = MM_UT_OBJID_1;
+    MM_AppData.Config.WakeupByteBudget     = 3 * MM_MAX_DUMP_DATA_SEG;
+    UT_SetDefaultReturnValue(UT_KEY(MM_ChildGetState), MM_CHILD_BUSY);
+
+    /* Execute the function being tested */
+    MM_SegmentBreak(MM_MAX_DUMP_DATA_SEG);
+    MM_SegmentBreak(MM_MAX_DUMP_DATA_SEG);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MM_AppData.SliceBytes, 2 * MM_MAX_DUMP_DATA_SEG);
+
+    /* Budget not used up, so neither wait nor delay */
+    UtAssert_STUB_COUNT(OS_BinSemTimedWait, 0);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+
+    /* The main task reads the command pipe itself while the child task runs */
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 0);
+}
+
+void MM_SegmentBreak_Test_PacedBudgetUsed(void)
+{
+    MM_AppData.WakeupSemaphore             = MM_UT_OBJID_1;
+    MM_AppData.Config.WakeupByteBudget     = 2 * MM_MAX_DUMP_DATA_SEG;
+    MM_AppData.WakeupCount                 = 5;
+    MM_AppData.SliceWakeupCount            = 5;
+    MM_AppData.SliceBytes                  = MM_MAX_DUMP_DATA_SEG;
+    UT_SetDefaultReturnValue(UT_KEY(MM_ChildGetState), MM_CHILD_BUSY);
+
+    UT_SetHookFunction(UT_KEY(OS_BinSemTimedWait), UT_MM_UTILS_TEST_WakeupHook, NULL);
+
+    /* Execute the function being tested */
+    MM_SegmentBreak(MM_MAX_DUMP_DATA_SEG);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_BinSemTimedWait, 1);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 0);
+
+    /* A new slice starts with the new wakeup */
+    UtAssert_UINT32_EQ(MM_AppData.SliceWakeupCount, 6);
+    UtAssert_UINT32_EQ(MM_AppData.SliceBytes, 0);
+
+    /* The count is read under the mutex before the wait and after it */
+    UtAssert_STUB_COUNT(MM_ChildLock, 2);
+    UtAssert_STUB_COUNT(MM_ChildUnlock, 2);
+}
+
+void MM_SegmentBreak_Test_PacedNewWakeup(void)
+{
+    MM_AppData.WakeupSemaphore             = MM_UT_OBJID_1;
+    MM_AppData.Config.WakeupByteBudget     = 2 * MM_MAX_DUMP_DATA_SEG;
+    MM_AppData.WakeupCount                 = 6;
+    MM_AppData.SliceWakeupCount            = 5;
+    MM_AppData.SliceBytes                  = MM_MAX_DUMP_DATA_SEG;
+    UT_SetDefaultReturnValue(UT_KEY(MM_ChildGetState), MM_CHILD_BUSY);
+
+    /* Execute the function being tested */
+    MM_SegmentBreak(MM_MAX_DUMP_DATA_SEG);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_BinSemTimedWait, 0);
+
+    /* Bytes from the previous wakeup are not charged to the new slice */
+    UtAssert_UINT32_EQ(MM_AppData.SliceWakeupCount, 6);
+    UtAssert_UINT32_EQ(MM_AppData.SliceBytes, MM_MAX_DUMP_DATA_SEG);
+}
+
+void MM_SegmentBreak_Test_PacedTimeout(void)
+{
+    MM_AppData.WakeupSemaphore             = MM_UT_OBJID_1;
+    MM_AppData.Config.WakeupByteBudget     = MM_MAX_DUMP_DATA_SEG;
+    MM_AppData.WakeupCount                 = 5;
+    MM_AppData.SliceWakeupCount            = 5;
+    UT_SetDefaultReturnValue(UT_KEY(MM_ChildGetState), MM_CHILD_BUSY);
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_BinSemTimedWait), OS_SEM_TIMEOUT);
+
+    /* Execute the function being tested */
+    MM_SegmentBreak(MM_MAX_DUMP_DATA_SEG);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_BinSemTimedWait, 1);
+
+    /* The operation carries on with a new slice when no wakeup arrives */
+    UtAssert_UINT32_EQ(MM_AppData.SliceWakeupCount, 5);
+    UtAssert_UINT32_EQ(MM_AppData.SliceBytes, 0);
+}
+
+void MM_SegmentBreak_Test_NotOnChildTask(void)
+{
+    MM_AppData.WakeupSemaphore             = MM_UT_OBJID_1;
+    MM_AppData.Config.WakeupByteBudget     = MM_MAX_DUMP_DATA_SEG;
+    UT_SetDefaultReturnValue(UT_KEY(MM_ChildGetState), MM_CHILD_DISABLED);
+
+    /* Execute the function being tested */
+    MM_SegmentBreak(MM_MAX_DUMP_DATA_SEG);
+
+    /* Verify results, the main task must never block waiting for a wakeup it processes itself */
+    UtAssert_STUB_COUNT(OS_BinSemTimedWait, 0);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 1);
+
+    /* The main task polls its command pipe during the break */
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 1);
+}
+
+void MM_SegmentPollCmds_Test_Hk(void)
+{
+    CFE_SB_Buffer_t *BufPtr = &UT_CmdBuf.Buf;
+    CFE_SB_MsgId_t   MsgId  = CFE_SB_ValueToMsgId(MM_SEND_HK_MID);
+
+    /* One message waiting, the pipe is empty after it */
+    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &BufPtr, sizeof(BufPtr), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 2, CFE_SB_NO_MESSAGE);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+
+    /* Execute the function being tested */
+    MM_SegmentPollCmds();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 2);
+    UtAssert_STUB_COUNT(MM_AppPipe, 1);
+    UtAssert_STUB_COUNT(MM_DeferCmd, 0);
+}
+
+void MM_SegmentPollCmds_Test_Wakeup(void)
+{
+    CFE_SB_Buffer_t *BufPtr = &UT_CmdBuf.Buf;
+    CFE_SB_MsgId_t   MsgId  = CFE_SB_ValueToMsgId(MM_WAKEUP_MID);
+
+    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &BufPtr, sizeof(BufPtr), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 2, CFE_SB_NO_MESSAGE);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+
+    /* Execute the function being tested */
+    MM_SegmentPollCmds();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(MM_AppPipe, 1);
+    UtAssert_STUB_COUNT(MM_DeferCmd, 0);
+}
+
+void MM_SegmentPollCmds_Test_Defer(void)
+{
+    CFE_SB_Buffer_t *BufPtr = &UT_CmdBuf.Buf;
+    CFE_SB_MsgId_t   MsgId  = CFE_SB_ValueToMsgId(MM_CMD_MID);
+
+    UT_SetDataBuffer(UT_KEY(CFE_SB_ReceiveBuffer), &BufPtr, sizeof(BufPtr), false);
+    UT_SetDeferredRetcode(UT_KEY(CFE_SB_ReceiveBuffer), 2, CFE_SB_NO_MESSAGE);
+    UT_SetDataBuffer(UT_KEY(CFE_MSG_GetMsgId), &MsgId, sizeof(MsgId), false);
+
+    /* Execute the function being tested */
+    MM_SegmentPollCmds();
+
+    /* Verify results, ground commands wait for the operation to complete */
+    UtAssert_STUB_COUNT(MM_AppPipe, 0);
+    UtAssert_STUB_COUNT(MM_DeferCmd, 1);
+}
+
+void MM_SegmentPollCmds_Test_PipeError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(CFE_SB_ReceiveBuffer), CFE_SB_NO_MESSAGE);
+
+    /* Execute the function being tested */
+    MM_SegmentPollCmds();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_SB_ReceiveBuffer, 1);
+    UtAssert_STUB_COUNT(MM_AppPipe, 0);
+    UtAssert_STUB_COUNT(MM_DeferCmd, 0);
+}
+
+void MM_SegmentMaxSize_Test(void)
+{
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(MM_SegmentMaxSize(MM_SEG_LOAD), MM_MAX_LOAD_DATA_SEG);
+    UtAssert_UINT32_EQ(MM_SegmentMaxSize(MM_SEG_DUMP), MM_MAX_DUMP_DATA_SEG);
+    UtAssert_UINT32_EQ(MM_SegmentMaxSize(MM_SEG_FILL), MM_MAX_FILL_DATA_SEG);
+    UtAssert_UINT32_EQ(MM_SegmentMaxSize(MM_SEG_COPY), MM_MAX_LOAD_DATA_SEG);
+    UtAssert_UINT32_EQ(MM_SegmentMaxSize(MM_SEG_CRC), MM_MAX_DUMP_DATA_SEG);
+    UtAssert_UINT32_EQ(MM_SegmentMaxSize(MM_SEG_NUM_TYPES), MM_MAX_FILL_DATA_SEG);
+}
+
+void MM_SegmentMaxSize_Test_Config(void)
+{
+    MM_AppData.Config.LoadDataSeg = 64;
+    MM_AppData.Config.DumpDataSeg = 0;
+    MM_AppData.Config.FillDataSeg = MM_MAX_FILL_DATA_SEG + 4;
+
+    /* Execute the function being tested, out of range table values fall back to the buffer size */
+    UtAssert_UINT32_EQ(MM_SegmentMaxSize(MM_SEG_LOAD), 64);
+    UtAssert_UINT32_EQ(MM_SegmentMaxSize(MM_SEG_COPY), 64);
+    UtAssert_UINT32_EQ(MM_SegmentMaxSize(MM_SEG_DUMP), MM_MAX_DUMP_DATA_SEG);
+    UtAssert_UINT32_EQ(MM_SegmentMaxSize(MM_SEG_CRC), MM_MAX_DUMP_DATA_SEG);
+    UtAssert_UINT32_EQ(MM_SegmentMaxSize(MM_SEG_FILL), MM_MAX_FILL_DATA_SEG);
+}
+
+void MM_SegmentStart_Test_Fixed(void)
+{
+    OS_time_t StartTime = OS_TimeFromTotalMicroseconds(1000);
+
+    MM_AppData.Config.SegmentTimeBudget = 0;
+    MM_AppData.SegmentSize[MM_SEG_DUMP] = 8;
+    MM_AppData.OpBytes                  = 100;
+    MM_AppData.OpSegments               = 5;
+    MM_AppData.OpBreakUsec              = 300;
+    MM_AppData.OpIoUsec                 = 400;
+
+    UT_SetDataBuffer(UT_KEY(OS_GetLocalTime), &StartTime, sizeof(StartTime), false);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(MM_SegmentStart(MM_SEG_DUMP), MM_MAX_DUMP_DATA_SEG);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MM_AppData.SegmentSize[MM_SEG_DUMP], MM_MAX_DUMP_DATA_SEG);
+    UtAssert_UINT32_EQ(MM_AppData.SegmentType, MM_SEG_DUMP);
+    UtAssert_UINT32_EQ(MM_AppData.OpBytes, 0);
+    UtAssert_UINT32_EQ(MM_AppData.OpSegments, 1);
+    UtAssert_INT32_EQ(MM_AppData.OpBreakUsec, 0);
+    UtAssert_INT32_EQ(MM_AppData.OpIoUsec, 0);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMicroseconds(MM_AppData.OpStartTime), 1000);
+    UtAssert_INT32_EQ(OS_TimeGetTotalMicroseconds(MM_AppData.SegmentStartTime), 1000);
+}
+
+void MM_SegmentStart_Test_Adaptive(void)
+{
+    MM_AppData.Config.SegmentTimeBudget = 100;
+    MM_AppData.SegmentSize[MM_SEG_LOAD] = 8;
+
+    /* Execute the function being tested, the size carries over from the last load */
+    UtAssert_UINT32_EQ(MM_SegmentStart(MM_SEG_LOAD), 8);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MM_AppData.SegmentType, MM_SEG_LOAD);
+}
+
+void MM_SegmentStart_Test_AdaptiveOutOfRange(void)
+{
+    MM_AppData.Config.SegmentTimeBudget = 100;
+    MM_AppData.SegmentSize[MM_SEG_FILL] = MM_MAX_FILL_DATA_SEG + MM_MIN_DATA_SEG;
+    MM_AppData.SegmentSize[MM_SEG_LOAD] = 0;
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(MM_SegmentStart(MM_SEG_FILL), MM_MAX_FILL_DATA_SEG);
+    UtAssert_UINT32_EQ(MM_SegmentStart(MM_SEG_LOAD), MM_MAX_LOAD_DATA_SEG);
+
+    /* An unknown type is treated as a fill */
+    UtAssert_UINT32_EQ(MM_SegmentStart(MM_SEG_NUM_TYPES), MM_MAX_FILL_DATA_SEG);
+    UtAssert_UINT32_EQ(MM_AppData.SegmentType, MM_SEG_FILL);
+}
+
+void MM_SegmentAdapt_Test_Shrink(void)
+{
+    MM_AppData.Config.SegmentTimeBudget = 100;
+    MM_AppData.SegmentType              = MM_SEG_LOAD;
+    MM_AppData.SegmentSize[MM_SEG_LOAD] = 200;
+
+    /* Execute the function being tested, four times over budget */
+    MM_SegmentAdapt(200, 400);
+
+    /* Verify results, half way from 200 to 50 and rounded down to a multiple of 4 */
+    UtAssert_UINT32_EQ(MM_AppData.SegmentSize[MM_SEG_LOAD], 124);
+}
+
+void MM_SegmentAdapt_Test_Grow(void)
+{
+    MM_AppData.Config.SegmentTimeBudget = 100;
+    MM_AppData.SegmentType              = MM_SEG_DUMP;
+    MM_AppData.SegmentSize[MM_SEG_DUMP] = 40;
+
+    /* Execute the function being tested, twice as fast as needed */
+    MM_SegmentAdapt(40, 50);
+
+    /* Verify results, half way from 40 to 80 */
+    UtAssert_UINT32_EQ(MM_AppData.SegmentSize[MM_SEG_DUMP], 60);
+
+    /* Far under budget, growth is limited to a factor of two */
+    MM_SegmentAdapt(60, 1);
+    UtAssert_UINT32_EQ(MM_AppData.SegmentSize[MM_SEG_DUMP], 120);
+
+    /* Too fast to measure, growth is limited by the buffer size */
+    MM_SegmentAdapt(120, 0);
+    UtAssert_UINT32_EQ(MM_AppData.SegmentSize[MM_SEG_DUMP], MM_MAX_DUMP_DATA_SEG);
+}
+
+void MM_SegmentAdapt_Test_Minimum(void)
+{
+    MM_AppData.Config.SegmentTimeBudget = 1;
+    MM_AppData.SegmentType              = MM_SEG_FILL;
+    MM_AppData.SegmentSize[MM_SEG_FILL] = MM_MIN_DATA_SEG;
+
+    /* Execute the function being tested */
+    MM_SegmentAdapt(MM_MIN_DATA_SEG, 1000000);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MM_AppData.SegmentSize[MM_SEG_FILL], MM_MIN_DATA_SEG);
+}
+
+void MM_SegmentAdapt_Test_PartialSegment(void)
+{
+    MM_AppData.Config.SegmentTimeBudget = 100;
+    MM_AppData.SegmentType              = MM_SEG_LOAD;
+    MM_AppData.SegmentSize[MM_SEG_LOAD] = 200;
+
+    /* Execute the function being tested */
+    MM_SegmentAdapt(20, 1000);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MM_AppData.SegmentSize[MM_SEG_LOAD], 200);
+}
+
+void MM_SegmentBreak_Test_Adaptive(void)
+{
+    /* Segment end, then the end of the segment break */
+    OS_time_t Times[2];
+
+    Times[0] = OS_TimeFromTotalMicroseconds(1400);
+    Times[1] = OS_TimeFromTotalMicroseconds(1500);
+
+    MM_AppData.Config.SegmentTimeBudget = 100;
+    MM_AppData.SegmentType              = MM_SEG_LOAD;
+    MM_AppData.SegmentSize[MM_SEG_LOAD] = 200;
+    MM_AppData.OpStartTime              = OS_TimeFromTotalMicroseconds(1000);
+    MM_AppData.SegmentStartTime         = OS_TimeFromTotalMicroseconds(1000);
+    MM_AppData.OpSegments               = 1;
+    MM_AppData.OpBreakUsec              = 0;
+
+    UT_SetDataBuffer(UT_KEY(OS_GetLocalTime), Times, sizeof(Times), false);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(MM_SegmentBreak(200), 124);
+
+    /* Verify results, 200 bytes in 400 usec */
+    UtAssert_UINT32_EQ(MM_AppData.SegmentSize[MM_SEG_LOAD], 124);
+    UtAssert_UINT32_EQ(MM_AppData.OpBytes, 200);
+    UtAssert_UINT32_EQ(MM_AppData.Throughput, 500000);
+
+    /* The next segment is timed from the end of the break */
+    UtAssert_INT32_EQ(OS_TimeGetTotalMicroseconds(MM_AppData.SegmentStartTime), 1500);
+
+    /* The break is counted for the statistics */
+    UtAssert_UINT32_EQ(MM_AppData.OpSegments, 2);
+    UtAssert_INT32_EQ(MM_AppData.OpBreakUsec, 100);
+}
+
+void MM_SegmentBreak_Test_FixedThroughput(void)
+{
+    OS_time_t Now = OS_TimeFromTotalMicroseconds(2000);
+
+    MM_AppData.Config.SegmentTimeBudget = 0;
+    MM_AppData.SegmentType              = MM_SEG_DUMP;
+    MM_AppData.SegmentSize[MM_SEG_DUMP] = MM_MAX_DUMP_DATA_SEG;
+    MM_AppData.OpBytes                  = 800;
+    MM_AppData.OpStartTime              = OS_TimeFromTotalMicroseconds(1000);
+    MM_AppData.SegmentStartTime         = OS_TimeFromTotalMicroseconds(1900);
+
+    UT_SetDataBuffer(UT_KEY(OS_GetLocalTime), &Now, sizeof(Now), false);
+
+    /* Execute the function being tested */
+    UtAssert_UINT32_EQ(MM_SegmentBreak(200), MM_MAX_DUMP_DATA_SEG);
+
+    /* Verify results, 1000 bytes in 1000 usec and the size is left alone */
+    UtAssert_UINT32_EQ(MM_AppData.SegmentSize[MM_SEG_DUMP], MM_MAX_DUMP_DATA_SEG);
+    UtAssert_UINT32_EQ(MM_AppData.Throughput, 1000000);
+}
+
+void MM_SegmentIo_Test(void)
+{
+    /* Start and end of the file read or write */
+    OS_time_t Times[2];
+
+    Times[0] = OS_TimeFromTotalMicroseconds(1000);
+    Times[1] = OS_TimeFromTotalMicroseconds(1250);
+
+    MM_AppData.OpIoUsec = 10;
+
+    UT_SetDataBuffer(UT_KEY(OS_GetLocalTime), Times, sizeof(Times), false);
+
+    /* Execute the function being tested */
+    MM_SegmentIoStart();
+    MM_SegmentIoEnd();
+
+    /* Verify results */
+    UtAssert_INT32_EQ(MM_AppData.OpIoUsec, 260);
+    UtAssert_STUB_COUNT(CFE_ES_PerfLogAdd, 2);
+}
+
+void MM_SegmentEnd_Test_FirstOp(void)
+{
+    OS_time_t     Now   = OS_TimeFromTotalMicroseconds(3000);
+    MM_OpStats_t *Stats = &MM_AppData.StatsPacket.Payload.LoadFromFile;
+
+    MM_ResetStats();
+
+    MM_AppData.SegmentType = MM_SEG_LOAD;
+    MM_AppData.OpStartTime = OS_TimeFromTotalMicroseconds(1000);
+    MM_AppData.OpSegments  = 3;
+    MM_AppData.OpBreakUsec = 500;
+    MM_AppData.OpIoUsec    = 700;
+
+    UT_SetDataBuffer(UT_KEY(OS_GetLocalTime), &Now, sizeof(Now), false);
+
+    /* Execute the function being tested */
+    MM_SegmentEnd(4000);
+
+    /* Verify results, 4000 bytes in 2000 usec */
+    UtAssert_UINT32_EQ(MM_AppData.Throughput, 2000000);
+    UtAssert_UINT32_EQ(Stats->CommandCode, MM_LOAD_MEM_FROM_FILE_CC);
+    UtAssert_UINT32_EQ(Stats->OpCount, 1);
+    UtAssert_UINT32_EQ(Stats->LastBytes, 4000);
+    UtAssert_UINT32_EQ(Stats->LastDuration, 2000);
+    UtAssert_UINT32_EQ(Stats->LastSegments, 3);
+    UtAssert_UINT32_EQ(Stats->LastBreakTime, 500);
+    UtAssert_UINT32_EQ(Stats->LastIoTime, 700);
+    UtAssert_UINT32_EQ(Stats->LastCopyTime, 800);
+    UtAssert_UINT32_EQ(Stats->LastThroughput, 2000000);
+    UtAssert_UINT32_EQ(Stats->MinDuration, 2000);
+    UtAssert_UINT32_EQ(Stats->MaxDuration, 2000);
+    UtAssert_UINT32_EQ(Stats->MeanDuration, 2000);
+    UtAssert_UINT32_EQ(Stats->MinThroughput, 2000000);
+    UtAssert_UINT32_EQ(Stats->MaxThroughput, 2000000);
+    UtAssert_UINT32_EQ(Stats->MeanThroughput, 2000000);
+
+    /* Other operation types are left alone */
+    UtAssert_UINT32_EQ(MM_AppData.StatsPacket.Payload.DumpToFile.OpCount, 0);
+    UtAssert_UINT32_EQ(MM_AppData.StatsPacket.Payload.Fill.OpCount, 0);
+    UtAssert_UINT32_EQ(MM_AppData.StatsPacket.Payload.Copy.OpCount, 0);
+    UtAssert_UINT32_EQ(MM_AppData.StatsPacket.Payload.Crc.OpCount, 0);
+
+    /* Once for the reset above and once for the update */
+    UtAssert_STUB_COUNT(MM_ChildLock, 2);
+    UtAssert_STUB_COUNT(MM_ChildUnlock, 2);
+}
+
+void MM_SegmentEnd_Test_Copy(void)
+{
+    MM_ResetStats();
+
+    MM_AppData.SegmentType = MM_SEG_COPY;
+
+    /* Execute the function being tested */
+    MM_SegmentEnd(100);
+
+    /* Verify results, a copy has its own statistics */
+    UtAssert_UINT32_EQ(MM_AppData.StatsPacket.Payload.Copy.OpCount, 1);
+    UtAssert_UINT32_EQ(MM_AppData.StatsPacket.Payload.Copy.LastBytes, 100);
+    UtAssert_UINT32_EQ(MM_AppData.StatsPacket.Payload.LoadFromFile.OpCount, 0);
+}
+
+void MM_SegmentEnd_Test_Crc(void)
+{
+    MM_ResetStats();
+
+    MM_AppData.SegmentType = MM_SEG_CRC;
+
+    /* Execute the function being tested */
+    MM_SegmentEnd(100);
+
+    /* Verify results, a CRC has its own statistics */
+    UtAssert_UINT32_EQ(MM_AppData.StatsPacket.Payload.Crc.OpCount, 1);
+    UtAssert_UINT32_EQ(MM_AppData.StatsPacket.Payload.Crc.LastBytes, 100);
+    UtAssert_UINT32_EQ(MM_AppData.StatsPacket.Payload.DumpToFile.OpCount, 0);
+}
+
+void MM_SegmentEnd_Test_RunningStats(void)
+{
+    OS_time_t     Now   = OS_TimeFromTotalMicroseconds(4000);
+    MM_OpStats_t *Stats = &MM_AppData.StatsPacket.Payload.Fill;
+
+    Stats->OpCount        = 1;
+    Stats->MinDuration    = 1000;
+    Stats->MaxDuration    = 1000;
+    Stats->MeanDuration   = 1000;
+    Stats->MinThroughput  = 1000;
+    Stats->MaxThroughput  = 1000;
+    Stats->MeanThroughput = 1000;
+
+    MM_AppData.SegmentType = MM_SEG_FILL;
+    MM_AppData.OpStartTime = OS_TimeFromTotalMicroseconds(1000);
+    MM_AppData.OpSegments  = 1;
+    MM_AppData.OpBreakUsec = 0;
+    MM_AppData.OpIoUsec    = 0;
+
+    UT_SetDataBuffer(UT_KEY(OS_GetLocalTime), &Now, sizeof(Now), false);
+
+    /* Execute the function being tested */
+    MM_SegmentEnd(6);
+
+    /* Verify results, 6 bytes in 3000 usec */
+    UtAssert_UINT32_EQ(Stats->OpCount, 2);
+    UtAssert_UINT32_EQ(Stats->LastThroughput, 2000);
+    UtAssert_UINT32_EQ(Stats->LastCopyTime, 3000);
+    UtAssert_UINT32_EQ(Stats->MinDuration, 1000);
+    UtAssert_UINT32_EQ(Stats->MaxDuration, 3000);
+    UtAssert_UINT32_EQ(Stats->MeanDuration, 2000);
+    UtAssert_UINT32_EQ(Stats->MinThroughput, 1000);
+    UtAssert_UINT32_EQ(Stats->MaxThroughput, 2000);
+    UtAssert_UINT32_EQ(Stats->MeanThroughput, 1500);
+}
+
+void MM_SegmentEnd_Test_Clamped(void)
+{
+    OS_time_t     Now   = OS_TimeFromTotalMicroseconds(1000);
+    MM_OpStats_t *Stats = &MM_AppData.StatsPacket.Payload.DumpToFile;
+
+    MM_ResetStats();
+
+    /* Faster than the clock can measure, with times that don't add up */
+    MM_AppData.SegmentType = MM_SEG_DUMP;
+    MM_AppData.OpStartTime = OS_TimeFromTotalMicroseconds(1000);
+    MM_AppData.OpSegments  = 1;
+    MM_AppData.OpBreakUsec = 5;
+    MM_AppData.OpIoUsec    = 5;
+
+    UT_SetDataBuffer(UT_KEY(OS_GetLocalTime), &Now, sizeof(Now), false);
+
+    /* Execute the function being tested */
+    MM_SegmentEnd(8);
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(Stats->LastDuration, 0);
+    UtAssert_UINT32_EQ(Stats->LastBreakTime, 0);
+    UtAssert_UINT32_EQ(Stats->LastIoTime, 0);
+    UtAssert_UINT32_EQ(Stats->LastCopyTime, 0);
+    UtAssert_UINT32_EQ(Stats->LastThroughput, 8000000);
+}
+
+void MM_SegmentMulti_Test_Nominal(void)
+{
+    MM_OpStats_t *Stats = &MM_AppData.StatsPacket.Payload.DumpToFile;
+
+    MM_ResetStats();
+
+    MM_AppData.Config.SegmentTimeBudget = 0;
+
+    /* Execute the functions being tested, two regions of one segment each */
+    MM_SegmentMultiStart(MM_SEG_DUMP);
+    UtAssert_BOOL_TRUE(MM_AppData.OpMultiRegion);
+
+    UtAssert_UINT32_EQ(MM_SegmentStart(MM_SEG_DUMP), MM_MAX_DUMP_DATA_SEG);
+    MM_SegmentEnd(100);
+    UtAssert_UINT32_EQ(MM_SegmentStart(MM_SEG_DUMP), MM_MAX_DUMP_DATA_SEG);
+    MM_SegmentEnd(200);
+
+    /* The regions are not recorded on their own */
+    UtAssert_UINT32_EQ(Stats->OpCount, 0);
+
+    MM_SegmentMultiEnd(true, 300);
+
+    /* Verify results, recorded once for the whole operation */
+    UtAssert_BOOL_FALSE(MM_AppData.OpMultiRegion);
+    UtAssert_UINT32_EQ(Stats->OpCount, 1);
+    UtAssert_UINT32_EQ(Stats->LastBytes, 300);
+    UtAssert_UINT32_EQ(Stats->LastSegments, 2);
+}
+
+void MM_SegmentMulti_Test_RegionFailed(void)
+{
+    MM_ResetStats();
+
+    /* Execute the functions being tested */
+    MM_SegmentMultiStart(MM_SEG_LOAD);
+    MM_SegmentStart(MM_SEG_LOAD);
+    MM_SegmentMultiEnd(false, 100);
+
+    /* Verify results, nothing is recorded and the next operation stands alone */
+    UtAssert_BOOL_FALSE(MM_AppData.OpMultiRegion);
+    UtAssert_UINT32_EQ(MM_AppData.StatsPacket.Payload.LoadFromFile.OpCount, 0);
+
+    MM_SegmentStart(MM_SEG_LOAD);
+    MM_SegmentEnd(100);
+
+    UtAssert_UINT32_EQ(MM_AppData.StatsPacket.Payload.LoadFromFile.OpCount, 1);
+    UtAssert_UINT32_EQ(MM_AppData.StatsPacket.Payload.LoadFromFile.LastSegments, 1);
+}
+
+void MM_ResetStats_Test(void)
+{
+    memset(&MM_AppData.StatsPacket.Payload, 1, sizeof(MM_AppData.StatsPacket.Payload));
+
+    /* Execute the function being tested */
+    MM_ResetStats();
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MM_AppData.StatsPacket.Payload.LoadFromFile.CommandCode, MM_LOAD_MEM_FROM_FILE_CC);
+    UtAssert_UINT32_EQ(MM_AppData.StatsPacket.Payload.DumpToFile.CommandCode, MM_DUMP_MEM_TO_FILE_CC);
+    UtAssert_UINT32_EQ(MM_AppData.StatsPacket.Payload.Fill.CommandCode, MM_FILL_MEM_CC);
+    UtAssert_UINT32_EQ(MM_AppData.StatsPacket.Payload.Copy.CommandCode, MM_COPY_MEM_CC);
+    UtAssert_UINT32_EQ(MM_AppData.StatsPacket.Payload.Crc.CommandCode, MM_CRC_MEM_CC);
+    UtAssert_UINT32_EQ(MM_AppData.StatsPacket.Payload.LoadFromFile.OpCount, 0);
+    UtAssert_UINT32_EQ(MM_AppData.StatsPacket.Payload.DumpToFile.MaxDuration, 0);
+    UtAssert_UINT32_EQ(MM_AppData.StatsPacket.Payload.Fill.MeanThroughput, 0);
+
+    UtAssert_STUB_COUNT(MM_ChildLock, 1);
+    UtAssert_STUB_COUNT(MM_ChildUnlock, 1);
+}
+
 void MM_VerifyPeekPokeParams_Test_ByteWidthRAM(void)
 {
     bool         Result;
@@ -447,7 +1059,7 @@ void MM_VerifyPeekPokeParams_Test_RAMValidateRangeError(void)
     char         ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "CFE_PSP_MemValidateRange error received: RC = 0x%%08X Addr = %%p Size = %%u MemType = MEM_RAM");
+             "CFE_PSP_MemValidateRange error received: RC = 0x%%08X Addr = %%p Size = %%u MemType = %%s");
 
     /* Set to generate error message MM_OS_MEMVALIDATE_ERR_EID */
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemValidateRange), 1, -1);
@@ -485,7 +1097,7 @@ void MM_VerifyPeekPokeParams_Test_EEPROMValidateRangeError(void)
     char         ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "CFE_PSP_MemValidateRange error received: RC = 0x%%08X Addr = %%p Size = %%u MemType = MEM_EEPROM");
+             "CFE_PSP_MemValidateRange error received: RC = 0x%%08X Addr = %%p Size = %%u MemType = %%s");
 
     /* Set to generate error message MM_OS_MEMVALIDATE_ERR_EID */
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemValidateRange), 1, -1);
@@ -523,7 +1135,7 @@ void MM_VerifyPeekPokeParams_Test_MEM32ValidateRangeError(void)
     char         ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "CFE_PSP_MemValidateRange error received: RC = 0x%%08X Addr = %%p Size = %%u MemType = MEM32");
+             "CFE_PSP_MemValidateRange error received: RC = 0x%%08X Addr = %%p Size = %%u MemType = %%s");
 
     /* Set to generate error message MM_OS_MEMVALIDATE_ERR_EID */
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemValidateRange), 1, -1);
@@ -561,7 +1173,7 @@ void MM_VerifyPeekPokeParams_Test_MEM16ValidateRangeError(void)
     char         ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "CFE_PSP_MemValidateRange error received: RC = 0x%%08X Addr = %%p Size = %%u MemType = MEM16");
+             "CFE_PSP_MemValidateRange error received: RC = 0x%%08X Addr = %%p Size = %%u MemType = %%s");
 
     /* Set to generate error message MM_OS_MEMVALIDATE_ERR_EID */
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemValidateRange), 1, -1);
@@ -599,7 +1211,7 @@ void MM_VerifyPeekPokeParams_Test_MEM8ValidateRangeError(void)
     char         ExpectedEventString[CFE_MISSION_EVS_MAX_MESSAGE_LENGTH];
 
     snprintf(ExpectedEventString, CFE_MISSION_EVS_MAX_MESSAGE_LENGTH,
-             "CFE_PSP_MemValidateRange error received: RC = 0x%%08X Addr = %%p Size = %%u MemType = MEM8");
+             "CFE_PSP_MemValidateRange error received: RC = 0x%%08X Addr = %%p Size = %%u MemType = %%s");
 
     /* Set to generate error message MM_OS_MEMVALIDATE_ERR_EID */
     UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemValidateRange), 1, -1);
@@ -873,6 +1485,56 @@ void MM_VerifyLoadDumpParams_Test_LoadRAMDataSizeErrorTooLarge(void)
     UtAssert_INT32_EQ(MM_AppData.HkPacket.Payload.ErrCounter, 0);
 }
 
+void MM_VerifyLoadDumpParams_Test_LoadRAMConfigLimit(void)
+{
+    bool         Result;
+    uint32       Address     = 0;
+    MM_MemType_t MemType     = MM_RAM;
+    size_t       SizeInBytes = 101;
+
+    MM_AppData.Config.Ram.MaxLoadFileData = 100;
+
+    /* Execute the function being tested */
+    Result = MM_VerifyLoadDumpParams(Address, MemType, SizeInBytes, MM_VERIFY_LOAD);
+
+    /* Verify results */
+    UtAssert_True(Result == false, "Result == false");
+
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_DATA_SIZE_BYTES_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    call_count_CFE_EVS_SendEvent = UT_GetStubCount(UT_KEY(CFE_EVS_SendEvent));
+    UtAssert_True(call_count_CFE_EVS_SendEvent == 1, "CFE_EVS_SendEvent was called %u time(s), expected 1",
+                  call_count_CFE_EVS_SendEvent);
+}
+
+void MM_VerifyLoadDumpParams_Test_MissionMemType(void)
+{
+    MM_MemTypeLimits_t        Limits = {8, 8, 8};
+    MM_MemTypeDriver_t        Driver = {"FPGA", CFE_PSP_MEM_RAM, 4, &Limits, NULL, NULL, NULL, NULL, NULL};
+    const MM_MemTypeDriver_t *DriverPtr = &Driver;
+    MM_MemType_t              MemType   = (MM_MemType_t)(MM_MEM32 + 1);
+
+    UT_SetDataBuffer(UT_KEY(MM_MemTypeGet), &DriverPtr, sizeof(DriverPtr), false);
+
+    /* Within the limits of the registered driver */
+    UtAssert_BOOL_TRUE(MM_VerifyLoadDumpParams(0, MemType, 8, MM_VERIFY_LOAD));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    /* Over the limits of the registered driver */
+    UtAssert_BOOL_FALSE(MM_VerifyLoadDumpParams(0, MemType, 12, MM_VERIFY_FILL));
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_DATA_SIZE_BYTES_ERR_EID);
+
+    /* Peeks and pokes must use the access width of the driver */
+    UtAssert_BOOL_FALSE(MM_VerifyPeekPokeParams(0, MemType, MM_WORD_BIT_WIDTH));
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, MM_DATA_SIZE_BITS_ERR_EID);
+
+    /* Not registered */
+    UT_ResetState(UT_KEY(MM_MemTypeGet));
+    UtAssert_BOOL_FALSE(MM_VerifyLoadDumpParams(0, MemType, 8, MM_VERIFY_LOAD));
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, MM_MEMTYPE_ERR_EID);
+}
+
 void MM_VerifyLoadDumpParams_Test_LoadEEPROMValidateRangeError(void)
 {
     bool         Result;
@@ -3529,6 +4191,454 @@ void MM_ResolveSymAddr_Test(void)
 
     /* Verify results */
     UtAssert_True(Result == false, "Result == false");
+
+    /* Every call is bracketed by a performance log entry and exit */
+    UtAssert_STUB_COUNT(CFE_ES_PerfLogAdd, 6);
+}
+
+void MM_ResolveSymAddr_Test_CacheHit(void)
+{
+    MM_SymAddr_t SymAddr;
+    cpuaddr      SymbolAddr   = 0x1000;
+    cpuaddr      ResolvedAddr = 0;
+
+    memset(&SymAddr, 0, sizeof(SymAddr));
+    strncpy(SymAddr.SymName, "symname", sizeof(SymAddr.SymName) - 1);
+    SymAddr.Offset = 4;
+
+    MM_AppData.SymCacheMutex = MM_UT_OBJID_1;
+
+    UT_SetDataBuffer(UT_KEY(OS_SymbolLookup), &SymbolAddr, sizeof(SymbolAddr), false);
+
+    /* Execute the function being tested, the second time the symbol comes from the cache */
+    UtAssert_BOOL_TRUE(MM_ResolveSymAddr(&SymAddr, &ResolvedAddr));
+    UtAssert_UINT32_EQ(ResolvedAddr, 0x1004);
+
+    ResolvedAddr = 0;
+    UtAssert_BOOL_TRUE(MM_ResolveSymAddr(&SymAddr, &ResolvedAddr));
+    UtAssert_UINT32_EQ(ResolvedAddr, 0x1004);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_SymbolLookup, 1);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.SymCacheHits, 1);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.SymCacheMisses, 1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 3);
+    UtAssert_STUB_COUNT(OS_MutSemGive, 3);
+}
+
+void MM_ResolveSymAddr_Test_CacheNotFound(void)
+{
+    MM_SymAddr_t SymAddr;
+    cpuaddr      ResolvedAddr = 0;
+
+    memset(&SymAddr, 0, sizeof(SymAddr));
+    strncpy(SymAddr.SymName, "symname", sizeof(SymAddr.SymName) - 1);
+
+    MM_AppData.SymCacheMutex = MM_UT_OBJID_1;
+
+    UT_SetDefaultReturnValue(UT_KEY(OS_SymbolLookup), OS_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_ResolveSymAddr(&SymAddr, &ResolvedAddr));
+    UtAssert_BOOL_FALSE(MM_ResolveSymAddr(&SymAddr, &ResolvedAddr));
+
+    /* Verify results, a symbol that can't be resolved is never cached */
+    UtAssert_STUB_COUNT(OS_SymbolLookup, 2);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.SymCacheHits, 0);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.SymCacheMisses, 2);
+    UtAssert_STRINGBUF_EQ(MM_AppData.SymCache[MM_SymCacheHash("symname")].SymName, OS_MAX_SYM_LEN, "", 1);
+}
+
+void MM_ResolveSymAddr_Test_CacheDisabled(void)
+{
+    MM_SymAddr_t SymAddr;
+    cpuaddr      ResolvedAddr = 0;
+
+    memset(&SymAddr, 0, sizeof(SymAddr));
+    strncpy(SymAddr.SymName, "symname", sizeof(SymAddr.SymName) - 1);
+
+    MM_AppData.SymCacheMutex = OS_OBJECT_ID_UNDEFINED;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_ResolveSymAddr(&SymAddr, &ResolvedAddr));
+    UtAssert_BOOL_TRUE(MM_ResolveSymAddr(&SymAddr, &ResolvedAddr));
+
+    /* Verify results, without the mutex every symbol goes to the OSAL */
+    UtAssert_STUB_COUNT(OS_SymbolLookup, 2);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.SymCacheMisses, 0);
+}
+
+void MM_SymCacheInit_Test_Nominal(void)
+{
+    strncpy(MM_AppData.SymCache[0].SymName, "symname", OS_MAX_SYM_LEN - 1);
+    MM_AppData.SymCacheGeneration = 3;
+
+    /* Execute the function being tested */
+    MM_SymCacheInit();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_MutSemCreate, 1);
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(MM_AppData.SymCacheMutex));
+    UtAssert_STRINGBUF_EQ(MM_AppData.SymCache[0].SymName, OS_MAX_SYM_LEN, "", 1);
+    UtAssert_UINT32_EQ(MM_AppData.SymCacheGeneration, 0);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_SymCacheInit_Test_MutexError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(OS_MutSemCreate), OS_ERROR);
+
+    /* Execute the function being tested */
+    MM_SymCacheInit();
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(MM_AppData.SymCacheMutex));
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_SYM_CACHE_INIT_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_SymCacheHash_Test(void)
+{
+    char   SymName[OS_MAX_SYM_LEN];
+    uint32 Index;
+
+    /* A name that fills the whole buffer without a terminator is still hashed in bounds */
+    memset(SymName, 'a', sizeof(SymName));
+
+    /* Execute the function being tested */
+    Index = MM_SymCacheHash(SymName);
+
+    /* Verify results */
+    UtAssert_True(Index < MM_SYM_CACHE_ENTRIES, "Index < MM_SYM_CACHE_ENTRIES");
+    UtAssert_UINT32_EQ(MM_SymCacheHash("symname"), MM_SymCacheHash("symname"));
+}
+
+void MM_SymCacheAdd_Test_Replace(void)
+{
+    char    SymName[OS_MAX_SYM_LEN];
+    cpuaddr Address    = 0;
+    uint32  Generation = 0;
+    uint32  i;
+
+    MM_AppData.SymCacheMutex = MM_UT_OBJID_1;
+
+    /* Find another name that maps to the same entry as "symname" */
+    for (i = 0; i < 100000; i++)
+    {
+        snprintf(SymName, sizeof(SymName), "sym%u", (unsigned int)i);
+        if (MM_SymCacheHash(SymName) == MM_SymCacheHash("symname"))
+        {
+            break;
+        }
+    }
+
+    UtAssert_True(i < 100000, "Colliding symbol name found");
+
+    /* Execute the function being tested */
+    MM_SymCacheAdd("symname", 0x1000, 0);
+    MM_SymCacheAdd(SymName, 0x2000, 0);
+
+    /* Verify results, the newer symbol replaces the older one */
+    UtAssert_BOOL_FALSE(MM_SymCacheLookup("symname", &Address, &Generation));
+    UtAssert_BOOL_TRUE(MM_SymCacheLookup(SymName, &Address, &Generation));
+    UtAssert_UINT32_EQ(Address, 0x2000);
+}
+
+void MM_SymCacheAdd_Test_Flushed(void)
+{
+    cpuaddr Address    = 0;
+    uint32  Generation = 0;
+
+    MM_AppData.SymCacheMutex = MM_UT_OBJID_1;
+
+    UtAssert_BOOL_FALSE(MM_SymCacheLookup("symname", &Address, &Generation));
+
+    /* The cache is flushed while the symbol is being looked up */
+    MM_SymCacheFlush();
+
+    /* Execute the function being tested */
+    MM_SymCacheAdd("symname", 0x1000, Generation);
+
+    /* Verify results, the possibly stale address is not remembered */
+    UtAssert_BOOL_FALSE(MM_SymCacheLookup("symname", &Address, &Generation));
+    UtAssert_UINT32_EQ(MM_AppData.SymCacheGeneration, 1);
+}
+
+void MM_SymCacheFlush_Test(void)
+{
+    cpuaddr Address    = 0;
+    uint32  Generation = 0;
+
+    MM_AppData.SymCacheMutex = MM_UT_OBJID_1;
+
+    MM_SymCacheAdd("symname", 0x1000, 0);
+    UtAssert_BOOL_TRUE(MM_SymCacheLookup("symname", &Address, &Generation));
+
+    /* Execute the function being tested */
+    MM_SymCacheFlush();
+
+    /* Verify results, the counters are kept */
+    UtAssert_BOOL_FALSE(MM_SymCacheLookup("symname", &Address, &Generation));
+    UtAssert_UINT32_EQ(Generation, 1);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.SymCacheHits, 1);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.SymCacheMisses, 1);
+}
+
+void MM_SymCacheFlush_Test_Disabled(void)
+{
+    MM_AppData.SymCacheMutex = OS_OBJECT_ID_UNDEFINED;
+
+    /* Execute the function being tested */
+    MM_SymCacheFlush();
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    UtAssert_UINT32_EQ(MM_AppData.SymCacheGeneration, 0);
+}
+
+/* PSP memory table returned through CFE_PSP_MemRangeGet by UT_MM_UTILS_TEST_MemRangeGetHook */
+typedef struct
+{
+    uint32  MemoryType;
+    cpuaddr StartAddr;
+    size_t  Size;
+} UT_MM_UTILS_TEST_MemRange_t;
+
+UT_MM_UTILS_TEST_MemRange_t UT_MM_UTILS_TEST_MemTable[] = {
+    {CFE_PSP_MEM_RAM, 0x1000, 0x1000},   {CFE_PSP_MEM_RAM, 0x1100, 0x10},   {CFE_PSP_MEM_EEPROM, 0x8000, 0x100},
+    {CFE_PSP_MEM_INVALID, 0x9000, 0x100}, {CFE_PSP_MEM_RAM, 0x0400, 0x100}, {CFE_PSP_MEM_RAM, 0x3000, 0}};
+
+int32 UT_MM_UTILS_TEST_MemRangeGetHook(void *UserObj, int32 StubRetcode, uint32 CallCount,
+                                       const UT_StubContext_t *Context)
+{
+    uint32   RangeNum   = UT_Hook_GetArgValueByName(Context, "RangeNum", uint32);
+    uint32  *MemoryType = UT_Hook_GetArgValueByName(Context, "MemoryType", uint32 *);
+    cpuaddr *StartAddr  = UT_Hook_GetArgValueByName(Context, "StartAddr", cpuaddr *);
+    size_t  *Size       = UT_Hook_GetArgValueByName(Context, "Size", size_t *);
+
+    /* Past the end of the table every range is another small RAM range */
+    if (RangeNum < (sizeof(UT_MM_UTILS_TEST_MemTable) / sizeof(UT_MM_UTILS_TEST_MemTable[0])))
+    {
+        *MemoryType = UT_MM_UTILS_TEST_MemTable[RangeNum].MemoryType;
+        *StartAddr  = UT_MM_UTILS_TEST_MemTable[RangeNum].StartAddr;
+        *Size       = UT_MM_UTILS_TEST_MemTable[RangeNum].Size;
+    }
+    else
+    {
+        *MemoryType = CFE_PSP_MEM_RAM;
+        *StartAddr  = 0x10000 + (RangeNum * 0x100);
+        *Size       = 0x100;
+    }
+
+    return StubRetcode;
+}
+
+void UT_MM_UTILS_TEST_SetupMemRanges(uint32 NumRanges)
+{
+    UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_MemRanges), NumRanges);
+    UT_SetHookFunction(UT_KEY(CFE_PSP_MemRangeGet), UT_MM_UTILS_TEST_MemRangeGetHook, NULL);
+}
+
+void MM_MemRangeInit_Test_Nominal(void)
+{
+    UT_MM_UTILS_TEST_SetupMemRanges(6);
+
+    /* Execute the function being tested */
+    MM_MemRangeInit();
+
+    /* Verify results, the map is sorted and other memory types and empty ranges are left out */
+    UtAssert_STUB_COUNT(OS_MutSemCreate, 1);
+    UtAssert_BOOL_TRUE(OS_ObjectIdDefined(MM_AppData.MemRangeMutex));
+    UtAssert_BOOL_TRUE(MM_AppData.MemRangeMapValid);
+    UtAssert_UINT32_EQ(MM_AppData.MemRangeCount[MM_MEM_RANGE_RAM], 3);
+    UtAssert_UINT32_EQ(MM_AppData.MemRangeCount[MM_MEM_RANGE_EEPROM], 1);
+    UtAssert_UINT32_EQ(MM_AppData.MemRangeMap[MM_MEM_RANGE_RAM][0].RangeNum, 4);
+    UtAssert_UINT32_EQ(MM_AppData.MemRangeMap[MM_MEM_RANGE_RAM][1].RangeNum, 0);
+    UtAssert_UINT32_EQ(MM_AppData.MemRangeMap[MM_MEM_RANGE_RAM][2].RangeNum, 1);
+    UtAssert_UINT32_EQ(MM_AppData.MemRangeMap[MM_MEM_RANGE_RAM][2].EndAddr, 0x110F);
+    UtAssert_UINT32_EQ(MM_AppData.MemRangeMap[MM_MEM_RANGE_RAM][2].MaxEndAddr, 0x1FFF);
+    UtAssert_UINT32_EQ(MM_AppData.MemRangeMap[MM_MEM_RANGE_RAM][2].MaxEndRange, 0);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.MemRangeEntries, 4);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.LastMemRange, MM_MEM_RANGE_UNKNOWN);
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+}
+
+void MM_MemRangeInit_Test_MutexError(void)
+{
+    UT_SetDefaultReturnValue(UT_KEY(OS_MutSemCreate), OS_ERROR);
+
+    /* Execute the function being tested */
+    MM_MemRangeInit();
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(OS_ObjectIdDefined(MM_AppData.MemRangeMutex));
+    UtAssert_BOOL_FALSE(MM_AppData.MemRangeMapValid);
+    UtAssert_STUB_COUNT(CFE_PSP_MemRangeGet, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_MEM_RANGE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_MemRangeRefresh_Test_NoMutex(void)
+{
+    MM_AppData.MemRangeMutex = OS_OBJECT_ID_UNDEFINED;
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_MemRangeRefresh());
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_PSP_MemRanges, 0);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.MemRangeEntries, 0);
+}
+
+void MM_MemRangeRefresh_Test_GetError(void)
+{
+    MM_AppData.MemRangeMutex    = MM_UT_OBJID_1;
+    MM_AppData.MemRangeMapValid = true;
+
+    UT_MM_UTILS_TEST_SetupMemRanges(6);
+    UT_SetDeferredRetcode(UT_KEY(CFE_PSP_MemRangeGet), 3, CFE_PSP_ERROR);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_MemRangeRefresh());
+
+    /* Verify results, the ranges read before the error are discarded */
+    UtAssert_STUB_COUNT(CFE_PSP_MemRangeGet, 3);
+    UtAssert_BOOL_FALSE(MM_AppData.MemRangeMapValid);
+    UtAssert_UINT32_EQ(MM_AppData.MemRangeCount[MM_MEM_RANGE_RAM], 0);
+    UtAssert_UINT32_EQ(MM_AppData.MemRangeCount[MM_MEM_RANGE_EEPROM], 0);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.MemRangeEntries, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_MEM_RANGE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_MemRangeRefresh_Test_Full(void)
+{
+    /* Every range past the six in the table is another RAM range */
+    MM_AppData.MemRangeMutex = MM_UT_OBJID_1;
+
+    UT_MM_UTILS_TEST_SetupMemRanges(MM_MEM_RANGE_MAP_ENTRIES + 6);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_MemRangeRefresh());
+
+    /* Verify results */
+    UtAssert_BOOL_FALSE(MM_AppData.MemRangeMapValid);
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.MemRangeEntries, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_MEM_RANGE_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+}
+
+void MM_MemRangeValidate_Test_Map(void)
+{
+    uint32 RangeNum = 0;
+
+    MM_AppData.MemRangeMutex = MM_UT_OBJID_1;
+
+    UT_MM_UTILS_TEST_SetupMemRanges(6);
+    UtAssert_BOOL_TRUE(MM_MemRangeRefresh());
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MM_MemRangeValidate(0x1000, 0x1000, CFE_PSP_MEM_RAM, &RangeNum), CFE_PSP_SUCCESS);
+    UtAssert_UINT32_EQ(RangeNum, 0);
+
+    /* Inside both overlapping ranges, found through the one that starts lower */
+    UtAssert_INT32_EQ(MM_MemRangeValidate(0x1800, 4, CFE_PSP_MEM_RAM, &RangeNum), CFE_PSP_SUCCESS);
+    UtAssert_UINT32_EQ(RangeNum, 0);
+
+    UtAssert_INT32_EQ(MM_MemRangeValidate(0x04FF, 1, CFE_PSP_MEM_RAM, &RangeNum), CFE_PSP_SUCCESS);
+    UtAssert_UINT32_EQ(RangeNum, 4);
+
+    UtAssert_INT32_EQ(MM_MemRangeValidate(0x8000, 0x100, CFE_PSP_MEM_EEPROM, &RangeNum), CFE_PSP_SUCCESS);
+    UtAssert_UINT32_EQ(RangeNum, 2);
+
+    /* Below every range, past the end of a range, in a gap, other memory type and empty range */
+    UtAssert_INT32_EQ(MM_MemRangeValidate(0x0100, 4, CFE_PSP_MEM_RAM, &RangeNum), CFE_PSP_INVALID_MEM_RANGE);
+    UtAssert_UINT32_EQ(RangeNum, MM_MEM_RANGE_UNKNOWN);
+    UtAssert_INT32_EQ(MM_MemRangeValidate(0x1FFE, 4, CFE_PSP_MEM_RAM, &RangeNum), CFE_PSP_INVALID_MEM_RANGE);
+    UtAssert_INT32_EQ(MM_MemRangeValidate(0x0500, 4, CFE_PSP_MEM_RAM, &RangeNum), CFE_PSP_INVALID_MEM_RANGE);
+    UtAssert_INT32_EQ(MM_MemRangeValidate(0x8000, 4, CFE_PSP_MEM_RAM, &RangeNum), CFE_PSP_INVALID_MEM_RANGE);
+    UtAssert_INT32_EQ(MM_MemRangeValidate(0x3000, 4, CFE_PSP_MEM_RAM, &RangeNum), CFE_PSP_INVALID_MEM_RANGE);
+
+    /* Empty and wrapping ranges are never valid */
+    UtAssert_INT32_EQ(MM_MemRangeValidate(0x1000, 0, CFE_PSP_MEM_RAM, &RangeNum), CFE_PSP_INVALID_MEM_RANGE);
+    UtAssert_INT32_EQ(MM_MemRangeValidate(0x1000, ~(size_t)0, CFE_PSP_MEM_RAM, &RangeNum),
+                      CFE_PSP_INVALID_MEM_RANGE);
+
+    UtAssert_STUB_COUNT(CFE_PSP_MemValidateRange, 0);
+}
+
+void MM_MemRangeValidate_Test_NotBuilt(void)
+{
+    uint32 RangeNum = 0;
+
+    MM_AppData.MemRangeMutex    = MM_UT_OBJID_1;
+    MM_AppData.MemRangeMapValid = false;
+
+    UT_SetDefaultReturnValue(UT_KEY(CFE_PSP_MemValidateRange), CFE_PSP_INVALID_MEM_TYPE);
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MM_MemRangeValidate(0x1000, 4, CFE_PSP_MEM_RAM, &RangeNum), CFE_PSP_INVALID_MEM_TYPE);
+
+    /* Verify results */
+    UtAssert_STUB_COUNT(CFE_PSP_MemValidateRange, 1);
+    UtAssert_UINT32_EQ(RangeNum, MM_MEM_RANGE_UNKNOWN);
+}
+
+void MM_MemRangeValidate_Test_OtherMemType(void)
+{
+    uint32 RangeNum = 0;
+
+    MM_AppData.MemRangeMutex    = MM_UT_OBJID_1;
+    MM_AppData.MemRangeMapValid = true;
+
+    /* Execute the function being tested */
+    UtAssert_INT32_EQ(MM_MemRangeValidate(0x1000, 4, CFE_PSP_MEM_ANY, &RangeNum), CFE_PSP_SUCCESS);
+
+    /* Verify results, only RAM and EEPROM are mapped */
+    UtAssert_STUB_COUNT(CFE_PSP_MemValidateRange, 1);
+    UtAssert_STUB_COUNT(OS_MutSemTake, 0);
+    UtAssert_UINT32_EQ(RangeNum, MM_MEM_RANGE_UNKNOWN);
+}
+
+void MM_VerifyPeekPokeParams_Test_MemRange(void)
+{
+    MM_AppData.MemRangeMutex = MM_UT_OBJID_1;
+
+    UT_MM_UTILS_TEST_SetupMemRanges(6);
+    UtAssert_BOOL_TRUE(MM_MemRangeRefresh());
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_VerifyPeekPokeParams(0x8010, MM_EEPROM, 32));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.LastMemRange, 2);
+
+    UtAssert_BOOL_FALSE(MM_VerifyPeekPokeParams(0x2000, MM_RAM, 32));
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.LastMemRange, 2);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_MEMVALIDATE_ERR_EID);
+
+    UtAssert_STUB_COUNT(CFE_PSP_MemValidateRange, 0);
+}
+
+void MM_VerifyLoadDumpParams_Test_MemRange(void)
+{
+    MM_AppData.MemRangeMutex = MM_UT_OBJID_1;
+
+    UT_MM_UTILS_TEST_SetupMemRanges(6);
+    UtAssert_BOOL_TRUE(MM_MemRangeRefresh());
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_VerifyLoadDumpParams(0x1100, MM_RAM, 0x100, MM_VERIFY_DUMP));
+
+    /* Verify results */
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.LastMemRange, 0);
+
+    UtAssert_BOOL_FALSE(MM_VerifyLoadDumpParams(0x1F00, MM_RAM, 0x200, MM_VERIFY_DUMP));
+    UtAssert_UINT32_EQ(MM_AppData.HkPacket.Payload.LastMemRange, 0);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_OS_MEMVALIDATE_ERR_EID);
+
+    UtAssert_STUB_COUNT(CFE_PSP_MemValidateRange, 0);
 }
 
 void MM_ComputeCRCFromFile_Test(void)
@@ -3546,7 +4656,7 @@ void MM_ComputeCRCFromFile_Test(void)
     UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 1);
     UT_SetDeferredRetcode(UT_KEY(OS_read), 1, 0);
 
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 1);
+    UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), 1);
 
     /* Execute the function being tested */
     Result = MM_ComputeCRCFromFile(FileHandle, &CrcPtr, TypeCRC);
@@ -3554,13 +4664,14 @@ void MM_ComputeCRCFromFile_Test(void)
     /* Verify results */
     UtAssert_True(Result == OS_SUCCESS, "Result == OS_SUCCESS");
     UtAssert_True(CrcPtr == 1, "CrcPtr == 1");
+    UtAssert_STUB_COUNT(CFE_ES_PerfLogAdd, 2);
 
     CrcPtr = 0;
 
     UT_SetDataBuffer(UT_KEY(OS_read), &FileHandle, sizeof(FileHandle), false);
     UT_SetDeferredRetcode(UT_KEY(OS_read), 1, -1);
 
-    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_CalculateCRC), 1);
+    UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), 1);
 
     /* Execute the function being tested */
     Result = MM_ComputeCRCFromFile(FileHandle, &CrcPtr, TypeCRC);
@@ -3569,6 +4680,126 @@ void MM_ComputeCRCFromFile_Test(void)
     UtAssert_True(Result == -1, "Result == -1");
 }
 
+void MM_ReadMemBlock_Test(void)
+{
+    uint8  Source[8]  = {1, 2, 3, 4, 5, 6, 7, 8};
+    uint8  Target[8]  = {0};
+    uint32 Aligned[2] = {0};
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadMem32), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadMem16), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadMem8), true);
+
+    /* Execute the function being tested, RAM and EEPROM are copied directly */
+    UtAssert_BOOL_TRUE(MM_ReadMemBlock((cpuaddr)Source, MM_RAM, Target, sizeof(Target)));
+    UtAssert_MemCmp(Target, Source, sizeof(Source), "RAM block read");
+    UtAssert_BOOL_TRUE(MM_ReadMemBlock((cpuaddr)Source, MM_EEPROM, Aligned, sizeof(Aligned)));
+    UtAssert_MemCmp(Aligned, Source, sizeof(Source), "EEPROM block read");
+
+    /* The optional memory types use their own access width */
+    UtAssert_BOOL_TRUE(MM_ReadMemBlock((cpuaddr)Source, MM_MEM32, Aligned, sizeof(Aligned)));
+    UtAssert_BOOL_TRUE(MM_ReadMemBlock((cpuaddr)Source, MM_MEM16, Aligned, sizeof(Aligned)));
+    UtAssert_BOOL_TRUE(MM_ReadMemBlock((cpuaddr)Source, MM_MEM8, Aligned, sizeof(Aligned)));
+    UtAssert_BOOL_FALSE(MM_ReadMemBlock((cpuaddr)Source, MM_NOMEMTYPE, Aligned, sizeof(Aligned)));
+
+    UtAssert_STUB_COUNT(MM_ReadMem32, 1);
+    UtAssert_STUB_COUNT(MM_ReadMem16, 1);
+    UtAssert_STUB_COUNT(MM_ReadMem8, 1);
+}
+
+void MM_WriteMemBlock_Test(void)
+{
+    uint8  Source[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    uint32 Target[2] = {0};
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_WriteMem32), true);
+    UT_SetDefaultReturnValue(UT_KEY(MM_WriteMem16), true);
+    UT_SetDeferredRetcode(UT_KEY(MM_WriteMem8), 1, false);
+
+    /* Execute the function being tested, RAM and EEPROM are copied directly */
+    UtAssert_BOOL_TRUE(MM_WriteMemBlock((cpuaddr)Target, MM_RAM, Source, sizeof(Source)));
+    UtAssert_MemCmp(Target, Source, sizeof(Source), "RAM block written");
+    UtAssert_BOOL_TRUE(MM_WriteMemBlock((cpuaddr)Target, MM_EEPROM, Source, sizeof(Source)));
+
+    /* The optional memory types use their own access width */
+    UtAssert_BOOL_TRUE(MM_WriteMemBlock((cpuaddr)Target, MM_MEM32, Source, sizeof(Source)));
+    UtAssert_BOOL_TRUE(MM_WriteMemBlock((cpuaddr)Target, MM_MEM16, Source, sizeof(Source)));
+    UtAssert_BOOL_FALSE(MM_WriteMemBlock((cpuaddr)Target, MM_MEM8, Source, sizeof(Source)));
+    UtAssert_BOOL_FALSE(MM_WriteMemBlock((cpuaddr)Target, MM_NOMEMTYPE, Source, sizeof(Source)));
+
+    UtAssert_STUB_COUNT(MM_WriteMem32, 1);
+    UtAssert_STUB_COUNT(MM_WriteMem16, 1);
+    UtAssert_STUB_COUNT(MM_WriteMem8, 1);
+}
+
+void MM_ComputeMemCRC_Test_Nominal(void)
+{
+    uint8  Source[40] = {0};
+    uint32 Crc        = 0;
+
+    MM_AppData.SegmentType              = MM_SEG_COPY;
+    MM_AppData.SegmentSize[MM_SEG_COPY] = 16;
+
+    UT_SetDefaultReturnValue(UT_KEY(MM_CalculateCRC), 0x1234);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_TRUE(MM_ComputeMemCRC((cpuaddr)Source, MM_RAM, sizeof(Source), &Crc, 0));
+
+    /* Verify results, segments of 16, 16 and 8 bytes with a break between them */
+    UtAssert_UINT32_EQ(Crc, 0x1234);
+    UtAssert_STUB_COUNT(MM_CalculateCRC, 3);
+    UtAssert_STUB_COUNT(OS_TaskDelay, 2);
+}
+
+void MM_ComputeMemCRC_Test_ReadError(void)
+{
+    uint32 Source[4] = {0};
+    uint32 Crc       = 0x5555;
+
+    MM_AppData.SegmentType              = MM_SEG_COPY;
+    MM_AppData.SegmentSize[MM_SEG_COPY] = 8;
+
+    UT_SetDeferredRetcode(UT_KEY(MM_ReadMem32), 2, false);
+    UT_SetDefaultReturnValue(UT_KEY(MM_ReadMem32), true);
+
+    /* Execute the function being tested */
+    UtAssert_BOOL_FALSE(MM_ComputeMemCRC((cpuaddr)Source, MM_MEM32, sizeof(Source), &Crc, 0));
+
+    /* Verify results, the CRC is left alone */
+    UtAssert_UINT32_EQ(Crc, 0x5555);
+    UtAssert_STUB_COUNT(MM_ReadMem32, 2);
+    UtAssert_STUB_COUNT(MM_CalculateCRC, 1);
+}
+
+void MM_VerifyFileEncoding_Test(void)
+{
+    /* Raw data works for every memory type */
+    UtAssert_BOOL_TRUE(MM_VerifyFileEncoding(MM_ENCODING_RAW, MM_RAM));
+    UtAssert_BOOL_TRUE(MM_VerifyFileEncoding(MM_ENCODING_RAW, MM_MEM32));
+
+    /* Run length encoded data is decoded a byte at a time */
+    UtAssert_BOOL_TRUE(MM_VerifyFileEncoding(MM_ENCODING_RLE, MM_RAM));
+    UtAssert_BOOL_TRUE(MM_VerifyFileEncoding(MM_ENCODING_RLE, MM_EEPROM));
+
+    /* Sparse data is also byte addressed */
+    UtAssert_BOOL_TRUE(MM_VerifyFileEncoding(MM_ENCODING_SPARSE, MM_RAM));
+    UtAssert_BOOL_TRUE(MM_VerifyFileEncoding(MM_ENCODING_SPARSE, MM_EEPROM));
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 0);
+
+    UtAssert_BOOL_FALSE(MM_VerifyFileEncoding(MM_ENCODING_RLE, MM_MEM16));
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventID, MM_FILE_ENCODING_ERR_EID);
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[0].EventType, CFE_EVS_EventType_ERROR);
+
+    UtAssert_BOOL_FALSE(MM_VerifyFileEncoding(MM_ENCODING_SPARSE, MM_MEM8));
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[1].EventID, MM_FILE_ENCODING_ERR_EID);
+
+    /* Unknown encoding */
+    UtAssert_BOOL_FALSE(MM_VerifyFileEncoding(99, MM_RAM));
+    UtAssert_INT32_EQ(context_CFE_EVS_SendEvent[2].EventID, MM_FILE_ENCODING_ERR_EID);
+
+    UtAssert_STUB_COUNT(CFE_EVS_SendEvent, 3);
+}
+
 /*
  * Register the test cases to execute with the unit test tool
  */
@@ -3581,7 +4812,45 @@ void UtTest_Setup(void)
     UtTest_Add(MM_VerifyCmdLength_Test_LengthError, MM_Test_Setup, MM_Test_TearDown,
                "MM_VerifyCmdLength_Test_LengthError");
 
+    UtTest_Add(MM_SegmentMaxSize_Test, MM_Test_Setup, MM_Test_TearDown, "MM_SegmentMaxSize_Test");
+    UtTest_Add(MM_SegmentMaxSize_Test_Config, MM_Test_Setup, MM_Test_TearDown, "MM_SegmentMaxSize_Test_Config");
+    UtTest_Add(MM_SegmentStart_Test_Fixed, MM_Test_Setup, MM_Test_TearDown, "MM_SegmentStart_Test_Fixed");
+    UtTest_Add(MM_SegmentStart_Test_Adaptive, MM_Test_Setup, MM_Test_TearDown, "MM_SegmentStart_Test_Adaptive");
+    UtTest_Add(MM_SegmentStart_Test_AdaptiveOutOfRange, MM_Test_Setup, MM_Test_TearDown,
+               "MM_SegmentStart_Test_AdaptiveOutOfRange");
+    UtTest_Add(MM_SegmentAdapt_Test_Shrink, MM_Test_Setup, MM_Test_TearDown, "MM_SegmentAdapt_Test_Shrink");
+    UtTest_Add(MM_SegmentAdapt_Test_Grow, MM_Test_Setup, MM_Test_TearDown, "MM_SegmentAdapt_Test_Grow");
+    UtTest_Add(MM_SegmentAdapt_Test_Minimum, MM_Test_Setup, MM_Test_TearDown, "MM_SegmentAdapt_Test_Minimum");
+    UtTest_Add(MM_SegmentAdapt_Test_PartialSegment, MM_Test_Setup, MM_Test_TearDown,
+               "MM_SegmentAdapt_Test_PartialSegment");
     UtTest_Add(MM_SegmentBreak_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_SegmentBreak_Test_Nominal");
+    UtTest_Add(MM_SegmentBreak_Test_PacedWithinBudget, MM_Test_Setup, MM_Test_TearDown,
+               "MM_SegmentBreak_Test_PacedWithinBudget");
+    UtTest_Add(MM_SegmentBreak_Test_PacedBudgetUsed, MM_Test_Setup, MM_Test_TearDown,
+               "MM_SegmentBreak_Test_PacedBudgetUsed");
+    UtTest_Add(MM_SegmentBreak_Test_PacedNewWakeup, MM_Test_Setup, MM_Test_TearDown,
+               "MM_SegmentBreak_Test_PacedNewWakeup");
+    UtTest_Add(MM_SegmentBreak_Test_PacedTimeout, MM_Test_Setup, MM_Test_TearDown, "MM_SegmentBreak_Test_PacedTimeout");
+    UtTest_Add(MM_SegmentBreak_Test_NotOnChildTask, MM_Test_Setup, MM_Test_TearDown,
+               "MM_SegmentBreak_Test_NotOnChildTask");
+    UtTest_Add(MM_SegmentBreak_Test_Adaptive, MM_Test_Setup, MM_Test_TearDown, "MM_SegmentBreak_Test_Adaptive");
+    UtTest_Add(MM_SegmentPollCmds_Test_Hk, MM_Test_Setup, MM_Test_TearDown, "MM_SegmentPollCmds_Test_Hk");
+    UtTest_Add(MM_SegmentPollCmds_Test_Wakeup, MM_Test_Setup, MM_Test_TearDown, "MM_SegmentPollCmds_Test_Wakeup");
+    UtTest_Add(MM_SegmentPollCmds_Test_Defer, MM_Test_Setup, MM_Test_TearDown, "MM_SegmentPollCmds_Test_Defer");
+    UtTest_Add(MM_SegmentPollCmds_Test_PipeError, MM_Test_Setup, MM_Test_TearDown,
+               "MM_SegmentPollCmds_Test_PipeError");
+    UtTest_Add(MM_SegmentBreak_Test_FixedThroughput, MM_Test_Setup, MM_Test_TearDown,
+               "MM_SegmentBreak_Test_FixedThroughput");
+    UtTest_Add(MM_SegmentIo_Test, MM_Test_Setup, MM_Test_TearDown, "MM_SegmentIo_Test");
+    UtTest_Add(MM_SegmentEnd_Test_FirstOp, MM_Test_Setup, MM_Test_TearDown, "MM_SegmentEnd_Test_FirstOp");
+    UtTest_Add(MM_SegmentEnd_Test_Copy, MM_Test_Setup, MM_Test_TearDown, "MM_SegmentEnd_Test_Copy");
+    UtTest_Add(MM_SegmentEnd_Test_Crc, MM_Test_Setup, MM_Test_TearDown, "MM_SegmentEnd_Test_Crc");
+    UtTest_Add(MM_SegmentEnd_Test_RunningStats, MM_Test_Setup, MM_Test_TearDown, "MM_SegmentEnd_Test_RunningStats");
+    UtTest_Add(MM_SegmentEnd_Test_Clamped, MM_Test_Setup, MM_Test_TearDown, "MM_SegmentEnd_Test_Clamped");
+    UtTest_Add(MM_SegmentMulti_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_SegmentMulti_Test_Nominal");
+    UtTest_Add(MM_SegmentMulti_Test_RegionFailed, MM_Test_Setup, MM_Test_TearDown,
+               "MM_SegmentMulti_Test_RegionFailed");
+    UtTest_Add(MM_ResetStats_Test, MM_Test_Setup, MM_Test_TearDown, "MM_ResetStats_Test");
 
     UtTest_Add(MM_VerifyPeekPokeParams_Test_ByteWidthRAM, MM_Test_Setup, MM_Test_TearDown,
                "MM_VerifyPeekPokeParams_Test_ByteWidthRAM");
@@ -3626,6 +4895,10 @@ void UtTest_Setup(void)
                "MM_VerifyLoadDumpParams_Test_LoadRAMDataSizeErrorTooSmall");
     UtTest_Add(MM_VerifyLoadDumpParams_Test_LoadRAMDataSizeErrorTooLarge, MM_Test_Setup, MM_Test_TearDown,
                "MM_VerifyLoadDumpParams_Test_LoadRAMDataSizeErrorTooLarge");
+    UtTest_Add(MM_VerifyLoadDumpParams_Test_LoadRAMConfigLimit, MM_Test_Setup, MM_Test_TearDown,
+               "MM_VerifyLoadDumpParams_Test_LoadRAMConfigLimit");
+    UtTest_Add(MM_VerifyLoadDumpParams_Test_MissionMemType, MM_Test_Setup, MM_Test_TearDown,
+               "MM_VerifyLoadDumpParams_Test_MissionMemType");
     UtTest_Add(MM_VerifyLoadDumpParams_Test_LoadEEPROMValidateRangeError, MM_Test_Setup, MM_Test_TearDown,
                "MM_VerifyLoadDumpParams_Test_LoadEEPROMValidateRangeError");
     UtTest_Add(MM_VerifyLoadDumpParams_Test_LoadEEPROMDataSizeErrorTooSmall, MM_Test_Setup, MM_Test_TearDown,
@@ -3791,6 +5064,39 @@ void UtTest_Setup(void)
     UtTest_Add(MM_Verify16Aligned_Test, MM_Test_Setup, MM_Test_TearDown, "MM_Verify16Aligned_Test");
 
     UtTest_Add(MM_ResolveSymAddr_Test, MM_Test_Setup, MM_Test_TearDown, "MM_ResolveSymAddr_Test");
+    UtTest_Add(MM_ResolveSymAddr_Test_CacheHit, MM_Test_Setup, MM_Test_TearDown, "MM_ResolveSymAddr_Test_CacheHit");
+    UtTest_Add(MM_ResolveSymAddr_Test_CacheNotFound, MM_Test_Setup, MM_Test_TearDown,
+               "MM_ResolveSymAddr_Test_CacheNotFound");
+    UtTest_Add(MM_ResolveSymAddr_Test_CacheDisabled, MM_Test_Setup, MM_Test_TearDown,
+               "MM_ResolveSymAddr_Test_CacheDisabled");
+    UtTest_Add(MM_SymCacheInit_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_SymCacheInit_Test_Nominal");
+    UtTest_Add(MM_SymCacheInit_Test_MutexError, MM_Test_Setup, MM_Test_TearDown, "MM_SymCacheInit_Test_MutexError");
+    UtTest_Add(MM_SymCacheHash_Test, MM_Test_Setup, MM_Test_TearDown, "MM_SymCacheHash_Test");
+    UtTest_Add(MM_SymCacheAdd_Test_Replace, MM_Test_Setup, MM_Test_TearDown, "MM_SymCacheAdd_Test_Replace");
+    UtTest_Add(MM_SymCacheAdd_Test_Flushed, MM_Test_Setup, MM_Test_TearDown, "MM_SymCacheAdd_Test_Flushed");
+    UtTest_Add(MM_SymCacheFlush_Test, MM_Test_Setup, MM_Test_TearDown, "MM_SymCacheFlush_Test");
+    UtTest_Add(MM_SymCacheFlush_Test_Disabled, MM_Test_Setup, MM_Test_TearDown, "MM_SymCacheFlush_Test_Disabled");
+
+    UtTest_Add(MM_MemRangeInit_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_MemRangeInit_Test_Nominal");
+    UtTest_Add(MM_MemRangeInit_Test_MutexError, MM_Test_Setup, MM_Test_TearDown, "MM_MemRangeInit_Test_MutexError");
+    UtTest_Add(MM_MemRangeRefresh_Test_NoMutex, MM_Test_Setup, MM_Test_TearDown, "MM_MemRangeRefresh_Test_NoMutex");
+    UtTest_Add(MM_MemRangeRefresh_Test_GetError, MM_Test_Setup, MM_Test_TearDown, "MM_MemRangeRefresh_Test_GetError");
+    UtTest_Add(MM_MemRangeRefresh_Test_Full, MM_Test_Setup, MM_Test_TearDown, "MM_MemRangeRefresh_Test_Full");
+    UtTest_Add(MM_MemRangeValidate_Test_Map, MM_Test_Setup, MM_Test_TearDown, "MM_MemRangeValidate_Test_Map");
+    UtTest_Add(MM_MemRangeValidate_Test_NotBuilt, MM_Test_Setup, MM_Test_TearDown,
+               "MM_MemRangeValidate_Test_NotBuilt");
+    UtTest_Add(MM_MemRangeValidate_Test_OtherMemType, MM_Test_Setup, MM_Test_TearDown,
+               "MM_MemRangeValidate_Test_OtherMemType");
+    UtTest_Add(MM_VerifyPeekPokeParams_Test_MemRange, MM_Test_Setup, MM_Test_TearDown,
+               "MM_VerifyPeekPokeParams_Test_MemRange");
+    UtTest_Add(MM_VerifyLoadDumpParams_Test_MemRange, MM_Test_Setup, MM_Test_TearDown,
+               "MM_VerifyLoadDumpParams_Test_MemRange");
 
     UtTest_Add(MM_ComputeCRCFromFile_Test, MM_Test_Setup, MM_Test_TearDown, "MM_ComputeCRCFromFile_Test");
+    UtTest_Add(MM_ReadMemBlock_Test, MM_Test_Setup, MM_Test_TearDown, "MM_ReadMemBlock_Test");
+    UtTest_Add(MM_WriteMemBlock_Test, MM_Test_Setup, MM_Test_TearDown, "MM_WriteMemBlock_Test");
+    UtTest_Add(MM_ComputeMemCRC_Test_Nominal, MM_Test_Setup, MM_Test_TearDown, "MM_ComputeMemCRC_Test_Nominal");
+    UtTest_Add(MM_ComputeMemCRC_Test_ReadError, MM_Test_Setup, MM_Test_TearDown, "MM_ComputeMemCRC_Test_ReadError");
+
+    UtTest_Add(MM_VerifyFileEncoding_Test, MM_Test_Setup, MM_Test_TearDown, "MM_VerifyFileEncoding_Test");
 }
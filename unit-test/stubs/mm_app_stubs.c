@@ -67,6 +67,23 @@ void MM_HousekeepingCmd(const CFE_SB_Buffer_t *msg)
     UT_DEFAULT_IMPL(MM_HousekeepingCmd);
 }
 
+void MM_WakeupCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_WakeupCmd), BufPtr);
+    UT_DEFAULT_IMPL(MM_WakeupCmd);
+}
+
+void MM_DeferCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_DeferCmd), BufPtr);
+    UT_DEFAULT_IMPL(MM_DeferCmd);
+}
+
+void MM_ProcessDeferredCmds(void)
+{
+    UT_DEFAULT_IMPL(MM_ProcessDeferredCmds);
+}
+
 bool MM_NoopCmd(const CFE_SB_Buffer_t *msg)
 {
     UT_Stub_RegisterContext(UT_KEY(MM_NoopCmd), msg);
@@ -91,6 +108,39 @@ bool MM_SymTblToFileCmd(const CFE_SB_Buffer_t *msg)
     return UT_DEFAULT_IMPL(MM_SymTblToFileCmd);
 }
 
+bool MM_MemRangeRefreshCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_MemRangeRefreshCmd), BufPtr);
+    return UT_DEFAULT_IMPL(MM_MemRangeRefreshCmd);
+}
+
+bool MM_LookupSymFileCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_LookupSymFileCmd), BufPtr);
+    return UT_DEFAULT_IMPL(MM_LookupSymFileCmd);
+}
+
+bool MM_LookupSymFile(osal_id_t InHandle, const char *InName, osal_id_t OutHandle, const char *OutName,
+                      MM_SymLookupFileHeader_t *FileHeader)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_LookupSymFile), InHandle);
+    UT_Stub_RegisterContext(UT_KEY(MM_LookupSymFile), InName);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_LookupSymFile), OutHandle);
+    UT_Stub_RegisterContext(UT_KEY(MM_LookupSymFile), OutName);
+    UT_Stub_RegisterContext(UT_KEY(MM_LookupSymFile), FileHeader);
+    return UT_DEFAULT_IMPL(MM_LookupSymFile);
+}
+
+bool MM_WriteSymLookupHeaders(const char *FileName, osal_id_t FileHandle, CFE_FS_Header_t *CFEHeader,
+                              const MM_SymLookupFileHeader_t *FileHeader)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_WriteSymLookupHeaders), FileName);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_WriteSymLookupHeaders), FileHandle);
+    UT_Stub_RegisterContext(UT_KEY(MM_WriteSymLookupHeaders), CFEHeader);
+    UT_Stub_RegisterContext(UT_KEY(MM_WriteSymLookupHeaders), FileHeader);
+    return UT_DEFAULT_IMPL(MM_WriteSymLookupHeaders);
+}
+
 bool MM_EepromWriteEnaCmd(const CFE_SB_Buffer_t *msg)
 {
     UT_Stub_RegisterContext(UT_KEY(MM_EepromWriteEnaCmd), msg);
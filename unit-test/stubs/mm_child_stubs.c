@@ -0,0 +1,98 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Unit test stubs for mm_child.c
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_app.h"
+#include "mm_child.h"
+
+/************************************************************************
+** UT Includes
+*************************************************************************/
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+CFE_Status_t MM_ChildInit(void)
+{
+    return UT_DEFAULT_IMPL(MM_ChildInit);
+}
+
+void MM_ChildLock(void)
+{
+    UT_DEFAULT_IMPL(MM_ChildLock);
+}
+
+void MM_ChildUnlock(void)
+{
+    UT_DEFAULT_IMPL(MM_ChildUnlock);
+}
+
+uint8 MM_ChildGetState(void)
+{
+    return UT_DEFAULT_IMPL(MM_ChildGetState);
+}
+
+void MM_ChildSetState(uint8 State)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_ChildSetState), State);
+    UT_DEFAULT_IMPL(MM_ChildSetState);
+}
+
+bool MM_ChildVerifyIdle(CFE_MSG_FcnCode_t CommandCode)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_ChildVerifyIdle), CommandCode);
+    return UT_DEFAULT_IMPL_RC(MM_ChildVerifyIdle, true);
+}
+
+void MM_ChildTask(void)
+{
+    UT_DEFAULT_IMPL(MM_ChildTask);
+}
+
+void MM_ChildLoop(void)
+{
+    UT_DEFAULT_IMPL(MM_ChildLoop);
+}
+
+void MM_ChildProcess(void)
+{
+    UT_DEFAULT_IMPL(MM_ChildProcess);
+}
+
+bool MM_ChildDispatchCmd(const CFE_SB_Buffer_t *BufPtr, CFE_MSG_FcnCode_t CommandCode, size_t CmdSize)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_ChildDispatchCmd), BufPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_ChildDispatchCmd), CommandCode);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_ChildDispatchCmd), CmdSize);
+    return UT_DEFAULT_IMPL(MM_ChildDispatchCmd);
+}
+
+bool MM_ChildExecuteCmd(const CFE_SB_Buffer_t *BufPtr, CFE_MSG_FcnCode_t CommandCode)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_ChildExecuteCmd), BufPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_ChildExecuteCmd), CommandCode);
+    return UT_DEFAULT_IMPL(MM_ChildExecuteCmd);
+}
@@ -0,0 +1,291 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Unit test stubs for mm_codec.c
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_codec.h"
+#include <string.h>
+
+/************************************************************************
+** UT Includes
+*************************************************************************/
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+void MM_RleEncodeInit(MM_RleEncoder_t *Enc, uint8 *Out, size_t OutSize)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_RleEncodeInit), Enc);
+    UT_Stub_RegisterContext(UT_KEY(MM_RleEncodeInit), Out);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_RleEncodeInit), OutSize);
+    UT_DEFAULT_IMPL(MM_RleEncodeInit);
+
+    /* Callers check the output buffer state */
+    memset(Enc, 0, sizeof(*Enc));
+    Enc->Out     = Out;
+    Enc->OutSize = OutSize;
+}
+
+void MM_RleEncodeRun(MM_RleEncoder_t *Enc)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_RleEncodeRun), Enc);
+    UT_DEFAULT_IMPL(MM_RleEncodeRun);
+}
+
+size_t MM_RleEncode(MM_RleEncoder_t *Enc, const uint8 *Src, size_t SrcLen)
+{
+    int32 status;
+
+    UT_Stub_RegisterContext(UT_KEY(MM_RleEncode), Enc);
+    UT_Stub_RegisterContext(UT_KEY(MM_RleEncode), Src);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_RleEncode), SrcLen);
+    status = UT_DEFAULT_IMPL(MM_RleEncode);
+
+    /* All input is used unless a test sets the count */
+    if (status != 0)
+    {
+        return status;
+    }
+
+    return SrcLen;
+}
+
+void MM_RleEncodeRewind(MM_RleEncoder_t *Enc)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_RleEncodeRewind), Enc);
+    UT_DEFAULT_IMPL(MM_RleEncodeRewind);
+
+    Enc->OutLen = 0;
+}
+
+void MM_RleEncodeFinish(MM_RleEncoder_t *Enc)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_RleEncodeFinish), Enc);
+    UT_DEFAULT_IMPL(MM_RleEncodeFinish);
+}
+
+void MM_RleDecodeInit(MM_RleDecoder_t *Dec)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_RleDecodeInit), Dec);
+    UT_DEFAULT_IMPL(MM_RleDecodeInit);
+
+    /* Callers check the decoder state */
+    memset(Dec, 0, sizeof(*Dec));
+    Dec->State = MM_RLE_STATE_CTRL;
+}
+
+size_t MM_RleDecode(MM_RleDecoder_t *Dec, const uint8 *Src, size_t SrcLen, size_t *SrcUsed, uint8 *Dst,
+                    size_t DstSize)
+{
+    int32 status;
+
+    UT_Stub_RegisterContext(UT_KEY(MM_RleDecode), Dec);
+    UT_Stub_RegisterContext(UT_KEY(MM_RleDecode), Src);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_RleDecode), SrcLen);
+    UT_Stub_RegisterContext(UT_KEY(MM_RleDecode), SrcUsed);
+    UT_Stub_RegisterContext(UT_KEY(MM_RleDecode), Dst);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_RleDecode), DstSize);
+    status = UT_DEFAULT_IMPL(MM_RleDecode);
+
+    /* All input is used and the output filled unless a test sets the count */
+    *SrcUsed = SrcLen;
+
+    if (status != 0)
+    {
+        return status;
+    }
+
+    return DstSize;
+}
+
+size_t MM_SparseScanFill(const uint8 *Src, size_t SrcLen, uint8 FillValue)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_SparseScanFill), Src);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_SparseScanFill), SrcLen);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_SparseScanFill), FillValue);
+    return UT_DEFAULT_IMPL(MM_SparseScanFill);
+}
+
+size_t MM_SparseScanData(const uint8 *Src, size_t SrcLen, uint8 FillValue)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_SparseScanData), Src);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_SparseScanData), SrcLen);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_SparseScanData), FillValue);
+    return UT_DEFAULT_IMPL(MM_SparseScanData);
+}
+
+void MM_SparseEncodeInit(MM_SparseEncoder_t *Enc, uint8 FillValue, uint8 *Out, size_t OutSize)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_SparseEncodeInit), Enc);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_SparseEncodeInit), FillValue);
+    UT_Stub_RegisterContext(UT_KEY(MM_SparseEncodeInit), Out);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_SparseEncodeInit), OutSize);
+    UT_DEFAULT_IMPL(MM_SparseEncodeInit);
+}
+
+size_t MM_SparseEncode(MM_SparseEncoder_t *Enc, const uint8 *Src, size_t SrcLen)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_SparseEncode), Enc);
+    UT_Stub_RegisterContext(UT_KEY(MM_SparseEncode), Src);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_SparseEncode), SrcLen);
+    return UT_DEFAULT_IMPL(MM_SparseEncode);
+}
+
+void MM_SparseDecodeInit(MM_SparseDecoder_t *Dec, uint8 FillValue, uint32 Size)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_SparseDecodeInit), Dec);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_SparseDecodeInit), FillValue);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_SparseDecodeInit), Size);
+    UT_DEFAULT_IMPL(MM_SparseDecodeInit);
+}
+
+size_t MM_SparseDecode(MM_SparseDecoder_t *Dec, const uint8 *Src, size_t SrcLen, size_t *SrcUsed, uint8 *Dst,
+                       size_t DstSize)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_SparseDecode), Dec);
+    UT_Stub_RegisterContext(UT_KEY(MM_SparseDecode), Src);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_SparseDecode), SrcLen);
+    UT_Stub_RegisterContext(UT_KEY(MM_SparseDecode), SrcUsed);
+    UT_Stub_RegisterContext(UT_KEY(MM_SparseDecode), Dst);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_SparseDecode), DstSize);
+    *SrcUsed = 0;
+    return UT_DEFAULT_IMPL(MM_SparseDecode);
+}
+
+void MM_FileEncodeInit(MM_FileEncoder_t *Enc, uint8 Encoding, uint8 FillValue, uint8 *Out, size_t OutSize)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_FileEncodeInit), Enc);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_FileEncodeInit), Encoding);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_FileEncodeInit), FillValue);
+    UT_Stub_RegisterContext(UT_KEY(MM_FileEncodeInit), Out);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_FileEncodeInit), OutSize);
+    UT_DEFAULT_IMPL(MM_FileEncodeInit);
+
+    memset(Enc, 0, sizeof(*Enc));
+    Enc->Encoding = Encoding;
+}
+
+size_t MM_FileEncode(MM_FileEncoder_t *Enc, const uint8 *Src, size_t SrcLen)
+{
+    int32 status;
+
+    UT_Stub_RegisterContext(UT_KEY(MM_FileEncode), Enc);
+    UT_Stub_RegisterContext(UT_KEY(MM_FileEncode), Src);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_FileEncode), SrcLen);
+    status = UT_DEFAULT_IMPL(MM_FileEncode);
+
+    /* All input is used unless a test sets the count */
+    if (status != 0)
+    {
+        return status;
+    }
+
+    return SrcLen;
+}
+
+bool MM_FileEncodeFull(const MM_FileEncoder_t *Enc)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_FileEncodeFull), Enc);
+    return UT_DEFAULT_IMPL(MM_FileEncodeFull);
+}
+
+size_t MM_FileEncodeOutput(const MM_FileEncoder_t *Enc, const uint8 **Out)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_FileEncodeOutput), Enc);
+    UT_Stub_RegisterContext(UT_KEY(MM_FileEncodeOutput), Out);
+
+    /* Tests set the output length, the data itself is never checked */
+    *Out = NULL;
+
+    return UT_DEFAULT_IMPL(MM_FileEncodeOutput);
+}
+
+void MM_FileEncodeRewind(MM_FileEncoder_t *Enc)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_FileEncodeRewind), Enc);
+    UT_DEFAULT_IMPL(MM_FileEncodeRewind);
+}
+
+void MM_FileEncodeFinish(MM_FileEncoder_t *Enc)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_FileEncodeFinish), Enc);
+    UT_DEFAULT_IMPL(MM_FileEncodeFinish);
+}
+
+void MM_FileDecodeInit(MM_FileDecoder_t *Dec, uint8 Encoding, uint8 FillValue, uint32 Size)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_FileDecodeInit), Dec);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_FileDecodeInit), Encoding);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_FileDecodeInit), FillValue);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_FileDecodeInit), Size);
+    UT_DEFAULT_IMPL(MM_FileDecodeInit);
+
+    memset(Dec, 0, sizeof(*Dec));
+    Dec->Encoding = Encoding;
+}
+
+size_t MM_FileDecode(MM_FileDecoder_t *Dec, const uint8 *Src, size_t SrcLen, size_t *SrcUsed, uint8 *Dst,
+                     size_t DstSize)
+{
+    int32 status;
+
+    UT_Stub_RegisterContext(UT_KEY(MM_FileDecode), Dec);
+    UT_Stub_RegisterContext(UT_KEY(MM_FileDecode), Src);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_FileDecode), SrcLen);
+    UT_Stub_RegisterContext(UT_KEY(MM_FileDecode), SrcUsed);
+    UT_Stub_RegisterContext(UT_KEY(MM_FileDecode), Dst);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_FileDecode), DstSize);
+    status = UT_DEFAULT_IMPL(MM_FileDecode);
+
+    /* All input is used and the output filled unless a test sets the count */
+    *SrcUsed = SrcLen;
+
+    if (status != 0)
+    {
+        return status;
+    }
+
+    return DstSize;
+}
+
+void MM_FileDecodeEnd(MM_FileDecoder_t *Dec)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_FileDecodeEnd), Dec);
+    UT_DEFAULT_IMPL(MM_FileDecodeEnd);
+}
+
+bool MM_FileDecodePending(const MM_FileDecoder_t *Dec)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_FileDecodePending), Dec);
+    return UT_DEFAULT_IMPL(MM_FileDecodePending);
+}
+
+bool MM_FileDecodeDone(const MM_FileDecoder_t *Dec)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_FileDecodeDone), Dec);
+
+    /* Decoding completes unless a test says otherwise */
+    return UT_DEFAULT_IMPL_RC(MM_FileDecodeDone, true);
+}
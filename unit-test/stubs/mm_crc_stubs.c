@@ -0,0 +1,49 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Unit test stubs for mm_crc.c
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_crc.h"
+
+/************************************************************************
+** UT Includes
+*************************************************************************/
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+void MM_CrcInit(void)
+{
+    UT_DEFAULT_IMPL(MM_CrcInit);
+}
+
+uint32 MM_CalculateCRC(const void *DataPtr, size_t DataLength, uint32 InputCRC, CFE_ES_CrcType_Enum_t TypeCRC)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_CalculateCRC), DataPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_CalculateCRC), DataLength);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_CalculateCRC), InputCRC);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_CalculateCRC), TypeCRC);
+    return UT_DEFAULT_IMPL(MM_CalculateCRC);
+}
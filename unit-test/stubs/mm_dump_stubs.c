@@ -48,7 +48,7 @@ bool MM_PeekMem(const MM_PeekCmd_t *CmdPtr, cpuaddr SrcAddress)
     return UT_DEFAULT_IMPL(MM_PeekMem);
 }
 
-bool MM_DumpMemToFile(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader)
+bool MM_DumpMemToFile(osal_id_t FileHandle, const char *FileName, MM_LoadDumpFileHeader_t *FileHeader)
 {
     UT_Stub_RegisterContextGenericArg(UT_KEY(MM_DumpMemToFile), FileHandle);
     UT_Stub_RegisterContext(UT_KEY(MM_DumpMemToFile), FileName);
@@ -56,6 +56,30 @@ bool MM_DumpMemToFile(osal_id_t FileHandle, const char *FileName, const MM_LoadD
     return UT_DEFAULT_IMPL(MM_DumpMemToFile);
 }
 
+bool MM_DumpMemToEncodedFile(osal_id_t FileHandle, const char *FileName, MM_LoadDumpFileHeader_t *FileHeader)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_DumpMemToEncodedFile), FileHandle);
+    UT_Stub_RegisterContext(UT_KEY(MM_DumpMemToEncodedFile), FileName);
+    UT_Stub_RegisterContext(UT_KEY(MM_DumpMemToEncodedFile), FileHeader);
+    return UT_DEFAULT_IMPL(MM_DumpMemToEncodedFile);
+}
+
+bool MM_WriteEncodedBlock(osal_id_t FileHandle, const char *FileName, MM_FileEncoder_t *Encoder)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_WriteEncodedBlock), FileHandle);
+    UT_Stub_RegisterContext(UT_KEY(MM_WriteEncodedBlock), FileName);
+    UT_Stub_RegisterContext(UT_KEY(MM_WriteEncodedBlock), Encoder);
+    return UT_DEFAULT_IMPL(MM_WriteEncodedBlock);
+}
+
+bool MM_DumpToFile(const MM_DumpMemToFileCmd_Payload_t *Payload, uint8 Encoding, uint8 FillValue)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_DumpToFile), Payload);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_DumpToFile), Encoding);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_DumpToFile), FillValue);
+    return UT_DEFAULT_IMPL(MM_DumpToFile);
+}
+
 bool MM_WriteFileHeaders(const char *FileName, osal_id_t FileHandle, CFE_FS_Header_t *CFEHeader,
                          const MM_LoadDumpFileHeader_t *MMHeader)
 {
@@ -66,6 +90,77 @@ bool MM_WriteFileHeaders(const char *FileName, osal_id_t FileHandle, CFE_FS_Head
     return UT_DEFAULT_IMPL(MM_WriteFileHeaders);
 }
 
+bool MM_OpenDeltaBaseline(const char *FileName, const MM_LoadDumpFileHeader_t *DumpHeader, osal_id_t *FileHandle,
+                          MM_DeltaFileHeader_t *DeltaHeader)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_OpenDeltaBaseline), FileName);
+    UT_Stub_RegisterContext(UT_KEY(MM_OpenDeltaBaseline), DumpHeader);
+    UT_Stub_RegisterContext(UT_KEY(MM_OpenDeltaBaseline), FileHandle);
+    UT_Stub_RegisterContext(UT_KEY(MM_OpenDeltaBaseline), DeltaHeader);
+    return UT_DEFAULT_IMPL(MM_OpenDeltaBaseline);
+}
+
+bool MM_DumpMemToDeltaFile(osal_id_t FileHandle, const char *FileName, osal_id_t BaselineHandle,
+                           const char *BaselineName, MM_LoadDumpFileHeader_t *FileHeader,
+                           MM_DeltaFileHeader_t *DeltaHeader)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_DumpMemToDeltaFile), FileHandle);
+    UT_Stub_RegisterContext(UT_KEY(MM_DumpMemToDeltaFile), FileName);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_DumpMemToDeltaFile), BaselineHandle);
+    UT_Stub_RegisterContext(UT_KEY(MM_DumpMemToDeltaFile), BaselineName);
+    UT_Stub_RegisterContext(UT_KEY(MM_DumpMemToDeltaFile), FileHeader);
+    UT_Stub_RegisterContext(UT_KEY(MM_DumpMemToDeltaFile), DeltaHeader);
+    return UT_DEFAULT_IMPL(MM_DumpMemToDeltaFile);
+}
+
+bool MM_WriteDeltaHeader(const char *FileName, osal_id_t FileHandle, const MM_DeltaFileHeader_t *DeltaHeader)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_WriteDeltaHeader), FileName);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_WriteDeltaHeader), FileHandle);
+    UT_Stub_RegisterContext(UT_KEY(MM_WriteDeltaHeader), DeltaHeader);
+    return UT_DEFAULT_IMPL(MM_WriteDeltaHeader);
+}
+
+bool MM_ReadDumpRegionFile(const char *FileName, MM_MultiFileHeader_t *MultiHeader, uint32 *TotalBytes)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_ReadDumpRegionFile), FileName);
+    UT_Stub_RegisterContext(UT_KEY(MM_ReadDumpRegionFile), MultiHeader);
+    UT_Stub_RegisterContext(UT_KEY(MM_ReadDumpRegionFile), TotalBytes);
+    return UT_DEFAULT_IMPL(MM_ReadDumpRegionFile);
+}
+
+bool MM_VerifyDumpRegion(const char *FileName, MM_LoadDumpFileHeader_t *Region, uint32 RegionNum)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_VerifyDumpRegion), FileName);
+    UT_Stub_RegisterContext(UT_KEY(MM_VerifyDumpRegion), Region);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_VerifyDumpRegion), RegionNum);
+    return UT_DEFAULT_IMPL(MM_VerifyDumpRegion);
+}
+
+bool MM_DumpMemToMultiFile(osal_id_t FileHandle, const char *FileName, const MM_MultiFileHeader_t *MultiHeader)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_DumpMemToMultiFile), FileHandle);
+    UT_Stub_RegisterContext(UT_KEY(MM_DumpMemToMultiFile), FileName);
+    UT_Stub_RegisterContext(UT_KEY(MM_DumpMemToMultiFile), MultiHeader);
+    return UT_DEFAULT_IMPL(MM_DumpMemToMultiFile);
+}
+
+bool MM_DumpFileRegion(osal_id_t FileHandle, const char *FileName, MM_LoadDumpFileHeader_t *Region)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_DumpFileRegion), FileHandle);
+    UT_Stub_RegisterContext(UT_KEY(MM_DumpFileRegion), FileName);
+    UT_Stub_RegisterContext(UT_KEY(MM_DumpFileRegion), Region);
+    return UT_DEFAULT_IMPL(MM_DumpFileRegion);
+}
+
+bool MM_WriteMultiFileTable(const char *FileName, osal_id_t FileHandle, const MM_MultiFileHeader_t *MultiHeader)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_WriteMultiFileTable), FileName);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_WriteMultiFileTable), FileHandle);
+    UT_Stub_RegisterContext(UT_KEY(MM_WriteMultiFileTable), MultiHeader);
+    return UT_DEFAULT_IMPL(MM_WriteMultiFileTable);
+}
+
 bool MM_FillDumpInEventBuffer(cpuaddr SrcAddress, const MM_DumpInEventCmd_t *CmdPtr, void *DumpBuffer)
 {
     UT_Stub_RegisterContextGenericArg(UT_KEY(MM_FillDumpInEventBuffer), SrcAddress);
@@ -87,9 +182,33 @@ bool MM_DumpMemToFileCmd(const CFE_SB_Buffer_t *BufPtr)
     return UT_DEFAULT_IMPL(MM_DumpMemToFileCmd);
 }
 
+bool MM_DumpMemToFileEncCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_DumpMemToFileEncCmd), BufPtr);
+    return UT_DEFAULT_IMPL(MM_DumpMemToFileEncCmd);
+}
+
+bool MM_DumpMemToDeltaFileCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_DumpMemToDeltaFileCmd), BufPtr);
+    return UT_DEFAULT_IMPL(MM_DumpMemToDeltaFileCmd);
+}
+
+bool MM_DumpMemToMultiFileCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_DumpMemToMultiFileCmd), BufPtr);
+    return UT_DEFAULT_IMPL(MM_DumpMemToMultiFileCmd);
+}
+
 bool MM_DumpInEventCmd(const CFE_SB_Buffer_t *BufPtr)
 {
     UT_Stub_RegisterContext(UT_KEY(MM_DumpInEventCmd), BufPtr);
     return UT_DEFAULT_IMPL(MM_DumpInEventCmd);
     CFE_EVS_SendEvent(MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR, "Symbolic address can't be resolved: Name = 'name'");
 }
+
+bool MM_CrcMemCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_CrcMemCmd), BufPtr);
+    return UT_DEFAULT_IMPL(MM_CrcMemCmd);
+}
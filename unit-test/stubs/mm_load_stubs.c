@@ -73,6 +73,57 @@ bool MM_LoadMemFromFile(osal_id_t FileHandle, const char *FileName, const MM_Loa
     return UT_DEFAULT_IMPL(MM_LoadMemFromFile);
 }
 
+uint8 *MM_GetLoadStagingBuf(const MM_LoadDumpFileHeader_t *FileHeader)
+{
+    uint8 *StagingBuf = NULL;
+
+    UT_Stub_RegisterContext(UT_KEY(MM_GetLoadStagingBuf), FileHeader);
+    UT_DEFAULT_IMPL(MM_GetLoadStagingBuf);
+    UT_Stub_CopyToLocal(UT_KEY(MM_GetLoadStagingBuf), &StagingBuf, sizeof(StagingBuf));
+
+    return StagingBuf;
+}
+
+int32 MM_StageLoadFile(osal_id_t FileHandle, const MM_LoadDumpFileHeader_t *FileHeader, uint8 *StagingBuf,
+                       uint32 *CrcPtr)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_StageLoadFile), FileHandle);
+    UT_Stub_RegisterContext(UT_KEY(MM_StageLoadFile), FileHeader);
+    UT_Stub_RegisterContext(UT_KEY(MM_StageLoadFile), StagingBuf);
+    UT_Stub_RegisterContext(UT_KEY(MM_StageLoadFile), CrcPtr);
+    return UT_DEFAULT_IMPL(MM_StageLoadFile);
+}
+
+bool MM_LoadMemFromStaging(const uint8 *StagingBuf, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader,
+                           cpuaddr DestAddress)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_LoadMemFromStaging), StagingBuf);
+    UT_Stub_RegisterContext(UT_KEY(MM_LoadMemFromStaging), FileName);
+    UT_Stub_RegisterContext(UT_KEY(MM_LoadMemFromStaging), FileHeader);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_LoadMemFromStaging), DestAddress);
+    return UT_DEFAULT_IMPL(MM_LoadMemFromStaging);
+}
+
+int32 MM_ComputeDecodedCRCFromFile(osal_id_t FileHandle, const char *FileName,
+                                   const MM_LoadDumpFileHeader_t *FileHeader, uint32 *CrcPtr)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_ComputeDecodedCRCFromFile), FileHandle);
+    UT_Stub_RegisterContext(UT_KEY(MM_ComputeDecodedCRCFromFile), FileName);
+    UT_Stub_RegisterContext(UT_KEY(MM_ComputeDecodedCRCFromFile), FileHeader);
+    UT_Stub_RegisterContext(UT_KEY(MM_ComputeDecodedCRCFromFile), CrcPtr);
+    return UT_DEFAULT_IMPL(MM_ComputeDecodedCRCFromFile);
+}
+
+bool MM_LoadMemFromEncodedFile(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader,
+                               cpuaddr DestAddress)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_LoadMemFromEncodedFile), FileHandle);
+    UT_Stub_RegisterContext(UT_KEY(MM_LoadMemFromEncodedFile), FileName);
+    UT_Stub_RegisterContext(UT_KEY(MM_LoadMemFromEncodedFile), FileHeader);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_LoadMemFromEncodedFile), DestAddress);
+    return UT_DEFAULT_IMPL(MM_LoadMemFromEncodedFile);
+}
+
 bool MM_VerifyLoadFileSize(const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader)
 {
     UT_Stub_RegisterContext(UT_KEY(MM_VerifyLoadFileSize), FileName);
@@ -80,6 +131,87 @@ bool MM_VerifyLoadFileSize(const char *FileName, const MM_LoadDumpFileHeader_t *
     return UT_DEFAULT_IMPL(MM_VerifyLoadFileSize);
 }
 
+bool MM_VerifyPatchFile(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader,
+                        cpuaddr DestAddress, MM_PatchFileHeader_t *PatchHeader)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_VerifyPatchFile), FileHandle);
+    UT_Stub_RegisterContext(UT_KEY(MM_VerifyPatchFile), FileName);
+    UT_Stub_RegisterContext(UT_KEY(MM_VerifyPatchFile), FileHeader);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_VerifyPatchFile), DestAddress);
+    UT_Stub_RegisterContext(UT_KEY(MM_VerifyPatchFile), PatchHeader);
+    return UT_DEFAULT_IMPL(MM_VerifyPatchFile);
+}
+
+bool MM_VerifyPatchRecord(const char *FileName, const MM_PatchRecord_t *Record, uint32 RecordNum, uint32 NextOffset,
+                          uint32 NumOfBytes)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_VerifyPatchRecord), FileName);
+    UT_Stub_RegisterContext(UT_KEY(MM_VerifyPatchRecord), Record);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_VerifyPatchRecord), RecordNum);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_VerifyPatchRecord), NextOffset);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_VerifyPatchRecord), NumOfBytes);
+    return UT_DEFAULT_IMPL(MM_VerifyPatchRecord);
+}
+
+bool MM_LoadMemFromPatchFile(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader,
+                             cpuaddr DestAddress, const MM_PatchFileHeader_t *PatchHeader)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_LoadMemFromPatchFile), FileHandle);
+    UT_Stub_RegisterContext(UT_KEY(MM_LoadMemFromPatchFile), FileName);
+    UT_Stub_RegisterContext(UT_KEY(MM_LoadMemFromPatchFile), FileHeader);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_LoadMemFromPatchFile), DestAddress);
+    UT_Stub_RegisterContext(UT_KEY(MM_LoadMemFromPatchFile), PatchHeader);
+    return UT_DEFAULT_IMPL(MM_LoadMemFromPatchFile);
+}
+
+bool MM_VerifyMultiFile(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader,
+                        MM_MultiFileHeader_t *MultiHeader)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_VerifyMultiFile), FileHandle);
+    UT_Stub_RegisterContext(UT_KEY(MM_VerifyMultiFile), FileName);
+    UT_Stub_RegisterContext(UT_KEY(MM_VerifyMultiFile), FileHeader);
+    UT_Stub_RegisterContext(UT_KEY(MM_VerifyMultiFile), MultiHeader);
+    return UT_DEFAULT_IMPL(MM_VerifyMultiFile);
+}
+
+bool MM_ReadMultiFileTable(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader,
+                           MM_MultiFileHeader_t *MultiHeader)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_ReadMultiFileTable), FileHandle);
+    UT_Stub_RegisterContext(UT_KEY(MM_ReadMultiFileTable), FileName);
+    UT_Stub_RegisterContext(UT_KEY(MM_ReadMultiFileTable), FileHeader);
+    UT_Stub_RegisterContext(UT_KEY(MM_ReadMultiFileTable), MultiHeader);
+    return UT_DEFAULT_IMPL(MM_ReadMultiFileTable);
+}
+
+bool MM_VerifyFileRegion(const char *FileName, MM_LoadDumpFileHeader_t *Region, uint32 RegionNum,
+                         cpuaddr *DestAddress)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_VerifyFileRegion), FileName);
+    UT_Stub_RegisterContext(UT_KEY(MM_VerifyFileRegion), Region);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_VerifyFileRegion), RegionNum);
+    UT_Stub_RegisterContext(UT_KEY(MM_VerifyFileRegion), DestAddress);
+    return UT_DEFAULT_IMPL(MM_VerifyFileRegion);
+}
+
+bool MM_LoadMemFromMultiFile(osal_id_t FileHandle, const char *FileName, const MM_MultiFileHeader_t *MultiHeader)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_LoadMemFromMultiFile), FileHandle);
+    UT_Stub_RegisterContext(UT_KEY(MM_LoadMemFromMultiFile), FileName);
+    UT_Stub_RegisterContext(UT_KEY(MM_LoadMemFromMultiFile), MultiHeader);
+    return UT_DEFAULT_IMPL(MM_LoadMemFromMultiFile);
+}
+
+bool MM_LoadFileRegion(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *Region,
+                       cpuaddr DestAddress)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_LoadFileRegion), FileHandle);
+    UT_Stub_RegisterContext(UT_KEY(MM_LoadFileRegion), FileName);
+    UT_Stub_RegisterContext(UT_KEY(MM_LoadFileRegion), Region);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_LoadFileRegion), DestAddress);
+    return UT_DEFAULT_IMPL(MM_LoadFileRegion);
+}
+
 bool MM_ReadFileHeaders(const char *FileName, osal_id_t FileHandle, CFE_FS_Header_t *CFEHeader,
                         MM_LoadDumpFileHeader_t *MMHeader)
 {
@@ -117,9 +249,60 @@ bool MM_LoadMemFromFileCmd(const CFE_SB_Buffer_t *BufPtr)
     return UT_DEFAULT_IMPL(MM_LoadMemFromFileCmd);
 }
 
+bool MM_LoadMemFromPatchFileCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_LoadMemFromPatchFileCmd), BufPtr);
+    return UT_DEFAULT_IMPL(MM_LoadMemFromPatchFileCmd);
+}
+
+bool MM_LoadMemFromMultiFileCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_LoadMemFromMultiFileCmd), BufPtr);
+    return UT_DEFAULT_IMPL(MM_LoadMemFromMultiFileCmd);
+}
+
 bool MM_FillMemCmd(const CFE_SB_Buffer_t *BufPtr)
 {
     UT_Stub_RegisterContext(UT_KEY(MM_FillMemCmd), BufPtr);
     return UT_DEFAULT_IMPL(MM_FillMemCmd);
     CFE_EVS_SendEvent(MM_SYMNAME_ERR_EID, CFE_EVS_EventType_ERROR, "Symbolic address can't be resolved: Name = 'name'");
 }
+
+bool MM_CopyMemCmd(const CFE_SB_Buffer_t *BufPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_CopyMemCmd), BufPtr);
+    return UT_DEFAULT_IMPL(MM_CopyMemCmd);
+}
+
+bool MM_CopyMem(cpuaddr SrcAddress, cpuaddr DestAddress, const MM_CopyMemCmd_t *CmdPtr, uint32 *CrcPtr)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_CopyMem), SrcAddress);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_CopyMem), DestAddress);
+    UT_Stub_RegisterContext(UT_KEY(MM_CopyMem), CmdPtr);
+    UT_Stub_RegisterContext(UT_KEY(MM_CopyMem), CrcPtr);
+    return UT_DEFAULT_IMPL(MM_CopyMem);
+}
+
+void MM_LoadCacheInit(void)
+{
+    UT_DEFAULT_IMPL(MM_LoadCacheInit);
+}
+
+bool MM_LoadCacheLookup(const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader, MM_LoadCacheEntry_t *CacheKey)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_LoadCacheLookup), FileName);
+    UT_Stub_RegisterContext(UT_KEY(MM_LoadCacheLookup), FileHeader);
+    UT_Stub_RegisterContext(UT_KEY(MM_LoadCacheLookup), CacheKey);
+    return UT_DEFAULT_IMPL(MM_LoadCacheLookup);
+}
+
+void MM_LoadCacheUpdate(const MM_LoadCacheEntry_t *CacheKey)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_LoadCacheUpdate), CacheKey);
+    UT_DEFAULT_IMPL(MM_LoadCacheUpdate);
+}
+
+void MM_LoadCacheSave(void)
+{
+    UT_DEFAULT_IMPL(MM_LoadCacheSave);
+}
@@ -47,7 +47,7 @@ bool MM_LoadMem16FromFile(osal_id_t FileHandle, const char *FileName, const MM_L
     return UT_DEFAULT_IMPL(MM_LoadMem16FromFile);
 }
 
-bool MM_DumpMem16ToFile(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader)
+bool MM_DumpMem16ToFile(osal_id_t FileHandle, const char *FileName, MM_LoadDumpFileHeader_t *FileHeader)
 {
     UT_Stub_RegisterContextGenericArg(UT_KEY(MM_DumpMem16ToFile), FileHandle);
     UT_Stub_RegisterContext(UT_KEY(MM_DumpMem16ToFile), FileName);
@@ -61,3 +61,19 @@ bool MM_FillMem16(cpuaddr DestAddress, const MM_FillMemCmd_t *CmdPtr)
     UT_Stub_RegisterContext(UT_KEY(MM_FillMem16), CmdPtr);
     return UT_DEFAULT_IMPL(MM_FillMem16);
 }
+
+bool MM_ReadMem16(cpuaddr SrcAddress, void *Buffer, size_t NumOfBytes)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_ReadMem16), SrcAddress);
+    UT_Stub_RegisterContext(UT_KEY(MM_ReadMem16), Buffer);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_ReadMem16), NumOfBytes);
+    return UT_DEFAULT_IMPL(MM_ReadMem16);
+}
+
+bool MM_WriteMem16(cpuaddr DestAddress, const void *Buffer, size_t NumOfBytes)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_WriteMem16), DestAddress);
+    UT_Stub_RegisterContext(UT_KEY(MM_WriteMem16), Buffer);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_WriteMem16), NumOfBytes);
+    return UT_DEFAULT_IMPL(MM_WriteMem16);
+}
@@ -47,7 +47,7 @@ bool MM_LoadMem32FromFile(osal_id_t FileHandle, const char *FileName, const MM_L
     return UT_DEFAULT_IMPL(MM_LoadMem32FromFile);
 }
 
-bool MM_DumpMem32ToFile(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader)
+bool MM_DumpMem32ToFile(osal_id_t FileHandle, const char *FileName, MM_LoadDumpFileHeader_t *FileHeader)
 {
     UT_Stub_RegisterContextGenericArg(UT_KEY(MM_DumpMem32ToFile), FileHandle);
     UT_Stub_RegisterContext(UT_KEY(MM_DumpMem32ToFile), FileName);
@@ -61,3 +61,19 @@ bool MM_FillMem32(cpuaddr DestAddress, const MM_FillMemCmd_t *CmdPtr)
     UT_Stub_RegisterContext(UT_KEY(MM_FillMem32), CmdPtr);
     return UT_DEFAULT_IMPL(MM_FillMem32);
 }
+
+bool MM_ReadMem32(cpuaddr SrcAddress, void *Buffer, size_t NumOfBytes)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_ReadMem32), SrcAddress);
+    UT_Stub_RegisterContext(UT_KEY(MM_ReadMem32), Buffer);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_ReadMem32), NumOfBytes);
+    return UT_DEFAULT_IMPL(MM_ReadMem32);
+}
+
+bool MM_WriteMem32(cpuaddr DestAddress, const void *Buffer, size_t NumOfBytes)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_WriteMem32), DestAddress);
+    UT_Stub_RegisterContext(UT_KEY(MM_WriteMem32), Buffer);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_WriteMem32), NumOfBytes);
+    return UT_DEFAULT_IMPL(MM_WriteMem32);
+}
@@ -47,7 +47,7 @@ bool MM_LoadMem8FromFile(osal_id_t FileHandle, const char *FileName, const MM_Lo
     return UT_DEFAULT_IMPL(MM_LoadMem8FromFile);
 }
 
-bool MM_DumpMem8ToFile(osal_id_t FileHandle, const char *FileName, const MM_LoadDumpFileHeader_t *FileHeader)
+bool MM_DumpMem8ToFile(osal_id_t FileHandle, const char *FileName, MM_LoadDumpFileHeader_t *FileHeader)
 {
     UT_Stub_RegisterContextGenericArg(UT_KEY(MM_DumpMem8ToFile), FileHandle);
     UT_Stub_RegisterContext(UT_KEY(MM_DumpMem8ToFile), FileName);
@@ -61,3 +61,19 @@ bool MM_FillMem8(cpuaddr DestAddress, const MM_FillMemCmd_t *CmdPtr)
     UT_Stub_RegisterContext(UT_KEY(MM_FillMem8), CmdPtr);
     return UT_DEFAULT_IMPL(MM_FillMem8);
 }
+
+bool MM_ReadMem8(cpuaddr SrcAddress, void *Buffer, size_t NumOfBytes)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_ReadMem8), SrcAddress);
+    UT_Stub_RegisterContext(UT_KEY(MM_ReadMem8), Buffer);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_ReadMem8), NumOfBytes);
+    return UT_DEFAULT_IMPL(MM_ReadMem8);
+}
+
+bool MM_WriteMem8(cpuaddr DestAddress, const void *Buffer, size_t NumOfBytes)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_WriteMem8), DestAddress);
+    UT_Stub_RegisterContext(UT_KEY(MM_WriteMem8), Buffer);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_WriteMem8), NumOfBytes);
+    return UT_DEFAULT_IMPL(MM_WriteMem8);
+}
@@ -0,0 +1,127 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Unit test stubs for mm_memtype.c
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_app.h"
+#include "mm_memtype.h"
+#include "mm_load.h"
+#include "mm_dump.h"
+#include "mm_mem32.h"
+#include "mm_mem16.h"
+#include "mm_mem8.h"
+#include <string.h>
+
+/************************************************************************
+** UT Includes
+*************************************************************************/
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+/*
+ * RAM and EEPROM are still copied with memcpy by default, so the modules
+ * under test behave as they did before the driver table
+ */
+static bool UT_MM_MemTypeReadRam(cpuaddr SrcAddress, void *Buffer, size_t NumOfBytes)
+{
+    memcpy(Buffer, (void *)SrcAddress, NumOfBytes);
+    return true;
+}
+
+static bool UT_MM_MemTypeWriteRam(cpuaddr DestAddress, const void *Buffer, size_t NumOfBytes)
+{
+    memcpy((void *)DestAddress, Buffer, NumOfBytes);
+    return true;
+}
+
+static const MM_MemTypeDriver_t UT_MM_MemTypeDrivers[] = {
+    [MM_RAM]    = {"MEM_RAM", CFE_PSP_MEM_RAM, 0, &MM_AppData.Config.Ram, MM_LoadMemFromFile, MM_DumpMemToFile,
+                MM_FillMem, UT_MM_MemTypeReadRam, UT_MM_MemTypeWriteRam},
+    [MM_EEPROM] = {"MEM_EEPROM", CFE_PSP_MEM_EEPROM, 0, &MM_AppData.Config.Eeprom, MM_LoadMemFromFile,
+                   MM_DumpMemToFile, MM_FillMem, UT_MM_MemTypeReadRam, UT_MM_MemTypeWriteRam},
+#ifdef MM_OPT_CODE_MEM32_MEMTYPE
+    [MM_MEM32] = {"MEM32", CFE_PSP_MEM_RAM, 4, &MM_AppData.Config.Mem32, MM_LoadMem32FromFile, MM_DumpMem32ToFile,
+                  MM_FillMem32, MM_ReadMem32, MM_WriteMem32},
+#endif
+#ifdef MM_OPT_CODE_MEM16_MEMTYPE
+    [MM_MEM16] = {"MEM16", CFE_PSP_MEM_RAM, 2, &MM_AppData.Config.Mem16, MM_LoadMem16FromFile, MM_DumpMem16ToFile,
+                  MM_FillMem16, MM_ReadMem16, MM_WriteMem16},
+#endif
+#ifdef MM_OPT_CODE_MEM8_MEMTYPE
+    [MM_MEM8] = {"MEM8", CFE_PSP_MEM_RAM, 1, &MM_AppData.Config.Mem8, MM_LoadMem8FromFile, MM_DumpMem8ToFile,
+                 MM_FillMem8, MM_ReadMem8, MM_WriteMem8},
+#endif
+};
+
+void MM_MemTypeInit(void)
+{
+    UT_DEFAULT_IMPL(MM_MemTypeInit);
+}
+
+bool MM_MemTypeRegister(MM_MemType_t MemType, const MM_MemTypeDriver_t *Driver)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_MemTypeRegister), MemType);
+    UT_Stub_RegisterContext(UT_KEY(MM_MemTypeRegister), Driver);
+    return UT_DEFAULT_IMPL(MM_MemTypeRegister) != 0;
+}
+
+/*
+ * Returns a driver set with UT_SetDataBuffer, otherwise the driver of a
+ * built-in memory type, or NULL if UT_SetDefaultReturnValue is non-zero
+ */
+const MM_MemTypeDriver_t *MM_MemTypeGet(MM_MemType_t MemType)
+{
+    const MM_MemTypeDriver_t *Driver = NULL;
+    int32                     Status;
+
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_MemTypeGet), MemType);
+    Status = UT_DEFAULT_IMPL(MM_MemTypeGet);
+
+    if (UT_Stub_CopyToLocal(UT_KEY(MM_MemTypeGet), &Driver, sizeof(Driver)) != sizeof(Driver) && (Status == 0) &&
+        ((uint32)MemType < (sizeof(UT_MM_MemTypeDrivers) / sizeof(UT_MM_MemTypeDrivers[0]))) &&
+        (UT_MM_MemTypeDrivers[MemType].Name != NULL))
+    {
+        Driver = &UT_MM_MemTypeDrivers[MemType];
+    }
+
+    return Driver;
+}
+
+bool MM_ReadMemRam(cpuaddr SrcAddress, void *Buffer, size_t NumOfBytes)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_ReadMemRam), SrcAddress);
+    UT_Stub_RegisterContext(UT_KEY(MM_ReadMemRam), Buffer);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_ReadMemRam), NumOfBytes);
+    return UT_DEFAULT_IMPL(MM_ReadMemRam) != 0;
+}
+
+bool MM_WriteMemRam(cpuaddr DestAddress, const void *Buffer, size_t NumOfBytes)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_WriteMemRam), DestAddress);
+    UT_Stub_RegisterContext(UT_KEY(MM_WriteMemRam), Buffer);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_WriteMemRam), NumOfBytes);
+    return UT_DEFAULT_IMPL(MM_WriteMemRam) != 0;
+}
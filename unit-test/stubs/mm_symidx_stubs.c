@@ -0,0 +1,67 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Unit test stubs for mm_symidx.c
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_symidx.h"
+
+/************************************************************************
+** UT Includes
+*************************************************************************/
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+void MM_SymIndexReset(void)
+{
+    UT_DEFAULT_IMPL(MM_SymIndexReset);
+}
+
+bool MM_SymIndexBuild(const char *FileName)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_SymIndexBuild), FileName);
+    return UT_DEFAULT_IMPL(MM_SymIndexBuild) != 0;
+}
+
+void MM_SymIndexSort(void)
+{
+    UT_DEFAULT_IMPL(MM_SymIndexSort);
+}
+
+bool MM_SymIndexLookup(cpuaddr Address, const char **SymName, cpuaddr *Offset)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_SymIndexLookup), Address);
+    UT_Stub_RegisterContext(UT_KEY(MM_SymIndexLookup), SymName);
+    UT_Stub_RegisterContext(UT_KEY(MM_SymIndexLookup), Offset);
+    return UT_DEFAULT_IMPL(MM_SymIndexLookup) != 0;
+}
+
+bool MM_SymIndexFormat(cpuaddr Address, char *Buffer, size_t BufferSize)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_SymIndexFormat), Address);
+    UT_Stub_RegisterContext(UT_KEY(MM_SymIndexFormat), Buffer);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_SymIndexFormat), BufferSize);
+    return UT_DEFAULT_IMPL(MM_SymIndexFormat) != 0;
+}
@@ -0,0 +1,82 @@
+/************************************************************************
+ * NASA Docket No. GSC-18,923-1, and identified as “Core Flight
+ * System (cFS) Memory Manager Application version 2.5.1”
+ *
+ * Copyright (c) 2021 United States Government as represented by the
+ * Administrator of the National Aeronautics and Space Administration.
+ * All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License"); you may
+ * not use this file except in compliance with the License. You may obtain
+ * a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ************************************************************************/
+
+/**
+ * @file
+ *   Unit test stubs for mm_tbl.c
+ */
+
+/************************************************************************
+** Includes
+*************************************************************************/
+#include "mm_app.h"
+#include "mm_tbl.h"
+
+/************************************************************************
+** UT Includes
+*************************************************************************/
+#include "uttest.h"
+#include "utassert.h"
+#include "utstubs.h"
+
+CFE_Status_t MM_TableInit(void)
+{
+    return UT_DEFAULT_IMPL(MM_TableInit);
+}
+
+void MM_TableSetDefaults(MM_ConfigTbl_t *TblPtr)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_TableSetDefaults), TblPtr);
+    UT_DEFAULT_IMPL(MM_TableSetDefaults);
+}
+
+void MM_TableManage(void)
+{
+    UT_DEFAULT_IMPL(MM_TableManage);
+}
+
+int32 MM_TableValidate(void *TblData)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_TableValidate), TblData);
+    return UT_DEFAULT_IMPL(MM_TableValidate);
+}
+
+bool MM_TableValidateLimit(const char *Name, uint32 Value, uint32 Max)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_TableValidateLimit), Name);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_TableValidateLimit), Value);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_TableValidateLimit), Max);
+    return UT_DEFAULT_IMPL(MM_TableValidateLimit);
+}
+
+bool MM_TableValidateSegment(const char *Name, uint32 Value, uint32 Max)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_TableValidateSegment), Name);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_TableValidateSegment), Value);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_TableValidateSegment), Max);
+    return UT_DEFAULT_IMPL(MM_TableValidateSegment);
+}
+
+bool MM_TableValidateBudget(const char *Name, uint32 Value, uint32 Min)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_TableValidateBudget), Name);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_TableValidateBudget), Value);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_TableValidateBudget), Min);
+    return UT_DEFAULT_IMPL(MM_TableValidateBudget);
+}
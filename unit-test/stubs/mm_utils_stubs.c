@@ -43,9 +43,100 @@ void MM_ResetHk(void)
     UT_DEFAULT_IMPL(MM_ResetHk);
 }
 
-void MM_SegmentBreak(void)
+size_t MM_SegmentMaxSize(uint8 SegmentType)
 {
-    UT_DEFAULT_IMPL(MM_SegmentBreak);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_SegmentMaxSize), SegmentType);
+    return UT_DEFAULT_IMPL(MM_SegmentMaxSize);
+}
+
+size_t MM_SegmentStart(uint8 SegmentType)
+{
+    int32 status;
+
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_SegmentStart), SegmentType);
+    status = UT_DEFAULT_IMPL(MM_SegmentStart);
+
+    if (status != 0)
+    {
+        return status;
+    }
+
+    /* Fixed segment sizes unless a test sets one */
+    switch (SegmentType)
+    {
+        case MM_SEG_LOAD:
+        case MM_SEG_COPY:
+            return MM_MAX_LOAD_DATA_SEG;
+
+        case MM_SEG_DUMP:
+        case MM_SEG_CRC:
+            return MM_MAX_DUMP_DATA_SEG;
+
+        default:
+            return MM_MAX_FILL_DATA_SEG;
+    }
+}
+
+void MM_SegmentAdapt(size_t SegmentSize, int64 ElapsedUsec)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_SegmentAdapt), SegmentSize);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_SegmentAdapt), ElapsedUsec);
+    UT_DEFAULT_IMPL(MM_SegmentAdapt);
+}
+
+size_t MM_SegmentBreak(size_t SegmentSize)
+{
+    int32 status;
+
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_SegmentBreak), SegmentSize);
+    status = UT_DEFAULT_IMPL(MM_SegmentBreak);
+
+    /* Next segment is the same size unless a test sets one */
+    if (status != 0)
+    {
+        return status;
+    }
+
+    return SegmentSize;
+}
+
+void MM_SegmentPollCmds(void)
+{
+    UT_DEFAULT_IMPL(MM_SegmentPollCmds);
+}
+
+void MM_SegmentIoStart(void)
+{
+    UT_DEFAULT_IMPL(MM_SegmentIoStart);
+}
+
+void MM_SegmentIoEnd(void)
+{
+    UT_DEFAULT_IMPL(MM_SegmentIoEnd);
+}
+
+void MM_SegmentEnd(size_t BytesProcessed)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_SegmentEnd), BytesProcessed);
+    UT_DEFAULT_IMPL(MM_SegmentEnd);
+}
+
+void MM_SegmentMultiStart(uint8 SegmentType)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_SegmentMultiStart), SegmentType);
+    UT_DEFAULT_IMPL(MM_SegmentMultiStart);
+}
+
+void MM_SegmentMultiEnd(bool Completed, size_t BytesProcessed)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_SegmentMultiEnd), Completed);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_SegmentMultiEnd), BytesProcessed);
+    UT_DEFAULT_IMPL(MM_SegmentMultiEnd);
+}
+
+void MM_ResetStats(void)
+{
+    UT_DEFAULT_IMPL(MM_ResetStats);
 }
 
 bool MM_VerifyCmdLength(const CFE_MSG_Message_t *MsgPtr, size_t ExpectedLength)
@@ -72,6 +163,13 @@ bool MM_VerifyLoadDumpParams(cpuaddr Address, MM_MemType_t MemType, size_t SizeI
     return UT_DEFAULT_IMPL(MM_VerifyLoadDumpParams);
 }
 
+bool MM_VerifyFileEncoding(uint8 Encoding, MM_MemType_t MemType)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_VerifyFileEncoding), Encoding);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_VerifyFileEncoding), MemType);
+    return UT_DEFAULT_IMPL(MM_VerifyFileEncoding);
+}
+
 bool MM_Verify32Aligned(cpuaddr Address, size_t Size)
 {
     UT_Stub_RegisterContextGenericArg(UT_KEY(MM_Verify32Aligned), Address);
@@ -100,3 +198,89 @@ int32 MM_ComputeCRCFromFile(osal_id_t FileHandle, uint32 *CrcPtr, uint32 TypeCRC
     UT_Stub_RegisterContextGenericArg(UT_KEY(MM_ComputeCRCFromFile), TypeCRC);
     return UT_DEFAULT_IMPL(MM_ComputeCRCFromFile);
 }
+
+bool MM_ReadMemBlock(cpuaddr SrcAddress, MM_MemType_t MemType, void *Buffer, size_t NumOfBytes)
+{
+    int32 Status;
+
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_ReadMemBlock), SrcAddress);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_ReadMemBlock), MemType);
+    UT_Stub_RegisterContext(UT_KEY(MM_ReadMemBlock), Buffer);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_ReadMemBlock), NumOfBytes);
+    Status = UT_DEFAULT_IMPL(MM_ReadMemBlock);
+
+    /* Memory contents can be given with UT_SetDataBuffer */
+    UT_Stub_CopyToLocal(UT_KEY(MM_ReadMemBlock), Buffer, NumOfBytes);
+
+    return Status;
+}
+
+bool MM_WriteMemBlock(cpuaddr DestAddress, MM_MemType_t MemType, const void *Buffer, size_t NumOfBytes)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_WriteMemBlock), DestAddress);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_WriteMemBlock), MemType);
+    UT_Stub_RegisterContext(UT_KEY(MM_WriteMemBlock), Buffer);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_WriteMemBlock), NumOfBytes);
+    return UT_DEFAULT_IMPL(MM_WriteMemBlock);
+}
+
+bool MM_ComputeMemCRC(cpuaddr Address, MM_MemType_t MemType, size_t NumOfBytes, uint32 *CrcPtr, uint32 TypeCRC)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_ComputeMemCRC), Address);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_ComputeMemCRC), MemType);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_ComputeMemCRC), NumOfBytes);
+    UT_Stub_RegisterContext(UT_KEY(MM_ComputeMemCRC), CrcPtr);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_ComputeMemCRC), TypeCRC);
+    return UT_DEFAULT_IMPL(MM_ComputeMemCRC);
+}
+
+void MM_SymCacheInit(void)
+{
+    UT_DEFAULT_IMPL(MM_SymCacheInit);
+}
+
+uint32 MM_SymCacheHash(const char *SymName)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_SymCacheHash), SymName);
+    return UT_DEFAULT_IMPL(MM_SymCacheHash);
+}
+
+bool MM_SymCacheLookup(const char *SymName, cpuaddr *Address, uint32 *Generation)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_SymCacheLookup), SymName);
+    UT_Stub_RegisterContext(UT_KEY(MM_SymCacheLookup), Address);
+    UT_Stub_RegisterContext(UT_KEY(MM_SymCacheLookup), Generation);
+    return UT_DEFAULT_IMPL(MM_SymCacheLookup);
+}
+
+void MM_SymCacheAdd(const char *SymName, cpuaddr Address, uint32 Generation)
+{
+    UT_Stub_RegisterContext(UT_KEY(MM_SymCacheAdd), SymName);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_SymCacheAdd), Address);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_SymCacheAdd), Generation);
+    UT_DEFAULT_IMPL(MM_SymCacheAdd);
+}
+
+void MM_SymCacheFlush(void)
+{
+    UT_DEFAULT_IMPL(MM_SymCacheFlush);
+}
+
+void MM_MemRangeInit(void)
+{
+    UT_DEFAULT_IMPL(MM_MemRangeInit);
+}
+
+bool MM_MemRangeRefresh(void)
+{
+    return UT_DEFAULT_IMPL(MM_MemRangeRefresh);
+}
+
+int32 MM_MemRangeValidate(cpuaddr Address, size_t Size, uint32 MemoryType, uint32 *RangeNum)
+{
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_MemRangeValidate), Address);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_MemRangeValidate), Size);
+    UT_Stub_RegisterContextGenericArg(UT_KEY(MM_MemRangeValidate), MemoryType);
+    UT_Stub_RegisterContext(UT_KEY(MM_MemRangeValidate), RangeNum);
+    return UT_DEFAULT_IMPL(MM_MemRangeValidate);
+}
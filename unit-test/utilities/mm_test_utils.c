@@ -27,6 +27,7 @@
 *************************************************************************/
 #include "mm_test_utils.h"
 #include "mm_app.h"
+#include "mm_utils.h"
 
 /************************************************************************
 ** UT Includes
@@ -85,6 +86,34 @@ void MM_Test_Setup(void)
     memset(&context_CFE_ES_WriteToSysLog, 0, sizeof(context_CFE_ES_WriteToSysLog));
     memset(&UT_CmdBuf, 0, sizeof(UT_CmdBuf));
 
+    /* Configuration table loaded with the compile time values */
+    MM_AppData.Config.Ram.MaxLoadFileData    = MM_MAX_LOAD_FILE_DATA_RAM;
+    MM_AppData.Config.Ram.MaxDumpFileData    = MM_MAX_DUMP_FILE_DATA_RAM;
+    MM_AppData.Config.Ram.MaxFillData        = MM_MAX_FILL_DATA_RAM;
+    MM_AppData.Config.Eeprom.MaxLoadFileData = MM_MAX_LOAD_FILE_DATA_EEPROM;
+    MM_AppData.Config.Eeprom.MaxDumpFileData = MM_MAX_DUMP_FILE_DATA_EEPROM;
+    MM_AppData.Config.Eeprom.MaxFillData     = MM_MAX_FILL_DATA_EEPROM;
+    MM_AppData.Config.Mem32.MaxLoadFileData  = MM_MAX_LOAD_FILE_DATA_MEM32;
+    MM_AppData.Config.Mem32.MaxDumpFileData  = MM_MAX_DUMP_FILE_DATA_MEM32;
+    MM_AppData.Config.Mem32.MaxFillData      = MM_MAX_FILL_DATA_MEM32;
+    MM_AppData.Config.Mem16.MaxLoadFileData  = MM_MAX_LOAD_FILE_DATA_MEM16;
+    MM_AppData.Config.Mem16.MaxDumpFileData  = MM_MAX_DUMP_FILE_DATA_MEM16;
+    MM_AppData.Config.Mem16.MaxFillData      = MM_MAX_FILL_DATA_MEM16;
+    MM_AppData.Config.Mem8.MaxLoadFileData   = MM_MAX_LOAD_FILE_DATA_MEM8;
+    MM_AppData.Config.Mem8.MaxDumpFileData   = MM_MAX_DUMP_FILE_DATA_MEM8;
+    MM_AppData.Config.Mem8.MaxFillData       = MM_MAX_FILL_DATA_MEM8;
+    MM_AppData.Config.LoadDataSeg            = MM_MAX_LOAD_DATA_SEG;
+    MM_AppData.Config.DumpDataSeg            = MM_MAX_DUMP_DATA_SEG;
+    MM_AppData.Config.FillDataSeg            = MM_MAX_FILL_DATA_SEG;
+    MM_AppData.Config.ProcessorCycle         = MM_PROCESSOR_CYCLE;
+    MM_AppData.Config.MaxStagedLoad          = MM_MAX_STAGED_LOAD;
+
+    /* Load files are read from the file unless a test provides a staging buffer */
+    UT_SetDefaultReturnValue(UT_KEY(CFE_ES_GetPoolBuf), CFE_ES_ERR_MEM_BLOCK_SIZE);
+
+    /* File encodings pass verification unless a test rejects them */
+    UT_SetDefaultReturnValue(UT_KEY(MM_VerifyFileEncoding), true);
+
     /* Register custom handlers */
     UT_SetVaHandlerFunction(UT_KEY(CFE_EVS_SendEvent), UT_Handler_CFE_EVS_SendEvent, NULL);
     UT_SetVaHandlerFunction(UT_KEY(CFE_ES_WriteToSysLog), UT_Handler_CFE_ES_WriteToSysLog, NULL);
@@ -53,26 +53,37 @@ extern CFE_ES_WriteToSysLog_context_t context_CFE_ES_WriteToSysLog;
 /* Command buffer typedef for any handler */
 typedef union
 {
-    CFE_SB_Buffer_t         Buf;
-    MM_NoArgsCmd_t          NoArgsCmd;
-    MM_PeekCmd_t            PeekCmd;
-    MM_PokeCmd_t            PokeCmd;
-    MM_LoadMemWIDCmd_t      LoadMemWIDCmd;
-    MM_DumpInEventCmd_t     DumpInEventCmd;
-    MM_LoadMemFromFileCmd_t LoadMemFromFileCmd;
-    MM_DumpMemToFileCmd_t   DumpMemToFileCmd;
-    MM_FillMemCmd_t         FillMemCmd;
-    MM_LookupSymCmd_t       LookupSymCmd;
-    MM_SymTblToFileCmd_t    SymTblToFileCmd;
-    MM_EepromWriteEnaCmd_t  EepromWriteEnaCmd;
-    MM_EepromWriteDisCmd_t  EepromWriteDisCmd;
+    CFE_SB_Buffer_t              Buf;
+    MM_NoArgsCmd_t               NoArgsCmd;
+    MM_PeekCmd_t                 PeekCmd;
+    MM_PokeCmd_t                 PokeCmd;
+    MM_LoadMemWIDCmd_t           LoadMemWIDCmd;
+    MM_DumpInEventCmd_t          DumpInEventCmd;
+    MM_LoadMemFromFileCmd_t      LoadMemFromFileCmd;
+    MM_LoadMemFromPatchFileCmd_t LoadMemFromPatchFileCmd;
+    MM_LoadMemFromMultiFileCmd_t LoadMemFromMultiFileCmd;
+    MM_DumpMemToFileCmd_t        DumpMemToFileCmd;
+    MM_DumpMemToFileEncCmd_t     DumpMemToFileEncCmd;
+    MM_DumpMemToDeltaFileCmd_t   DumpMemToDeltaFileCmd;
+    MM_DumpMemToMultiFileCmd_t   DumpMemToMultiFileCmd;
+    MM_FillMemCmd_t              FillMemCmd;
+    MM_CopyMemCmd_t              CopyMemCmd;
+    MM_CrcMemCmd_t               CrcMemCmd;
+    MM_LookupSymCmd_t            LookupSymCmd;
+    MM_SymTblToFileCmd_t         SymTblToFileCmd;
+    MM_LookupAddrCmd_t           LookupAddrCmd;
+    MM_LookupSymFileCmd_t        LookupSymFileCmd;
+    MM_EepromWriteEnaCmd_t       EepromWriteEnaCmd;
+    MM_EepromWriteDisCmd_t       EepromWriteDisCmd;
 } UT_CmdBuf_t;
 
 extern UT_CmdBuf_t UT_CmdBuf;
 
 /* Unit test ids */
-#define MM_UT_OBJID_1 OS_ObjectIdFromInteger(1)
-#define MM_UT_MID_1   CFE_SB_ValueToMsgId(1)
+#define MM_UT_OBJID_1     OS_ObjectIdFromInteger(1)
+#define MM_UT_OBJID_2     OS_ObjectIdFromInteger(2)
+#define MM_UT_MID_1       CFE_SB_ValueToMsgId(1)
+#define MM_UT_CDSHANDLE_1 CFE_ES_CDSHANDLE_C(CFE_RESOURCEID_WRAP(1))
 
 /*
  * Function Definitions